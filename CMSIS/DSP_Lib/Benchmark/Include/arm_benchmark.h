@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_benchmark.h
+*
+* Description:	Declarations for the DSP Library benchmark suite.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0 and host
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#ifndef ARM_BENCHMARK_H
+#define ARM_BENCHMARK_H
+
+/* ----------------------------------------------------------------------
+* Size of each scratch buffer in samples.  Sweep points that need more
+* storage than this are skipped; reduce it on targets with little RAM.
+* ------------------------------------------------------------------- */
+#ifndef ARM_BENCH_BUFFER_SIZE
+#define ARM_BENCH_BUFFER_SIZE   8192u
+#endif
+
+/**
+ * @brief Description of one benchmarked kernel.
+ *
+ * setup() prepares the instance for the given sweep point outside of the
+ * timed region and returns the number of samples processed per call, or
+ * zero if the sweep point is not supported.  Samples are input samples for
+ * filters and transforms, and output elements for convolution, correlation
+ * and matrix functions.  run() performs one call of
+ * the kernel.  prepare(), if not NULL, restores the input data before every
+ * call (for in-place kernels); its cost is measured separately and
+ * subtracted.
+ */
+typedef struct
+{
+  const char *function;               /**< library function being measured. */
+  const char *group;                  /**< library module of the function. */
+  const char *type;                   /**< data type: f32, q31, q15 or q7. */
+  const char *param;                  /**< name of the swept parameter. */
+  const uint32_t *pSizes;             /**< values of the swept parameter. */
+  uint32_t numSizes;                  /**< number of values in pSizes. */
+  uint32_t (*setup) (uint32_t size);  /**< untimed initialization. */
+  void (*run) (uint32_t size);        /**< one call of the kernel. */
+  void (*prepare) (uint32_t size);    /**< untimed input refresh, or NULL. */
+} arm_bench_case;
+
+extern const arm_bench_case arm_bench_cases[];
+extern const uint32_t arm_bench_num_cases;
+
+/**
+ * @brief Initializes the cycle counter and the wall clock.
+ */
+void arm_bench_timer_init(void);
+
+/**
+ * @brief Returns the running cycle count (0 when no counter is available).
+ */
+uint64_t arm_bench_cycles(void);
+
+/**
+ * @brief Returns a monotonic time stamp in nanoseconds.
+ */
+uint64_t arm_bench_ns(void);
+
+/**
+ * @brief Returns the name of the cycle counter in use.
+ */
+const char *arm_bench_cycle_source(void);
+
+/**
+ * @brief Returns the name of the platform the benchmark runs on.
+ */
+const char *arm_bench_platform(void);
+
+#endif /* ARM_BENCHMARK_H */
@@ -0,0 +1,1346 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_bench_cases.c
+*
+* Description:	Kernels measured by the benchmark suite and their sweeps.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0 and host
+* -------------------------------------------------------------------- */
+
+#include "arm_benchmark.h"
+
+#define ARM_BENCH_N             ARM_BENCH_BUFFER_SIZE
+#define ARM_BENCH_COUNT(a)      (sizeof(a) / sizeof((a)[0]))
+
+/* Block size used when the number of taps or stages is swept */
+#define ARM_BENCH_FILTER_BLOCK  128u
+
+/* Block size of the circular-state FIR comparison (long filters, short blocks) */
+#define ARM_BENCH_SHORT_BLOCK   16u
+
+/* Longest filter of the FFT-based FIR comparison */
+#define ARM_BENCH_LONG_TAPS     4096u
+
+/* Longest partition of the FFT-based convolution */
+#define ARM_BENCH_CONV_PART     256u
+
+/* Window length of the sliding window statistics */
+#define ARM_BENCH_WINDOW        64u
+
+/* Decimation and interpolation factor */
+#define ARM_BENCH_RATE          4u
+
+/* Sample rate conversion ratio L/M of the resamplers (44.1 kHz to 48 kHz) */
+#define ARM_BENCH_RESAMPLE_L    160u
+#define ARM_BENCH_RESAMPLE_M    147u
+
+/* Input block, passband edge and attenuation of the large factor decimators */
+#define ARM_BENCH_DECIMATE_BLOCK        1024u
+#define ARM_BENCH_DECIMATE_PASSBAND     0.4f
+#define ARM_BENCH_DECIMATE_ATTENUATION  80.0f
+
+/* Number of stages of the CIC front end */
+#define ARM_BENCH_CIC_STAGES    4u
+
+/* Number of channels of the multichannel filters */
+#define ARM_BENCH_CHANNELS      16u
+
+/* Number of bins of the Goertzel filter bank and of the sliding DFT */
+#define ARM_BENCH_BINS          4u
+
+/* ----------------------------------------------------------------------
+* Sweep points
+* ------------------------------------------------------------------- */
+static const uint32_t blockSizes[] = { 16u, 64u, 256u, 1024u, 4096u };
+static const uint32_t tapCounts[]  = { 8u, 32u, 64u, 128u, 256u };
+static const uint32_t longTapCounts[] = { 256u, 1024u, 4096u };
+static const uint32_t phaseLengths[] = { 8u, 16u, 32u };
+static const uint32_t decimateFactors[] = { 16u, 64u, 256u };
+static const uint32_t stageCounts[] = { 1u, 2u, 4u, 8u };
+static const uint32_t convLengths[] = { 16u, 64u, 256u, 1024u };
+static const uint32_t cfftLengths[] = { 16u, 64u, 256u, 1024u };
+static const uint32_t cfft8Lengths[] = { 16u, 32u, 64u, 128u, 256u, 512u, 1024u, 2048u, 4096u };
+static const uint32_t rfftLengths[] = { 128u, 512u, 2048u };
+static const uint32_t rfftFastLengths[] = { 32u, 64u, 128u, 256u, 512u, 1024u, 2048u, 4096u };
+static const uint32_t matDims[]     = { 4u, 8u, 16u, 32u, 64u, 128u, 256u };
+
+/* ----------------------------------------------------------------------
+* Scratch buffers.  A and B hold the random inputs, W is the working copy
+* of in-place kernels, D is the output and C/S hold coefficients and state.
+* ------------------------------------------------------------------- */
+static float32_t bufA_f32[ARM_BENCH_N], bufB_f32[ARM_BENCH_N], bufW_f32[ARM_BENCH_N];
+static float32_t bufD_f32[ARM_BENCH_N], bufC_f32[ARM_BENCH_N], bufS_f32[ARM_BENCH_N];
+static q31_t bufA_q31[ARM_BENCH_N], bufB_q31[ARM_BENCH_N], bufW_q31[ARM_BENCH_N];
+static q31_t bufD_q31[ARM_BENCH_N], bufC_q31[ARM_BENCH_N], bufS_q31[ARM_BENCH_N];
+static q15_t bufA_q15[ARM_BENCH_N], bufB_q15[ARM_BENCH_N], bufW_q15[ARM_BENCH_N];
+static q15_t bufD_q15[ARM_BENCH_N], bufC_q15[ARM_BENCH_N], bufS_q15[ARM_BENCH_N];
+static q7_t bufA_q7[ARM_BENCH_N], bufB_q7[ARM_BENCH_N];
+static q7_t bufD_q7[ARM_BENCH_N], bufC_q7[ARM_BENCH_N], bufS_q7[ARM_BENCH_N];
+static uint8_t bufShift[ARM_BENCH_N];
+
+/* State of the FFT-based FIR filter, partitioned into ARM_BENCH_FILTER_BLOCK samples */
+static float32_t bufF_f32[2u * ARM_BENCH_FILTER_BLOCK * ((ARM_BENCH_LONG_TAPS / ARM_BENCH_FILTER_BLOCK) + 3u)];
+
+/* Instances */
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+static arm_fir_circular_instance_f32 firCircF32;
+static arm_fir_circular_instance_q31 firCircQ31;
+static arm_fir_circular_instance_q15 firCircQ15;
+static arm_fir_circular_instance_q7 firCircQ7;
+static arm_fir_fft_instance_f32 firFftF32;
+static arm_fir_multichannel_instance_f32 firMcF32;
+static arm_fir_multichannel_instance_q15 firMcQ15;
+static arm_fir_decimate_instance_f32 decF32;
+static arm_fir_decimate_instance_q31 decQ31;
+static arm_fir_decimate_instance_q15 decQ15;
+static arm_fir_decimate_instance_f32 decStagesF32[ARM_DECIMATE_PLAN_MAX_STAGES];
+static arm_fir_decimate_instance_q31 decStagesQ31[ARM_DECIMATE_PLAN_MAX_STAGES];
+static arm_fir_decimate_multistage_instance_f32 decMsF32;
+static arm_fir_decimate_multistage_instance_q31 decMsQ31;
+static arm_cic_decimate_instance_q31 cicQ31;
+static q63_t cicState[2u * ARM_BENCH_CIC_STAGES];
+static arm_fir_interpolate_instance_f32 intF32;
+static arm_fir_interpolate_instance_q31 intQ31;
+static arm_fir_interpolate_instance_q15 intQ15;
+static arm_fir_resample_instance_f32 resF32;
+static arm_fir_resample_instance_q31 resQ31;
+static arm_fir_resample_instance_q15 resQ15;
+static arm_lms_instance_f32 lmsF32;
+static arm_biquad_casd_df1_inst_f32 iirF32;
+static arm_biquad_casd_df1_inst_q31 iirQ31;
+static arm_biquad_casd_df1_inst_q15 iirQ15;
+static arm_biquad_cascade_df2T_instance_f32 iir2TF32;
+static arm_biquad_cascade_df2T_block_instance_f32 iir2TBlockF32;
+static arm_biquad_cascade_df2T_multichannel_instance_f32 iir2TMcF32;
+static arm_biquad_cascade_df1_multichannel_instance_q31 iirMcQ31;
+static arm_biquad_cascade_df1_multichannel_instance_q15 iirMcQ15;
+static arm_cfft_radix4_instance_f32 cfftF32;
+static arm_cfft_radix4_instance_q31 cfftQ31;
+static arm_cfft_radix4_instance_q15 cfftQ15;
+static arm_cfft_radix8_instance_f32 cfft8F32;
+static arm_rfft_instance_f32 rfftF32;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_q15 rfftQ15;
+static arm_rfft_fast_instance_f32 rfftFastF32;
+static arm_dct4_instance_f32 dct4F32;
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_sdft_instance_f32 sdftF32;
+static arm_sdft_instance_q31 sdftQ31;
+static uint16_t goertzelBins[ARM_BENCH_BINS];
+static float32_t goertzelCoefF32[2u * ARM_BENCH_BINS];
+static q31_t goertzelCoefQ31[2u * ARM_BENCH_BINS];
+static float32_t sdftCoefF32[2u * ARM_BENCH_BINS];
+static q31_t sdftCoefQ31[2u * ARM_BENCH_BINS];
+static float32_t sdftStateF32[(2u * ARM_BENCH_BINS) + ARM_BENCH_N];
+static q31_t sdftStateQ31[(2u * ARM_BENCH_BINS) + ARM_BENCH_N];
+static arm_stats_instance_f32 statsF32;
+static arm_stats_instance_q31 statsQ31;
+static arm_stats_instance_q15 statsQ15;
+static arm_moving_minmax_instance_f32 movMaxF32;
+static arm_moving_minmax_instance_q15 movMaxQ15;
+static arm_moving_average_instance_f32 movAvgF32;
+static arm_moving_average_instance_q15 movAvgQ15;
+static float32_t movValF32[ARM_BENCH_WINDOW];
+static q15_t movValQ15[ARM_BENCH_WINDOW];
+static uint32_t movIdx[ARM_BENCH_WINDOW];
+static arm_nco_instance_f32 ncoF32;
+static arm_nco_instance_q31 ncoQ31;
+static arm_nco_instance_q15 ncoQ15;
+static arm_matrix_instance_f32 matA_f32, matB_f32, matD_f32;
+static arm_matrix_instance_q31 matA_q31, matB_q31, matD_q31;
+static arm_matrix_instance_q15 matA_q15, matB_q15, matD_q15;
+static arm_matrix_instance_q7 matA_q7;
+static uint16_t matPerm[ARM_BENCH_N];
+static arm_matrix_instance_sym_f32 symB_f32, symD_f32;
+static arm_matrix_instance_diag_f32 diagB_f32;
+
+/* Scalar results are written here so that they are not optimized away */
+static volatile float32_t sink_f32;
+static volatile q63_t sink_q63;
+static float32_t res_f32, res2_f32;
+static q63_t res_q63;
+static q31_t res_q31, res2_q31;
+static q15_t res_q15;
+static q7_t res_q7;
+static uint32_t resIndex;
+
+static uint32_t randState = 0x12345678u;
+
+static uint32_t arm_bench_rand(void)
+{
+  randState = (randState * 1664525u) + 1013904223u;
+
+  return randState;
+}
+
+/* Uniform value in [-0.5, 0.5) */
+static float32_t arm_bench_rand_f32(void)
+{
+  return ((float32_t) (arm_bench_rand() >> 8) / 16777216.0f) - 0.5f;
+}
+
+static void arm_bench_fill_inputs(void)
+{
+  static uint32_t filled = 0u;
+  uint32_t i;
+
+  if(filled != 0u)
+  {
+    return;
+  }
+
+  for (i = 0u; i < ARM_BENCH_N; i++)
+  {
+    bufA_f32[i] = arm_bench_rand_f32();
+    bufB_f32[i] = arm_bench_rand_f32();
+  }
+
+  arm_float_to_q31(bufA_f32, bufA_q31, ARM_BENCH_N);
+  arm_float_to_q31(bufB_f32, bufB_q31, ARM_BENCH_N);
+  arm_float_to_q15(bufA_f32, bufA_q15, ARM_BENCH_N);
+  arm_float_to_q15(bufB_f32, bufB_q15, ARM_BENCH_N);
+  arm_float_to_q7(bufA_f32, bufA_q7, ARM_BENCH_N);
+  arm_float_to_q7(bufB_f32, bufB_q7, ARM_BENCH_N);
+
+  filled = 1u;
+}
+
+/* FIR coefficients with a gain below one */
+static void arm_bench_fill_taps(uint32_t numTaps)
+{
+  uint32_t i;
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    bufC_f32[i] = bufB_f32[i] / (float32_t) numTaps;
+  }
+
+  arm_float_to_q31(bufC_f32, bufC_q31, numTaps);
+  arm_float_to_q15(bufC_f32, bufC_q15, numTaps);
+  arm_float_to_q7(bufC_f32, bufC_q7, numTaps);
+}
+
+/* ----------------------------------------------------------------------
+* Setup functions.  Each returns the number of samples per call.
+* ------------------------------------------------------------------- */
+static uint32_t setup_block(uint32_t size)
+{
+  arm_bench_fill_inputs();
+
+  return (size <= ARM_BENCH_N) ? size : 0u;
+}
+
+/* Positive inputs for the logarithms */
+static uint32_t setup_positive(uint32_t size)
+{
+  arm_bench_fill_inputs();
+
+  if(size > ARM_BENCH_N)
+  {
+    return (0u);
+  }
+
+  arm_abs_f32(bufA_f32, bufS_f32, size);
+  arm_abs_q31(bufA_q31, bufS_q31, size);
+  arm_abs_q15(bufA_q15, bufS_q15, size);
+
+  return (size);
+}
+
+static uint32_t setup_cmplx(uint32_t size)
+{
+  arm_bench_fill_inputs();
+
+  return ((2u * size) <= ARM_BENCH_N) ? size : 0u;
+}
+
+static uint32_t setup_conv(uint32_t size)
+{
+  arm_bench_fill_inputs();
+
+  return ((2u * size) <= ARM_BENCH_N) ? ((2u * size) - 1u) : 0u;
+}
+
+static uint32_t setup_fir(uint32_t numTaps)
+{
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(numTaps);
+
+  arm_fir_init_f32(&firF32, (uint16_t) numTaps, bufC_f32, bufS_f32, ARM_BENCH_FILTER_BLOCK);
+  arm_fir_init_q31(&firQ31, (uint16_t) numTaps, bufC_q31, bufS_q31, ARM_BENCH_FILTER_BLOCK);
+  arm_fir_init_q7(&firQ7, (uint16_t) numTaps, bufC_q7, bufS_q7, ARM_BENCH_FILTER_BLOCK);
+
+  if(arm_fir_init_q15(&firQ15, (uint16_t) numTaps, bufC_q15, bufS_q15,
+                      ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+/* Linear and circular state FIR filters with a short block */
+static uint32_t setup_fir_short(uint32_t numTaps)
+{
+  if(setup_fir(numTaps) == 0u)
+  {
+    return 0u;
+  }
+
+  arm_fir_circular_init_f32(&firCircF32, (uint16_t) numTaps, bufC_f32, bufW_f32, ARM_BENCH_SHORT_BLOCK);
+  arm_fir_circular_init_q31(&firCircQ31, (uint16_t) numTaps, bufC_q31, bufW_q31, ARM_BENCH_SHORT_BLOCK);
+  arm_fir_circular_init_q15(&firCircQ15, (uint16_t) numTaps, bufC_q15, bufW_q15, ARM_BENCH_SHORT_BLOCK);
+  arm_fir_circular_init_q7(&firCircQ7, (uint16_t) numTaps, bufC_q7, bufB_q7, ARM_BENCH_SHORT_BLOCK);
+
+  return ARM_BENCH_SHORT_BLOCK;
+}
+
+/* Direct form and FFT-based FIR filters with up to ARM_BENCH_LONG_TAPS taps */
+static uint32_t setup_fir_long(uint32_t numTaps)
+{
+  if((numTaps > ARM_BENCH_LONG_TAPS) || (setup_fir(numTaps) == 0u))
+  {
+    return 0u;
+  }
+
+  if(arm_fir_fft_init_f32(&firFftF32, (uint16_t) numTaps, bufC_f32, bufW_f32, bufF_f32,
+                          ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_fir_multichannel(uint32_t numTaps)
+{
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(numTaps);
+
+  if((ARM_BENCH_CHANNELS * (numTaps + ARM_BENCH_FILTER_BLOCK - 1u)) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  arm_fir_multichannel_init_f32(&firMcF32, (uint16_t) numTaps, ARM_BENCH_CHANNELS, 0u,
+                                bufC_f32, bufS_f32, ARM_BENCH_FILTER_BLOCK);
+  arm_fir_multichannel_init_q15(&firMcQ15, (uint16_t) numTaps, ARM_BENCH_CHANNELS, 0u,
+                                bufC_q15, bufS_q15, ARM_BENCH_FILTER_BLOCK);
+
+  return ARM_BENCH_CHANNELS * ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_decimate(uint32_t numTaps)
+{
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(numTaps);
+
+  if((arm_fir_decimate_init_f32(&decF32, (uint16_t) numTaps, ARM_BENCH_RATE, bufC_f32,
+                                bufS_f32, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS) ||
+     (arm_fir_decimate_init_q31(&decQ31, (uint16_t) numTaps, ARM_BENCH_RATE, bufC_q31,
+                                bufS_q31, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS) ||
+     (arm_fir_decimate_init_q15(&decQ15, (uint16_t) numTaps, ARM_BENCH_RATE, bufC_q15,
+                                bufS_q15, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS))
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+/* Resamplers with phaseLength taps per output sample, ARM_BENCH_RESAMPLE_M input samples per call */
+static uint32_t setup_resample(uint32_t phaseLength)
+{
+  uint32_t numTaps = ARM_BENCH_RESAMPLE_L * phaseLength;
+
+  arm_bench_fill_inputs();
+
+  if(numTaps > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  arm_bench_fill_taps(numTaps);
+
+  if((arm_fir_resample_init_f32(&resF32, ARM_BENCH_RESAMPLE_L, ARM_BENCH_RESAMPLE_M, (uint16_t) numTaps,
+                                bufC_f32, bufS_f32, ARM_BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS) ||
+     (arm_fir_resample_init_q31(&resQ31, ARM_BENCH_RESAMPLE_L, ARM_BENCH_RESAMPLE_M, (uint16_t) numTaps,
+                                bufC_q31, bufS_q31, ARM_BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS) ||
+     (arm_fir_resample_init_q15(&resQ15, ARM_BENCH_RESAMPLE_L, ARM_BENCH_RESAMPLE_M, (uint16_t) numTaps,
+                                bufC_q15, bufS_q15, ARM_BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS))
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_RESAMPLE_M;
+}
+
+/* Single FIR decimator by M, with the length estimated by the planner */
+static uint32_t setup_decimate_single(uint32_t M)
+{
+  arm_fir_decimate_plan_instance plan;
+
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(ARM_BENCH_N);
+
+  if((arm_fir_decimate_plan_f32(&plan, M, 1u, 0u, ARM_BENCH_DECIMATE_PASSBAND,
+                                ARM_BENCH_DECIMATE_ATTENUATION) != ARM_MATH_SUCCESS) ||
+     ((plan.numTaps[0] + ARM_BENCH_DECIMATE_BLOCK) > ARM_BENCH_N) ||
+     (arm_fir_decimate_init_f32(&decF32, plan.numTaps[0], plan.M[0], bufC_f32, bufS_f32,
+                                ARM_BENCH_DECIMATE_BLOCK) != ARM_MATH_SUCCESS))
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_DECIMATE_BLOCK;
+}
+
+/* Planned cascades: FIR stages only for f32, CIC front end and FIR stages for q31 */
+static uint32_t setup_decimate_multistage(uint32_t M)
+{
+  arm_fir_decimate_plan_instance plan;
+  uint32_t blkCnt, offset, i;
+
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(ARM_BENCH_N);
+
+  if(arm_fir_decimate_plan_f32(&plan, M, ARM_DECIMATE_PLAN_MAX_STAGES, 0u, ARM_BENCH_DECIMATE_PASSBAND,
+                               ARM_BENCH_DECIMATE_ATTENUATION) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  /* The stage states follow each other in the state buffer */
+  blkCnt = ARM_BENCH_DECIMATE_BLOCK;
+  offset = 0u;
+
+  for (i = 0u; i < plan.numStages; i++)
+  {
+    (void) arm_fir_decimate_init_f32(&decStagesF32[i], plan.numTaps[i], plan.M[i], bufC_f32,
+                                     bufS_f32 + offset, blkCnt);
+    offset += plan.numTaps[i] + blkCnt - 1u;
+    blkCnt /= plan.M[i];
+  }
+
+  if(arm_fir_decimate_multistage_init_f32(&decMsF32, plan.numStages, decStagesF32, bufW_f32,
+                                          ARM_BENCH_DECIMATE_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  if(arm_fir_decimate_plan_f32(&plan, M, ARM_DECIMATE_PLAN_MAX_STAGES, ARM_BENCH_CIC_STAGES,
+                               ARM_BENCH_DECIMATE_PASSBAND, ARM_BENCH_DECIMATE_ATTENUATION) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  (void) arm_cic_decimate_init_q31(&cicQ31, ARM_BENCH_CIC_STAGES, plan.cicFactor, cicState,
+                                   ARM_BENCH_DECIMATE_BLOCK);
+
+  blkCnt = ARM_BENCH_DECIMATE_BLOCK / plan.cicFactor;
+  offset = 0u;
+
+  for (i = 0u; i < plan.numStages; i++)
+  {
+    (void) arm_fir_decimate_init_q31(&decStagesQ31[i], plan.numTaps[i], plan.M[i], bufC_q31,
+                                     bufS_q31 + offset, blkCnt);
+    offset += plan.numTaps[i] + blkCnt - 1u;
+    blkCnt /= plan.M[i];
+  }
+
+  if(arm_fir_decimate_multistage_init_q31(&decMsQ31, (plan.cicFactor > 1u) ? &cicQ31 : NULL,
+                                          plan.numStages, decStagesQ31, bufW_q31,
+                                          ARM_BENCH_DECIMATE_BLOCK) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_DECIMATE_BLOCK;
+}
+
+static uint32_t setup_interpolate(uint32_t numTaps)
+{
+  arm_bench_fill_inputs();
+  arm_bench_fill_taps(numTaps);
+
+  if((arm_fir_interpolate_init_f32(&intF32, ARM_BENCH_RATE, (uint16_t) numTaps, bufC_f32,
+                                   bufS_f32, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS) ||
+     (arm_fir_interpolate_init_q31(&intQ31, ARM_BENCH_RATE, (uint16_t) numTaps, bufC_q31,
+                                   bufS_q31, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS) ||
+     (arm_fir_interpolate_init_q15(&intQ15, ARM_BENCH_RATE, (uint16_t) numTaps, bufC_q15,
+                                   bufS_q15, ARM_BENCH_FILTER_BLOCK) != ARM_MATH_SUCCESS))
+  {
+    return 0u;
+  }
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_lms(uint32_t numTaps)
+{
+  arm_bench_fill_inputs();
+  arm_fill_f32(0.0f, bufC_f32, numTaps);
+
+  arm_lms_init_f32(&lmsF32, (uint16_t) numTaps, bufC_f32, bufS_f32, 0.01f,
+                   ARM_BENCH_FILTER_BLOCK);
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_biquad(uint32_t numStages)
+{
+  /* Stable low-pass section: b = {0.25, 0.5, 0.25}, a1 = 0.5, a2 = -0.25.
+   * The fixed-point coefficients are stored at half scale (postShift 1). */
+  static const float32_t coeffs[5] = { 0.25f, 0.5f, 0.25f, 0.5f, -0.25f };
+  uint32_t i;
+
+  arm_bench_fill_inputs();
+
+  for (i = 0u; i < numStages; i++)
+  {
+    memcpy(&bufC_f32[5u * i], coeffs, sizeof(coeffs));
+
+    bufC_q31[(5u * i) + 0u] = 0x10000000;
+    bufC_q31[(5u * i) + 1u] = 0x20000000;
+    bufC_q31[(5u * i) + 2u] = 0x10000000;
+    bufC_q31[(5u * i) + 3u] = 0x20000000;
+    bufC_q31[(5u * i) + 4u] = -0x10000000;
+
+    bufC_q15[(6u * i) + 0u] = 0x1000;
+    bufC_q15[(6u * i) + 1u] = 0;
+    bufC_q15[(6u * i) + 2u] = 0x2000;
+    bufC_q15[(6u * i) + 3u] = 0x1000;
+    bufC_q15[(6u * i) + 4u] = 0x2000;
+    bufC_q15[(6u * i) + 5u] = -0x1000;
+  }
+
+  arm_biquad_cascade_df1_init_f32(&iirF32, (uint8_t) numStages, bufC_f32, bufS_f32);
+  arm_biquad_cascade_df1_init_q31(&iirQ31, (uint8_t) numStages, bufC_q31, bufS_q31, 1);
+  arm_biquad_cascade_df1_init_q15(&iirQ15, (uint8_t) numStages, bufC_q15, bufS_q15, 1);
+  arm_biquad_cascade_df2T_init_f32(&iir2TF32, (uint8_t) numStages, bufC_f32, &bufS_f32[4u * numStages]);
+  arm_biquad_cascade_df2T_block_init_f32(&iir2TBlockF32, (uint8_t) numStages, bufC_f32, bufF_f32,
+                                         &bufS_f32[6u * numStages]);
+
+  return ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_biquad_multichannel(uint32_t numStages)
+{
+  (void) setup_biquad(numStages);
+
+  arm_biquad_cascade_df2T_multichannel_init_f32(&iir2TMcF32, (uint8_t) numStages, ARM_BENCH_CHANNELS,
+                                                bufC_f32, bufW_f32);
+  arm_biquad_cascade_df1_multichannel_init_q31(&iirMcQ31, (uint8_t) numStages, ARM_BENCH_CHANNELS, 0u,
+                                               bufC_q31, bufW_q31, 1);
+  arm_biquad_cascade_df1_multichannel_init_q15(&iirMcQ15, (uint8_t) numStages, ARM_BENCH_CHANNELS, 0u,
+                                               bufC_q15, bufW_q15, 1);
+
+  return ARM_BENCH_CHANNELS * ARM_BENCH_FILTER_BLOCK;
+}
+
+static uint32_t setup_cfft_f32(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  return (arm_cfft_radix4_init_f32(&cfftF32, (uint16_t) fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_cfft_q31(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  return (arm_cfft_radix4_init_q31(&cfftQ31, (uint16_t) fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_cfft_q15(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  return (arm_cfft_radix4_init_q15(&cfftQ15, (uint16_t) fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_cfft8_f32(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  if((2u * fftLen) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  return (arm_cfft_radix8_init_f32(&cfft8F32, (uint16_t) fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+/* The real FFT writes 2 * fftLen values to the output buffer */
+static uint32_t setup_rfft_f32(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  if((2u * fftLen) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  return (arm_rfft_init_f32(&rfftF32, &cfftF32, fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_rfft_q31(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  if((2u * fftLen) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  return (arm_rfft_init_q31(&rfftQ31, &cfftQ31, fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_rfft_q15(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  if((2u * fftLen) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  return (arm_rfft_init_q15(&rfftQ15, &cfftQ15, fftLen, 0u, 1u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_rfft_fast_f32(uint32_t fftLen)
+{
+  arm_bench_fill_inputs();
+
+  return (arm_rfft_fast_init_f32(&rfftFastF32, fftLen, 0u) ==
+          ARM_MATH_SUCCESS) ? fftLen : 0u;
+}
+
+static uint32_t setup_dct4(uint32_t N)
+{
+  arm_bench_fill_inputs();
+
+  if(arm_dct4_init_f32(&dct4F32, &rfftF32, &cfftF32, (uint16_t) N, (uint16_t) (N / 2u),
+                       sqrtf(2.0f / (float32_t) N)) != ARM_MATH_SUCCESS)
+  {
+    return 0u;
+  }
+
+  return N;
+}
+
+static uint32_t setup_goertzel(uint32_t N)
+{
+  uint32_t i;
+
+  arm_bench_fill_inputs();
+
+  if(N > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  /* Bins spread over the band, as a tone detector would use */
+  for (i = 0u; i < ARM_BENCH_BINS; i++)
+  {
+    goertzelBins[i] = (uint16_t) (((2u * i) + 1u) * (N / (4u * ARM_BENCH_BINS)));
+  }
+
+  if((arm_goertzel_init_f32(&goertzelF32, ARM_BENCH_BINS, (uint16_t) N, goertzelBins,
+                            goertzelCoefF32) != ARM_MATH_SUCCESS) ||
+     (arm_goertzel_init_q31(&goertzelQ31, ARM_BENCH_BINS, (uint16_t) N, goertzelBins,
+                            goertzelCoefQ31) != ARM_MATH_SUCCESS) ||
+     (arm_sdft_init_f32(&sdftF32, ARM_BENCH_BINS, (uint16_t) N, goertzelBins,
+                        sdftCoefF32, sdftStateF32) != ARM_MATH_SUCCESS) ||
+     (arm_sdft_init_q31(&sdftQ31, ARM_BENCH_BINS, (uint16_t) N, goertzelBins,
+                        sdftCoefQ31, sdftStateQ31) != ARM_MATH_SUCCESS))
+  {
+    return 0u;
+  }
+
+  return N;
+}
+
+static uint32_t setup_matrix(uint32_t dim)
+{
+  arm_bench_fill_inputs();
+
+  if((dim * dim) > ARM_BENCH_N)
+  {
+    return 0u;
+  }
+
+  arm_mat_init_f32(&matA_f32, (uint16_t) dim, (uint16_t) dim, bufA_f32);
+  arm_mat_init_f32(&matB_f32, (uint16_t) dim, (uint16_t) dim, bufB_f32);
+  arm_mat_init_f32(&matD_f32, (uint16_t) dim, (uint16_t) dim, bufD_f32);
+  arm_mat_init_q31(&matA_q31, (uint16_t) dim, (uint16_t) dim, bufA_q31);
+  arm_mat_init_q31(&matB_q31, (uint16_t) dim, (uint16_t) dim, bufB_q31);
+  arm_mat_init_q31(&matD_q31, (uint16_t) dim, (uint16_t) dim, bufD_q31);
+  arm_mat_init_q15(&matA_q15, (uint16_t) dim, (uint16_t) dim, bufA_q15);
+  arm_mat_init_q15(&matB_q15, (uint16_t) dim, (uint16_t) dim, bufB_q15);
+  arm_mat_init_q15(&matD_q15, (uint16_t) dim, (uint16_t) dim, bufD_q15);
+  matA_q7.numRows = (uint16_t) dim;
+  matA_q7.numCols = (uint16_t) dim;
+  matA_q7.pData = bufA_q7;
+  arm_mat_diag_init_f32(&diagB_f32, (uint16_t) dim, bufC_f32);
+
+  return dim * dim;
+}
+
+static uint32_t setup_matrix_spd(uint32_t dim)
+{
+  uint32_t i, j, n = setup_matrix(dim);
+
+  /* Symmetric and diagonally dominant, hence positive definite */
+  for (i = 0u; i < n / dim; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      bufB_f32[(i * dim) + j] = bufB_f32[(j * dim) + i] = bufA_f32[(i * dim) + j];
+      bufB_q31[(i * dim) + j] = bufB_q31[(j * dim) + i] =
+        bufA_q31[(i * dim) + j] / (q31_t) (2u * dim);
+    }
+
+    bufB_f32[(i * dim) + i] = (float32_t) dim + 1.0f;
+    bufB_q31[(i * dim) + i] = 0x60000000;
+  }
+
+  return n;
+}
+
+static uint32_t setup_matrix_sym(uint32_t dim)
+{
+  uint32_t n = setup_matrix(dim);
+
+  arm_mat_sym_init_f32(&symB_f32, (uint16_t) dim, bufC_f32);
+  arm_mat_sym_init_f32(&symD_f32, (uint16_t) dim, bufW_f32);
+  arm_mat_sym_pack_f32(&matB_f32, &symB_f32);
+
+  return n;
+}
+
+/* ----------------------------------------------------------------------
+* Input refresh for in-place kernels
+* ------------------------------------------------------------------- */
+static void prep_cmplx_f32(uint32_t n) { memcpy(bufW_f32, bufA_f32, 2u * n * sizeof(float32_t)); }
+static void prep_cmplx_q31(uint32_t n) { memcpy(bufW_q31, bufA_q31, 2u * n * sizeof(q31_t)); }
+static void prep_cmplx_q15(uint32_t n) { memcpy(bufW_q15, bufA_q15, 2u * n * sizeof(q15_t)); }
+static void prep_real_f32(uint32_t n) { memcpy(bufW_f32, bufA_f32, n * sizeof(float32_t)); }
+static void prep_real_q31(uint32_t n) { memcpy(bufW_q31, bufA_q31, n * sizeof(q31_t)); }
+static void prep_real_q15(uint32_t n) { memcpy(bufW_q15, bufA_q15, n * sizeof(q15_t)); }
+
+/* ----------------------------------------------------------------------
+* Basic math functions
+* ------------------------------------------------------------------- */
+static void run_add_f32(uint32_t n) { arm_add_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_add_q31(uint32_t n) { arm_add_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_add_q15(uint32_t n) { arm_add_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+static void run_add_q7(uint32_t n) { arm_add_q7(bufA_q7, bufB_q7, bufD_q7, n); }
+static void run_sub_f32(uint32_t n) { arm_sub_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_sub_q31(uint32_t n) { arm_sub_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_sub_q15(uint32_t n) { arm_sub_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+static void run_sub_q7(uint32_t n) { arm_sub_q7(bufA_q7, bufB_q7, bufD_q7, n); }
+static void run_mult_f32(uint32_t n) { arm_mult_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_mult_q31(uint32_t n) { arm_mult_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_mult_q15(uint32_t n) { arm_mult_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+static void run_mult_q7(uint32_t n) { arm_mult_q7(bufA_q7, bufB_q7, bufD_q7, n); }
+static void run_scale_f32(uint32_t n) { arm_scale_f32(bufA_f32, 0.75f, bufD_f32, n); }
+static void run_scale_q31(uint32_t n) { arm_scale_q31(bufA_q31, 0x60000000, 1, bufD_q31, n); }
+static void run_scale_q15(uint32_t n) { arm_scale_q15(bufA_q15, 0x6000, 1, bufD_q15, n); }
+static void run_scale_q7(uint32_t n) { arm_scale_q7(bufA_q7, 0x60, 1, bufD_q7, n); }
+static void run_abs_f32(uint32_t n) { arm_abs_f32(bufA_f32, bufD_f32, n); }
+static void run_abs_q31(uint32_t n) { arm_abs_q31(bufA_q31, bufD_q31, n); }
+static void run_abs_q15(uint32_t n) { arm_abs_q15(bufA_q15, bufD_q15, n); }
+static void run_abs_q7(uint32_t n) { arm_abs_q7(bufA_q7, bufD_q7, n); }
+static void run_negate_f32(uint32_t n) { arm_negate_f32(bufA_f32, bufD_f32, n); }
+static void run_negate_q31(uint32_t n) { arm_negate_q31(bufA_q31, bufD_q31, n); }
+static void run_negate_q15(uint32_t n) { arm_negate_q15(bufA_q15, bufD_q15, n); }
+static void run_negate_q7(uint32_t n) { arm_negate_q7(bufA_q7, bufD_q7, n); }
+static void run_offset_f32(uint32_t n) { arm_offset_f32(bufA_f32, 0.25f, bufD_f32, n); }
+static void run_offset_q31(uint32_t n) { arm_offset_q31(bufA_q31, 0x20000000, bufD_q31, n); }
+static void run_offset_q15(uint32_t n) { arm_offset_q15(bufA_q15, 0x2000, bufD_q15, n); }
+static void run_offset_q7(uint32_t n) { arm_offset_q7(bufA_q7, 0x20, bufD_q7, n); }
+static void run_shift_q31(uint32_t n) { arm_shift_q31(bufA_q31, 1, bufD_q31, n); }
+static void run_shift_q15(uint32_t n) { arm_shift_q15(bufA_q15, 1, bufD_q15, n); }
+static void run_shift_q7(uint32_t n) { arm_shift_q7(bufA_q7, 1, bufD_q7, n); }
+static void run_dot_prod_f32(uint32_t n) { arm_dot_prod_f32(bufA_f32, bufB_f32, n, &res_f32); sink_f32 = res_f32; }
+static void run_dot_prod_q31(uint32_t n) { arm_dot_prod_q31(bufA_q31, bufB_q31, n, &res_q63); sink_q63 = res_q63; }
+static void run_dot_prod_q15(uint32_t n) { arm_dot_prod_q15(bufA_q15, bufB_q15, n, &res_q63); sink_q63 = res_q63; }
+static void run_dot_prod_q7(uint32_t n) { arm_dot_prod_q7(bufA_q7, bufB_q7, n, &res_q31); sink_q63 = res_q31; }
+
+/* ----------------------------------------------------------------------
+* Fast math and controller functions (scalar, called over a block)
+* ------------------------------------------------------------------- */
+static void run_sin_f32(uint32_t n)
+{
+  float32_t acc = 0.0f;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    acc += arm_sin_f32(bufA_f32[i] * 6.28f);
+  }
+  sink_f32 = acc;
+}
+
+static void run_cos_f32(uint32_t n)
+{
+  float32_t acc = 0.0f;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    acc += arm_cos_f32(bufA_f32[i] * 6.28f);
+  }
+  sink_f32 = acc;
+}
+
+static void run_sin_q31(uint32_t n)
+{
+  q63_t acc = 0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    acc += arm_sin_q31(bufA_q31[i] & 0x7FFFFFFF);
+  }
+  sink_q63 = acc;
+}
+
+static void run_sin_q15(uint32_t n)
+{
+  q63_t acc = 0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    acc += arm_sin_q15(bufA_q15[i] & 0x7FFF);
+  }
+  sink_q63 = acc;
+}
+
+static void run_sqrt_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sqrt_q31(bufA_q31[i] & 0x7FFFFFFF, &bufD_q31[i]);
+  }
+}
+
+static void run_sqrt_q15(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sqrt_q15(bufA_q15[i] & 0x7FFF, &bufD_q15[i]);
+  }
+}
+
+static void run_sin_cos_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_f32(bufA_f32[i] * 359.0f, &res_f32, &res2_f32);
+    sink_f32 = res_f32 + res2_f32;
+  }
+}
+
+static void run_sin_cos_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_q31(bufA_q31[i], &res_q31, &res2_q31);
+    sink_q63 = (q63_t) res_q31 + res2_q31;
+  }
+}
+
+static void run_vsin_f32(uint32_t n) { arm_vsin_f32(bufA_f32, bufD_f32, n); }
+static void run_vsin_cos_f32(uint32_t n) { arm_vsin_cos_f32(bufA_f32, bufD_f32, bufS_f32, n); }
+static void run_vexp_f32(uint32_t n) { arm_vexp_f32(bufA_f32, bufD_f32, n); }
+static void run_vlog_f32(uint32_t n) { arm_vlog_f32(bufS_f32, bufD_f32, n); }
+static void run_vatan2_f32(uint32_t n) { arm_vatan2_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_vtanh_f32(uint32_t n) { arm_vtanh_f32(bufA_f32, bufD_f32, n); }
+static void run_vsin_q31(uint32_t n) { arm_vsin_q31(bufA_q31, bufD_q31, n); }
+static void run_vsin_cos_q31(uint32_t n) { arm_vsin_cos_q31(bufA_q31, bufD_q31, bufS_q31, n); }
+static void run_vlog_q31(uint32_t n) { arm_vlog_q31(bufS_q31, bufD_q31, n); }
+static void run_vatan2_q31(uint32_t n) { arm_vatan2_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_vsin_q15(uint32_t n) { arm_vsin_q15(bufA_q15, bufD_q15, n); }
+static void run_vatan2_q15(uint32_t n) { arm_vatan2_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+static void run_vsqrt_f32(uint32_t n) { arm_vsqrt_f32(bufS_f32, bufD_f32, n); }
+static void run_vsqrt_q31(uint32_t n) { arm_vsqrt_q31(bufS_q31, bufD_q31, n); }
+static void run_vsqrt_q15(uint32_t n) { arm_vsqrt_q15(bufS_q15, bufD_q15, n); }
+static void run_vrsqrt_f32(uint32_t n) { arm_vrsqrt_f32(bufS_f32, bufD_f32, n); }
+static void run_vrsqrt_q31(uint32_t n) { arm_vrsqrt_q31(bufS_q31, bufD_q31, bufShift, n); }
+static void run_vrsqrt_q15(uint32_t n) { arm_vrsqrt_q15(bufS_q15, bufD_q15, bufShift, n); }
+static void run_nco_f32(uint32_t n) { arm_nco_init_f32(&ncoF32, 0.1234f, 0.0f); arm_nco_f32(&ncoF32, bufD_f32, n); }
+static void run_nco_q31(uint32_t n) { arm_nco_init_q31(&ncoQ31, 0x0FCD6E9E, 0); arm_nco_q31(&ncoQ31, bufD_q31, n); }
+static void run_nco_q15(uint32_t n) { arm_nco_init_q15(&ncoQ15, 0x0FCD, 0); arm_nco_q15(&ncoQ15, bufD_q15, n); }
+static void run_nco_mix_f32(uint32_t n) { arm_nco_init_f32(&ncoF32, -0.1234f, 0.0f); arm_nco_mix_f32(&ncoF32, bufA_f32, bufD_f32, n); }
+static void run_nco_mix_q31(uint32_t n) { arm_nco_init_q31(&ncoQ31, -0x0FCD6E9E, 0); arm_nco_mix_q31(&ncoQ31, bufA_q31, bufD_q31, n); }
+static void run_nco_mix_q15(uint32_t n) { arm_nco_init_q15(&ncoQ15, -0x0FCD, 0); arm_nco_mix_q15(&ncoQ15, bufA_q15, bufD_q15, n); }
+
+/* ----------------------------------------------------------------------
+* Complex math functions
+* ------------------------------------------------------------------- */
+static void run_cmplx_mag_f32(uint32_t n) { arm_cmplx_mag_f32(bufA_f32, bufD_f32, n); }
+static void run_cmplx_mag_q31(uint32_t n) { arm_cmplx_mag_q31(bufA_q31, bufD_q31, n); }
+static void run_cmplx_mag_q15(uint32_t n) { arm_cmplx_mag_q15(bufA_q15, bufD_q15, n); }
+static void run_cmplx_mag_squared_f32(uint32_t n) { arm_cmplx_mag_squared_f32(bufA_f32, bufD_f32, n); }
+static void run_cmplx_mag_squared_q31(uint32_t n) { arm_cmplx_mag_squared_q31(bufA_q31, bufD_q31, n); }
+static void run_cmplx_mag_squared_q15(uint32_t n) { arm_cmplx_mag_squared_q15(bufA_q15, bufD_q15, n); }
+static void run_cmplx_mag_fast_f32(uint32_t n) { arm_cmplx_mag_fast_f32(bufA_f32, bufD_f32, n); }
+static void run_cmplx_mag_fast_q31(uint32_t n) { arm_cmplx_mag_fast_q31(bufA_q31, bufD_q31, n); }
+static void run_cmplx_mag_fast_q15(uint32_t n) { arm_cmplx_mag_fast_q15(bufA_q15, bufD_q15, n); }
+static void run_cmplx_mag_db_f32(uint32_t n) { arm_cmplx_mag_db_f32(bufA_f32, bufD_f32, n); }
+static void run_cmplx_mag_db_q31(uint32_t n) { arm_cmplx_mag_db_q31(bufA_q31, bufD_q31, n); }
+static void run_cmplx_mag_db_q15(uint32_t n) { arm_cmplx_mag_db_q15(bufA_q15, bufD_q15, n); }
+static void run_cmplx_mult_cmplx_f32(uint32_t n) { arm_cmplx_mult_cmplx_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_cmplx_mult_cmplx_q31(uint32_t n) { arm_cmplx_mult_cmplx_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_cmplx_mult_cmplx_q15(uint32_t n) { arm_cmplx_mult_cmplx_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+static void run_cmplx_mult_real_f32(uint32_t n) { arm_cmplx_mult_real_f32(bufA_f32, bufB_f32, bufD_f32, n); }
+static void run_cmplx_mult_real_q31(uint32_t n) { arm_cmplx_mult_real_q31(bufA_q31, bufB_q31, bufD_q31, n); }
+static void run_cmplx_mult_real_q15(uint32_t n) { arm_cmplx_mult_real_q15(bufA_q15, bufB_q15, bufD_q15, n); }
+
+/* ----------------------------------------------------------------------
+* Filtering functions
+* ------------------------------------------------------------------- */
+static void run_fir_f32(uint32_t t) { (void) t; arm_fir_f32(&firF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_q31(uint32_t t) { (void) t; arm_fir_q31(&firQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_fast_q31(uint32_t t) { (void) t; arm_fir_fast_q31(&firQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_q15(uint32_t t) { (void) t; arm_fir_q15(&firQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_fast_q15(uint32_t t) { (void) t; arm_fir_fast_q15(&firQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_q7(uint32_t t) { (void) t; arm_fir_q7(&firQ7, bufA_q7, bufD_q7, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_short_f32(uint32_t t) { (void) t; arm_fir_f32(&firF32, bufA_f32, bufD_f32, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_short_q31(uint32_t t) { (void) t; arm_fir_q31(&firQ31, bufA_q31, bufD_q31, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_short_q15(uint32_t t) { (void) t; arm_fir_q15(&firQ15, bufA_q15, bufD_q15, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_short_q7(uint32_t t) { (void) t; arm_fir_q7(&firQ7, bufA_q7, bufD_q7, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_fft_f32(uint32_t t) { (void) t; arm_fir_fft_f32(&firFftF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_circular_f32(uint32_t t) { (void) t; arm_fir_circular_f32(&firCircF32, bufA_f32, bufD_f32, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_circular_q31(uint32_t t) { (void) t; arm_fir_circular_q31(&firCircQ31, bufA_q31, bufD_q31, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_circular_q15(uint32_t t) { (void) t; arm_fir_circular_q15(&firCircQ15, bufA_q15, bufD_q15, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_circular_q7(uint32_t t) { (void) t; arm_fir_circular_q7(&firCircQ7, bufA_q7, bufD_q7, ARM_BENCH_SHORT_BLOCK); }
+static void run_fir_multichannel_f32(uint32_t t) { (void) t; arm_fir_multichannel_f32(&firMcF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_fir_multichannel_q15(uint32_t t) { (void) t; arm_fir_multichannel_q15(&firMcQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_decimate_f32(uint32_t t) { (void) t; arm_fir_decimate_f32(&decF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_decimate_q31(uint32_t t) { (void) t; arm_fir_decimate_q31(&decQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_decimate_q15(uint32_t t) { (void) t; arm_fir_decimate_q15(&decQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_resample_f32(uint32_t t) { (void) t; arm_fir_resample_f32(&resF32, bufA_f32, bufD_f32, ARM_BENCH_RESAMPLE_M); }
+static void run_resample_q31(uint32_t t) { (void) t; arm_fir_resample_q31(&resQ31, bufA_q31, bufD_q31, ARM_BENCH_RESAMPLE_M); }
+static void run_resample_q15(uint32_t t) { (void) t; arm_fir_resample_q15(&resQ15, bufA_q15, bufD_q15, ARM_BENCH_RESAMPLE_M); }
+static void run_decimate_single_f32(uint32_t t) { (void) t; arm_fir_decimate_f32(&decF32, bufA_f32, bufD_f32, ARM_BENCH_DECIMATE_BLOCK); }
+static void run_decimate_multistage_f32(uint32_t t) { (void) t; arm_fir_decimate_multistage_f32(&decMsF32, bufA_f32, bufD_f32, ARM_BENCH_DECIMATE_BLOCK); }
+static void run_decimate_multistage_q31(uint32_t t) { (void) t; arm_fir_decimate_multistage_q31(&decMsQ31, bufA_q31, bufD_q31, ARM_BENCH_DECIMATE_BLOCK); }
+static void run_interpolate_f32(uint32_t t) { (void) t; arm_fir_interpolate_f32(&intF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_interpolate_q31(uint32_t t) { (void) t; arm_fir_interpolate_q31(&intQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_interpolate_q15(uint32_t t) { (void) t; arm_fir_interpolate_q15(&intQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_lms_f32(uint32_t t) { (void) t; arm_lms_f32(&lmsF32, bufA_f32, bufB_f32, bufD_f32, bufW_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_f32(uint32_t s) { (void) s; arm_biquad_cascade_df1_f32(&iirF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_q31(uint32_t s) { (void) s; arm_biquad_cascade_df1_q31(&iirQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_fast_q31(uint32_t s) { (void) s; arm_biquad_cascade_df1_fast_q31(&iirQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_q15(uint32_t s) { (void) s; arm_biquad_cascade_df1_q15(&iirQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_fast_q15(uint32_t s) { (void) s; arm_biquad_cascade_df1_fast_q15(&iirQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df2T_f32(uint32_t s) { (void) s; arm_biquad_cascade_df2T_f32(&iir2TF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df2T_block_f32(uint32_t s) { (void) s; arm_biquad_cascade_df2T_block_f32(&iir2TBlockF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df2T_multichannel_f32(uint32_t s) { (void) s; arm_biquad_cascade_df2T_multichannel_f32(&iir2TMcF32, bufA_f32, bufD_f32, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_multichannel_q31(uint32_t s) { (void) s; arm_biquad_cascade_df1_multichannel_q31(&iirMcQ31, bufA_q31, bufD_q31, ARM_BENCH_FILTER_BLOCK); }
+static void run_biquad_df1_multichannel_q15(uint32_t s) { (void) s; arm_biquad_cascade_df1_multichannel_q15(&iirMcQ15, bufA_q15, bufD_q15, ARM_BENCH_FILTER_BLOCK); }
+static void run_conv_f32(uint32_t n) { arm_conv_f32(bufA_f32, n, bufB_f32, n, bufD_f32); }
+static void run_conv_fft_f32(uint32_t n)
+{
+  (void) arm_conv_fft_f32(bufA_f32, n, bufB_f32, n, bufD_f32,
+                          (uint16_t) ((n < ARM_BENCH_CONV_PART) ? n : ARM_BENCH_CONV_PART), bufW_f32);
+}
+static void run_conv_q31(uint32_t n) { arm_conv_q31(bufA_q31, n, bufB_q31, n, bufD_q31); }
+static void run_conv_q15(uint32_t n) { arm_conv_q15(bufA_q15, n, bufB_q15, n, bufD_q15); }
+static void run_conv_q7(uint32_t n) { arm_conv_q7(bufA_q7, n, bufB_q7, n, bufD_q7); }
+static void run_correlate_f32(uint32_t n) { arm_correlate_f32(bufA_f32, n, bufB_f32, n, bufD_f32); }
+static void run_correlate_q31(uint32_t n) { arm_correlate_q31(bufA_q31, n, bufB_q31, n, bufD_q31); }
+static void run_correlate_q15(uint32_t n) { arm_correlate_q15(bufA_q15, n, bufB_q15, n, bufD_q15); }
+static void run_correlate_q7(uint32_t n) { arm_correlate_q7(bufA_q7, n, bufB_q7, n, bufD_q7); }
+
+/* ----------------------------------------------------------------------
+* Transform functions
+* ------------------------------------------------------------------- */
+static void run_cfft_f32(uint32_t n) { (void) n; arm_cfft_radix4_f32(&cfftF32, bufW_f32); }
+static void run_cfft_q31(uint32_t n) { (void) n; arm_cfft_radix4_q31(&cfftQ31, bufW_q31); }
+static void run_cfft_q15(uint32_t n) { (void) n; arm_cfft_radix4_q15(&cfftQ15, bufW_q15); }
+static void run_cfft8_f32(uint32_t n) { (void) n; arm_cfft_radix8_f32(&cfft8F32, bufW_f32); }
+static void run_rfft_f32(uint32_t n) { (void) n; arm_rfft_f32(&rfftF32, bufW_f32, bufD_f32); }
+static void run_rfft_fast_f32(uint32_t n) { (void) n; arm_rfft_fast_f32(&rfftFastF32, bufW_f32, bufD_f32); }
+static void run_rfft_q31(uint32_t n) { (void) n; arm_rfft_q31(&rfftQ31, bufW_q31, bufD_q31); }
+static void run_rfft_q15(uint32_t n) { (void) n; arm_rfft_q15(&rfftQ15, bufW_q15, bufD_q15); }
+static void run_dct4_f32(uint32_t n) { (void) n; arm_dct4_f32(&dct4F32, bufS_f32, bufW_f32); }
+static void run_goertzel_f32(uint32_t n) { (void) n; arm_goertzel_f32(&goertzelF32, bufA_f32, bufD_f32); }
+static void run_goertzel_q31(uint32_t n) { (void) n; arm_goertzel_q31(&goertzelQ31, bufA_q31, bufD_q31); }
+static void run_sdft_f32(uint32_t n) { arm_sdft_f32(&sdftF32, bufA_f32, bufD_f32, n); }
+static void run_sdft_q31(uint32_t n) { arm_sdft_q31(&sdftQ31, bufA_q31, bufD_q31, n); }
+
+/* ----------------------------------------------------------------------
+* Matrix functions
+* ------------------------------------------------------------------- */
+static void run_mat_add_f32(uint32_t d) { (void) d; arm_mat_add_f32(&matA_f32, &matB_f32, &matD_f32); }
+static void run_mat_add_q31(uint32_t d) { (void) d; arm_mat_add_q31(&matA_q31, &matB_q31, &matD_q31); }
+static void run_mat_add_q15(uint32_t d) { (void) d; arm_mat_add_q15(&matA_q15, &matB_q15, &matD_q15); }
+static void run_mat_trans_f32(uint32_t d) { (void) d; arm_mat_trans_f32(&matA_f32, &matD_f32); }
+static void run_mat_trans_q31(uint32_t d) { (void) d; arm_mat_trans_q31(&matA_q31, &matD_q31); }
+static void run_mat_trans_q15(uint32_t d) { (void) d; arm_mat_trans_q15(&matA_q15, &matD_q15); }
+static void run_mat_scale_f32(uint32_t d) { (void) d; arm_mat_scale_f32(&matA_f32, 0.75f, &matD_f32); }
+static void run_mat_scale_q31(uint32_t d) { (void) d; arm_mat_scale_q31(&matA_q31, 0x60000000, 1, &matD_q31); }
+static void run_mat_scale_q15(uint32_t d) { (void) d; arm_mat_scale_q15(&matA_q15, 0x6000, 1, &matD_q15); }
+static void run_mat_mult_f32(uint32_t d) { (void) d; arm_mat_mult_f32(&matA_f32, &matB_f32, &matD_f32); }
+static void run_mat_mult_q31(uint32_t d) { (void) d; arm_mat_mult_q31(&matA_q31, &matB_q31, &matD_q31); }
+static void run_mat_mult_fast_q31(uint32_t d) { (void) d; arm_mat_mult_fast_q31(&matA_q31, &matB_q31, &matD_q31); }
+static void run_mat_mult_q15(uint32_t d) { (void) d; arm_mat_mult_q15(&matA_q15, &matB_q15, &matD_q15, bufS_q15); }
+static void run_mat_mult_fast_q15(uint32_t d) { (void) d; arm_mat_mult_fast_q15(&matA_q15, &matB_q15, &matD_q15, bufS_q15); }
+static void run_mat_vec_mult_f32(uint32_t d) { (void) d; arm_mat_vec_mult_f32(&matA_f32, bufB_f32, bufD_f32); }
+static void run_mat_vec_mult_q31(uint32_t d) { (void) d; arm_mat_vec_mult_q31(&matA_q31, bufB_q31, bufD_q31); }
+static void run_mat_vec_mult_q15(uint32_t d) { (void) d; arm_mat_vec_mult_q15(&matA_q15, bufB_q15, bufD_q15); }
+static void run_mat_vec_mult_q7(uint32_t d) { (void) d; arm_mat_vec_mult_q7(&matA_q7, bufB_q7, bufD_q7); }
+static void run_mat_mult_trans_f32(uint32_t d) { (void) d; arm_mat_mult_trans_f32(&matA_f32, &matB_f32, &matD_f32); }
+static void run_mat_sym_mult_f32(uint32_t d) { (void) d; arm_mat_sym_mult_f32(&symB_f32, &matA_f32, &matD_f32); }
+static void run_mat_sym_abat_f32(uint32_t d) { (void) d; arm_mat_sym_abat_f32(&matA_f32, &symB_f32, &symD_f32, bufS_f32); }
+static void run_mat_diag_mult_f32(uint32_t d) { (void) d; arm_mat_diag_mult_f32(&diagB_f32, &matA_f32, &matD_f32); }
+static void run_mat_mult_diag_f32(uint32_t d) { (void) d; arm_mat_mult_diag_f32(&matA_f32, &diagB_f32, &matD_f32); }
+static void run_mat_cholesky_f32(uint32_t d) { (void) d; arm_mat_cholesky_f32(&matB_f32, &matD_f32); }
+static void run_mat_cholesky_q31(uint32_t d) { (void) d; arm_mat_cholesky_q31(&matB_q31, &matD_q31); }
+static void run_mat_ldlt_f32(uint32_t d) { (void) d; arm_mat_ldlt_f32(&matB_f32, &matD_f32); }
+static void run_mat_lu_f32(uint32_t d) { (void) d; arm_mat_lu_f32(&matA_f32, &matD_f32, matPerm); }
+static void run_mat_qr_f32(uint32_t d) { (void) d; arm_mat_qr_f32(&matA_f32, &matD_f32, bufS_f32); }
+
+/* ----------------------------------------------------------------------
+* Statistics functions
+* ------------------------------------------------------------------- */
+static void run_max_f32(uint32_t n) { arm_max_f32(bufA_f32, n, &res_f32, &resIndex); }
+static void run_max_q31(uint32_t n) { arm_max_q31(bufA_q31, n, &res_q31, &resIndex); }
+static void run_max_q15(uint32_t n) { arm_max_q15(bufA_q15, n, &res_q15, &resIndex); }
+static void run_max_q7(uint32_t n) { arm_max_q7(bufA_q7, n, &res_q7, &resIndex); }
+static void run_min_f32(uint32_t n) { arm_min_f32(bufA_f32, n, &res_f32, &resIndex); }
+static void run_min_q31(uint32_t n) { arm_min_q31(bufA_q31, n, &res_q31, &resIndex); }
+static void run_min_q15(uint32_t n) { arm_min_q15(bufA_q15, n, &res_q15, &resIndex); }
+static void run_min_q7(uint32_t n) { arm_min_q7(bufA_q7, n, &res_q7, &resIndex); }
+static void run_mean_f32(uint32_t n) { arm_mean_f32(bufA_f32, n, &res_f32); }
+static void run_mean_q31(uint32_t n) { arm_mean_q31(bufA_q31, n, &res_q31); }
+static void run_mean_q15(uint32_t n) { arm_mean_q15(bufA_q15, n, &res_q15); }
+static void run_mean_q7(uint32_t n) { arm_mean_q7(bufA_q7, n, &res_q7); }
+static void run_power_f32(uint32_t n) { arm_power_f32(bufA_f32, n, &res_f32); }
+static void run_power_q31(uint32_t n) { arm_power_q31(bufA_q31, n, &res_q63); }
+static void run_power_q15(uint32_t n) { arm_power_q15(bufA_q15, n, &res_q63); }
+static void run_power_q7(uint32_t n) { arm_power_q7(bufA_q7, n, &res_q31); }
+static void run_rms_f32(uint32_t n) { arm_rms_f32(bufA_f32, n, &res_f32); }
+static void run_rms_q31(uint32_t n) { arm_rms_q31(bufA_q31, n, &res_q31); }
+static void run_rms_q15(uint32_t n) { arm_rms_q15(bufA_q15, n, &res_q15); }
+static void run_var_f32(uint32_t n) { arm_var_f32(bufA_f32, n, &res_f32); }
+static void run_var_q31(uint32_t n) { arm_var_q31(bufA_q31, n, &res_q63); }
+static void run_var_q15(uint32_t n) { arm_var_q15(bufA_q15, n, &res_q31); }
+static void run_std_f32(uint32_t n) { arm_std_f32(bufA_f32, n, &res_f32); }
+static void run_std_q31(uint32_t n) { arm_std_q31(bufA_q31, n, &res_q31); }
+static void run_std_q15(uint32_t n) { arm_std_q15(bufA_q15, n, &res_q15); }
+static void run_stats_update_f32(uint32_t n) { arm_stats_init_f32(&statsF32); arm_stats_update_f32(&statsF32, bufA_f32, n); }
+static void run_stats_update_q31(uint32_t n) { arm_stats_init_q31(&statsQ31); arm_stats_update_q31(&statsQ31, bufA_q31, n); }
+static void run_stats_update_q15(uint32_t n) { arm_stats_init_q15(&statsQ15); arm_stats_update_q15(&statsQ15, bufA_q15, n); }
+static void run_moving_max_f32(uint32_t n) { arm_moving_minmax_init_f32(&movMaxF32, ARM_BENCH_WINDOW, movValF32, movIdx); arm_moving_max_f32(&movMaxF32, bufA_f32, bufD_f32, NULL, n); }
+static void run_moving_max_q15(uint32_t n) { arm_moving_minmax_init_q15(&movMaxQ15, ARM_BENCH_WINDOW, movValQ15, movIdx); arm_moving_max_q15(&movMaxQ15, bufA_q15, bufD_q15, NULL, n); }
+static void run_moving_average_f32(uint32_t n) { arm_moving_average_init_f32(&movAvgF32, ARM_BENCH_WINDOW, movValF32); arm_moving_average_f32(&movAvgF32, bufA_f32, bufD_f32, n); }
+static void run_moving_average_q15(uint32_t n) { arm_moving_average_init_q15(&movAvgQ15, ARM_BENCH_WINDOW, movValQ15); arm_moving_average_q15(&movAvgQ15, bufA_q15, bufD_q15, n); }
+static void run_moving_rms_f32(uint32_t n) { arm_moving_average_init_f32(&movAvgF32, ARM_BENCH_WINDOW, movValF32); arm_moving_rms_f32(&movAvgF32, bufA_f32, bufD_f32, n); }
+
+/* ----------------------------------------------------------------------
+* Support functions
+* ------------------------------------------------------------------- */
+static void run_copy_f32(uint32_t n) { arm_copy_f32(bufA_f32, bufD_f32, n); }
+static void run_copy_q31(uint32_t n) { arm_copy_q31(bufA_q31, bufD_q31, n); }
+static void run_copy_q15(uint32_t n) { arm_copy_q15(bufA_q15, bufD_q15, n); }
+static void run_copy_q7(uint32_t n) { arm_copy_q7(bufA_q7, bufD_q7, n); }
+static void run_fill_f32(uint32_t n) { arm_fill_f32(0.5f, bufD_f32, n); }
+static void run_fill_q31(uint32_t n) { arm_fill_q31(0x40000000, bufD_q31, n); }
+static void run_fill_q15(uint32_t n) { arm_fill_q15(0x4000, bufD_q15, n); }
+static void run_fill_q7(uint32_t n) { arm_fill_q7(0x40, bufD_q7, n); }
+static void run_float_to_q31(uint32_t n) { arm_float_to_q31(bufA_f32, bufD_q31, n); }
+static void run_float_to_q15(uint32_t n) { arm_float_to_q15(bufA_f32, bufD_q15, n); }
+static void run_float_to_q7(uint32_t n) { arm_float_to_q7(bufA_f32, bufD_q7, n); }
+static void run_q31_to_float(uint32_t n) { arm_q31_to_float(bufA_q31, bufD_f32, n); }
+static void run_q15_to_float(uint32_t n) { arm_q15_to_float(bufA_q15, bufD_f32, n); }
+static void run_q7_to_float(uint32_t n) { arm_q7_to_float(bufA_q7, bufD_f32, n); }
+static void run_q31_to_q15(uint32_t n) { arm_q31_to_q15(bufA_q31, bufD_q15, n); }
+static void run_q15_to_q31(uint32_t n) { arm_q15_to_q31(bufA_q15, bufD_q31, n); }
+static void run_q15_to_q7(uint32_t n) { arm_q15_to_q7(bufA_q15, bufD_q7, n); }
+static void run_q7_to_q15(uint32_t n) { arm_q7_to_q15(bufA_q7, bufD_q15, n); }
+
+/* ----------------------------------------------------------------------
+* Case table
+* ------------------------------------------------------------------- */
+#define BLOCK(fn, grp, typ, run)    { fn, grp, typ, "blockSize", blockSizes, ARM_BENCH_COUNT(blockSizes), setup_block, run, NULL }
+#define POSITIVE(fn, typ, run)      { fn, "FastMath", typ, "blockSize", blockSizes, ARM_BENCH_COUNT(blockSizes), setup_positive, run, NULL }
+#define NCO(fn, typ, run)           { fn, "Controller", typ, "blockSize", blockSizes, ARM_BENCH_COUNT(blockSizes), setup_cmplx, run, NULL }
+#define CMPLX(fn, typ, run)         { fn, "ComplexMath", typ, "numSamples", blockSizes, ARM_BENCH_COUNT(blockSizes), setup_cmplx, run, NULL }
+#define TAPS(fn, typ, setup, run)   { fn, "Filtering", typ, "numTaps", tapCounts, ARM_BENCH_COUNT(tapCounts), setup, run, NULL }
+#define LONGTAPS(fn, typ, setup, run) { fn, "Filtering", typ, "numTaps", longTapCounts, ARM_BENCH_COUNT(longTapCounts), setup, run, NULL }
+#define STAGES(fn, typ, run)        { fn, "Filtering", typ, "numStages", stageCounts, ARM_BENCH_COUNT(stageCounts), setup_biquad, run, NULL }
+#define PHASES(fn, typ, run)        { fn, "Filtering", typ, "phaseLength", phaseLengths, ARM_BENCH_COUNT(phaseLengths), setup_resample, run, NULL }
+#define FACTORS(fn, typ, setup, run) { fn, "Filtering", typ, "M", decimateFactors, ARM_BENCH_COUNT(decimateFactors), setup, run, NULL }
+#define CONV(fn, typ, run)          { fn, "Filtering", typ, "srcLen", convLengths, ARM_BENCH_COUNT(convLengths), setup_conv, run, NULL }
+#define MATRIX(fn, typ, run)        { fn, "Matrix", typ, "dim", matDims, ARM_BENCH_COUNT(matDims), setup_matrix, run, NULL }
+#define MATRIX_SYM(fn, typ, run)    { fn, "Matrix", typ, "dim", matDims, ARM_BENCH_COUNT(matDims), setup_matrix_sym, run, NULL }
+#define MATRIX_SPD(fn, typ, run)    { fn, "Matrix", typ, "dim", matDims, ARM_BENCH_COUNT(matDims), setup_matrix_spd, run, NULL }
+
+const arm_bench_case arm_bench_cases[] = {
+  BLOCK("arm_add_f32", "BasicMath", "f32", run_add_f32),
+  BLOCK("arm_add_q31", "BasicMath", "q31", run_add_q31),
+  BLOCK("arm_add_q15", "BasicMath", "q15", run_add_q15),
+  BLOCK("arm_add_q7", "BasicMath", "q7", run_add_q7),
+  BLOCK("arm_sub_f32", "BasicMath", "f32", run_sub_f32),
+  BLOCK("arm_sub_q31", "BasicMath", "q31", run_sub_q31),
+  BLOCK("arm_sub_q15", "BasicMath", "q15", run_sub_q15),
+  BLOCK("arm_sub_q7", "BasicMath", "q7", run_sub_q7),
+  BLOCK("arm_mult_f32", "BasicMath", "f32", run_mult_f32),
+  BLOCK("arm_mult_q31", "BasicMath", "q31", run_mult_q31),
+  BLOCK("arm_mult_q15", "BasicMath", "q15", run_mult_q15),
+  BLOCK("arm_mult_q7", "BasicMath", "q7", run_mult_q7),
+  BLOCK("arm_scale_f32", "BasicMath", "f32", run_scale_f32),
+  BLOCK("arm_scale_q31", "BasicMath", "q31", run_scale_q31),
+  BLOCK("arm_scale_q15", "BasicMath", "q15", run_scale_q15),
+  BLOCK("arm_scale_q7", "BasicMath", "q7", run_scale_q7),
+  BLOCK("arm_abs_f32", "BasicMath", "f32", run_abs_f32),
+  BLOCK("arm_abs_q31", "BasicMath", "q31", run_abs_q31),
+  BLOCK("arm_abs_q15", "BasicMath", "q15", run_abs_q15),
+  BLOCK("arm_abs_q7", "BasicMath", "q7", run_abs_q7),
+  BLOCK("arm_negate_f32", "BasicMath", "f32", run_negate_f32),
+  BLOCK("arm_negate_q31", "BasicMath", "q31", run_negate_q31),
+  BLOCK("arm_negate_q15", "BasicMath", "q15", run_negate_q15),
+  BLOCK("arm_negate_q7", "BasicMath", "q7", run_negate_q7),
+  BLOCK("arm_offset_f32", "BasicMath", "f32", run_offset_f32),
+  BLOCK("arm_offset_q31", "BasicMath", "q31", run_offset_q31),
+  BLOCK("arm_offset_q15", "BasicMath", "q15", run_offset_q15),
+  BLOCK("arm_offset_q7", "BasicMath", "q7", run_offset_q7),
+  BLOCK("arm_shift_q31", "BasicMath", "q31", run_shift_q31),
+  BLOCK("arm_shift_q15", "BasicMath", "q15", run_shift_q15),
+  BLOCK("arm_shift_q7", "BasicMath", "q7", run_shift_q7),
+  BLOCK("arm_dot_prod_f32", "BasicMath", "f32", run_dot_prod_f32),
+  BLOCK("arm_dot_prod_q31", "BasicMath", "q31", run_dot_prod_q31),
+  BLOCK("arm_dot_prod_q15", "BasicMath", "q15", run_dot_prod_q15),
+  BLOCK("arm_dot_prod_q7", "BasicMath", "q7", run_dot_prod_q7),
+
+  BLOCK("arm_sin_f32", "FastMath", "f32", run_sin_f32),
+  BLOCK("arm_cos_f32", "FastMath", "f32", run_cos_f32),
+  BLOCK("arm_sin_q31", "FastMath", "q31", run_sin_q31),
+  BLOCK("arm_sin_q15", "FastMath", "q15", run_sin_q15),
+  BLOCK("arm_sqrt_q31", "FastMath", "q31", run_sqrt_q31),
+  BLOCK("arm_sqrt_q15", "FastMath", "q15", run_sqrt_q15),
+  POSITIVE("arm_vsqrt_f32", "f32", run_vsqrt_f32),
+  POSITIVE("arm_vsqrt_q31", "q31", run_vsqrt_q31),
+  POSITIVE("arm_vsqrt_q15", "q15", run_vsqrt_q15),
+  POSITIVE("arm_vrsqrt_f32", "f32", run_vrsqrt_f32),
+  POSITIVE("arm_vrsqrt_q31", "q31", run_vrsqrt_q31),
+  POSITIVE("arm_vrsqrt_q15", "q15", run_vrsqrt_q15),
+  BLOCK("arm_sin_cos_f32", "Controller", "f32", run_sin_cos_f32),
+  BLOCK("arm_sin_cos_q31", "Controller", "q31", run_sin_cos_q31),
+  NCO("arm_nco_f32", "f32", run_nco_f32),
+  NCO("arm_nco_q31", "q31", run_nco_q31),
+  NCO("arm_nco_q15", "q15", run_nco_q15),
+  NCO("arm_nco_mix_f32", "f32", run_nco_mix_f32),
+  NCO("arm_nco_mix_q31", "q31", run_nco_mix_q31),
+  NCO("arm_nco_mix_q15", "q15", run_nco_mix_q15),
+  BLOCK("arm_vsin_f32", "FastMath", "f32", run_vsin_f32),
+  BLOCK("arm_vsin_cos_f32", "FastMath", "f32", run_vsin_cos_f32),
+  BLOCK("arm_vexp_f32", "FastMath", "f32", run_vexp_f32),
+  POSITIVE("arm_vlog_f32", "f32", run_vlog_f32),
+  BLOCK("arm_vatan2_f32", "FastMath", "f32", run_vatan2_f32),
+  BLOCK("arm_vtanh_f32", "FastMath", "f32", run_vtanh_f32),
+  BLOCK("arm_vsin_q31", "FastMath", "q31", run_vsin_q31),
+  BLOCK("arm_vsin_cos_q31", "FastMath", "q31", run_vsin_cos_q31),
+  POSITIVE("arm_vlog_q31", "q31", run_vlog_q31),
+  BLOCK("arm_vatan2_q31", "FastMath", "q31", run_vatan2_q31),
+  BLOCK("arm_vsin_q15", "FastMath", "q15", run_vsin_q15),
+  BLOCK("arm_vatan2_q15", "FastMath", "q15", run_vatan2_q15),
+
+  CMPLX("arm_cmplx_mag_f32", "f32", run_cmplx_mag_f32),
+  CMPLX("arm_cmplx_mag_q31", "q31", run_cmplx_mag_q31),
+  CMPLX("arm_cmplx_mag_q15", "q15", run_cmplx_mag_q15),
+  CMPLX("arm_cmplx_mag_squared_f32", "f32", run_cmplx_mag_squared_f32),
+  CMPLX("arm_cmplx_mag_squared_q31", "q31", run_cmplx_mag_squared_q31),
+  CMPLX("arm_cmplx_mag_squared_q15", "q15", run_cmplx_mag_squared_q15),
+  CMPLX("arm_cmplx_mag_fast_f32", "f32", run_cmplx_mag_fast_f32),
+  CMPLX("arm_cmplx_mag_fast_q31", "q31", run_cmplx_mag_fast_q31),
+  CMPLX("arm_cmplx_mag_fast_q15", "q15", run_cmplx_mag_fast_q15),
+  CMPLX("arm_cmplx_mag_db_f32", "f32", run_cmplx_mag_db_f32),
+  CMPLX("arm_cmplx_mag_db_q31", "q31", run_cmplx_mag_db_q31),
+  CMPLX("arm_cmplx_mag_db_q15", "q15", run_cmplx_mag_db_q15),
+  CMPLX("arm_cmplx_mult_cmplx_f32", "f32", run_cmplx_mult_cmplx_f32),
+  CMPLX("arm_cmplx_mult_cmplx_q31", "q31", run_cmplx_mult_cmplx_q31),
+  CMPLX("arm_cmplx_mult_cmplx_q15", "q15", run_cmplx_mult_cmplx_q15),
+  CMPLX("arm_cmplx_mult_real_f32", "f32", run_cmplx_mult_real_f32),
+  CMPLX("arm_cmplx_mult_real_q31", "q31", run_cmplx_mult_real_q31),
+  CMPLX("arm_cmplx_mult_real_q15", "q15", run_cmplx_mult_real_q15),
+
+  TAPS("arm_fir_f32", "f32", setup_fir, run_fir_f32),
+  TAPS("arm_fir_q31", "q31", setup_fir, run_fir_q31),
+  TAPS("arm_fir_fast_q31", "q31", setup_fir, run_fir_fast_q31),
+  TAPS("arm_fir_q15", "q15", setup_fir, run_fir_q15),
+  TAPS("arm_fir_fast_q15", "q15", setup_fir, run_fir_fast_q15),
+  TAPS("arm_fir_q7", "q7", setup_fir, run_fir_q7),
+  TAPS("arm_fir_f32", "f32", setup_fir_short, run_fir_short_f32),
+  TAPS("arm_fir_circular_f32", "f32", setup_fir_short, run_fir_circular_f32),
+  TAPS("arm_fir_q31", "q31", setup_fir_short, run_fir_short_q31),
+  TAPS("arm_fir_circular_q31", "q31", setup_fir_short, run_fir_circular_q31),
+  TAPS("arm_fir_q15", "q15", setup_fir_short, run_fir_short_q15),
+  TAPS("arm_fir_circular_q15", "q15", setup_fir_short, run_fir_circular_q15),
+  TAPS("arm_fir_q7", "q7", setup_fir_short, run_fir_short_q7),
+  TAPS("arm_fir_circular_q7", "q7", setup_fir_short, run_fir_circular_q7),
+  LONGTAPS("arm_fir_f32", "f32", setup_fir_long, run_fir_f32),
+  LONGTAPS("arm_fir_fft_f32", "f32", setup_fir_long, run_fir_fft_f32),
+  TAPS("arm_fir_multichannel_f32", "f32", setup_fir_multichannel, run_fir_multichannel_f32),
+  TAPS("arm_fir_multichannel_q15", "q15", setup_fir_multichannel, run_fir_multichannel_q15),
+  TAPS("arm_fir_decimate_f32", "f32", setup_decimate, run_decimate_f32),
+  TAPS("arm_fir_decimate_q31", "q31", setup_decimate, run_decimate_q31),
+  TAPS("arm_fir_decimate_q15", "q15", setup_decimate, run_decimate_q15),
+  FACTORS("arm_fir_decimate_f32", "f32", setup_decimate_single, run_decimate_single_f32),
+  FACTORS("arm_fir_decimate_multistage_f32", "f32", setup_decimate_multistage, run_decimate_multistage_f32),
+  FACTORS("arm_fir_decimate_multistage_q31", "q31", setup_decimate_multistage, run_decimate_multistage_q31),
+  TAPS("arm_fir_interpolate_f32", "f32", setup_interpolate, run_interpolate_f32),
+  TAPS("arm_fir_interpolate_q31", "q31", setup_interpolate, run_interpolate_q31),
+  TAPS("arm_fir_interpolate_q15", "q15", setup_interpolate, run_interpolate_q15),
+  PHASES("arm_fir_resample_f32", "f32", run_resample_f32),
+  PHASES("arm_fir_resample_q31", "q31", run_resample_q31),
+  PHASES("arm_fir_resample_q15", "q15", run_resample_q15),
+  TAPS("arm_lms_f32", "f32", setup_lms, run_lms_f32),
+  STAGES("arm_biquad_cascade_df1_f32", "f32", run_biquad_df1_f32),
+  STAGES("arm_biquad_cascade_df1_q31", "q31", run_biquad_df1_q31),
+  STAGES("arm_biquad_cascade_df1_fast_q31", "q31", run_biquad_df1_fast_q31),
+  STAGES("arm_biquad_cascade_df1_q15", "q15", run_biquad_df1_q15),
+  STAGES("arm_biquad_cascade_df1_fast_q15", "q15", run_biquad_df1_fast_q15),
+  STAGES("arm_biquad_cascade_df2T_f32", "f32", run_biquad_df2T_f32),
+  STAGES("arm_biquad_cascade_df2T_block_f32", "f32", run_biquad_df2T_block_f32),
+  { "arm_biquad_cascade_df2T_multichannel_f32", "Filtering", "f32", "numStages", stageCounts, ARM_BENCH_COUNT(stageCounts), setup_biquad_multichannel, run_biquad_df2T_multichannel_f32, NULL },
+  { "arm_biquad_cascade_df1_multichannel_q31", "Filtering", "q31", "numStages", stageCounts, ARM_BENCH_COUNT(stageCounts), setup_biquad_multichannel, run_biquad_df1_multichannel_q31, NULL },
+  { "arm_biquad_cascade_df1_multichannel_q15", "Filtering", "q15", "numStages", stageCounts, ARM_BENCH_COUNT(stageCounts), setup_biquad_multichannel, run_biquad_df1_multichannel_q15, NULL },
+  CONV("arm_conv_f32", "f32", run_conv_f32),
+  CONV("arm_conv_fft_f32", "f32", run_conv_fft_f32),
+  CONV("arm_conv_q31", "q31", run_conv_q31),
+  CONV("arm_conv_q15", "q15", run_conv_q15),
+  CONV("arm_conv_q7", "q7", run_conv_q7),
+  CONV("arm_correlate_f32", "f32", run_correlate_f32),
+  CONV("arm_correlate_q31", "q31", run_correlate_q31),
+  CONV("arm_correlate_q15", "q15", run_correlate_q15),
+  CONV("arm_correlate_q7", "q7", run_correlate_q7),
+
+  { "arm_cfft_radix4_f32", "Transform", "f32", "fftLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_cfft_f32, run_cfft_f32, prep_cmplx_f32 },
+  { "arm_cfft_radix4_q31", "Transform", "q31", "fftLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_cfft_q31, run_cfft_q31, prep_cmplx_q31 },
+  { "arm_cfft_radix4_q15", "Transform", "q15", "fftLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_cfft_q15, run_cfft_q15, prep_cmplx_q15 },
+  { "arm_cfft_radix8_f32", "Transform", "f32", "fftLen", cfft8Lengths, ARM_BENCH_COUNT(cfft8Lengths), setup_cfft8_f32, run_cfft8_f32, prep_cmplx_f32 },
+  { "arm_rfft_f32", "Transform", "f32", "fftLen", rfftLengths, ARM_BENCH_COUNT(rfftLengths), setup_rfft_f32, run_rfft_f32, prep_real_f32 },
+  { "arm_rfft_fast_f32", "Transform", "f32", "fftLen", rfftFastLengths, ARM_BENCH_COUNT(rfftFastLengths), setup_rfft_fast_f32, run_rfft_fast_f32, prep_real_f32 },
+  { "arm_rfft_q31", "Transform", "q31", "fftLen", rfftLengths, ARM_BENCH_COUNT(rfftLengths), setup_rfft_q31, run_rfft_q31, prep_real_q31 },
+  { "arm_rfft_q15", "Transform", "q15", "fftLen", rfftLengths, ARM_BENCH_COUNT(rfftLengths), setup_rfft_q15, run_rfft_q15, prep_real_q15 },
+  { "arm_dct4_f32", "Transform", "f32", "N", rfftLengths, ARM_BENCH_COUNT(rfftLengths), setup_dct4, run_dct4_f32, prep_real_f32 },
+  { "arm_goertzel_f32", "Transform", "f32", "frameLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_goertzel, run_goertzel_f32, NULL },
+  { "arm_goertzel_q31", "Transform", "q31", "frameLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_goertzel, run_goertzel_q31, NULL },
+  { "arm_sdft_f32", "Transform", "f32", "frameLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_goertzel, run_sdft_f32, NULL },
+  { "arm_sdft_q31", "Transform", "q31", "frameLen", cfftLengths, ARM_BENCH_COUNT(cfftLengths), setup_goertzel, run_sdft_q31, NULL },
+
+  MATRIX("arm_mat_add_f32", "f32", run_mat_add_f32),
+  MATRIX("arm_mat_add_q31", "q31", run_mat_add_q31),
+  MATRIX("arm_mat_add_q15", "q15", run_mat_add_q15),
+  MATRIX("arm_mat_trans_f32", "f32", run_mat_trans_f32),
+  MATRIX("arm_mat_trans_q31", "q31", run_mat_trans_q31),
+  MATRIX("arm_mat_trans_q15", "q15", run_mat_trans_q15),
+  MATRIX("arm_mat_scale_f32", "f32", run_mat_scale_f32),
+  MATRIX("arm_mat_scale_q31", "q31", run_mat_scale_q31),
+  MATRIX("arm_mat_scale_q15", "q15", run_mat_scale_q15),
+  MATRIX("arm_mat_mult_f32", "f32", run_mat_mult_f32),
+  MATRIX("arm_mat_mult_q31", "q31", run_mat_mult_q31),
+  MATRIX("arm_mat_mult_fast_q31", "q31", run_mat_mult_fast_q31),
+  MATRIX("arm_mat_mult_q15", "q15", run_mat_mult_q15),
+  MATRIX("arm_mat_mult_fast_q15", "q15", run_mat_mult_fast_q15),
+  MATRIX("arm_mat_vec_mult_f32", "f32", run_mat_vec_mult_f32),
+  MATRIX("arm_mat_vec_mult_q31", "q31", run_mat_vec_mult_q31),
+  MATRIX("arm_mat_vec_mult_q15", "q15", run_mat_vec_mult_q15),
+  MATRIX("arm_mat_vec_mult_q7", "q7", run_mat_vec_mult_q7),
+  MATRIX("arm_mat_mult_trans_f32", "f32", run_mat_mult_trans_f32),
+  MATRIX_SYM("arm_mat_sym_mult_f32", "f32", run_mat_sym_mult_f32),
+  MATRIX_SYM("arm_mat_sym_abat_f32", "f32", run_mat_sym_abat_f32),
+  MATRIX("arm_mat_diag_mult_f32", "f32", run_mat_diag_mult_f32),
+  MATRIX("arm_mat_mult_diag_f32", "f32", run_mat_mult_diag_f32),
+  MATRIX_SPD("arm_mat_cholesky_f32", "f32", run_mat_cholesky_f32),
+  MATRIX_SPD("arm_mat_cholesky_q31", "q31", run_mat_cholesky_q31),
+  MATRIX_SPD("arm_mat_ldlt_f32", "f32", run_mat_ldlt_f32),
+  MATRIX("arm_mat_lu_f32", "f32", run_mat_lu_f32),
+  MATRIX("arm_mat_qr_f32", "f32", run_mat_qr_f32),
+
+  BLOCK("arm_max_f32", "Statistics", "f32", run_max_f32),
+  BLOCK("arm_max_q31", "Statistics", "q31", run_max_q31),
+  BLOCK("arm_max_q15", "Statistics", "q15", run_max_q15),
+  BLOCK("arm_max_q7", "Statistics", "q7", run_max_q7),
+  BLOCK("arm_min_f32", "Statistics", "f32", run_min_f32),
+  BLOCK("arm_min_q31", "Statistics", "q31", run_min_q31),
+  BLOCK("arm_min_q15", "Statistics", "q15", run_min_q15),
+  BLOCK("arm_min_q7", "Statistics", "q7", run_min_q7),
+  BLOCK("arm_mean_f32", "Statistics", "f32", run_mean_f32),
+  BLOCK("arm_mean_q31", "Statistics", "q31", run_mean_q31),
+  BLOCK("arm_mean_q15", "Statistics", "q15", run_mean_q15),
+  BLOCK("arm_mean_q7", "Statistics", "q7", run_mean_q7),
+  BLOCK("arm_power_f32", "Statistics", "f32", run_power_f32),
+  BLOCK("arm_power_q31", "Statistics", "q31", run_power_q31),
+  BLOCK("arm_power_q15", "Statistics", "q15", run_power_q15),
+  BLOCK("arm_power_q7", "Statistics", "q7", run_power_q7),
+  BLOCK("arm_rms_f32", "Statistics", "f32", run_rms_f32),
+  BLOCK("arm_rms_q31", "Statistics", "q31", run_rms_q31),
+  BLOCK("arm_rms_q15", "Statistics", "q15", run_rms_q15),
+  BLOCK("arm_var_f32", "Statistics", "f32", run_var_f32),
+  BLOCK("arm_var_q31", "Statistics", "q31", run_var_q31),
+  BLOCK("arm_var_q15", "Statistics", "q15", run_var_q15),
+  BLOCK("arm_std_f32", "Statistics", "f32", run_std_f32),
+  BLOCK("arm_std_q31", "Statistics", "q31", run_std_q31),
+  BLOCK("arm_std_q15", "Statistics", "q15", run_std_q15),
+  BLOCK("arm_stats_update_f32", "Statistics", "f32", run_stats_update_f32),
+  BLOCK("arm_stats_update_q31", "Statistics", "q31", run_stats_update_q31),
+  BLOCK("arm_stats_update_q15", "Statistics", "q15", run_stats_update_q15),
+  BLOCK("arm_moving_max_f32", "Statistics", "f32", run_moving_max_f32),
+  BLOCK("arm_moving_max_q15", "Statistics", "q15", run_moving_max_q15),
+  BLOCK("arm_moving_average_f32", "Statistics", "f32", run_moving_average_f32),
+  BLOCK("arm_moving_average_q15", "Statistics", "q15", run_moving_average_q15),
+  BLOCK("arm_moving_rms_f32", "Statistics", "f32", run_moving_rms_f32),
+
+  BLOCK("arm_copy_f32", "Support", "f32", run_copy_f32),
+  BLOCK("arm_copy_q31", "Support", "q31", run_copy_q31),
+  BLOCK("arm_copy_q15", "Support", "q15", run_copy_q15),
+  BLOCK("arm_copy_q7", "Support", "q7", run_copy_q7),
+  BLOCK("arm_fill_f32", "Support", "f32", run_fill_f32),
+  BLOCK("arm_fill_q31", "Support", "q31", run_fill_q31),
+  BLOCK("arm_fill_q15", "Support", "q15", run_fill_q15),
+  BLOCK("arm_fill_q7", "Support", "q7", run_fill_q7),
+  BLOCK("arm_float_to_q31", "Support", "f32", run_float_to_q31),
+  BLOCK("arm_float_to_q15", "Support", "f32", run_float_to_q15),
+  BLOCK("arm_float_to_q7", "Support", "f32", run_float_to_q7),
+  BLOCK("arm_q31_to_float", "Support", "q31", run_q31_to_float),
+  BLOCK("arm_q15_to_float", "Support", "q15", run_q15_to_float),
+  BLOCK("arm_q7_to_float", "Support", "q7", run_q7_to_float),
+  BLOCK("arm_q31_to_q15", "Support", "q31", run_q31_to_q15),
+  BLOCK("arm_q15_to_q31", "Support", "q15", run_q15_to_q31),
+  BLOCK("arm_q15_to_q7", "Support", "q15", run_q15_to_q7),
+  BLOCK("arm_q7_to_q15", "Support", "q7", run_q7_to_q15),
+};
+
+const uint32_t arm_bench_num_cases = ARM_BENCH_COUNT(arm_bench_cases);
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_bench_timer.c
+*
+* Description:	Cycle counter and wall clock used by the benchmark suite.
+*
+*               Host:      Linux perf_event CPU cycles, falling back to the
+*                          x86 time stamp counter; CLOCK_MONOTONIC for time.
+*               Cortex-M4/Cortex-M3: DWT CYCCNT, extended to 64 bits.
+*               Cortex-M0: SysTick, extended to 64 bits.
+*               On the target time is derived from SystemCoreClock.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0 and host
+* -------------------------------------------------------------------- */
+
+#if defined (ARM_MATH_HOST) && defined (__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include "arm_benchmark.h"
+
+#if defined (ARM_MATH_HOST)
+
+#include <time.h>
+
+#if defined (__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+
+/* ----------------------------------------------------------------------
+* Host implementation
+* ------------------------------------------------------------------- */
+
+static int perfFd = -1;
+static const char *cycleSource = "none";
+
+void arm_bench_timer_init(void)
+{
+#if defined (__linux__)
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = PERF_COUNT_HW_CPU_CYCLES;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  perfFd = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+
+  if(perfFd >= 0)
+  {
+    ioctl(perfFd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(perfFd, PERF_EVENT_IOC_ENABLE, 0);
+    cycleSource = "perf_event";
+    return;
+  }
+#endif
+
+#if defined (__x86_64__) || defined (__i386__)
+  cycleSource = "rdtsc";
+#endif
+}
+
+uint64_t arm_bench_cycles(void)
+{
+#if defined (__linux__)
+  if(perfFd >= 0)
+  {
+    uint64_t count = 0u;
+
+    if(read(perfFd, &count, sizeof(count)) == (ssize_t) sizeof(count))
+    {
+      return count;
+    }
+    return 0u;
+  }
+#endif
+
+#if defined (__x86_64__) || defined (__i386__)
+  return (uint64_t) __rdtsc();
+#else
+  return 0u;
+#endif
+}
+
+uint64_t arm_bench_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint64_t) ts.tv_sec * 1000000000u) + (uint64_t) ts.tv_nsec;
+}
+
+const char *arm_bench_cycle_source(void)
+{
+  return cycleSource;
+}
+
+const char *arm_bench_platform(void)
+{
+#if defined (__x86_64__)
+  return "host-x86_64";
+#elif defined (__aarch64__)
+  return "host-aarch64";
+#else
+  return "host";
+#endif
+}
+
+#else
+
+/* ----------------------------------------------------------------------
+* Target implementation.  The device header provides the core peripheral
+* definitions (DWT, CoreDebug, SysTick) and SystemCoreClock.
+* ------------------------------------------------------------------- */
+
+#ifndef ARM_BENCH_DEVICE_HEADER
+#if defined (ARM_MATH_CM4)
+#define ARM_BENCH_DEVICE_HEADER "ARMCM4.h"
+#elif defined (ARM_MATH_CM3)
+#define ARM_BENCH_DEVICE_HEADER "ARMCM3.h"
+#else
+#define ARM_BENCH_DEVICE_HEADER "ARMCM0.h"
+#endif
+#endif
+
+#include ARM_BENCH_DEVICE_HEADER
+
+static uint32_t lastCount;
+static uint64_t extCount;
+
+void arm_bench_timer_init(void)
+{
+#if defined (ARM_MATH_CM0)
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0u;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#else
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  lastCount = 0u;
+  extCount = 0u;
+}
+
+uint64_t arm_bench_cycles(void)
+{
+  uint32_t count;
+
+#if defined (ARM_MATH_CM0)
+  /* SysTick counts down over 24 bits */
+  count = SysTick_LOAD_RELOAD_Msk - SysTick->VAL;
+  extCount += (count - lastCount) & SysTick_LOAD_RELOAD_Msk;
+#else
+  count = DWT->CYCCNT;
+  extCount += (uint32_t) (count - lastCount);
+#endif
+
+  lastCount = count;
+
+  return extCount;
+}
+
+uint64_t arm_bench_ns(void)
+{
+  uint64_t cycles = arm_bench_cycles();
+
+  return ((cycles / SystemCoreClock) * 1000000000u) +
+    (((cycles % SystemCoreClock) * 1000000000u) / SystemCoreClock);
+}
+
+const char *arm_bench_cycle_source(void)
+{
+#if defined (ARM_MATH_CM0)
+  return "systick";
+#else
+  return "dwt";
+#endif
+}
+
+const char *arm_bench_platform(void)
+{
+#if defined (ARM_MATH_CM4)
+  return "cortex-m4";
+#elif defined (ARM_MATH_CM3)
+  return "cortex-m3";
+#else
+  return "cortex-m0";
+#endif
+}
+
+#endif /* ARM_MATH_HOST */
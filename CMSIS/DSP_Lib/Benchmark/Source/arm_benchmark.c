@@ -0,0 +1,257 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_benchmark.c
+*
+* Description:	Benchmark driver.  Runs every case of arm_bench_cases[]
+*               over its sweep points and prints the results as JSON.
+*
+*               Host options:
+*                 -f <text>   only run functions whose name contains text
+*                 -t <ms>     minimum duration of one timed batch
+*                 -o <file>   write the JSON report to file
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0 and host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "arm_benchmark.h"
+
+/* ----------------------------------------------------------------------
+* Measurement parameters
+* ------------------------------------------------------------------- */
+#ifndef ARM_BENCH_MIN_TIME_MS
+#define ARM_BENCH_MIN_TIME_MS   10u     /* minimum duration of one timed batch */
+#endif
+
+#define ARM_BENCH_NUM_TRIALS    3u      /* best of this many batches is reported */
+#define ARM_BENCH_MAX_CALLS     (1u << 24)
+
+typedef struct
+{
+  uint64_t ns;                          /* elapsed time */
+  uint64_t cycles;                      /* elapsed cycles */
+} arm_bench_sample;
+
+/**
+ * @brief  Times calls of a case, optionally without the kernel itself.
+ * @param  pCase     case to time
+ * @param  size      sweep point
+ * @param  calls     number of calls in the batch
+ * @param  withRun   0 times only the prepare step of every call
+ * @return elapsed time and cycles of the batch
+ */
+
+static arm_bench_sample arm_bench_batch(
+  const arm_bench_case * pCase,
+  uint32_t size,
+  uint32_t calls,
+  uint32_t withRun)
+{
+  arm_bench_sample start, stop;
+  uint32_t i;
+
+  start.cycles = arm_bench_cycles();
+  start.ns = arm_bench_ns();
+
+  for (i = 0u; i < calls; i++)
+  {
+    if(pCase->prepare != NULL)
+    {
+      pCase->prepare(size);
+    }
+
+    if(withRun != 0u)
+    {
+      pCase->run(size);
+    }
+  }
+
+  stop.ns = arm_bench_ns();
+  stop.cycles = arm_bench_cycles();
+
+  stop.ns -= start.ns;
+  stop.cycles -= start.cycles;
+
+  return stop;
+}
+
+/**
+ * @brief  Lowest time and cycle count over several batches.
+ */
+
+static arm_bench_sample arm_bench_best(
+  const arm_bench_case * pCase,
+  uint32_t size,
+  uint32_t calls,
+  uint32_t withRun)
+{
+  arm_bench_sample best, trial;
+  uint32_t i;
+
+  best = arm_bench_batch(pCase, size, calls, withRun);
+
+  for (i = 1u; i < ARM_BENCH_NUM_TRIALS; i++)
+  {
+    trial = arm_bench_batch(pCase, size, calls, withRun);
+
+    if(trial.ns < best.ns)
+    {
+      best.ns = trial.ns;
+    }
+
+    if(trial.cycles < best.cycles)
+    {
+      best.cycles = trial.cycles;
+    }
+  }
+
+  return best;
+}
+
+static int arm_bench_match(
+  const char *name,
+  const char *filter)
+{
+  const char *h, *n;
+
+  if(filter == NULL)
+  {
+    return 1;
+  }
+
+  for (; *name != '\0'; name++)
+  {
+    for (h = name, n = filter; (*n != '\0') && (*h == *n); h++, n++)
+    {
+    }
+
+    if(*n == '\0')
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(
+  int argc,
+  char **argv)
+{
+  const arm_bench_case *pCase;
+  arm_bench_sample total, prep;
+  FILE *out = stdout;
+  const char *filter = NULL;
+  uint64_t minTimeNs = (uint64_t) ARM_BENCH_MIN_TIME_MS * 1000000u;
+  uint32_t i, j, size, samples, calls;
+  uint32_t first = 1u;
+  double ns, cycles;
+  int k;
+
+  for (k = 1; k < argc; k++)
+  {
+    if((argv[k][0] == '-') && (argv[k][1] != '\0') && (argv[k][2] == '\0')
+       && (k + 1 < argc))
+    {
+      switch (argv[k][1])
+      {
+      case 'f':
+        filter = argv[++k];
+        continue;
+      case 't':
+        minTimeNs = (uint64_t) strtoul(argv[++k], NULL, 10) * 1000000u;
+        continue;
+      case 'o':
+        out = fopen(argv[++k], "w");
+        if(out == NULL)
+        {
+          fprintf(stderr, "cannot open %s\n", argv[k]);
+          return 1;
+        }
+        continue;
+      default:
+        break;
+      }
+    }
+
+    fprintf(stderr, "usage: %s [-f function] [-t ms] [-o file]\n", argv[0]);
+    return 1;
+  }
+
+  arm_bench_timer_init();
+
+  fprintf(out, "{\n");
+  fprintf(out, "  \"platform\": \"%s\",\n", arm_bench_platform());
+  fprintf(out, "  \"cycle_source\": \"%s\",\n", arm_bench_cycle_source());
+  fprintf(out, "  \"results\": [");
+
+  for (i = 0u; i < arm_bench_num_cases; i++)
+  {
+    pCase = &arm_bench_cases[i];
+
+    if(!arm_bench_match(pCase->function, filter))
+    {
+      continue;
+    }
+
+    for (j = 0u; j < pCase->numSizes; j++)
+    {
+      size = pCase->pSizes[j];
+      samples = pCase->setup(size);
+
+      if(samples == 0u)
+      {
+        continue;
+      }
+
+      /* Warm up and find a batch length that lasts at least minTimeNs */
+      calls = 1u;
+      total = arm_bench_batch(pCase, size, calls, 1u);
+
+      while((total.ns < minTimeNs) && (calls < ARM_BENCH_MAX_CALLS))
+      {
+        calls <<= 1u;
+        total = arm_bench_batch(pCase, size, calls, 1u);
+      }
+
+      total = arm_bench_best(pCase, size, calls, 1u);
+
+      /* Remove the cost of restoring the input of in-place kernels */
+      if(pCase->prepare != NULL)
+      {
+        prep = arm_bench_best(pCase, size, calls, 0u);
+        total.ns = (total.ns > prep.ns) ? (total.ns - prep.ns) : 0u;
+        total.cycles = (total.cycles > prep.cycles) ?
+          (total.cycles - prep.cycles) : 0u;
+      }
+
+      ns = (double) total.ns / calls;
+      cycles = (double) total.cycles / calls;
+
+      fprintf(out, "%s\n    {\"function\": \"%s\", \"group\": \"%s\", "
+              "\"type\": \"%s\", \"param\": \"%s\", \"size\": %u, "
+              "\"samples\": %u, \"calls\": %u, \"ns_per_call\": %.3f, "
+              "\"ns_per_sample\": %.4f, \"cycles_per_sample\": %.4f}",
+              first ? "" : ",", pCase->function, pCase->group, pCase->type,
+              pCase->param, (unsigned) size, (unsigned) samples,
+              (unsigned) calls, ns, ns / samples, cycles / samples);
+
+      first = 0u;
+    }
+  }
+
+  fprintf(out, "\n  ]\n}\n");
+
+  if(out != stdout)
+  {
+    fclose(out);
+  }
+
+  return 0;
+}
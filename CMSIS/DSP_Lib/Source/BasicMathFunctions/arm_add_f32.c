@@ -32,6 +32,88 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_add_f32(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_add_f32_avx2(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    _mm256_storeu_ps(pDst, _mm256_add_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrcA++) + (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_add_f32(): 4 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_add_f32_sse41(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 2u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, _mm_add_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrcA++) + (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -70,6 +152,25 @@ void arm_add_f32(
 {
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_add_f32_avx2(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_add_f32_sse41(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
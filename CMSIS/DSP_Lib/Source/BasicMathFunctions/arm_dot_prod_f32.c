@@ -32,6 +32,108 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_dot_prod_f32(): one partial sum per lane.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_dot_prod_f32_avx2(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+{
+  __m256 acc = _mm256_setzero_ps();              /* partial sums */
+  __m128 acc128;                                 /* partial sums of the two halves */
+  float32_t sum;                                 /* result */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+
+    pSrcA += 8u;
+    pSrcB += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Add the partial sums */
+  acc128 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+  acc128 = _mm_add_ps(acc128, _mm_movehl_ps(acc128, acc128));
+  acc128 = _mm_add_ss(acc128, _mm_shuffle_ps(acc128, acc128, 0x55));
+  sum = _mm_cvtss_f32(acc128);
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    sum += (*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the result back in the destination buffer */
+  *result = sum;
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_dot_prod_f32(): one partial sum per lane.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_dot_prod_f32_sse41(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+{
+  __m128 acc = _mm_setzero_ps();                 /* partial sums */
+  float32_t sum;                                 /* result */
+  uint32_t blkCnt = blockSize >> 2u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+
+    pSrcA += 4u;
+    pSrcB += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Add the partial sums */
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+  sum = _mm_cvtss_f32(acc);
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    sum += (*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the result back in the destination buffer */
+  *result = sum;
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -56,6 +158,11 @@
  * @param[in]       blockSize number of samples in each vector   
  * @param[out]      *result output result returned here   
  * @return none.   
+ *
+ * \par
+ * The x86 host kernels (ARM_MATH_HOST_SSE41, ARM_MATH_HOST_AVX2) keep one partial
+ * sum per vector lane and add them at the end.  The result may differ from that
+ * of the sequential summation in the last bits.
  */
 
 
@@ -69,6 +176,25 @@ void arm_dot_prod_f32(
   uint32_t blkCnt;                               /* loop counter */
 
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_dot_prod_f32_avx2(pSrcA, pSrcB, blockSize, result);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_dot_prod_f32_sse41(pSrcA, pSrcB, blockSize, result);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
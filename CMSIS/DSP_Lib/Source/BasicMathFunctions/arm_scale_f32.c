@@ -32,6 +32,88 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_scale_f32(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_scale_f32_avx2(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __m256 vScale = _mm256_set1_ps(scale);         /* scale factor in every lane */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    _mm256_storeu_ps(pDst, _mm256_mul_ps(_mm256_loadu_ps(pSrc), vScale));
+
+    pSrc += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrc++) * scale;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_scale_f32(): 4 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_scale_f32_sse41(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __m128 vScale = _mm_set1_ps(scale);         /* scale factor in every lane */
+  uint32_t blkCnt = blockSize >> 2u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    _mm_storeu_ps(pDst, _mm_mul_ps(_mm_loadu_ps(pSrc), vScale));
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (*pSrc++) * scale;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -83,6 +165,25 @@ void arm_scale_f32(
 {
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_scale_f32_avx2(pSrc, scale, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_scale_f32_sse41(pSrc, scale, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
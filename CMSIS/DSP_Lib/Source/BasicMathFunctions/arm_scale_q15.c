@@ -32,6 +32,114 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_scale_q15(): 16 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_scale_q15_avx2(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t kShift,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  __m256i vScale = _mm256_set1_epi16(scaleFract); /* scale factor in every lane */
+  __m128i vShift = _mm_cvtsi32_si128(kShift);    /* shift count */
+  __m256i in, prodLo, prodHi;                    /* input, low and high halves of the products */
+  uint32_t blkCnt = blockSize >> 4u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm256_loadu_si256((__m256i *) pSrc);
+
+    /* 32-bit products, interleaved from their low and high halves */
+    prodLo = _mm256_mullo_epi16(in, vScale);
+    prodHi = _mm256_mulhi_epi16(in, vScale);
+
+    in = _mm256_sra_epi32(_mm256_unpacklo_epi16(prodLo, prodHi), vShift);
+    prodHi = _mm256_sra_epi32(_mm256_unpackhi_epi16(prodLo, prodHi), vShift);
+
+    /* Saturate to 16 bits.  The pack restores the order of the samples. */
+    _mm256_storeu_si256((__m256i *) pDst, _mm256_packs_epi32(in, prodHi));
+
+    pSrc += 16u;
+    pDst += 16u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 15u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) (__SSAT(((*pSrc++) * scaleFract) >> kShift, 16));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_scale_q15(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_scale_q15_sse41(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t kShift,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  __m128i vScale = _mm_set1_epi16(scaleFract); /* scale factor in every lane */
+  __m128i vShift = _mm_cvtsi32_si128(kShift);    /* shift count */
+  __m128i in, prodLo, prodHi;                    /* input, low and high halves of the products */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* 32-bit products, interleaved from their low and high halves */
+    prodLo = _mm_mullo_epi16(in, vScale);
+    prodHi = _mm_mulhi_epi16(in, vScale);
+
+    in = _mm_sra_epi32(_mm_unpacklo_epi16(prodLo, prodHi), vShift);
+    prodHi = _mm_sra_epi32(_mm_unpackhi_epi16(prodLo, prodHi), vShift);
+
+    /* Saturate to 16 bits.  The pack restores the order of the samples. */
+    _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(in, prodHi));
+
+    pSrc += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) (__SSAT(((*pSrc++) * scaleFract) >> kShift, 16));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -67,6 +175,25 @@ void arm_scale_q15(
   int8_t kShift = 15 - shift;                    /* shift to apply after scaling */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if((kShift >= 0) && (kShift <= 31) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_scale_q15_avx2(pSrc, scaleFract, kShift, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if((kShift >= 0) && (kShift <= 31) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_scale_q15_sse41(pSrc, scaleFract, kShift, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
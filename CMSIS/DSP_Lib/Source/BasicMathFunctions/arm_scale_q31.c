@@ -32,6 +32,134 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_scale_q31(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_scale_q31_avx2(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t kShift,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  __m256i vScale = _mm256_set1_epi32(scaleFract); /* scale factor in every lane */
+  __m128i vShift = _mm_cvtsi32_si128(kShift);    /* shift count */
+  __m256i vSign = _mm256_srl_epi64(_mm256_set1_epi64x(INT64_MIN), vShift); /* sign bit after the shift */
+  __m256i vMax = _mm256_set1_epi32(0x7FFFFFFF);  /* largest Q31 value */
+  __m256i in, even, odd, lo, hi;                 /* input, 64-bit results, their low and high words */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm256_loadu_si256((__m256i *) pSrc);
+
+    /* 64-bit products of the even and of the odd samples */
+    even = _mm256_mul_epi32(in, vScale);
+    odd = _mm256_mul_epi32(_mm256_srli_epi64(in, 32), vScale);
+
+    /* Arithmetic right shift of the products: logical shift, then sign extension */
+    even = _mm256_sub_epi64(_mm256_xor_si256(_mm256_srl_epi64(even, vShift), vSign), vSign);
+    odd = _mm256_sub_epi64(_mm256_xor_si256(_mm256_srl_epi64(odd, vShift), vSign), vSign);
+
+    /* Low and high words of the results, in the order of the samples */
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+
+    /* clip_q63_to_q31(): the result fits if the high word is the sign extension of the low word */
+    in = _mm256_cmpeq_epi32(hi, _mm256_srai_epi32(lo, 31));
+    hi = _mm256_xor_si256(vMax, _mm256_srai_epi32(hi, 31));
+
+    _mm256_storeu_si256((__m256i *) pDst, _mm256_blendv_epi8(hi, lo, in));
+
+    pSrc += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = clip_q63_to_q31(((q63_t) * pSrc++ * scaleFract) >> kShift);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_scale_q31(): 4 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_scale_q31_sse41(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t kShift,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  __m128i vScale = _mm_set1_epi32(scaleFract);   /* scale factor in every lane */
+  __m128i vShift = _mm_cvtsi32_si128(kShift);    /* shift count */
+  __m128i vSign = _mm_srl_epi64(_mm_set1_epi64x(INT64_MIN), vShift); /* sign bit after the shift */
+  __m128i vMax = _mm_set1_epi32(0x7FFFFFFF);     /* largest Q31 value */
+  __m128i in, even, odd, lo, hi;                 /* input, 64-bit results, their low and high words */
+  uint32_t blkCnt = blockSize >> 2u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* 64-bit products of the even and of the odd samples */
+    even = _mm_mul_epi32(in, vScale);
+    odd = _mm_mul_epi32(_mm_srli_epi64(in, 32), vScale);
+
+    /* Arithmetic right shift of the products: logical shift, then sign extension */
+    even = _mm_sub_epi64(_mm_xor_si128(_mm_srl_epi64(even, vShift), vSign), vSign);
+    odd = _mm_sub_epi64(_mm_xor_si128(_mm_srl_epi64(odd, vShift), vSign), vSign);
+
+    /* Low and high words of the results, in the order of the samples */
+    lo = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+    hi = _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+
+    /* clip_q63_to_q31(): the result fits if the high word is the sign extension of the low word */
+    in = _mm_cmpeq_epi32(hi, _mm_srai_epi32(lo, 31));
+    hi = _mm_xor_si128(vMax, _mm_srai_epi32(hi, 31));
+
+    _mm_storeu_si128((__m128i *) pDst, _mm_blendv_epi8(hi, lo, in));
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = clip_q63_to_q31(((q63_t) * pSrc++ * scaleFract) >> kShift);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -66,6 +194,25 @@ void arm_scale_q31(
   int8_t kShift = 31 - shift;                    /* Shift to apply after scaling */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if((kShift >= 0) && (kShift <= 63) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_scale_q31_avx2(pSrc, scaleFract, kShift, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if((kShift >= 0) && (kShift <= 63) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_scale_q31_sse41(pSrc, scaleFract, kShift, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
@@ -32,6 +32,94 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_sub_q15(): 16 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_sub_q15_avx2(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 4u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Saturating 16-bit subtraction */
+    _mm256_storeu_si256((__m256i *) pDst,
+                        _mm256_subs_epi16(_mm256_loadu_si256((__m256i *) pSrcA),
+                                          _mm256_loadu_si256((__m256i *) pSrcB)));
+
+    pSrcA += 16u;
+    pSrcB += 16u;
+    pDst += 16u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 15u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) __SSAT(((q31_t) * pSrcA++ - *pSrcB++), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_sub_q15(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_sub_q15_sse41(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Saturating 16-bit subtraction */
+    _mm_storeu_si128((__m128i *) pDst,
+                        _mm_subs_epi16(_mm_loadu_si128((__m128i *) pSrcA),
+                                          _mm_loadu_si128((__m128i *) pSrcB)));
+
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) __SSAT(((q31_t) * pSrcA++ - *pSrcB++), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -64,6 +152,25 @@ void arm_sub_q15(
   uint32_t blkCnt;                               /* loop counter */
 
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_sub_q15_avx2(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_sub_q15_sse41(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
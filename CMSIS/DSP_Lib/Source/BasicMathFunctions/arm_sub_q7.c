@@ -32,6 +32,94 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_sub_q7(): 32 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_sub_q7_avx2(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 5u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Saturating 8-bit subtraction */
+    _mm256_storeu_si256((__m256i *) pDst,
+                        _mm256_subs_epi8(_mm256_loadu_si256((__m256i *) pSrcA),
+                                         _mm256_loadu_si256((__m256i *) pSrcB)));
+
+    pSrcA += 32u;
+    pSrcB += 32u;
+    pDst += 32u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 31u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q7_t) __SSAT((q15_t) * pSrcA++ - *pSrcB++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_sub_q7(): 16 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_sub_q7_sse41(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize >> 4u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Saturating 8-bit subtraction */
+    _mm_storeu_si128((__m128i *) pDst,
+                        _mm_subs_epi8(_mm_loadu_si128((__m128i *) pSrcA),
+                                         _mm_loadu_si128((__m128i *) pSrcB)));
+
+    pSrcA += 16u;
+    pSrcB += 16u;
+    pDst += 16u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 15u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q7_t) __SSAT((q15_t) * pSrcA++ - *pSrcB++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupMath   
  */
@@ -63,6 +151,25 @@ void arm_sub_q7(
 {
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_sub_q7_avx2(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_sub_q7_sse41(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
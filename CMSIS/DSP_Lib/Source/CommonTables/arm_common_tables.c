@@ -30,6 +30,12 @@
 
 #include "arm_math.h"
 
+/*   
+* With ARM_DSP_CONFIG_TABLES defined the FFT tables come from   
+* arm_dsp_tables.c, written by arm_table_gen for the selected lengths only.   
+*/
+#if !defined (ARM_DSP_CONFIG_TABLES)
+
 /**   
  * @ingroup groupTransforms   
  */
@@ -57,7 +63,7 @@
 *   y[l] = y[l] >> 1;   
 *  } </pre>   
 * \par   
-* where N = 1024	logN2 = 10   
+* where N = 4096	logN2 = 12   
 * \par   
 * N is the maximum FFT Size supported   
 */
@@ -65,46 +71,4276 @@
 /*   
 * @brief  Table for bit reversal process   
 */
-const uint16_t armBitRevTable[256] = {
-  0x100, 0x80, 0x180, 0x40, 0x140, 0xc0, 0x1c0,
-  0x20, 0x120, 0xa0, 0x1a0, 0x60, 0x160, 0xe0,
-  0x1e0, 0x10, 0x110, 0x90, 0x190, 0x50, 0x150,
-  0xd0, 0x1d0, 0x30, 0x130, 0xb0, 0x1b0, 0x70,
-  0x170, 0xf0, 0x1f0, 0x8, 0x108, 0x88, 0x188,
-  0x48, 0x148, 0xc8, 0x1c8, 0x28, 0x128, 0xa8,
-  0x1a8, 0x68, 0x168, 0xe8, 0x1e8, 0x18, 0x118,
-  0x98, 0x198, 0x58, 0x158, 0xd8, 0x1d8, 0x38,
-  0x138, 0xb8, 0x1b8, 0x78, 0x178, 0xf8, 0x1f8,
-  0x4, 0x104, 0x84, 0x184, 0x44, 0x144, 0xc4,
-  0x1c4, 0x24, 0x124, 0xa4, 0x1a4, 0x64, 0x164,
-  0xe4, 0x1e4, 0x14, 0x114, 0x94, 0x194, 0x54,
-  0x154, 0xd4, 0x1d4, 0x34, 0x134, 0xb4, 0x1b4,
-  0x74, 0x174, 0xf4, 0x1f4, 0xc, 0x10c, 0x8c,
-  0x18c, 0x4c, 0x14c, 0xcc, 0x1cc, 0x2c, 0x12c,
-  0xac, 0x1ac, 0x6c, 0x16c, 0xec, 0x1ec, 0x1c,
-  0x11c, 0x9c, 0x19c, 0x5c, 0x15c, 0xdc, 0x1dc,
-  0x3c, 0x13c, 0xbc, 0x1bc, 0x7c, 0x17c, 0xfc,
-  0x1fc, 0x2, 0x102, 0x82, 0x182, 0x42, 0x142,
-  0xc2, 0x1c2, 0x22, 0x122, 0xa2, 0x1a2, 0x62,
-  0x162, 0xe2, 0x1e2, 0x12, 0x112, 0x92, 0x192,
-  0x52, 0x152, 0xd2, 0x1d2, 0x32, 0x132, 0xb2,
-  0x1b2, 0x72, 0x172, 0xf2, 0x1f2, 0xa, 0x10a,
-  0x8a, 0x18a, 0x4a, 0x14a, 0xca, 0x1ca, 0x2a,
-  0x12a, 0xaa, 0x1aa, 0x6a, 0x16a, 0xea, 0x1ea,
-  0x1a, 0x11a, 0x9a, 0x19a, 0x5a, 0x15a, 0xda,
-  0x1da, 0x3a, 0x13a, 0xba, 0x1ba, 0x7a, 0x17a,
-  0xfa, 0x1fa, 0x6, 0x106, 0x86, 0x186, 0x46,
-  0x146, 0xc6, 0x1c6, 0x26, 0x126, 0xa6, 0x1a6,
-  0x66, 0x166, 0xe6, 0x1e6, 0x16, 0x116, 0x96,
-  0x196, 0x56, 0x156, 0xd6, 0x1d6, 0x36, 0x136,
-  0xb6, 0x1b6, 0x76, 0x176, 0xf6, 0x1f6, 0xe,
-  0x10e, 0x8e, 0x18e, 0x4e, 0x14e, 0xce, 0x1ce,
-  0x2e, 0x12e, 0xae, 0x1ae, 0x6e, 0x16e, 0xee,
-  0x1ee, 0x1e, 0x11e, 0x9e, 0x19e, 0x5e, 0x15e,
-  0xde, 0x1de, 0x3e, 0x13e, 0xbe, 0x1be, 0x7e,
-  0x17e, 0xfe, 0x1fe, 0x1
+const uint16_t armBitRevTable[1024] = {
+  0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700,
+  0x80, 0x480, 0x280, 0x680, 0x180, 0x580, 0x380,
+  0x780, 0x40, 0x440, 0x240, 0x640, 0x140, 0x540,
+  0x340, 0x740, 0xc0, 0x4c0, 0x2c0, 0x6c0, 0x1c0,
+  0x5c0, 0x3c0, 0x7c0, 0x20, 0x420, 0x220, 0x620,
+  0x120, 0x520, 0x320, 0x720, 0xa0, 0x4a0, 0x2a0,
+  0x6a0, 0x1a0, 0x5a0, 0x3a0, 0x7a0, 0x60, 0x460,
+  0x260, 0x660, 0x160, 0x560, 0x360, 0x760, 0xe0,
+  0x4e0, 0x2e0, 0x6e0, 0x1e0, 0x5e0, 0x3e0, 0x7e0,
+  0x10, 0x410, 0x210, 0x610, 0x110, 0x510, 0x310,
+  0x710, 0x90, 0x490, 0x290, 0x690, 0x190, 0x590,
+  0x390, 0x790, 0x50, 0x450, 0x250, 0x650, 0x150,
+  0x550, 0x350, 0x750, 0xd0, 0x4d0, 0x2d0, 0x6d0,
+  0x1d0, 0x5d0, 0x3d0, 0x7d0, 0x30, 0x430, 0x230,
+  0x630, 0x130, 0x530, 0x330, 0x730, 0xb0, 0x4b0,
+  0x2b0, 0x6b0, 0x1b0, 0x5b0, 0x3b0, 0x7b0, 0x70,
+  0x470, 0x270, 0x670, 0x170, 0x570, 0x370, 0x770,
+  0xf0, 0x4f0, 0x2f0, 0x6f0, 0x1f0, 0x5f0, 0x3f0,
+  0x7f0, 0x8, 0x408, 0x208, 0x608, 0x108, 0x508,
+  0x308, 0x708, 0x88, 0x488, 0x288, 0x688, 0x188,
+  0x588, 0x388, 0x788, 0x48, 0x448, 0x248, 0x648,
+  0x148, 0x548, 0x348, 0x748, 0xc8, 0x4c8, 0x2c8,
+  0x6c8, 0x1c8, 0x5c8, 0x3c8, 0x7c8, 0x28, 0x428,
+  0x228, 0x628, 0x128, 0x528, 0x328, 0x728, 0xa8,
+  0x4a8, 0x2a8, 0x6a8, 0x1a8, 0x5a8, 0x3a8, 0x7a8,
+  0x68, 0x468, 0x268, 0x668, 0x168, 0x568, 0x368,
+  0x768, 0xe8, 0x4e8, 0x2e8, 0x6e8, 0x1e8, 0x5e8,
+  0x3e8, 0x7e8, 0x18, 0x418, 0x218, 0x618, 0x118,
+  0x518, 0x318, 0x718, 0x98, 0x498, 0x298, 0x698,
+  0x198, 0x598, 0x398, 0x798, 0x58, 0x458, 0x258,
+  0x658, 0x158, 0x558, 0x358, 0x758, 0xd8, 0x4d8,
+  0x2d8, 0x6d8, 0x1d8, 0x5d8, 0x3d8, 0x7d8, 0x38,
+  0x438, 0x238, 0x638, 0x138, 0x538, 0x338, 0x738,
+  0xb8, 0x4b8, 0x2b8, 0x6b8, 0x1b8, 0x5b8, 0x3b8,
+  0x7b8, 0x78, 0x478, 0x278, 0x678, 0x178, 0x578,
+  0x378, 0x778, 0xf8, 0x4f8, 0x2f8, 0x6f8, 0x1f8,
+  0x5f8, 0x3f8, 0x7f8, 0x4, 0x404, 0x204, 0x604,
+  0x104, 0x504, 0x304, 0x704, 0x84, 0x484, 0x284,
+  0x684, 0x184, 0x584, 0x384, 0x784, 0x44, 0x444,
+  0x244, 0x644, 0x144, 0x544, 0x344, 0x744, 0xc4,
+  0x4c4, 0x2c4, 0x6c4, 0x1c4, 0x5c4, 0x3c4, 0x7c4,
+  0x24, 0x424, 0x224, 0x624, 0x124, 0x524, 0x324,
+  0x724, 0xa4, 0x4a4, 0x2a4, 0x6a4, 0x1a4, 0x5a4,
+  0x3a4, 0x7a4, 0x64, 0x464, 0x264, 0x664, 0x164,
+  0x564, 0x364, 0x764, 0xe4, 0x4e4, 0x2e4, 0x6e4,
+  0x1e4, 0x5e4, 0x3e4, 0x7e4, 0x14, 0x414, 0x214,
+  0x614, 0x114, 0x514, 0x314, 0x714, 0x94, 0x494,
+  0x294, 0x694, 0x194, 0x594, 0x394, 0x794, 0x54,
+  0x454, 0x254, 0x654, 0x154, 0x554, 0x354, 0x754,
+  0xd4, 0x4d4, 0x2d4, 0x6d4, 0x1d4, 0x5d4, 0x3d4,
+  0x7d4, 0x34, 0x434, 0x234, 0x634, 0x134, 0x534,
+  0x334, 0x734, 0xb4, 0x4b4, 0x2b4, 0x6b4, 0x1b4,
+  0x5b4, 0x3b4, 0x7b4, 0x74, 0x474, 0x274, 0x674,
+  0x174, 0x574, 0x374, 0x774, 0xf4, 0x4f4, 0x2f4,
+  0x6f4, 0x1f4, 0x5f4, 0x3f4, 0x7f4, 0xc, 0x40c,
+  0x20c, 0x60c, 0x10c, 0x50c, 0x30c, 0x70c, 0x8c,
+  0x48c, 0x28c, 0x68c, 0x18c, 0x58c, 0x38c, 0x78c,
+  0x4c, 0x44c, 0x24c, 0x64c, 0x14c, 0x54c, 0x34c,
+  0x74c, 0xcc, 0x4cc, 0x2cc, 0x6cc, 0x1cc, 0x5cc,
+  0x3cc, 0x7cc, 0x2c, 0x42c, 0x22c, 0x62c, 0x12c,
+  0x52c, 0x32c, 0x72c, 0xac, 0x4ac, 0x2ac, 0x6ac,
+  0x1ac, 0x5ac, 0x3ac, 0x7ac, 0x6c, 0x46c, 0x26c,
+  0x66c, 0x16c, 0x56c, 0x36c, 0x76c, 0xec, 0x4ec,
+  0x2ec, 0x6ec, 0x1ec, 0x5ec, 0x3ec, 0x7ec, 0x1c,
+  0x41c, 0x21c, 0x61c, 0x11c, 0x51c, 0x31c, 0x71c,
+  0x9c, 0x49c, 0x29c, 0x69c, 0x19c, 0x59c, 0x39c,
+  0x79c, 0x5c, 0x45c, 0x25c, 0x65c, 0x15c, 0x55c,
+  0x35c, 0x75c, 0xdc, 0x4dc, 0x2dc, 0x6dc, 0x1dc,
+  0x5dc, 0x3dc, 0x7dc, 0x3c, 0x43c, 0x23c, 0x63c,
+  0x13c, 0x53c, 0x33c, 0x73c, 0xbc, 0x4bc, 0x2bc,
+  0x6bc, 0x1bc, 0x5bc, 0x3bc, 0x7bc, 0x7c, 0x47c,
+  0x27c, 0x67c, 0x17c, 0x57c, 0x37c, 0x77c, 0xfc,
+  0x4fc, 0x2fc, 0x6fc, 0x1fc, 0x5fc, 0x3fc, 0x7fc,
+  0x2, 0x402, 0x202, 0x602, 0x102, 0x502, 0x302,
+  0x702, 0x82, 0x482, 0x282, 0x682, 0x182, 0x582,
+  0x382, 0x782, 0x42, 0x442, 0x242, 0x642, 0x142,
+  0x542, 0x342, 0x742, 0xc2, 0x4c2, 0x2c2, 0x6c2,
+  0x1c2, 0x5c2, 0x3c2, 0x7c2, 0x22, 0x422, 0x222,
+  0x622, 0x122, 0x522, 0x322, 0x722, 0xa2, 0x4a2,
+  0x2a2, 0x6a2, 0x1a2, 0x5a2, 0x3a2, 0x7a2, 0x62,
+  0x462, 0x262, 0x662, 0x162, 0x562, 0x362, 0x762,
+  0xe2, 0x4e2, 0x2e2, 0x6e2, 0x1e2, 0x5e2, 0x3e2,
+  0x7e2, 0x12, 0x412, 0x212, 0x612, 0x112, 0x512,
+  0x312, 0x712, 0x92, 0x492, 0x292, 0x692, 0x192,
+  0x592, 0x392, 0x792, 0x52, 0x452, 0x252, 0x652,
+  0x152, 0x552, 0x352, 0x752, 0xd2, 0x4d2, 0x2d2,
+  0x6d2, 0x1d2, 0x5d2, 0x3d2, 0x7d2, 0x32, 0x432,
+  0x232, 0x632, 0x132, 0x532, 0x332, 0x732, 0xb2,
+  0x4b2, 0x2b2, 0x6b2, 0x1b2, 0x5b2, 0x3b2, 0x7b2,
+  0x72, 0x472, 0x272, 0x672, 0x172, 0x572, 0x372,
+  0x772, 0xf2, 0x4f2, 0x2f2, 0x6f2, 0x1f2, 0x5f2,
+  0x3f2, 0x7f2, 0xa, 0x40a, 0x20a, 0x60a, 0x10a,
+  0x50a, 0x30a, 0x70a, 0x8a, 0x48a, 0x28a, 0x68a,
+  0x18a, 0x58a, 0x38a, 0x78a, 0x4a, 0x44a, 0x24a,
+  0x64a, 0x14a, 0x54a, 0x34a, 0x74a, 0xca, 0x4ca,
+  0x2ca, 0x6ca, 0x1ca, 0x5ca, 0x3ca, 0x7ca, 0x2a,
+  0x42a, 0x22a, 0x62a, 0x12a, 0x52a, 0x32a, 0x72a,
+  0xaa, 0x4aa, 0x2aa, 0x6aa, 0x1aa, 0x5aa, 0x3aa,
+  0x7aa, 0x6a, 0x46a, 0x26a, 0x66a, 0x16a, 0x56a,
+  0x36a, 0x76a, 0xea, 0x4ea, 0x2ea, 0x6ea, 0x1ea,
+  0x5ea, 0x3ea, 0x7ea, 0x1a, 0x41a, 0x21a, 0x61a,
+  0x11a, 0x51a, 0x31a, 0x71a, 0x9a, 0x49a, 0x29a,
+  0x69a, 0x19a, 0x59a, 0x39a, 0x79a, 0x5a, 0x45a,
+  0x25a, 0x65a, 0x15a, 0x55a, 0x35a, 0x75a, 0xda,
+  0x4da, 0x2da, 0x6da, 0x1da, 0x5da, 0x3da, 0x7da,
+  0x3a, 0x43a, 0x23a, 0x63a, 0x13a, 0x53a, 0x33a,
+  0x73a, 0xba, 0x4ba, 0x2ba, 0x6ba, 0x1ba, 0x5ba,
+  0x3ba, 0x7ba, 0x7a, 0x47a, 0x27a, 0x67a, 0x17a,
+  0x57a, 0x37a, 0x77a, 0xfa, 0x4fa, 0x2fa, 0x6fa,
+  0x1fa, 0x5fa, 0x3fa, 0x7fa, 0x6, 0x406, 0x206,
+  0x606, 0x106, 0x506, 0x306, 0x706, 0x86, 0x486,
+  0x286, 0x686, 0x186, 0x586, 0x386, 0x786, 0x46,
+  0x446, 0x246, 0x646, 0x146, 0x546, 0x346, 0x746,
+  0xc6, 0x4c6, 0x2c6, 0x6c6, 0x1c6, 0x5c6, 0x3c6,
+  0x7c6, 0x26, 0x426, 0x226, 0x626, 0x126, 0x526,
+  0x326, 0x726, 0xa6, 0x4a6, 0x2a6, 0x6a6, 0x1a6,
+  0x5a6, 0x3a6, 0x7a6, 0x66, 0x466, 0x266, 0x666,
+  0x166, 0x566, 0x366, 0x766, 0xe6, 0x4e6, 0x2e6,
+  0x6e6, 0x1e6, 0x5e6, 0x3e6, 0x7e6, 0x16, 0x416,
+  0x216, 0x616, 0x116, 0x516, 0x316, 0x716, 0x96,
+  0x496, 0x296, 0x696, 0x196, 0x596, 0x396, 0x796,
+  0x56, 0x456, 0x256, 0x656, 0x156, 0x556, 0x356,
+  0x756, 0xd6, 0x4d6, 0x2d6, 0x6d6, 0x1d6, 0x5d6,
+  0x3d6, 0x7d6, 0x36, 0x436, 0x236, 0x636, 0x136,
+  0x536, 0x336, 0x736, 0xb6, 0x4b6, 0x2b6, 0x6b6,
+  0x1b6, 0x5b6, 0x3b6, 0x7b6, 0x76, 0x476, 0x276,
+  0x676, 0x176, 0x576, 0x376, 0x776, 0xf6, 0x4f6,
+  0x2f6, 0x6f6, 0x1f6, 0x5f6, 0x3f6, 0x7f6, 0xe,
+  0x40e, 0x20e, 0x60e, 0x10e, 0x50e, 0x30e, 0x70e,
+  0x8e, 0x48e, 0x28e, 0x68e, 0x18e, 0x58e, 0x38e,
+  0x78e, 0x4e, 0x44e, 0x24e, 0x64e, 0x14e, 0x54e,
+  0x34e, 0x74e, 0xce, 0x4ce, 0x2ce, 0x6ce, 0x1ce,
+  0x5ce, 0x3ce, 0x7ce, 0x2e, 0x42e, 0x22e, 0x62e,
+  0x12e, 0x52e, 0x32e, 0x72e, 0xae, 0x4ae, 0x2ae,
+  0x6ae, 0x1ae, 0x5ae, 0x3ae, 0x7ae, 0x6e, 0x46e,
+  0x26e, 0x66e, 0x16e, 0x56e, 0x36e, 0x76e, 0xee,
+  0x4ee, 0x2ee, 0x6ee, 0x1ee, 0x5ee, 0x3ee, 0x7ee,
+  0x1e, 0x41e, 0x21e, 0x61e, 0x11e, 0x51e, 0x31e,
+  0x71e, 0x9e, 0x49e, 0x29e, 0x69e, 0x19e, 0x59e,
+  0x39e, 0x79e, 0x5e, 0x45e, 0x25e, 0x65e, 0x15e,
+  0x55e, 0x35e, 0x75e, 0xde, 0x4de, 0x2de, 0x6de,
+  0x1de, 0x5de, 0x3de, 0x7de, 0x3e, 0x43e, 0x23e,
+  0x63e, 0x13e, 0x53e, 0x33e, 0x73e, 0xbe, 0x4be,
+  0x2be, 0x6be, 0x1be, 0x5be, 0x3be, 0x7be, 0x7e,
+  0x47e, 0x27e, 0x67e, 0x17e, 0x57e, 0x37e, 0x77e,
+  0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe, 0x5fe, 0x3fe,
+  0x7fe, 0x1
 };
 
+/**   
+* \par   
+* Example code for Floating-point Twiddle factors Generation:   
+* \par   
+* <pre>for(i = 0; i< N; i++)   
+* {   
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);   
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);   
+* } </pre>   
+* \par   
+* where N = 4096	and PI = 3.14159265358979   
+* \par   
+* Cos and Sin values are in interleaved fashion   
+*    
+*/
+
+/*   
+* @brief  Floating-point twiddle factor table shared by the complex FFTs   
+*/
+const float32_t twiddleCoef[8192] = {
+  1.000000000000000000f, 0.000000000000000000f,
+  0.999998823451701879f, 0.001533980186284766f,
+  0.999995293809576191f, 0.003067956762965976f,
+  0.999989411081928403f, 0.004601926120448570f,
+  0.999981175282601109f, 0.006135884649154475f,
+  0.999970586430974140f, 0.007669828739531097f,
+  0.999957644551963898f, 0.009203754782059819f,
+  0.999942349676023912f, 0.010737659167264491f,
+  0.999924701839144503f, 0.012271538285719925f,
+  0.999904701082852898f, 0.013805388528060391f,
+  0.999882347454212561f, 0.015339206284988100f,
+  0.999857641005823861f, 0.016872987947281710f,
+  0.999830581795823403f, 0.018406729905804820f,
+  0.999801169887884256f, 0.019940428551514441f,
+  0.999769405351215279f, 0.021474080275469508f,
+  0.999735288260561683f, 0.023007681468839369f,
+  0.999698818696204250f, 0.024541228522912288f,
+  0.999659996743959223f, 0.026074717829103901f,
+  0.999618822495178638f, 0.027608145778965740f,
+  0.999575296046749218f, 0.029141508764193722f,
+  0.999529417501093143f, 0.030674803176636626f,
+  0.999481186966166946f, 0.032208025408304586f,
+  0.999430604555461732f, 0.033741171851377580f,
+  0.999377670388002848f, 0.035274238898213947f,
+  0.999322384588349544f, 0.036807222941358832f,
+  0.999264747286594424f, 0.038340120373552694f,
+  0.999204758618363886f, 0.039872927587739811f,
+  0.999142418724816905f, 0.041405640977076739f,
+  0.999077727752645361f, 0.042938256934940820f,
+  0.999010685854073377f, 0.044470771854938668f,
+  0.998941293186856871f, 0.046003182130914623f,
+  0.998869549914283561f, 0.047535484156959303f,
+  0.998795456205172405f, 0.049067674327418015f,
+  0.998719012233872938f, 0.050599749036899282f,
+  0.998640218180265271f, 0.052131704680283324f,
+  0.998559074229759314f, 0.053663537652730520f,
+  0.998475580573294774f, 0.055195244349689934f,
+  0.998389737407340161f, 0.056726821166907748f,
+  0.998301544933892893f, 0.058258264500435752f,
+  0.998211003360478188f, 0.059789570746639868f,
+  0.998118112900149179f, 0.061320736302208578f,
+  0.998022873771486241f, 0.062851757564161406f,
+  0.997925286198595995f, 0.064382630929857465f,
+  0.997825350411111645f, 0.065913352797003805f,
+  0.997723066644191636f, 0.067443919563664051f,
+  0.997618435138519555f, 0.068974327628266746f,
+  0.997511456140303454f, 0.070504573389613856f,
+  0.997402129901275303f, 0.072034653246889332f,
+  0.997290456678690207f, 0.073564563599667426f,
+  0.997176436735326188f, 0.075094300847921305f,
+  0.997060070339482962f, 0.076623861392031492f,
+  0.996941357764982161f, 0.078153241632794232f,
+  0.996820299291165668f, 0.079682437971430126f,
+  0.996696895202896060f, 0.081211446809592441f,
+  0.996571145790554835f, 0.082740264549375692f,
+  0.996443051350042630f, 0.084268887593324071f,
+  0.996312612182778001f, 0.085797312344439894f,
+  0.996179828595696981f, 0.087325535206192059f,
+  0.996044700901251967f, 0.088853552582524600f,
+  0.995907229417411721f, 0.090381360877864983f,
+  0.995767414467659817f, 0.091908956497132724f,
+  0.995625256380994306f, 0.093436335845747787f,
+  0.995480755491926939f, 0.094963495329638992f,
+  0.995333912140482280f, 0.096490431355252593f,
+  0.995184726672196929f, 0.098017140329560604f,
+  0.995033199438118632f, 0.099543618660069319f,
+  0.994879330794805616f, 0.101069862754827822f,
+  0.994723121104325703f, 0.102595869022436281f,
+  0.994564570734255415f, 0.104121633872054586f,
+  0.994403680057679096f, 0.105647153713410616f,
+  0.994240449453187902f, 0.107172424956808843f,
+  0.994074879304879366f, 0.108697444013138717f,
+  0.993906970002356061f, 0.110222207293883059f,
+  0.993736721940724599f, 0.111746711211126587f,
+  0.993564135520595304f, 0.113270952177564346f,
+  0.993389211148080653f, 0.114794926606510084f,
+  0.993211949234794500f, 0.116318630911904752f,
+  0.993032350197851410f, 0.117842061508324977f,
+  0.992850414459865105f, 0.119365214810991355f,
+  0.992666142448948019f, 0.120888087235777084f,
+  0.992479534598709967f, 0.122410675199216196f,
+  0.992290591348257367f, 0.123932975118512159f,
+  0.992099313142191797f, 0.125454983411546234f,
+  0.991905700430609327f, 0.126976696496885866f,
+  0.991709753669099525f, 0.128498110793793169f,
+  0.991511473318743897f, 0.130019222722233346f,
+  0.991310859846115444f, 0.131540028702883116f,
+  0.991107913723276890f, 0.133060525157139065f,
+  0.990902635427780010f, 0.134580708507126168f,
+  0.990695025442664634f, 0.136100575175706201f,
+  0.990485084256457093f, 0.137620121586486038f,
+  0.990272812363169108f, 0.139139344163826201f,
+  0.990058210262297123f, 0.140658239332849211f,
+  0.989841278458820528f, 0.142176803519448031f,
+  0.989622017463200887f, 0.143695033150294471f,
+  0.989400427791380377f, 0.145212924652847464f,
+  0.989176509964781014f, 0.146730474455361748f,
+  0.988950264510302990f, 0.148247678986896031f,
+  0.988721691960323779f, 0.149764534677321509f,
+  0.988490792852696587f, 0.151281037957330222f,
+  0.988257567730749464f, 0.152797185258443435f,
+  0.988022017143283526f, 0.154312973013020105f,
+  0.987784141644572178f, 0.155828397654265233f,
+  0.987543941794359226f, 0.157343455616238248f,
+  0.987301418157858435f, 0.158858143333861446f,
+  0.987056571305750974f, 0.160372457242928285f,
+  0.986809401814185527f, 0.161886393780111826f,
+  0.986559910264775408f, 0.163399949382973225f,
+  0.986308097244598669f, 0.164913120489969922f,
+  0.986053963346195439f, 0.166425903540464104f,
+  0.985797509167567476f, 0.167938294974731173f,
+  0.985538735312176062f, 0.169450291233967959f,
+  0.985277642388941222f, 0.170961888760301217f,
+  0.985014231012239838f, 0.172473083996795951f,
+  0.984748501801904208f, 0.173983873387463822f,
+  0.984480455383220932f, 0.175494253377271425f,
+  0.984210092386929025f, 0.177004220412148749f,
+  0.983937413449218923f, 0.178513770938997507f,
+  0.983662419211730255f, 0.180022901405699515f,
+  0.983385110321551181f, 0.181531608261124966f,
+  0.983105487431216285f, 0.183039887955140951f,
+  0.982823551198705236f, 0.184547736938619616f,
+  0.982539302287441241f, 0.186055151663446633f,
+  0.982252741366289372f, 0.187562128582529603f,
+  0.981963869109555243f, 0.189068664149806193f,
+  0.981672686196983113f, 0.190574754820252740f,
+  0.981379193313754561f, 0.192080397049892437f,
+  0.981083391150486706f, 0.193585587295803607f,
+  0.980785280403230431f, 0.195090322016128248f,
+  0.980484861773469385f, 0.196594597670080223f,
+  0.980182135968117429f, 0.198098410717953560f,
+  0.979877103699517638f, 0.199601757621130971f,
+  0.979569765685440519f, 0.201104634842091901f,
+  0.979260122649082021f, 0.202607038844421133f,
+  0.978948175319062197f, 0.204108966092816868f,
+  0.978633924429423208f, 0.205610413053099239f,
+  0.978317370719627655f, 0.207111376192218560f,
+  0.977998514934557139f, 0.208611851978263485f,
+  0.977677357824509929f, 0.210111836880469610f,
+  0.977353900145199961f, 0.211611327369227553f,
+  0.977028142657754395f, 0.213110319916091362f,
+  0.976700086128711842f, 0.214608810993786758f,
+  0.976369731330021140f, 0.216106797076219520f,
+  0.976037079039039024f, 0.217604274638483641f,
+  0.975702130038528570f, 0.219101240156869798f,
+  0.975364885116656977f, 0.220597690108873506f,
+  0.975025345066994120f, 0.222093620973203509f,
+  0.974683510688510668f, 0.223589029229789987f,
+  0.974339382785575858f, 0.225083911359792832f,
+  0.973992962167955834f, 0.226578263845610001f,
+  0.973644249650811977f, 0.228072083170885731f,
+  0.973293246054698247f, 0.229565365820518869f,
+  0.972939952205560177f, 0.231058108280671110f,
+  0.972584368934732213f, 0.232550307038775245f,
+  0.972226497078936269f, 0.234041958583543430f,
+  0.971866337480279396f, 0.235533059404975487f,
+  0.971503890986251784f, 0.237023605994367198f,
+  0.971139158449725093f, 0.238513594844318416f,
+  0.970772140728950350f, 0.240003022448741499f,
+  0.970402838687555502f, 0.241491885302869330f,
+  0.970031253194543974f, 0.242980179903263871f,
+  0.969657385124292448f, 0.244467902747824151f,
+  0.969281235356548532f, 0.245955050335794595f,
+  0.968902804776428872f, 0.247441619167773269f,
+  0.968522094274417378f, 0.248927605745720149f,
+  0.968139104746362444f, 0.250413006572965224f,
+  0.967753837093475511f, 0.251897818154216968f,
+  0.967366292222328505f, 0.253382036995570159f,
+  0.966976471044852071f, 0.254865659604514572f,
+  0.966584374478333119f, 0.256348682489942914f,
+  0.966190003445412504f, 0.257831102162158987f,
+  0.965793358874083685f, 0.259312915132886235f,
+  0.965394441697689398f, 0.260794117915275514f,
+  0.964993252854920325f, 0.262274707023913589f,
+  0.964589793289812758f, 0.263754678974831347f,
+  0.964184063951745829f, 0.265234030285511790f,
+  0.963776065795439840f, 0.266712757474898365f,
+  0.963365799780954046f, 0.268190857063403176f,
+  0.962953266873683877f, 0.269668325572915091f,
+  0.962538468044359163f, 0.271145159526808011f,
+  0.962121404269041580f, 0.272621355449948977f,
+  0.961702076529122540f, 0.274096909868706384f,
+  0.961280485811320640f, 0.275571819310958144f,
+  0.960856633107679659f, 0.277046080306099896f,
+  0.960430519415565787f, 0.278519689385053060f,
+  0.960002145737665957f, 0.279992643080273218f,
+  0.959571513081984517f, 0.281464937925757941f,
+  0.959138622461841894f, 0.282936570457055392f,
+  0.958703474895871599f, 0.284407537211271877f,
+  0.958266071408017672f, 0.285877834727080615f,
+  0.957826413027532908f, 0.287347459544729511f,
+  0.957384500788975856f, 0.288816408206049480f,
+  0.956940335732208824f, 0.290284677254462331f,
+  0.956493918902395102f, 0.291752263234989262f,
+  0.956045251349996406f, 0.293219162694258628f,
+  0.955594334130771106f, 0.294685372180514327f,
+  0.955141168305770782f, 0.296150888243623789f,
+  0.954685754941338338f, 0.297615707435086196f,
+  0.954228095109105667f, 0.299079826308040475f,
+  0.953768189885990325f, 0.300543241417273455f,
+  0.953306040354193862f, 0.302005949319228084f,
+  0.952841647601198716f, 0.303467946572011316f,
+  0.952375012719765879f, 0.304929229735402374f,
+  0.951906136807932346f, 0.306389795370860918f,
+  0.951435020969008338f, 0.307849640041534867f,
+  0.950961666311575082f, 0.309308760312268727f,
+  0.950486073949481702f, 0.310767152749611475f,
+  0.950008245001842999f, 0.312224813921824884f,
+  0.949528180593036675f, 0.313681740398891518f,
+  0.949045881852700557f, 0.315137928752522445f,
+  0.948561349915730267f, 0.316593375556165846f,
+  0.948074585922276225f, 0.318048077385014949f,
+  0.947585591017741091f, 0.319502030816015692f,
+  0.947094366352777217f, 0.320955232427875214f,
+  0.946600913083283535f, 0.322407678801069852f,
+  0.946105232370403448f, 0.323859366517852854f,
+  0.945607325380521280f, 0.325310292162262926f,
+  0.945107193285260605f, 0.326760452320131733f,
+  0.944604837261480257f, 0.328209843579092497f,
+  0.944100258491272659f, 0.329658462528587493f,
+  0.943593458161960386f, 0.331106305759876429f,
+  0.943084437466093495f, 0.332553369866044224f,
+  0.942573197601446866f, 0.333999651442009382f,
+  0.942059739771017313f, 0.335445147084531603f,
+  0.941544065183020806f, 0.336889853392220051f,
+  0.941026175050889258f, 0.338333766965541127f,
+  0.940506070593268295f, 0.339776884406826851f,
+  0.939983753034014047f, 0.341219202320282355f,
+  0.939459223602189919f, 0.342660717311994378f,
+  0.938932483532064599f, 0.344101425989938814f,
+  0.938403534063108058f, 0.345541324963989094f,
+  0.937872376439989885f, 0.346980410845923681f,
+  0.937339011912574960f, 0.348418680249434565f,
+  0.936803441735921560f, 0.349856129790134918f,
+  0.936265667170278260f, 0.351292756085567093f,
+  0.935725689481080369f, 0.352728555755210726f,
+  0.935183509938947610f, 0.354163525420490344f,
+  0.934639129819680781f, 0.355597661704783852f,
+  0.934092550404258981f, 0.357030961233429978f,
+  0.933543772978836173f, 0.358463420633736540f,
+  0.932992798834738957f, 0.359895036534988111f,
+  0.932439629268462356f, 0.361325805568454284f,
+  0.931884265581668148f, 0.362755724367397225f,
+  0.931326709081180426f, 0.364184789567079892f,
+  0.930766961078983712f, 0.365612997804773854f,
+  0.930205022892219069f, 0.367040345719767180f,
+  0.929640895843181325f, 0.368466829953372321f,
+  0.929074581259315857f, 0.369892447148934100f,
+  0.928506080473215589f, 0.371317193951837543f,
+  0.927935394822617887f, 0.372741067009515759f,
+  0.927362525650401115f, 0.374164062971457934f,
+  0.926787474304581749f, 0.375586178489217215f,
+  0.926210242138311379f, 0.377007410216418259f,
+  0.925630830509872715f, 0.378427754808765560f,
+  0.925049240782677584f, 0.379847208924051161f,
+  0.924465474325262604f, 0.381265769222162376f,
+  0.923879532511286738f, 0.382683432365089782f,
+  0.923291416719527636f, 0.384100195016935042f,
+  0.922701128333878628f, 0.385516053843918849f,
+  0.922108668743345183f, 0.386931005514388582f,
+  0.921514039342042013f, 0.388345046698826246f,
+  0.920917241529189523f, 0.389758174069856411f,
+  0.920318276709110594f, 0.391170384302253871f,
+  0.919717146291227361f, 0.392581674072951470f,
+  0.919113851690057770f, 0.393992040061048099f,
+  0.918508394325212252f, 0.395401478947816354f,
+  0.917900775621390497f, 0.396809987416710308f,
+  0.917290997008377906f, 0.398217562153373561f,
+  0.916679059921042705f, 0.399624199845646788f,
+  0.916064965799331721f, 0.401029897183575623f,
+  0.915448716088267833f, 0.402434650859418430f,
+  0.914830312237946197f, 0.403838457567654074f,
+  0.914209755703530691f, 0.405241314004989861f,
+  0.913587047945250808f, 0.406643216870369029f,
+  0.912962190428398213f, 0.408044162864978688f,
+  0.912335184623322748f, 0.409444148692257592f,
+  0.911706032005429878f, 0.410843171057903911f,
+  0.911074734055176361f, 0.412241226669882888f,
+  0.910441292258067247f, 0.413638312238434502f,
+  0.909805708104652222f, 0.415034424476081631f,
+  0.909167983090522380f, 0.416429560097637153f,
+  0.908528118716306121f, 0.417823715820212271f,
+  0.907886116487666261f, 0.419216888363223905f,
+  0.907241977915295816f, 0.420609074448402509f,
+  0.906595704514915335f, 0.422000270799799682f,
+  0.905947297807268459f, 0.423390474143796047f,
+  0.905296759318118816f, 0.424779681209108806f,
+  0.904644090578246240f, 0.426167888726799615f,
+  0.903989293123443338f, 0.427555093430282085f,
+  0.903332368494511817f, 0.428941292055329493f,
+  0.902673318237258826f, 0.430326481340082612f,
+  0.902012143902493180f, 0.431710658025057259f,
+  0.901348847046022028f, 0.433093818853151957f,
+  0.900683429228646970f, 0.434475960569655650f,
+  0.900015892016160279f, 0.435857079922255475f,
+  0.899346236979341573f, 0.437237173661044087f,
+  0.898674465693953817f, 0.438616238538527659f,
+  0.898000579740739879f, 0.439994271309633256f,
+  0.897324580705418318f, 0.441371268731716671f,
+  0.896646470178680155f, 0.442747227564570023f,
+  0.895966249756185218f, 0.444122144570429200f,
+  0.895283921038557584f, 0.445496016513981741f,
+  0.894599485631382696f, 0.446868840162374159f,
+  0.893912945145203253f, 0.448240612285219886f,
+  0.893224301195515324f, 0.449611329654606540f,
+  0.892533555402764578f, 0.450980989045103864f,
+  0.891840709392342723f, 0.452349587233770889f,
+  0.891145764794583184f, 0.453717121000163870f,
+  0.890448723244757878f, 0.455083587126343836f,
+  0.889749586383072777f, 0.456448982396883918f,
+  0.889048355854664574f, 0.457813303598877175f,
+  0.888345033309596355f, 0.459176547521944090f,
+  0.887639620402853935f, 0.460538710958240005f,
+  0.886932118794342195f, 0.461899790702462731f,
+  0.886222530148880638f, 0.463259783551860149f,
+  0.885510856136199953f, 0.464618686306237816f,
+  0.884797098430937790f, 0.465976495767966181f,
+  0.884081258712634988f, 0.467333208741988415f,
+  0.883363338665731579f, 0.468688822035827901f,
+  0.882643339979562791f, 0.470043332459595620f,
+  0.881921264348355050f, 0.471396736825997642f,
+  0.881197113471222093f, 0.472749031950342791f,
+  0.880470889052160754f, 0.474100214650549967f,
+  0.879742592800047407f, 0.475450281747155867f,
+  0.879012226428633525f, 0.476799230063322088f,
+  0.878279791656541575f, 0.478147056424843009f,
+  0.877545290207261353f, 0.479493757660153008f,
+  0.876808723809145651f, 0.480839330600333958f,
+  0.876070094195406601f, 0.482183772079122719f,
+  0.875329403104110892f, 0.483527078932918741f,
+  0.874586652278176113f, 0.484869248000791064f,
+  0.873841843465366863f, 0.486210276124486418f,
+  0.873094978418290091f, 0.487550160148435996f,
+  0.872346058894391541f, 0.488888896919763172f,
+  0.871595086655950979f, 0.490226483288291159f,
+  0.870842063470078975f, 0.491562916106549896f,
+  0.870086991108711461f, 0.492898192229784038f,
+  0.869329871348606842f, 0.494232308515959673f,
+  0.868570705971340895f, 0.495565261825772541f,
+  0.867809496763303323f, 0.496897049022654469f,
+  0.867046245515692648f, 0.498227666972781869f,
+  0.866280954024512995f, 0.499557112545081838f,
+  0.865513624090569089f, 0.500885382611240715f,
+  0.864744257519462378f, 0.502212474045710788f,
+  0.863972856121586807f, 0.503538383725717575f,
+  0.863199421712124160f, 0.504863108531267590f,
+  0.862423956111040613f, 0.506186645345155228f,
+  0.861646461143081299f, 0.507508991052970870f,
+  0.860866938637767309f, 0.508830142543106989f,
+  0.860085390429390140f, 0.510150096706766809f,
+  0.859301818357008473f, 0.511468850437970302f,
+  0.858516224264442740f, 0.512786400633562955f,
+  0.857728610000272118f, 0.514102744193221661f,
+  0.856938977417828762f, 0.515417878019462927f,
+  0.856147328375194472f, 0.516731799017649873f,
+  0.855353664735196029f, 0.518044504095999336f,
+  0.854557988365400534f, 0.519355990165589643f,
+  0.853760301138111410f, 0.520666254140367157f,
+  0.852960604930363631f, 0.521975292937154389f,
+  0.852158901623919829f, 0.523283103475656430f,
+  0.851355193105265196f, 0.524589682678468949f,
+  0.850549481265603480f, 0.525895027471084631f,
+  0.849741768000852549f, 0.527199134781901280f,
+  0.848932055211639613f, 0.528502001542228483f,
+  0.848120344803297233f, 0.529803624686294605f,
+  0.847306638685858315f, 0.531104001151255001f,
+  0.846490938774052126f, 0.532403127877197901f,
+  0.845673246987299065f, 0.533701001807152964f,
+  0.844853565249707117f, 0.534997619887097153f,
+  0.844031895490066408f, 0.536292979065963182f,
+  0.843208239641845436f, 0.537587076295645394f,
+  0.842382599643185848f, 0.538879908531008422f,
+  0.841554977436898444f, 0.540171472729892854f,
+  0.840725374970458073f, 0.541461765853123445f,
+  0.839893794195999521f, 0.542750784864515889f,
+  0.839060237070312742f, 0.544038526730883820f,
+  0.838224705554838079f, 0.545324988422046464f,
+  0.837387201615661936f, 0.546610166910834860f,
+  0.836547727223512005f, 0.547894059173100190f,
+  0.835706284353752604f, 0.549176662187719655f,
+  0.834862874986380010f, 0.550457972936604811f,
+  0.834017501106018133f, 0.551737988404707336f,
+  0.833170164701913185f, 0.553016705580027468f,
+  0.832320867767929684f, 0.554294121453620003f,
+  0.831469612302545236f, 0.555570233019602178f,
+  0.830616400308846314f, 0.556845037275160104f,
+  0.829761233794523045f, 0.558118531220556102f,
+  0.828904114771864875f, 0.559390711859136136f,
+  0.828045045257755796f, 0.560661576197336031f,
+  0.827184027273669131f, 0.561931121244689469f,
+  0.826321062845663534f, 0.563199344013834091f,
+  0.825456154004377551f, 0.564466241520519496f,
+  0.824589302785025291f, 0.565731810783613120f,
+  0.823720511227391428f, 0.566996048825108678f,
+  0.822849781375826428f, 0.568258952670131490f,
+  0.821977115279241555f, 0.569520519346947141f,
+  0.821102514991104648f, 0.570780745886967256f,
+  0.820225982569434686f, 0.572039629324757049f,
+  0.819347520076796898f, 0.573297166698042204f,
+  0.818467129580298658f, 0.574553355047715764f,
+  0.817584813151583711f, 0.575808191417845339f,
+  0.816700572866827845f, 0.577061672855679442f,
+  0.815814410806733781f, 0.578313796411655590f,
+  0.814926329056526622f, 0.579564559139405633f,
+  0.814036329705948414f, 0.580813958095764526f,
+  0.813144414849253594f, 0.582061990340775437f,
+  0.812250586585203882f, 0.583308652937698291f,
+  0.811354847017063729f, 0.584553942953015326f,
+  0.810457198252594768f, 0.585797857456438864f,
+  0.809557642404051259f, 0.587040393520917969f,
+  0.808656181588174983f, 0.588281548222645223f,
+  0.807752817926190358f, 0.589521318641063941f,
+  0.806847553543799334f, 0.590759701858874164f,
+  0.805940390571176279f, 0.591996694962040992f,
+  0.805031331142963658f, 0.593232295039799795f,
+  0.804120377398265807f, 0.594466499184664432f,
+  0.803207531480644943f, 0.595699304492433357f,
+  0.802292795538115722f, 0.596930708062196502f,
+  0.801376171723140240f, 0.598160706996342273f,
+  0.800457662192622821f, 0.599389298400564541f,
+  0.799537269107905013f, 0.600616479383868973f,
+  0.798614994634760822f, 0.601842247058580027f,
+  0.797690840943391155f, 0.603066598540348164f,
+  0.796764810208418828f, 0.604289530948155962f,
+  0.795836904608883566f, 0.605511041404325545f,
+  0.794907126328237013f, 0.606731127034524476f,
+  0.793975477554337172f, 0.607949784967773632f,
+  0.793041960479443642f, 0.609167012336453206f,
+  0.792106577300212389f, 0.610382806276309475f,
+  0.791169330217690203f, 0.611597163926461906f,
+  0.790230221437310032f, 0.612810082429409708f,
+  0.789289253168885652f, 0.614021558931038380f,
+  0.788346427626606339f, 0.615231590580626819f,
+  0.787401747029031429f, 0.616440174530853646f,
+  0.786455213599085767f, 0.617647307937803869f,
+  0.785506829564053932f, 0.618852987960976320f,
+  0.784556597155575242f, 0.620057211763289096f,
+  0.783604518609638201f, 0.621259976511087553f,
+  0.782650596166575729f, 0.622461279374149967f,
+  0.781694832071059387f, 0.623661117525694531f,
+  0.780737228572094488f, 0.624859488142386343f,
+  0.779777787923014554f, 0.626056388404343522f,
+  0.778816512381475978f, 0.627251815495144083f,
+  0.777853404209453148f, 0.628445766601832712f,
+  0.776888465673232442f, 0.629638238914926984f,
+  0.775921699043407687f, 0.630829229628424470f,
+  0.774953106594873931f, 0.632018735939809062f,
+  0.773982690606822898f, 0.633206755050057191f,
+  0.773010453362736993f, 0.634393284163645488f,
+  0.772036397150384524f, 0.635578320488556114f,
+  0.771060524261813818f, 0.636761861236284199f,
+  0.770082836993347897f, 0.637943903621844055f,
+  0.769103337645579699f, 0.639124444863775731f,
+  0.768122028523365419f, 0.640303482184151673f,
+  0.767138911935820400f, 0.641481012808583162f,
+  0.766153990196312917f, 0.642657033966226865f,
+  0.765167265622458959f, 0.643831542889791386f,
+  0.764178740536116674f, 0.645004536815543927f,
+  0.763188417263381269f, 0.646176012983316284f,
+  0.762196298134578898f, 0.647345968636512059f,
+  0.761202385484261779f, 0.648514401022112441f,
+  0.760206681651202421f, 0.649681307390683194f,
+  0.759209188978388072f, 0.650846684996380875f,
+  0.758209909813015281f, 0.652010531096959500f,
+  0.757208846506484567f, 0.653172842953776756f,
+  0.756206001414394535f, 0.654333617831800440f,
+  0.755201376896536547f, 0.655492852999615350f,
+  0.754194975316889171f, 0.656650545729428936f,
+  0.753186799043612520f, 0.657806693297078637f,
+  0.752176850449042811f, 0.658961292982037317f,
+  0.751165131909686479f, 0.660114342067420479f,
+  0.750151645806215073f, 0.661265837839992265f,
+  0.749136394523459370f, 0.662415777590171784f,
+  0.748119380450403604f, 0.663564158612039767f,
+  0.747100605980180132f, 0.664710978203344793f,
+  0.746080073510063779f, 0.665856233665509722f,
+  0.745057785441466058f, 0.666999922303637471f,
+  0.744033744179929291f, 0.668142041426518452f,
+  0.743007952135121719f, 0.669282588346636009f,
+  0.741980411720831068f, 0.670421560380173087f,
+  0.740951125354959106f, 0.671558954847018330f,
+  0.739920095459516203f, 0.672694769070772858f,
+  0.738887324460615114f, 0.673829000378756038f,
+  0.737852814788465983f, 0.674961646102011925f,
+  0.736816568877369904f, 0.676092703575315923f,
+  0.735778589165713592f, 0.677222170137180335f,
+  0.734738878095963499f, 0.678350043129861469f,
+  0.733697438114660372f, 0.679476319899364967f,
+  0.732654271672412816f, 0.680600997795453022f,
+  0.731609381223892630f, 0.681724074171649708f,
+  0.730562769227827591f, 0.682845546385248081f,
+  0.729514438146997013f, 0.683965411797315403f,
+  0.728464390448225196f, 0.685083667772700355f,
+  0.727412628602375766f, 0.686200311680038588f,
+  0.726359155084346009f, 0.687315340891759052f,
+  0.725303972373060768f, 0.688428752784090436f,
+  0.724247082951467003f, 0.689540544737066829f,
+  0.723188489306527460f, 0.690650714134534605f,
+  0.722128193929215345f, 0.691759258364157748f,
+  0.721066199314508105f, 0.692866174817424629f,
+  0.720002507961381655f, 0.693971460889654002f,
+  0.718937122372804494f, 0.695075113980000880f,
+  0.717870045055731709f, 0.696177131491462986f,
+  0.716801278521099539f, 0.697277510830886516f,
+  0.715730825283818595f, 0.698376249408972916f,
+  0.714658687862769093f, 0.699473344640283767f,
+  0.713584868780793635f, 0.700568793943248336f,
+  0.712509370564692324f, 0.701662594740168455f,
+  0.711432195745216434f, 0.702754744457225300f,
+  0.710353346857062418f, 0.703845240524484939f,
+  0.709272826438865689f, 0.704934080375904881f,
+  0.708190637033195403f, 0.706021261449339743f,
+  0.707106781186547573f, 0.707106781186547462f,
+  0.706021261449339743f, 0.708190637033195292f,
+  0.704934080375904992f, 0.709272826438865578f,
+  0.703845240524484939f, 0.710353346857062307f,
+  0.702754744457225300f, 0.711432195745216434f,
+  0.701662594740168566f, 0.712509370564692324f,
+  0.700568793943248447f, 0.713584868780793524f,
+  0.699473344640283767f, 0.714658687862768982f,
+  0.698376249408972916f, 0.715730825283818595f,
+  0.697277510830886627f, 0.716801278521099539f,
+  0.696177131491462986f, 0.717870045055731709f,
+  0.695075113980000880f, 0.718937122372804382f,
+  0.693971460889654002f, 0.720002507961381655f,
+  0.692866174817424740f, 0.721066199314508105f,
+  0.691759258364157748f, 0.722128193929215345f,
+  0.690650714134534716f, 0.723188489306527349f,
+  0.689540544737066941f, 0.724247082951466892f,
+  0.688428752784090547f, 0.725303972373060657f,
+  0.687315340891759163f, 0.726359155084346009f,
+  0.686200311680038699f, 0.727412628602375766f,
+  0.685083667772700355f, 0.728464390448225196f,
+  0.683965411797315515f, 0.729514438146996902f,
+  0.682845546385248081f, 0.730562769227827591f,
+  0.681724074171649819f, 0.731609381223892519f,
+  0.680600997795453133f, 0.732654271672412816f,
+  0.679476319899365078f, 0.733697438114660261f,
+  0.678350043129861580f, 0.734738878095963388f,
+  0.677222170137180446f, 0.735778589165713481f,
+  0.676092703575316034f, 0.736816568877369793f,
+  0.674961646102012036f, 0.737852814788465983f,
+  0.673829000378756149f, 0.738887324460615114f,
+  0.672694769070772969f, 0.739920095459516092f,
+  0.671558954847018330f, 0.740951125354959106f,
+  0.670421560380173087f, 0.741980411720830957f,
+  0.669282588346636009f, 0.743007952135121719f,
+  0.668142041426518563f, 0.744033744179929180f,
+  0.666999922303637471f, 0.745057785441465947f,
+  0.665856233665509722f, 0.746080073510063779f,
+  0.664710978203344904f, 0.747100605980180132f,
+  0.663564158612039878f, 0.748119380450403493f,
+  0.662415777590171784f, 0.749136394523459259f,
+  0.661265837839992265f, 0.750151645806214962f,
+  0.660114342067420479f, 0.751165131909686368f,
+  0.658961292982037317f, 0.752176850449042700f,
+  0.657806693297078637f, 0.753186799043612409f,
+  0.656650545729429047f, 0.754194975316889171f,
+  0.655492852999615461f, 0.755201376896536547f,
+  0.654333617831800551f, 0.756206001414394535f,
+  0.653172842953776756f, 0.757208846506484456f,
+  0.652010531096959500f, 0.758209909813015281f,
+  0.650846684996380986f, 0.759209188978387961f,
+  0.649681307390683194f, 0.760206681651202421f,
+  0.648514401022112552f, 0.761202385484261779f,
+  0.647345968636512059f, 0.762196298134578898f,
+  0.646176012983316395f, 0.763188417263381269f,
+  0.645004536815544038f, 0.764178740536116674f,
+  0.643831542889791497f, 0.765167265622458959f,
+  0.642657033966226865f, 0.766153990196312806f,
+  0.641481012808583162f, 0.767138911935820400f,
+  0.640303482184151673f, 0.768122028523365308f,
+  0.639124444863775731f, 0.769103337645579588f,
+  0.637943903621844166f, 0.770082836993347897f,
+  0.636761861236284199f, 0.771060524261813707f,
+  0.635578320488556225f, 0.772036397150384412f,
+  0.634393284163645488f, 0.773010453362736993f,
+  0.633206755050057191f, 0.773982690606822787f,
+  0.632018735939809062f, 0.774953106594873820f,
+  0.630829229628424470f, 0.775921699043407576f,
+  0.629638238914927095f, 0.776888465673232442f,
+  0.628445766601832712f, 0.777853404209453037f,
+  0.627251815495144194f, 0.778816512381475867f,
+  0.626056388404343522f, 0.779777787923014443f,
+  0.624859488142386454f, 0.780737228572094377f,
+  0.623661117525694642f, 0.781694832071059387f,
+  0.622461279374150078f, 0.782650596166575729f,
+  0.621259976511087664f, 0.783604518609638201f,
+  0.620057211763289207f, 0.784556597155575242f,
+  0.618852987960976320f, 0.785506829564053932f,
+  0.617647307937803980f, 0.786455213599085767f,
+  0.616440174530853646f, 0.787401747029031318f,
+  0.615231590580626819f, 0.788346427626606228f,
+  0.614021558931038491f, 0.789289253168885652f,
+  0.612810082429409708f, 0.790230221437310032f,
+  0.611597163926462017f, 0.791169330217690092f,
+  0.610382806276309475f, 0.792106577300212389f,
+  0.609167012336453206f, 0.793041960479443642f,
+  0.607949784967773743f, 0.793975477554337172f,
+  0.606731127034524476f, 0.794907126328237013f,
+  0.605511041404325545f, 0.795836904608883455f,
+  0.604289530948156073f, 0.796764810208418717f,
+  0.603066598540348275f, 0.797690840943391044f,
+  0.601842247058580027f, 0.798614994634760822f,
+  0.600616479383868973f, 0.799537269107905013f,
+  0.599389298400564541f, 0.800457662192622710f,
+  0.598160706996342384f, 0.801376171723140129f,
+  0.596930708062196502f, 0.802292795538115722f,
+  0.595699304492433468f, 0.803207531480644832f,
+  0.594466499184664543f, 0.804120377398265695f,
+  0.593232295039799795f, 0.805031331142963658f,
+  0.591996694962040992f, 0.805940390571176279f,
+  0.590759701858874275f, 0.806847553543799223f,
+  0.589521318641063941f, 0.807752817926190358f,
+  0.588281548222645334f, 0.808656181588174983f,
+  0.587040393520918080f, 0.809557642404051259f,
+  0.585797857456438864f, 0.810457198252594768f,
+  0.584553942953015326f, 0.811354847017063729f,
+  0.583308652937698291f, 0.812250586585203882f,
+  0.582061990340775548f, 0.813144414849253594f,
+  0.580813958095764526f, 0.814036329705948303f,
+  0.579564559139405744f, 0.814926329056526622f,
+  0.578313796411655590f, 0.815814410806733781f,
+  0.577061672855679553f, 0.816700572866827845f,
+  0.575808191417845339f, 0.817584813151583711f,
+  0.574553355047715764f, 0.818467129580298658f,
+  0.573297166698042315f, 0.819347520076796898f,
+  0.572039629324757049f, 0.820225982569434686f,
+  0.570780745886967367f, 0.821102514991104648f,
+  0.569520519346947252f, 0.821977115279241555f,
+  0.568258952670131490f, 0.822849781375826317f,
+  0.566996048825108678f, 0.823720511227391317f,
+  0.565731810783613231f, 0.824589302785025291f,
+  0.564466241520519496f, 0.825456154004377440f,
+  0.563199344013834091f, 0.826321062845663423f,
+  0.561931121244689469f, 0.827184027273669020f,
+  0.560661576197336031f, 0.828045045257755796f,
+  0.559390711859136136f, 0.828904114771864875f,
+  0.558118531220556102f, 0.829761233794523045f,
+  0.556845037275160104f, 0.830616400308846203f,
+  0.555570233019602289f, 0.831469612302545236f,
+  0.554294121453620114f, 0.832320867767929684f,
+  0.553016705580027579f, 0.833170164701913185f,
+  0.551737988404707447f, 0.834017501106018133f,
+  0.550457972936604811f, 0.834862874986380010f,
+  0.549176662187719766f, 0.835706284353752604f,
+  0.547894059173100190f, 0.836547727223511894f,
+  0.546610166910834860f, 0.837387201615661936f,
+  0.545324988422046464f, 0.838224705554837968f,
+  0.544038526730883931f, 0.839060237070312631f,
+  0.542750784864516000f, 0.839893794195999410f,
+  0.541461765853123556f, 0.840725374970458073f,
+  0.540171472729892965f, 0.841554977436898333f,
+  0.538879908531008422f, 0.842382599643185959f,
+  0.537587076295645505f, 0.843208239641845436f,
+  0.536292979065963182f, 0.844031895490066408f,
+  0.534997619887097264f, 0.844853565249707006f,
+  0.533701001807152964f, 0.845673246987299065f,
+  0.532403127877198012f, 0.846490938774052015f,
+  0.531104001151255001f, 0.847306638685858315f,
+  0.529803624686294827f, 0.848120344803297121f,
+  0.528502001542228483f, 0.848932055211639613f,
+  0.527199134781901391f, 0.849741768000852438f,
+  0.525895027471084742f, 0.850549481265603369f,
+  0.524589682678468838f, 0.851355193105265196f,
+  0.523283103475656430f, 0.852158901623919829f,
+  0.521975292937154389f, 0.852960604930363631f,
+  0.520666254140367268f, 0.853760301138111299f,
+  0.519355990165589532f, 0.854557988365400534f,
+  0.518044504095999336f, 0.855353664735196029f,
+  0.516731799017649984f, 0.856147328375194472f,
+  0.515417878019463149f, 0.856938977417828651f,
+  0.514102744193221661f, 0.857728610000272118f,
+  0.512786400633563066f, 0.858516224264442740f,
+  0.511468850437970524f, 0.859301818357008362f,
+  0.510150096706766698f, 0.860085390429390140f,
+  0.508830142543106989f, 0.860866938637767309f,
+  0.507508991052970870f, 0.861646461143081299f,
+  0.506186645345155450f, 0.862423956111040502f,
+  0.504863108531267479f, 0.863199421712124160f,
+  0.503538383725717575f, 0.863972856121586696f,
+  0.502212474045710899f, 0.864744257519462378f,
+  0.500885382611240937f, 0.865513624090568978f,
+  0.499557112545081894f, 0.866280954024512995f,
+  0.498227666972781869f, 0.867046245515692648f,
+  0.496897049022654635f, 0.867809496763303212f,
+  0.495565261825772485f, 0.868570705971340895f,
+  0.494232308515959728f, 0.869329871348606731f,
+  0.492898192229784093f, 0.870086991108711350f,
+  0.491562916106550063f, 0.870842063470078864f,
+  0.490226483288291104f, 0.871595086655951090f,
+  0.488888896919763227f, 0.872346058894391541f,
+  0.487550160148436051f, 0.873094978418290091f,
+  0.486210276124486529f, 0.873841843465366752f,
+  0.484869248000791120f, 0.874586652278176113f,
+  0.483527078932918741f, 0.875329403104110781f,
+  0.482183772079122830f, 0.876070094195406601f,
+  0.480839330600333903f, 0.876808723809145762f,
+  0.479493757660153008f, 0.877545290207261242f,
+  0.478147056424843120f, 0.878279791656541464f,
+  0.476799230063322255f, 0.879012226428633414f,
+  0.475450281747155867f, 0.879742592800047407f,
+  0.474100214650550023f, 0.880470889052160754f,
+  0.472749031950342902f, 0.881197113471221982f,
+  0.471396736825997809f, 0.881921264348354939f,
+  0.470043332459595620f, 0.882643339979562791f,
+  0.468688822035827957f, 0.883363338665731579f,
+  0.467333208741988526f, 0.884081258712634988f,
+  0.465976495767966126f, 0.884797098430937790f,
+  0.464618686306237816f, 0.885510856136199953f,
+  0.463259783551860260f, 0.886222530148880638f,
+  0.461899790702462842f, 0.886932118794342084f,
+  0.460538710958240005f, 0.887639620402853935f,
+  0.459176547521944145f, 0.888345033309596244f,
+  0.457813303598877286f, 0.889048355854664574f,
+  0.456448982396883862f, 0.889749586383072888f,
+  0.455083587126343836f, 0.890448723244757878f,
+  0.453717121000163925f, 0.891145764794583184f,
+  0.452349587233771000f, 0.891840709392342723f,
+  0.450980989045103808f, 0.892533555402764689f,
+  0.449611329654606595f, 0.893224301195515324f,
+  0.448240612285219997f, 0.893912945145203253f,
+  0.446868840162374326f, 0.894599485631382585f,
+  0.445496016513981741f, 0.895283921038557584f,
+  0.444122144570429256f, 0.895966249756185107f,
+  0.442747227564570134f, 0.896646470178680155f,
+  0.441371268731716615f, 0.897324580705418318f,
+  0.439994271309633256f, 0.898000579740739879f,
+  0.438616238538527714f, 0.898674465693953817f,
+  0.437237173661044198f, 0.899346236979341462f,
+  0.435857079922255475f, 0.900015892016160279f,
+  0.434475960569655706f, 0.900683429228646859f,
+  0.433093818853152013f, 0.901348847046022028f,
+  0.431710658025057370f, 0.902012143902493069f,
+  0.430326481340082612f, 0.902673318237258826f,
+  0.428941292055329548f, 0.903332368494511817f,
+  0.427555093430282196f, 0.903989293123443338f,
+  0.426167888726799615f, 0.904644090578246240f,
+  0.424779681209108806f, 0.905296759318118816f,
+  0.423390474143796103f, 0.905947297807268459f,
+  0.422000270799799793f, 0.906595704514915335f,
+  0.420609074448402509f, 0.907241977915295927f,
+  0.419216888363223961f, 0.907886116487666150f,
+  0.417823715820212382f, 0.908528118716306121f,
+  0.416429560097637319f, 0.909167983090522269f,
+  0.415034424476081631f, 0.909805708104652222f,
+  0.413638312238434558f, 0.910441292258067136f,
+  0.412241226669882999f, 0.911074734055176250f,
+  0.410843171057903911f, 0.911706032005429878f,
+  0.409444148692257592f, 0.912335184623322748f,
+  0.408044162864978743f, 0.912962190428398102f,
+  0.406643216870369140f, 0.913587047945250808f,
+  0.405241314004989861f, 0.914209755703530691f,
+  0.403838457567654130f, 0.914830312237946086f,
+  0.402434650859418541f, 0.915448716088267833f,
+  0.401029897183575790f, 0.916064965799331610f,
+  0.399624199845646788f, 0.916679059921042705f,
+  0.398217562153373617f, 0.917290997008377906f,
+  0.396809987416710419f, 0.917900775621390386f,
+  0.395401478947816298f, 0.918508394325212252f,
+  0.393992040061048099f, 0.919113851690057770f,
+  0.392581674072951525f, 0.919717146291227361f,
+  0.391170384302253982f, 0.920318276709110483f,
+  0.389758174069856411f, 0.920917241529189523f,
+  0.388345046698826302f, 0.921514039342041902f,
+  0.386931005514388693f, 0.922108668743345072f,
+  0.385516053843919015f, 0.922701128333878517f,
+  0.384100195016935042f, 0.923291416719527636f,
+  0.382683432365089837f, 0.923879532511286738f,
+  0.381265769222162487f, 0.924465474325262604f,
+  0.379847208924051105f, 0.925049240782677584f,
+  0.378427754808765615f, 0.925630830509872715f,
+  0.377007410216418315f, 0.926210242138311268f,
+  0.375586178489217326f, 0.926787474304581749f,
+  0.374164062971457989f, 0.927362525650401115f,
+  0.372741067009515814f, 0.927935394822617887f,
+  0.371317193951837599f, 0.928506080473215478f,
+  0.369892447148934267f, 0.929074581259315746f,
+  0.368466829953372321f, 0.929640895843181325f,
+  0.367040345719767236f, 0.930205022892219069f,
+  0.365612997804773965f, 0.930766961078983712f,
+  0.364184789567079836f, 0.931326709081180426f,
+  0.362755724367397225f, 0.931884265581668148f,
+  0.361325805568454339f, 0.932439629268462356f,
+  0.359895036534988277f, 0.932992798834738846f,
+  0.358463420633736540f, 0.933543772978836173f,
+  0.357030961233430033f, 0.934092550404258870f,
+  0.355597661704783963f, 0.934639129819680781f,
+  0.354163525420490510f, 0.935183509938947499f,
+  0.352728555755210726f, 0.935725689481080369f,
+  0.351292756085567148f, 0.936265667170278260f,
+  0.349856129790135029f, 0.936803441735921560f,
+  0.348418680249434509f, 0.937339011912574960f,
+  0.346980410845923681f, 0.937872376439989885f,
+  0.345541324963989149f, 0.938403534063108058f,
+  0.344101425989938980f, 0.938932483532064488f,
+  0.342660717311994378f, 0.939459223602189919f,
+  0.341219202320282411f, 0.939983753034013936f,
+  0.339776884406826962f, 0.940506070593268295f,
+  0.338333766965541294f, 0.941026175050889258f,
+  0.336889853392220051f, 0.941544065183020806f,
+  0.335445147084531659f, 0.942059739771017313f,
+  0.333999651442009493f, 0.942573197601446866f,
+  0.332553369866044224f, 0.943084437466093495f,
+  0.331106305759876429f, 0.943593458161960386f,
+  0.329658462528587548f, 0.944100258491272659f,
+  0.328209843579092664f, 0.944604837261480257f,
+  0.326760452320131789f, 0.945107193285260605f,
+  0.325310292162262982f, 0.945607325380521280f,
+  0.323859366517852965f, 0.946105232370403337f,
+  0.322407678801070019f, 0.946600913083283535f,
+  0.320955232427875214f, 0.947094366352777217f,
+  0.319502030816015747f, 0.947585591017741091f,
+  0.318048077385015060f, 0.948074585922276225f,
+  0.316593375556165846f, 0.948561349915730267f,
+  0.315137928752522445f, 0.949045881852700557f,
+  0.313681740398891573f, 0.949528180593036675f,
+  0.312224813921825051f, 0.950008245001842999f,
+  0.310767152749611475f, 0.950486073949481702f,
+  0.309308760312268782f, 0.950961666311575082f,
+  0.307849640041534978f, 0.951435020969008338f,
+  0.306389795370861084f, 0.951906136807932235f,
+  0.304929229735402429f, 0.952375012719765879f,
+  0.303467946572011371f, 0.952841647601198716f,
+  0.302005949319228195f, 0.953306040354193751f,
+  0.300543241417273399f, 0.953768189885990325f,
+  0.299079826308040475f, 0.954228095109105667f,
+  0.297615707435086307f, 0.954685754941338338f,
+  0.296150888243623955f, 0.955141168305770671f,
+  0.294685372180514327f, 0.955594334130771106f,
+  0.293219162694258684f, 0.956045251349996406f,
+  0.291752263234989373f, 0.956493918902394991f,
+  0.290284677254462331f, 0.956940335732208935f,
+  0.288816408206049480f, 0.957384500788975856f,
+  0.287347459544729567f, 0.957826413027532908f,
+  0.285877834727080726f, 0.958266071408017672f,
+  0.284407537211271821f, 0.958703474895871599f,
+  0.282936570457055392f, 0.959138622461841894f,
+  0.281464937925758052f, 0.959571513081984517f,
+  0.279992643080273385f, 0.960002145737665846f,
+  0.278519689385053060f, 0.960430519415565787f,
+  0.277046080306099951f, 0.960856633107679659f,
+  0.275571819310958255f, 0.961280485811320640f,
+  0.274096909868706329f, 0.961702076529122540f,
+  0.272621355449948977f, 0.962121404269041580f,
+  0.271145159526808066f, 0.962538468044359163f,
+  0.269668325572915202f, 0.962953266873683877f,
+  0.268190857063403176f, 0.963365799780954046f,
+  0.266712757474898421f, 0.963776065795439840f,
+  0.265234030285511901f, 0.964184063951745718f,
+  0.263754678974831513f, 0.964589793289812647f,
+  0.262274707023913589f, 0.964993252854920325f,
+  0.260794117915275570f, 0.965394441697689398f,
+  0.259312915132886346f, 0.965793358874083574f,
+  0.257831102162158932f, 0.966190003445412615f,
+  0.256348682489942914f, 0.966584374478333119f,
+  0.254865659604514627f, 0.966976471044852071f,
+  0.253382036995570270f, 0.967366292222328505f,
+  0.251897818154216913f, 0.967753837093475511f,
+  0.250413006572965280f, 0.968139104746362333f,
+  0.248927605745720260f, 0.968522094274417267f,
+  0.247441619167773436f, 0.968902804776428872f,
+  0.245955050335794595f, 0.969281235356548532f,
+  0.244467902747824206f, 0.969657385124292448f,
+  0.242980179903263982f, 0.970031253194543974f,
+  0.241491885302869302f, 0.970402838687555502f,
+  0.240003022448741499f, 0.970772140728950350f,
+  0.238513594844318499f, 0.971139158449725093f,
+  0.237023605994367337f, 0.971503890986251784f,
+  0.235533059404975459f, 0.971866337480279396f,
+  0.234041958583543458f, 0.972226497078936269f,
+  0.232550307038775328f, 0.972584368934732213f,
+  0.231058108280671276f, 0.972939952205560066f,
+  0.229565365820518869f, 0.973293246054698247f,
+  0.228072083170885787f, 0.973644249650811866f,
+  0.226578263845610112f, 0.973992962167955834f,
+  0.225083911359792777f, 0.974339382785575858f,
+  0.223589029229790015f, 0.974683510688510668f,
+  0.222093620973203593f, 0.975025345066994120f,
+  0.220597690108873645f, 0.975364885116656866f,
+  0.219101240156869770f, 0.975702130038528570f,
+  0.217604274638483669f, 0.976037079039039024f,
+  0.216106797076219603f, 0.976369731330021140f,
+  0.214608810993786925f, 0.976700086128711842f,
+  0.213110319916091362f, 0.977028142657754395f,
+  0.211611327369227609f, 0.977353900145199961f,
+  0.210111836880469721f, 0.977677357824509929f,
+  0.208611851978263457f, 0.977998514934557139f,
+  0.207111376192218560f, 0.978317370719627655f,
+  0.205610413053099322f, 0.978633924429423097f,
+  0.204108966092817007f, 0.978948175319062197f,
+  0.202607038844421106f, 0.979260122649082021f,
+  0.201104634842091956f, 0.979569765685440519f,
+  0.199601757621131054f, 0.979877103699517638f,
+  0.198098410717953727f, 0.980182135968117318f,
+  0.196594597670080223f, 0.980484861773469385f,
+  0.195090322016128331f, 0.980785280403230431f,
+  0.193585587295803746f, 0.981083391150486595f,
+  0.192080397049892382f, 0.981379193313754561f,
+  0.190574754820252795f, 0.981672686196983113f,
+  0.189068664149806276f, 0.981963869109555243f,
+  0.187562128582529741f, 0.982252741366289372f,
+  0.186055151663446633f, 0.982539302287441241f,
+  0.184547736938619644f, 0.982823551198705236f,
+  0.183039887955141062f, 0.983105487431216285f,
+  0.181531608261125132f, 0.983385110321551181f,
+  0.180022901405699515f, 0.983662419211730255f,
+  0.178513770938997590f, 0.983937413449218923f,
+  0.177004220412148860f, 0.984210092386929025f,
+  0.175494253377271370f, 0.984480455383220932f,
+  0.173983873387463850f, 0.984748501801904208f,
+  0.172473083996796034f, 0.985014231012239838f,
+  0.170961888760301356f, 0.985277642388941222f,
+  0.169450291233967931f, 0.985538735312176062f,
+  0.167938294974731228f, 0.985797509167567365f,
+  0.166425903540464215f, 0.986053963346195439f,
+  0.164913120489970089f, 0.986308097244598669f,
+  0.163399949382973225f, 0.986559910264775408f,
+  0.161886393780111881f, 0.986809401814185416f,
+  0.160372457242928396f, 0.987056571305750974f,
+  0.158858143333861390f, 0.987301418157858435f,
+  0.157343455616238276f, 0.987543941794359226f,
+  0.155828397654265316f, 0.987784141644572178f,
+  0.154312973013020244f, 0.988022017143283526f,
+  0.152797185258443408f, 0.988257567730749464f,
+  0.151281037957330250f, 0.988490792852696587f,
+  0.149764534677321620f, 0.988721691960323779f,
+  0.148247678986896197f, 0.988950264510302990f,
+  0.146730474455361748f, 0.989176509964781014f,
+  0.145212924652847519f, 0.989400427791380377f,
+  0.143695033150294582f, 0.989622017463200776f,
+  0.142176803519448003f, 0.989841278458820528f,
+  0.140658239332849239f, 0.990058210262297123f,
+  0.139139344163826284f, 0.990272812363169108f,
+  0.137620121586486177f, 0.990485084256456982f,
+  0.136100575175706201f, 0.990695025442664634f,
+  0.134580708507126223f, 0.990902635427780010f,
+  0.133060525157139176f, 0.991107913723276779f,
+  0.131540028702883283f, 0.991310859846115444f,
+  0.130019222722233346f, 0.991511473318743897f,
+  0.128498110793793224f, 0.991709753669099525f,
+  0.126976696496885977f, 0.991905700430609327f,
+  0.125454983411546206f, 0.992099313142191797f,
+  0.123932975118512201f, 0.992290591348257367f,
+  0.122410675199216279f, 0.992479534598709967f,
+  0.120888087235777222f, 0.992666142448948019f,
+  0.119365214810991355f, 0.992850414459865105f,
+  0.117842061508325019f, 0.993032350197851410f,
+  0.116318630911904877f, 0.993211949234794500f,
+  0.114794926606510250f, 0.993389211148080653f,
+  0.113270952177564360f, 0.993564135520595304f,
+  0.111746711211126656f, 0.993736721940724599f,
+  0.110222207293883184f, 0.993906970002356061f,
+  0.108697444013138675f, 0.994074879304879366f,
+  0.107172424956808870f, 0.994240449453187902f,
+  0.105647153713410699f, 0.994403680057679096f,
+  0.104121633872054725f, 0.994564570734255415f,
+  0.102595869022436281f, 0.994723121104325703f,
+  0.101069862754827877f, 0.994879330794805616f,
+  0.099543618660069444f, 0.995033199438118632f,
+  0.098017140329560770f, 0.995184726672196818f,
+  0.096490431355252607f, 0.995333912140482280f,
+  0.094963495329639061f, 0.995480755491926939f,
+  0.093436335845747912f, 0.995625256380994306f,
+  0.091908956497132696f, 0.995767414467659817f,
+  0.090381360877865011f, 0.995907229417411721f,
+  0.088853552582524684f, 0.996044700901251967f,
+  0.087325535206192226f, 0.996179828595696870f,
+  0.085797312344439880f, 0.996312612182778001f,
+  0.084268887593324127f, 0.996443051350042630f,
+  0.082740264549375803f, 0.996571145790554835f,
+  0.081211446809592386f, 0.996696895202896060f,
+  0.079682437971430126f, 0.996820299291165668f,
+  0.078153241632794315f, 0.996941357764982161f,
+  0.076623861392031617f, 0.997060070339482962f,
+  0.075094300847921291f, 0.997176436735326188f,
+  0.073564563599667454f, 0.997290456678690207f,
+  0.072034653246889416f, 0.997402129901275303f,
+  0.070504573389614009f, 0.997511456140303454f,
+  0.068974327628266732f, 0.997618435138519555f,
+  0.067443919563664106f, 0.997723066644191636f,
+  0.065913352797003930f, 0.997825350411111645f,
+  0.064382630929857410f, 0.997925286198595995f,
+  0.062851757564161420f, 0.998022873771486241f,
+  0.061320736302208648f, 0.998118112900149179f,
+  0.059789570746640007f, 0.998211003360478188f,
+  0.058258264500435732f, 0.998301544933892893f,
+  0.056726821166907783f, 0.998389737407340161f,
+  0.055195244349690031f, 0.998475580573294774f,
+  0.053663537652730679f, 0.998559074229759314f,
+  0.052131704680283317f, 0.998640218180265271f,
+  0.050599749036899337f, 0.998719012233872938f,
+  0.049067674327418126f, 0.998795456205172405f,
+  0.047535484156959261f, 0.998869549914283561f,
+  0.046003182130914644f, 0.998941293186856871f,
+  0.044470771854938744f, 0.999010685854073377f,
+  0.042938256934940959f, 0.999077727752645361f,
+  0.041405640977076712f, 0.999142418724816905f,
+  0.039872927587739845f, 0.999204758618363886f,
+  0.038340120373552791f, 0.999264747286594424f,
+  0.036807222941358991f, 0.999322384588349544f,
+  0.035274238898213947f, 0.999377670388002848f,
+  0.033741171851377642f, 0.999430604555461732f,
+  0.032208025408304704f, 0.999481186966166946f,
+  0.030674803176636581f, 0.999529417501093143f,
+  0.029141508764193740f, 0.999575296046749218f,
+  0.027608145778965820f, 0.999618822495178638f,
+  0.026074717829104040f, 0.999659996743959223f,
+  0.024541228522912264f, 0.999698818696204250f,
+  0.023007681468839410f, 0.999735288260561683f,
+  0.021474080275469605f, 0.999769405351215279f,
+  0.019940428551514598f, 0.999801169887884256f,
+  0.018406729905804820f, 0.999830581795823403f,
+  0.016872987947281773f, 0.999857641005823861f,
+  0.015339206284988220f, 0.999882347454212561f,
+  0.013805388528060349f, 0.999904701082852898f,
+  0.012271538285719944f, 0.999924701839144503f,
+  0.010737659167264572f, 0.999942349676023912f,
+  0.009203754782059960f, 0.999957644551963898f,
+  0.007669828739531077f, 0.999970586430974140f,
+  0.006135884649154515f, 0.999981175282601109f,
+  0.004601926120448672f, 0.999989411081928403f,
+  0.003067956762966138f, 0.999995293809576191f,
+  0.001533980186284766f, 0.999998823451701879f,
+  0.000000000000000061f, 1.000000000000000000f,
+  -0.001533980186284644f, 0.999998823451701879f,
+  -0.003067956762966016f, 0.999995293809576191f,
+  -0.004601926120448550f, 0.999989411081928403f,
+  -0.006135884649154393f, 0.999981175282601109f,
+  -0.007669828739530955f, 0.999970586430974140f,
+  -0.009203754782059837f, 0.999957644551963898f,
+  -0.010737659167264449f, 0.999942349676023912f,
+  -0.012271538285719823f, 0.999924701839144503f,
+  -0.013805388528060226f, 0.999904701082852898f,
+  -0.015339206284988098f, 0.999882347454212561f,
+  -0.016872987947281651f, 0.999857641005823861f,
+  -0.018406729905804695f, 0.999830581795823403f,
+  -0.019940428551514476f, 0.999801169887884256f,
+  -0.021474080275469484f, 0.999769405351215279f,
+  -0.023007681468839289f, 0.999735288260561683f,
+  -0.024541228522912142f, 0.999698818696204250f,
+  -0.026074717829103915f, 0.999659996743959223f,
+  -0.027608145778965698f, 0.999618822495178638f,
+  -0.029141508764193618f, 0.999575296046749218f,
+  -0.030674803176636459f, 0.999529417501093143f,
+  -0.032208025408304579f, 0.999481186966166946f,
+  -0.033741171851377517f, 0.999430604555461732f,
+  -0.035274238898213822f, 0.999377670388002848f,
+  -0.036807222941358866f, 0.999322384588349544f,
+  -0.038340120373552666f, 0.999264747286594424f,
+  -0.039872927587739727f, 0.999204758618363886f,
+  -0.041405640977076594f, 0.999142418724816905f,
+  -0.042938256934940834f, 0.999077727752645361f,
+  -0.044470771854938619f, 0.999010685854073377f,
+  -0.046003182130914519f, 0.998941293186856871f,
+  -0.047535484156959136f, 0.998869549914283561f,
+  -0.049067674327418008f, 0.998795456205172405f,
+  -0.050599749036899212f, 0.998719012233872938f,
+  -0.052131704680283192f, 0.998640218180265271f,
+  -0.053663537652730554f, 0.998559074229759314f,
+  -0.055195244349689913f, 0.998475580573294774f,
+  -0.056726821166907658f, 0.998389737407340161f,
+  -0.058258264500435607f, 0.998301544933892893f,
+  -0.059789570746639882f, 0.998211003360478188f,
+  -0.061320736302208530f, 0.998118112900149179f,
+  -0.062851757564161309f, 0.998022873771486241f,
+  -0.064382630929857285f, 0.997925286198595995f,
+  -0.065913352797003805f, 0.997825350411111645f,
+  -0.067443919563663982f, 0.997723066644191636f,
+  -0.068974327628266607f, 0.997618435138519555f,
+  -0.070504573389613898f, 0.997511456140303454f,
+  -0.072034653246889291f, 0.997402129901275303f,
+  -0.073564563599667329f, 0.997290456678690207f,
+  -0.075094300847921167f, 0.997176436735326188f,
+  -0.076623861392031506f, 0.997060070339482962f,
+  -0.078153241632794190f, 0.996941357764982161f,
+  -0.079682437971430015f, 0.996820299291165779f,
+  -0.081211446809592261f, 0.996696895202896060f,
+  -0.082740264549375678f, 0.996571145790554835f,
+  -0.084268887593324002f, 0.996443051350042630f,
+  -0.085797312344439755f, 0.996312612182778001f,
+  -0.087325535206192101f, 0.996179828595696870f,
+  -0.088853552582524559f, 0.996044700901251967f,
+  -0.090381360877864886f, 0.995907229417411721f,
+  -0.091908956497132571f, 0.995767414467659817f,
+  -0.093436335845747787f, 0.995625256380994306f,
+  -0.094963495329638950f, 0.995480755491926939f,
+  -0.096490431355252482f, 0.995333912140482280f,
+  -0.098017140329560645f, 0.995184726672196929f,
+  -0.099543618660069319f, 0.995033199438118632f,
+  -0.101069862754827752f, 0.994879330794805616f,
+  -0.102595869022436156f, 0.994723121104325703f,
+  -0.104121633872054600f, 0.994564570734255415f,
+  -0.105647153713410574f, 0.994403680057679096f,
+  -0.107172424956808759f, 0.994240449453187902f,
+  -0.108697444013138564f, 0.994074879304879477f,
+  -0.110222207293883059f, 0.993906970002356061f,
+  -0.111746711211126545f, 0.993736721940724599f,
+  -0.113270952177564235f, 0.993564135520595304f,
+  -0.114794926606510125f, 0.993389211148080653f,
+  -0.116318630911904752f, 0.993211949234794500f,
+  -0.117842061508324894f, 0.993032350197851410f,
+  -0.119365214810991230f, 0.992850414459865105f,
+  -0.120888087235777097f, 0.992666142448948019f,
+  -0.122410675199216154f, 0.992479534598709967f,
+  -0.123932975118512076f, 0.992290591348257367f,
+  -0.125454983411546067f, 0.992099313142191797f,
+  -0.126976696496885866f, 0.991905700430609327f,
+  -0.128498110793793113f, 0.991709753669099525f,
+  -0.130019222722233235f, 0.991511473318744008f,
+  -0.131540028702883144f, 0.991310859846115444f,
+  -0.133060525157139037f, 0.991107913723276890f,
+  -0.134580708507126112f, 0.990902635427780010f,
+  -0.136100575175706062f, 0.990695025442664634f,
+  -0.137620121586486066f, 0.990485084256456982f,
+  -0.139139344163826173f, 0.990272812363169108f,
+  -0.140658239332849128f, 0.990058210262297123f,
+  -0.142176803519447892f, 0.989841278458820528f,
+  -0.143695033150294443f, 0.989622017463200887f,
+  -0.145212924652847408f, 0.989400427791380377f,
+  -0.146730474455361637f, 0.989176509964781014f,
+  -0.148247678986896086f, 0.988950264510302990f,
+  -0.149764534677321509f, 0.988721691960323779f,
+  -0.151281037957330139f, 0.988490792852696698f,
+  -0.152797185258443297f, 0.988257567730749464f,
+  -0.154312973013020133f, 0.988022017143283526f,
+  -0.155828397654265205f, 0.987784141644572178f,
+  -0.157343455616238165f, 0.987543941794359337f,
+  -0.158858143333861279f, 0.987301418157858435f,
+  -0.160372457242928257f, 0.987056571305750974f,
+  -0.161886393780111770f, 0.986809401814185527f,
+  -0.163399949382973114f, 0.986559910264775519f,
+  -0.164913120489969950f, 0.986308097244598669f,
+  -0.166425903540464104f, 0.986053963346195439f,
+  -0.167938294974731089f, 0.985797509167567476f,
+  -0.169450291233967820f, 0.985538735312176062f,
+  -0.170961888760301245f, 0.985277642388941222f,
+  -0.172473083996795923f, 0.985014231012239838f,
+  -0.173983873387463711f, 0.984748501801904208f,
+  -0.175494253377271259f, 0.984480455383220932f,
+  -0.177004220412148749f, 0.984210092386929025f,
+  -0.178513770938997451f, 0.983937413449218923f,
+  -0.180022901405699404f, 0.983662419211730255f,
+  -0.181531608261125021f, 0.983385110321551181f,
+  -0.183039887955140923f, 0.983105487431216285f,
+  -0.184547736938619533f, 0.982823551198705347f,
+  -0.186055151663446494f, 0.982539302287441241f,
+  -0.187562128582529603f, 0.982252741366289372f,
+  -0.189068664149806165f, 0.981963869109555243f,
+  -0.190574754820252656f, 0.981672686196983113f,
+  -0.192080397049892271f, 0.981379193313754561f,
+  -0.193585587295803607f, 0.981083391150486706f,
+  -0.195090322016128193f, 0.980785280403230431f,
+  -0.196594597670080112f, 0.980484861773469385f,
+  -0.198098410717953616f, 0.980182135968117429f,
+  -0.199601757621130943f, 0.979877103699517638f,
+  -0.201104634842091817f, 0.979569765685440519f,
+  -0.202607038844420967f, 0.979260122649082132f,
+  -0.204108966092816896f, 0.978948175319062197f,
+  -0.205610413053099211f, 0.978633924429423208f,
+  -0.207111376192218449f, 0.978317370719627655f,
+  -0.208611851978263318f, 0.977998514934557139f,
+  -0.210111836880469610f, 0.977677357824509929f,
+  -0.211611327369227498f, 0.977353900145200072f,
+  -0.213110319916091251f, 0.977028142657754395f,
+  -0.214608810993786814f, 0.976700086128711842f,
+  -0.216106797076219492f, 0.976369731330021140f,
+  -0.217604274638483558f, 0.976037079039039135f,
+  -0.219101240156869659f, 0.975702130038528570f,
+  -0.220597690108873534f, 0.975364885116656977f,
+  -0.222093620973203482f, 0.975025345066994120f,
+  -0.223589029229789876f, 0.974683510688510668f,
+  -0.225083911359792666f, 0.974339382785575858f,
+  -0.226578263845610001f, 0.973992962167955834f,
+  -0.228072083170885676f, 0.973644249650811977f,
+  -0.229565365820518758f, 0.973293246054698247f,
+  -0.231058108280671137f, 0.972939952205560177f,
+  -0.232550307038775217f, 0.972584368934732213f,
+  -0.234041958583543319f, 0.972226497078936380f,
+  -0.235533059404975348f, 0.971866337480279396f,
+  -0.237023605994367226f, 0.971503890986251784f,
+  -0.238513594844318388f, 0.971139158449725093f,
+  -0.240003022448741388f, 0.970772140728950350f,
+  -0.241491885302869164f, 0.970402838687555502f,
+  -0.242980179903263871f, 0.970031253194543974f,
+  -0.244467902747824095f, 0.969657385124292448f,
+  -0.245955050335794484f, 0.969281235356548532f,
+  -0.247441619167773325f, 0.968902804776428872f,
+  -0.248927605745720121f, 0.968522094274417378f,
+  -0.250413006572965169f, 0.968139104746362444f,
+  -0.251897818154216802f, 0.967753837093475511f,
+  -0.253382036995570159f, 0.967366292222328505f,
+  -0.254865659604514516f, 0.966976471044852071f,
+  -0.256348682489942803f, 0.966584374478333119f,
+  -0.257831102162158821f, 0.966190003445412615f,
+  -0.259312915132886235f, 0.965793358874083685f,
+  -0.260794117915275458f, 0.965394441697689398f,
+  -0.262274707023913478f, 0.964993252854920436f,
+  -0.263754678974831402f, 0.964589793289812758f,
+  -0.265234030285511790f, 0.964184063951745829f,
+  -0.266712757474898310f, 0.963776065795439840f,
+  -0.268190857063403010f, 0.963365799780954046f,
+  -0.269668325572915091f, 0.962953266873683877f,
+  -0.271145159526807955f, 0.962538468044359163f,
+  -0.272621355449948866f, 0.962121404269041580f,
+  -0.274096909868706218f, 0.961702076529122540f,
+  -0.275571819310958144f, 0.961280485811320640f,
+  -0.277046080306099840f, 0.960856633107679659f,
+  -0.278519689385052949f, 0.960430519415565898f,
+  -0.279992643080273274f, 0.960002145737665846f,
+  -0.281464937925757941f, 0.959571513081984517f,
+  -0.282936570457055281f, 0.959138622461842005f,
+  -0.284407537211271710f, 0.958703474895871599f,
+  -0.285877834727080615f, 0.958266071408017672f,
+  -0.287347459544729456f, 0.957826413027532908f,
+  -0.288816408206049369f, 0.957384500788975967f,
+  -0.290284677254462165f, 0.956940335732208935f,
+  -0.291752263234989262f, 0.956493918902395102f,
+  -0.293219162694258573f, 0.956045251349996517f,
+  -0.294685372180514216f, 0.955594334130771106f,
+  -0.296150888243623844f, 0.955141168305770671f,
+  -0.297615707435086196f, 0.954685754941338338f,
+  -0.299079826308040364f, 0.954228095109105667f,
+  -0.300543241417273288f, 0.953768189885990325f,
+  -0.302005949319228084f, 0.953306040354193862f,
+  -0.303467946572011260f, 0.952841647601198716f,
+  -0.304929229735402263f, 0.952375012719765879f,
+  -0.306389795370860973f, 0.951906136807932346f,
+  -0.307849640041534867f, 0.951435020969008338f,
+  -0.309308760312268616f, 0.950961666311575082f,
+  -0.310767152749611364f, 0.950486073949481813f,
+  -0.312224813921824940f, 0.950008245001842999f,
+  -0.313681740398891407f, 0.949528180593036675f,
+  -0.315137928752522334f, 0.949045881852700668f,
+  -0.316593375556165735f, 0.948561349915730379f,
+  -0.318048077385014949f, 0.948074585922276225f,
+  -0.319502030816015636f, 0.947585591017741202f,
+  -0.320955232427875103f, 0.947094366352777217f,
+  -0.322407678801069852f, 0.946600913083283535f,
+  -0.323859366517852854f, 0.946105232370403448f,
+  -0.325310292162262871f, 0.945607325380521391f,
+  -0.326760452320131622f, 0.945107193285260605f,
+  -0.328209843579092553f, 0.944604837261480257f,
+  -0.329658462528587437f, 0.944100258491272659f,
+  -0.331106305759876318f, 0.943593458161960386f,
+  -0.332553369866044057f, 0.943084437466093495f,
+  -0.333999651442009382f, 0.942573197601446866f,
+  -0.335445147084531547f, 0.942059739771017424f,
+  -0.336889853392219940f, 0.941544065183020806f,
+  -0.338333766965541183f, 0.941026175050889258f,
+  -0.339776884406826851f, 0.940506070593268295f,
+  -0.341219202320282300f, 0.939983753034014047f,
+  -0.342660717311994267f, 0.939459223602189919f,
+  -0.344101425989938869f, 0.938932483532064488f,
+  -0.345541324963989038f, 0.938403534063108169f,
+  -0.346980410845923570f, 0.937872376439989885f,
+  -0.348418680249434398f, 0.937339011912574960f,
+  -0.349856129790134918f, 0.936803441735921560f,
+  -0.351292756085567037f, 0.936265667170278260f,
+  -0.352728555755210615f, 0.935725689481080369f,
+  -0.354163525420490399f, 0.935183509938947610f,
+  -0.355597661704783852f, 0.934639129819680781f,
+  -0.357030961233429922f, 0.934092550404258981f,
+  -0.358463420633736429f, 0.933543772978836284f,
+  -0.359895036534988166f, 0.932992798834738846f,
+  -0.361325805568454228f, 0.932439629268462356f,
+  -0.362755724367397114f, 0.931884265581668148f,
+  -0.364184789567079725f, 0.931326709081180537f,
+  -0.365612997804773854f, 0.930766961078983712f,
+  -0.367040345719767125f, 0.930205022892219069f,
+  -0.368466829953372210f, 0.929640895843181325f,
+  -0.369892447148934156f, 0.929074581259315746f,
+  -0.371317193951837488f, 0.928506080473215589f,
+  -0.372741067009515703f, 0.927935394822617887f,
+  -0.374164062971457878f, 0.927362525650401115f,
+  -0.375586178489217215f, 0.926787474304581749f,
+  -0.377007410216418204f, 0.926210242138311379f,
+  -0.378427754808765449f, 0.925630830509872826f,
+  -0.379847208924050994f, 0.925049240782677695f,
+  -0.381265769222162376f, 0.924465474325262604f,
+  -0.382683432365089726f, 0.923879532511286738f,
+  -0.384100195016934931f, 0.923291416719527747f,
+  -0.385516053843918904f, 0.922701128333878517f,
+  -0.386931005514388582f, 0.922108668743345183f,
+  -0.388345046698826191f, 0.921514039342042013f,
+  -0.389758174069856300f, 0.920917241529189523f,
+  -0.391170384302253871f, 0.920318276709110594f,
+  -0.392581674072951414f, 0.919717146291227361f,
+  -0.393992040061047988f, 0.919113851690057770f,
+  -0.395401478947816187f, 0.918508394325212252f,
+  -0.396809987416710308f, 0.917900775621390497f,
+  -0.398217562153373505f, 0.917290997008378017f,
+  -0.399624199845646677f, 0.916679059921042705f,
+  -0.401029897183575679f, 0.916064965799331721f,
+  -0.402434650859418430f, 0.915448716088267833f,
+  -0.403838457567654019f, 0.914830312237946197f,
+  -0.405241314004989750f, 0.914209755703530691f,
+  -0.406643216870369029f, 0.913587047945250808f,
+  -0.408044162864978632f, 0.912962190428398213f,
+  -0.409444148692257481f, 0.912335184623322859f,
+  -0.410843171057903800f, 0.911706032005429878f,
+  -0.412241226669882888f, 0.911074734055176361f,
+  -0.413638312238434447f, 0.910441292258067247f,
+  -0.415034424476081520f, 0.909805708104652333f,
+  -0.416429560097636986f, 0.909167983090522491f,
+  -0.417823715820212271f, 0.908528118716306121f,
+  -0.419216888363224072f, 0.907886116487666150f,
+  -0.420609074448402398f, 0.907241977915295927f,
+  -0.422000270799799682f, 0.906595704514915335f,
+  -0.423390474143795770f, 0.905947297807268570f,
+  -0.424779681209108695f, 0.905296759318118816f,
+  -0.426167888726799671f, 0.904644090578246129f,
+  -0.427555093430281863f, 0.903989293123443449f,
+  -0.428941292055329437f, 0.903332368494511817f,
+  -0.430326481340082723f, 0.902673318237258826f,
+  -0.431710658025057092f, 0.902012143902493291f,
+  -0.433093818853151902f, 0.901348847046022028f,
+  -0.434475960569655817f, 0.900683429228646859f,
+  -0.435857079922255364f, 0.900015892016160279f,
+  -0.437237173661044087f, 0.899346236979341573f,
+  -0.438616238538527381f, 0.898674465693953928f,
+  -0.439994271309633145f, 0.898000579740739879f,
+  -0.441371268731716726f, 0.897324580705418318f,
+  -0.442747227564569801f, 0.896646470178680266f,
+  -0.444122144570429145f, 0.895966249756185218f,
+  -0.445496016513981796f, 0.895283921038557473f,
+  -0.446868840162373993f, 0.894599485631382807f,
+  -0.448240612285219886f, 0.893912945145203253f,
+  -0.449611329654606706f, 0.893224301195515213f,
+  -0.450980989045103697f, 0.892533555402764689f,
+  -0.452349587233770889f, 0.891840709392342723f,
+  -0.453717121000163592f, 0.891145764794583406f,
+  -0.455083587126343725f, 0.890448723244757989f,
+  -0.456448982396883973f, 0.889749586383072777f,
+  -0.457813303598877008f, 0.889048355854664685f,
+  -0.459176547521944034f, 0.888345033309596355f,
+  -0.460538710958240061f, 0.887639620402853935f,
+  -0.461899790702462565f, 0.886932118794342306f,
+  -0.463259783551860149f, 0.886222530148880638f,
+  -0.464618686306237927f, 0.885510856136199842f,
+  -0.465976495767966015f, 0.884797098430937901f,
+  -0.467333208741988415f, 0.884081258712634988f,
+  -0.468688822035827679f, 0.883363338665731690f,
+  -0.470043332459595509f, 0.882643339979562902f,
+  -0.471396736825997698f, 0.881921264348355050f,
+  -0.472749031950342569f, 0.881197113471222204f,
+  -0.474100214650549912f, 0.880470889052160866f,
+  -0.475450281747155978f, 0.879742592800047407f,
+  -0.476799230063321922f, 0.879012226428633525f,
+  -0.478147056424843009f, 0.878279791656541575f,
+  -0.479493757660153119f, 0.877545290207261242f,
+  -0.480839330600333792f, 0.876808723809145762f,
+  -0.482183772079122719f, 0.876070094195406601f,
+  -0.483527078932918464f, 0.875329403104111003f,
+  -0.484869248000791009f, 0.874586652278176224f,
+  -0.486210276124486418f, 0.873841843465366863f,
+  -0.487550160148435718f, 0.873094978418290202f,
+  -0.488888896919763116f, 0.872346058894391541f,
+  -0.490226483288291215f, 0.871595086655950979f,
+  -0.491562916106549785f, 0.870842063470078975f,
+  -0.492898192229783982f, 0.870086991108711461f,
+  -0.494232308515959839f, 0.869329871348606731f,
+  -0.495565261825772374f, 0.868570705971341006f,
+  -0.496897049022654524f, 0.867809496763303212f,
+  -0.498227666972781591f, 0.867046245515692759f,
+  -0.499557112545081783f, 0.866280954024513106f,
+  -0.500885382611240826f, 0.865513624090569089f,
+  -0.502212474045710566f, 0.864744257519462489f,
+  -0.503538383725717464f, 0.863972856121586807f,
+  -0.504863108531267590f, 0.863199421712124160f,
+  -0.506186645345155117f, 0.862423956111040613f,
+  -0.507508991052970759f, 0.861646461143081299f,
+  -0.508830142543107100f, 0.860866938637767198f,
+  -0.510150096706766587f, 0.860085390429390251f,
+  -0.511468850437970413f, 0.859301818357008362f,
+  -0.512786400633562733f, 0.858516224264442962f,
+  -0.514102744193221661f, 0.857728610000272118f,
+  -0.515417878019463038f, 0.856938977417828762f,
+  -0.516731799017649651f, 0.856147328375194583f,
+  -0.518044504095999225f, 0.855353664735196029f,
+  -0.519355990165589643f, 0.854557988365400534f,
+  -0.520666254140366935f, 0.853760301138111521f,
+  -0.521975292937154278f, 0.852960604930363742f,
+  -0.523283103475656541f, 0.852158901623919718f,
+  -0.524589682678468727f, 0.851355193105265196f,
+  -0.525895027471084631f, 0.850549481265603480f,
+  -0.527199134781901058f, 0.849741768000852660f,
+  -0.528502001542228372f, 0.848932055211639724f,
+  -0.529803624686294716f, 0.848120344803297233f,
+  -0.531104001151254779f, 0.847306638685858537f,
+  -0.532403127877197901f, 0.846490938774052126f,
+  -0.533701001807152964f, 0.845673246987299065f,
+  -0.534997619887097042f, 0.844853565249707228f,
+  -0.536292979065963071f, 0.844031895490066408f,
+  -0.537587076295645616f, 0.843208239641845436f,
+  -0.538879908531008311f, 0.842382599643185959f,
+  -0.540171472729892854f, 0.841554977436898444f,
+  -0.541461765853123222f, 0.840725374970458184f,
+  -0.542750784864515778f, 0.839893794195999632f,
+  -0.544038526730883931f, 0.839060237070312631f,
+  -0.545324988422046242f, 0.838224705554838190f,
+  -0.546610166910834860f, 0.837387201615661936f,
+  -0.547894059173100190f, 0.836547727223512005f,
+  -0.549176662187719544f, 0.835706284353752715f,
+  -0.550457972936604700f, 0.834862874986380121f,
+  -0.551737988404707447f, 0.834017501106018022f,
+  -0.553016705580027357f, 0.833170164701913296f,
+  -0.554294121453620114f, 0.832320867767929684f,
+  -0.555570233019601956f, 0.831469612302545458f,
+  -0.556845037275159993f, 0.830616400308846314f,
+  -0.558118531220556102f, 0.829761233794523045f,
+  -0.559390711859135803f, 0.828904114771865097f,
+  -0.560661576197335920f, 0.828045045257755796f,
+  -0.561931121244689469f, 0.827184027273669131f,
+  -0.563199344013833980f, 0.826321062845663645f,
+  -0.564466241520519385f, 0.825456154004377551f,
+  -0.565731810783613231f, 0.824589302785025180f,
+  -0.566996048825108456f, 0.823720511227391539f,
+  -0.568258952670131490f, 0.822849781375826317f,
+  -0.569520519346947252f, 0.821977115279241444f,
+  -0.570780745886967145f, 0.821102514991104759f,
+  -0.572039629324757049f, 0.820225982569434686f,
+  -0.573297166698041982f, 0.819347520076797120f,
+  -0.574553355047715764f, 0.818467129580298769f,
+  -0.575808191417845339f, 0.817584813151583711f,
+  -0.577061672855679331f, 0.816700572866827956f,
+  -0.578313796411655479f, 0.815814410806733781f,
+  -0.579564559139405855f, 0.814926329056526511f,
+  -0.580813958095764415f, 0.814036329705948525f,
+  -0.582061990340775548f, 0.813144414849253594f,
+  -0.583308652937698402f, 0.812250586585203882f,
+  -0.584553942953015215f, 0.811354847017063840f,
+  -0.585797857456438864f, 0.810457198252594768f,
+  -0.587040393520917747f, 0.809557642404051481f,
+  -0.588281548222645223f, 0.808656181588175094f,
+  -0.589521318641063941f, 0.807752817926190358f,
+  -0.590759701858874053f, 0.806847553543799445f,
+  -0.591996694962040881f, 0.805940390571176390f,
+  -0.593232295039799906f, 0.805031331142963547f,
+  -0.594466499184664321f, 0.804120377398265807f,
+  -0.595699304492433357f, 0.803207531480644943f,
+  -0.596930708062196613f, 0.802292795538115611f,
+  -0.598160706996342162f, 0.801376171723140351f,
+  -0.599389298400564541f, 0.800457662192622821f,
+  -0.600616479383868751f, 0.799537269107905235f,
+  -0.601842247058579916f, 0.798614994634760933f,
+  -0.603066598540348275f, 0.797690840943391044f,
+  -0.604289530948155851f, 0.796764810208418939f,
+  -0.605511041404325434f, 0.795836904608883566f,
+  -0.606731127034524587f, 0.794907126328236902f,
+  -0.607949784967773521f, 0.793975477554337283f,
+  -0.609167012336453206f, 0.793041960479443642f,
+  -0.610382806276309586f, 0.792106577300212278f,
+  -0.611597163926461795f, 0.791169330217690314f,
+  -0.612810082429409708f, 0.790230221437310032f,
+  -0.614021558931038158f, 0.789289253168885874f,
+  -0.615231590580626708f, 0.788346427626606339f,
+  -0.616440174530853646f, 0.787401747029031318f,
+  -0.617647307937803758f, 0.786455213599085878f,
+  -0.618852987960976209f, 0.785506829564054043f,
+  -0.620057211763289207f, 0.784556597155575131f,
+  -0.621259976511087442f, 0.783604518609638312f,
+  -0.622461279374149967f, 0.782650596166575729f,
+  -0.623661117525694642f, 0.781694832071059276f,
+  -0.624859488142386232f, 0.780737228572094599f,
+  -0.626056388404343522f, 0.779777787923014443f,
+  -0.627251815495143861f, 0.778816512381476089f,
+  -0.628445766601832601f, 0.777853404209453148f,
+  -0.629638238914927095f, 0.776888465673232442f,
+  -0.630829229628424359f, 0.775921699043407798f,
+  -0.632018735939808951f, 0.774953106594873931f,
+  -0.633206755050057302f, 0.773982690606822787f,
+  -0.634393284163645377f, 0.773010453362737104f,
+  -0.635578320488556114f, 0.772036397150384524f,
+  -0.636761861236284310f, 0.771060524261813707f,
+  -0.637943903621843944f, 0.770082836993348008f,
+  -0.639124444863775731f, 0.769103337645579588f,
+  -0.640303482184151451f, 0.768122028523365530f,
+  -0.641481012808583051f, 0.767138911935820511f,
+  -0.642657033966226865f, 0.766153990196312917f,
+  -0.643831542889791275f, 0.765167265622459070f,
+  -0.645004536815543927f, 0.764178740536116785f,
+  -0.646176012983316395f, 0.763188417263381269f,
+  -0.647345968636511948f, 0.762196298134579009f,
+  -0.648514401022112441f, 0.761202385484261890f,
+  -0.649681307390683305f, 0.760206681651202310f,
+  -0.650846684996380764f, 0.759209188978388183f,
+  -0.652010531096959500f, 0.758209909813015281f,
+  -0.653172842953776533f, 0.757208846506484679f,
+  -0.654333617831800440f, 0.756206001414394535f,
+  -0.655492852999615461f, 0.755201376896536547f,
+  -0.656650545729428825f, 0.754194975316889282f,
+  -0.657806693297078637f, 0.753186799043612520f,
+  -0.658961292982037428f, 0.752176850449042700f,
+  -0.660114342067420368f, 0.751165131909686590f,
+  -0.661265837839992154f, 0.750151645806215073f,
+  -0.662415777590171895f, 0.749136394523459259f,
+  -0.663564158612039656f, 0.748119380450403715f,
+  -0.664710978203344904f, 0.747100605980180132f,
+  -0.665856233665509500f, 0.746080073510064001f,
+  -0.666999922303637360f, 0.745057785441466058f,
+  -0.668142041426518563f, 0.744033744179929291f,
+  -0.669282588346635898f, 0.743007952135121830f,
+  -0.670421560380173087f, 0.741980411720831068f,
+  -0.671558954847018441f, 0.740951125354958995f,
+  -0.672694769070772747f, 0.739920095459516314f,
+  -0.673829000378756038f, 0.738887324460615225f,
+  -0.674961646102012147f, 0.737852814788465872f,
+  -0.676092703575315812f, 0.736816568877370015f,
+  -0.677222170137180446f, 0.735778589165713481f,
+  -0.678350043129861247f, 0.734738878095963610f,
+  -0.679476319899364967f, 0.733697438114660372f,
+  -0.680600997795453022f, 0.732654271672412816f,
+  -0.681724074171649597f, 0.731609381223892741f,
+  -0.682845546385247970f, 0.730562769227827591f,
+  -0.683965411797315515f, 0.729514438146997013f,
+  -0.685083667772700244f, 0.728464390448225307f,
+  -0.686200311680038588f, 0.727412628602375766f,
+  -0.687315340891759163f, 0.726359155084345898f,
+  -0.688428752784090325f, 0.725303972373060879f,
+  -0.689540544737066941f, 0.724247082951466892f,
+  -0.690650714134534383f, 0.723188489306527571f,
+  -0.691759258364157636f, 0.722128193929215456f,
+  -0.692866174817424740f, 0.721066199314508105f,
+  -0.693971460889653780f, 0.720002507961381766f,
+  -0.695075113980000769f, 0.718937122372804494f,
+  -0.696177131491462986f, 0.717870045055731709f,
+  -0.697277510830886404f, 0.716801278521099650f,
+  -0.698376249408972805f, 0.715730825283818706f,
+  -0.699473344640283878f, 0.714658687862768982f,
+  -0.700568793943248225f, 0.713584868780793746f,
+  -0.701662594740168455f, 0.712509370564692324f,
+  -0.702754744457225078f, 0.711432195745216656f,
+  -0.703845240524484828f, 0.710353346857062418f,
+  -0.704934080375904881f, 0.709272826438865578f,
+  -0.706021261449339632f, 0.708190637033195514f,
+  -0.707106781186547462f, 0.707106781186547573f,
+  -0.708190637033195403f, 0.706021261449339743f,
+  -0.709272826438865467f, 0.704934080375905103f,
+  -0.710353346857062307f, 0.703845240524485050f,
+  -0.711432195745216545f, 0.702754744457225189f,
+  -0.712509370564692213f, 0.701662594740168677f,
+  -0.713584868780793635f, 0.700568793943248336f,
+  -0.714658687862768871f, 0.699473344640283989f,
+  -0.715730825283818595f, 0.698376249408972916f,
+  -0.716801278521099539f, 0.697277510830886516f,
+  -0.717870045055731598f, 0.696177131491463097f,
+  -0.718937122372804382f, 0.695075113980000991f,
+  -0.720002507961381655f, 0.693971460889654002f,
+  -0.721066199314507994f, 0.692866174817424851f,
+  -0.722128193929215234f, 0.691759258364157859f,
+  -0.723188489306527460f, 0.690650714134534605f,
+  -0.724247082951466781f, 0.689540544737067052f,
+  -0.725303972373060768f, 0.688428752784090436f,
+  -0.726359155084345787f, 0.687315340891759274f,
+  -0.727412628602375655f, 0.686200311680038699f,
+  -0.728464390448225196f, 0.685083667772700355f,
+  -0.729514438146996791f, 0.683965411797315626f,
+  -0.730562769227827480f, 0.682845546385248192f,
+  -0.731609381223892630f, 0.681724074171649708f,
+  -0.732654271672412705f, 0.680600997795453244f,
+  -0.733697438114660261f, 0.679476319899365078f,
+  -0.734738878095963499f, 0.678350043129861358f,
+  -0.735778589165713370f, 0.677222170137180557f,
+  -0.736816568877369904f, 0.676092703575315923f,
+  -0.737852814788465761f, 0.674961646102012258f,
+  -0.738887324460615003f, 0.673829000378756149f,
+  -0.739920095459516203f, 0.672694769070772858f,
+  -0.740951125354958884f, 0.671558954847018552f,
+  -0.741980411720830957f, 0.670421560380173198f,
+  -0.743007952135121719f, 0.669282588346636009f,
+  -0.744033744179929069f, 0.668142041426518674f,
+  -0.745057785441465947f, 0.666999922303637582f,
+  -0.746080073510063890f, 0.665856233665509611f,
+  -0.747100605980180021f, 0.664710978203345015f,
+  -0.748119380450403604f, 0.663564158612039767f,
+  -0.749136394523459148f, 0.662415777590172006f,
+  -0.750151645806214962f, 0.661265837839992376f,
+  -0.751165131909686479f, 0.660114342067420479f,
+  -0.752176850449042478f, 0.658961292982037539f,
+  -0.753186799043612409f, 0.657806693297078748f,
+  -0.754194975316889171f, 0.656650545729429047f,
+  -0.755201376896536436f, 0.655492852999615572f,
+  -0.756206001414394424f, 0.654333617831800551f,
+  -0.757208846506484567f, 0.653172842953776644f,
+  -0.758209909813015170f, 0.652010531096959722f,
+  -0.759209188978388072f, 0.650846684996380986f,
+  -0.760206681651202199f, 0.649681307390683416f,
+  -0.761202385484261668f, 0.648514401022112552f,
+  -0.762196298134578898f, 0.647345968636512059f,
+  -0.763188417263381047f, 0.646176012983316617f,
+  -0.764178740536116674f, 0.645004536815544038f,
+  -0.765167265622458959f, 0.643831542889791386f,
+  -0.766153990196312695f, 0.642657033966227087f,
+  -0.767138911935820289f, 0.641481012808583162f,
+  -0.768122028523365419f, 0.640303482184151562f,
+  -0.769103337645579477f, 0.639124444863775842f,
+  -0.770082836993347897f, 0.637943903621844055f,
+  -0.771060524261813596f, 0.636761861236284421f,
+  -0.772036397150384412f, 0.635578320488556225f,
+  -0.773010453362736993f, 0.634393284163645488f,
+  -0.773982690606822676f, 0.633206755050057413f,
+  -0.774953106594873820f, 0.632018735939809062f,
+  -0.775921699043407687f, 0.630829229628424470f,
+  -0.776888465673232331f, 0.629638238914927206f,
+  -0.777853404209453037f, 0.628445766601832712f,
+  -0.778816512381475978f, 0.627251815495144083f,
+  -0.779777787923014332f, 0.626056388404343633f,
+  -0.780737228572094488f, 0.624859488142386343f,
+  -0.781694832071059165f, 0.623661117525694864f,
+  -0.782650596166575618f, 0.622461279374150078f,
+  -0.783604518609638201f, 0.621259976511087553f,
+  -0.784556597155575020f, 0.620057211763289429f,
+  -0.785506829564053932f, 0.618852987960976431f,
+  -0.786455213599085767f, 0.617647307937803869f,
+  -0.787401747029031207f, 0.616440174530853757f,
+  -0.788346427626606228f, 0.615231590580626930f,
+  -0.789289253168885763f, 0.614021558931038380f,
+  -0.790230221437309921f, 0.612810082429409819f,
+  -0.791169330217690203f, 0.611597163926461906f,
+  -0.792106577300212167f, 0.610382806276309697f,
+  -0.793041960479443531f, 0.609167012336453317f,
+  -0.793975477554337172f, 0.607949784967773632f,
+  -0.794907126328236791f, 0.606731127034524698f,
+  -0.795836904608883455f, 0.605511041404325656f,
+  -0.796764810208418828f, 0.604289530948155962f,
+  -0.797690840943390933f, 0.603066598540348386f,
+  -0.798614994634760822f, 0.601842247058580138f,
+  -0.799537269107905124f, 0.600616479383868862f,
+  -0.800457662192622710f, 0.599389298400564652f,
+  -0.801376171723140240f, 0.598160706996342384f,
+  -0.802292795538115500f, 0.596930708062196724f,
+  -0.803207531480644832f, 0.595699304492433468f,
+  -0.804120377398265695f, 0.594466499184664432f,
+  -0.805031331142963436f, 0.593232295039800017f,
+  -0.805940390571176279f, 0.591996694962040992f,
+  -0.806847553543799334f, 0.590759701858874164f,
+  -0.807752817926190247f, 0.589521318641064052f,
+  -0.808656181588174983f, 0.588281548222645334f,
+  -0.809557642404051370f, 0.587040393520917969f,
+  -0.810457198252594657f, 0.585797857456438975f,
+  -0.811354847017063729f, 0.584553942953015326f,
+  -0.812250586585203771f, 0.583308652937698513f,
+  -0.813144414849253483f, 0.582061990340775659f,
+  -0.814036329705948414f, 0.580813958095764526f,
+  -0.814926329056526400f, 0.579564559139405966f,
+  -0.815814410806733670f, 0.578313796411655701f,
+  -0.816700572866827845f, 0.577061672855679442f,
+  -0.817584813151583600f, 0.575808191417845450f,
+  -0.818467129580298658f, 0.574553355047715875f,
+  -0.819347520076797009f, 0.573297166698042093f,
+  -0.820225982569434575f, 0.572039629324757271f,
+  -0.821102514991104648f, 0.570780745886967256f,
+  -0.821977115279241333f, 0.569520519346947474f,
+  -0.822849781375826206f, 0.568258952670131712f,
+  -0.823720511227391428f, 0.566996048825108678f,
+  -0.824589302785025069f, 0.565731810783613454f,
+  -0.825456154004377440f, 0.564466241520519496f,
+  -0.826321062845663534f, 0.563199344013834091f,
+  -0.827184027273669020f, 0.561931121244689580f,
+  -0.828045045257755685f, 0.560661576197336142f,
+  -0.828904114771864986f, 0.559390711859136025f,
+  -0.829761233794522934f, 0.558118531220556324f,
+  -0.830616400308846314f, 0.556845037275160104f,
+  -0.831469612302545347f, 0.555570233019602178f,
+  -0.832320867767929573f, 0.554294121453620225f,
+  -0.833170164701913185f, 0.553016705580027579f,
+  -0.834017501106018022f, 0.551737988404707669f,
+  -0.834862874986380010f, 0.550457972936604922f,
+  -0.835706284353752604f, 0.549176662187719655f,
+  -0.836547727223511894f, 0.547894059173100412f,
+  -0.837387201615661825f, 0.546610166910834971f,
+  -0.838224705554838079f, 0.545324988422046353f,
+  -0.839060237070312631f, 0.544038526730884042f,
+  -0.839893794195999521f, 0.542750784864515889f,
+  -0.840725374970458073f, 0.541461765853123334f,
+  -0.841554977436898333f, 0.540171472729892965f,
+  -0.842382599643185848f, 0.538879908531008422f,
+  -0.843208239641845325f, 0.537587076295645727f,
+  -0.844031895490066408f, 0.536292979065963293f,
+  -0.844853565249707117f, 0.534997619887097153f,
+  -0.845673246987298954f, 0.533701001807153186f,
+  -0.846490938774052015f, 0.532403127877198012f,
+  -0.847306638685858426f, 0.531104001151254890f,
+  -0.848120344803297121f, 0.529803624686294827f,
+  -0.848932055211639613f, 0.528502001542228483f,
+  -0.849741768000852549f, 0.527199134781901280f,
+  -0.850549481265603369f, 0.525895027471084853f,
+  -0.851355193105265196f, 0.524589682678468949f,
+  -0.852158901623919607f, 0.523283103475656652f,
+  -0.852960604930363631f, 0.521975292937154500f,
+  -0.853760301138111410f, 0.520666254140367157f,
+  -0.854557988365400423f, 0.519355990165589754f,
+  -0.855353664735195918f, 0.518044504095999447f,
+  -0.856147328375194472f, 0.516731799017649762f,
+  -0.856938977417828651f, 0.515417878019463149f,
+  -0.857728610000272007f, 0.514102744193221772f,
+  -0.858516224264442851f, 0.512786400633562955f,
+  -0.859301818357008362f, 0.511468850437970524f,
+  -0.860085390429390140f, 0.510150096706766809f,
+  -0.860866938637767087f, 0.508830142543107322f,
+  -0.861646461143081299f, 0.507508991052970981f,
+  -0.862423956111040502f, 0.506186645345155228f,
+  -0.863199421712124049f, 0.504863108531267701f,
+  -0.863972856121586696f, 0.503538383725717686f,
+  -0.864744257519462378f, 0.502212474045710677f,
+  -0.865513624090568978f, 0.500885382611240937f,
+  -0.866280954024512995f, 0.499557112545081949f,
+  -0.867046245515692759f, 0.498227666972781758f,
+  -0.867809496763303212f, 0.496897049022654691f,
+  -0.868570705971340895f, 0.495565261825772541f,
+  -0.869329871348606620f, 0.494232308515960006f,
+  -0.870086991108711350f, 0.492898192229784149f,
+  -0.870842063470078975f, 0.491562916106549896f,
+  -0.871595086655950868f, 0.490226483288291381f,
+  -0.872346058894391430f, 0.488888896919763283f,
+  -0.873094978418290091f, 0.487550160148435885f,
+  -0.873841843465366752f, 0.486210276124486585f,
+  -0.874586652278176113f, 0.484869248000791120f,
+  -0.875329403104110892f, 0.483527078932918630f,
+  -0.876070094195406490f, 0.482183772079122885f,
+  -0.876808723809145651f, 0.480839330600333958f,
+  -0.877545290207261131f, 0.479493757660153286f,
+  -0.878279791656541464f, 0.478147056424843175f,
+  -0.879012226428633525f, 0.476799230063322088f,
+  -0.879742592800047296f, 0.475450281747156089f,
+  -0.880470889052160754f, 0.474100214650550078f,
+  -0.881197113471222093f, 0.472749031950342735f,
+  -0.881921264348354939f, 0.471396736825997864f,
+  -0.882643339979562791f, 0.470043332459595675f,
+  -0.883363338665731690f, 0.468688822035827846f,
+  -0.884081258712634876f, 0.467333208741988582f,
+  -0.884797098430937790f, 0.465976495767966181f,
+  -0.885510856136199842f, 0.464618686306238093f,
+  -0.886222530148880527f, 0.463259783551860316f,
+  -0.886932118794342195f, 0.461899790702462731f,
+  -0.887639620402853824f, 0.460538710958240227f,
+  -0.888345033309596244f, 0.459176547521944201f,
+  -0.889048355854664574f, 0.457813303598877175f,
+  -0.889749586383072666f, 0.456448982396884140f,
+  -0.890448723244757878f, 0.455083587126343891f,
+  -0.891145764794583295f, 0.453717121000163759f,
+  -0.891840709392342612f, 0.452349587233771055f,
+  -0.892533555402764578f, 0.450980989045103864f,
+  -0.893224301195515213f, 0.449611329654606873f,
+  -0.893912945145203142f, 0.448240612285220053f,
+  -0.894599485631382696f, 0.446868840162374159f,
+  -0.895283921038557362f, 0.445496016513981963f,
+  -0.895966249756185107f, 0.444122144570429311f,
+  -0.896646470178680266f, 0.442747227564569967f,
+  -0.897324580705418207f, 0.441371268731716893f,
+  -0.898000579740739768f, 0.439994271309633311f,
+  -0.898674465693953928f, 0.438616238538527548f,
+  -0.899346236979341462f, 0.437237173661044254f,
+  -0.900015892016160168f, 0.435857079922255530f,
+  -0.900683429228646748f, 0.434475960569655983f,
+  -0.901348847046021917f, 0.433093818853152068f,
+  -0.902012143902493180f, 0.431710658025057259f,
+  -0.902673318237258715f, 0.430326481340082889f,
+  -0.903332368494511817f, 0.428941292055329604f,
+  -0.903989293123443338f, 0.427555093430282029f,
+  -0.904644090578246129f, 0.426167888726799837f,
+  -0.905296759318118704f, 0.424779681209108861f,
+  -0.905947297807268459f, 0.423390474143795936f,
+  -0.906595704514915335f, 0.422000270799799848f,
+  -0.907241977915295816f, 0.420609074448402565f,
+  -0.907886116487666039f, 0.419216888363224238f,
+  -0.908528118716306121f, 0.417823715820212438f,
+  -0.909167983090522380f, 0.416429560097637153f,
+  -0.909805708104652111f, 0.415034424476081854f,
+  -0.910441292258067136f, 0.413638312238434613f,
+  -0.911074734055176361f, 0.412241226669882832f,
+  -0.911706032005429767f, 0.410843171057904133f,
+  -0.912335184623322748f, 0.409444148692257648f,
+  -0.912962190428398213f, 0.408044162864978577f,
+  -0.913587047945250808f, 0.406643216870369195f,
+  -0.914209755703530691f, 0.405241314004989917f,
+  -0.914830312237945975f, 0.403838457567654407f,
+  -0.915448716088267722f, 0.402434650859418597f,
+  -0.916064965799331721f, 0.401029897183575623f,
+  -0.916679059921042594f, 0.399624199845647066f,
+  -0.917290997008377906f, 0.398217562153373672f,
+  -0.917900775621390497f, 0.396809987416710253f,
+  -0.918508394325212141f, 0.395401478947816520f,
+  -0.919113851690057770f, 0.393992040061048154f,
+  -0.919717146291227361f, 0.392581674072951414f,
+  -0.920318276709110483f, 0.391170384302254037f,
+  -0.920917241529189412f, 0.389758174069856467f,
+  -0.921514039342041791f, 0.388345046698826579f,
+  -0.922108668743345072f, 0.386931005514388748f,
+  -0.922701128333878628f, 0.385516053843918849f,
+  -0.923291416719527525f, 0.384100195016935320f,
+  -0.923879532511286738f, 0.382683432365089893f,
+  -0.924465474325262604f, 0.381265769222162321f,
+  -0.925049240782677473f, 0.379847208924051383f,
+  -0.925630830509872715f, 0.378427754808765671f,
+  -0.926210242138311379f, 0.377007410216418148f,
+  -0.926787474304581749f, 0.375586178489217382f,
+  -0.927362525650401115f, 0.374164062971458045f,
+  -0.927935394822617776f, 0.372741067009516092f,
+  -0.928506080473215478f, 0.371317193951837710f,
+  -0.929074581259315746f, 0.369892447148934100f,
+  -0.929640895843181214f, 0.368466829953372599f,
+  -0.930205022892219069f, 0.367040345719767291f,
+  -0.930766961078983712f, 0.365612997804773798f,
+  -0.931326709081180315f, 0.364184789567080114f,
+  -0.931884265581668036f, 0.362755724367397281f,
+  -0.932439629268462467f, 0.361325805568454173f,
+  -0.932992798834738846f, 0.359895036534988333f,
+  -0.933543772978836173f, 0.358463420633736596f,
+  -0.934092550404258759f, 0.357030961233430311f,
+  -0.934639129819680670f, 0.355597661704784018f,
+  -0.935183509938947610f, 0.354163525420490399f,
+  -0.935725689481080258f, 0.352728555755210949f,
+  -0.936265667170278260f, 0.351292756085567204f,
+  -0.936803441735921671f, 0.349856129790134862f,
+  -0.937339011912574849f, 0.348418680249434787f,
+  -0.937872376439989774f, 0.346980410845923737f,
+  -0.938403534063108169f, 0.345541324963988983f,
+  -0.938932483532064488f, 0.344101425989939036f,
+  -0.939459223602189919f, 0.342660717311994434f,
+  -0.939983753034013825f, 0.341219202320282688f,
+  -0.940506070593268295f, 0.339776884406827018f,
+  -0.941026175050889258f, 0.338333766965541183f,
+  -0.941544065183020695f, 0.336889853392220329f,
+  -0.942059739771017313f, 0.335445147084531714f,
+  -0.942573197601446866f, 0.333999651442009382f,
+  -0.943084437466093384f, 0.332553369866044446f,
+  -0.943593458161960386f, 0.331106305759876485f,
+  -0.944100258491272659f, 0.329658462528587437f,
+  -0.944604837261480146f, 0.328209843579092719f,
+  -0.945107193285260605f, 0.326760452320131844f,
+  -0.945607325380521169f, 0.325310292162263259f,
+  -0.946105232370403337f, 0.323859366517853020f,
+  -0.946600913083283535f, 0.322407678801069852f,
+  -0.947094366352777106f, 0.320955232427875492f,
+  -0.947585591017741091f, 0.319502030816015803f,
+  -0.948074585922276225f, 0.318048077385014893f,
+  -0.948561349915730267f, 0.316593375556166068f,
+  -0.949045881852700557f, 0.315137928752522500f,
+  -0.949528180593036675f, 0.313681740398891407f,
+  -0.950008245001842999f, 0.312224813921825106f,
+  -0.950486073949481702f, 0.310767152749611530f,
+  -0.950961666311574971f, 0.309308760312269004f,
+  -0.951435020969008338f, 0.307849640041535033f,
+  -0.951906136807932346f, 0.306389795370860918f,
+  -0.952375012719765768f, 0.304929229735402652f,
+  -0.952841647601198605f, 0.303467946572011427f,
+  -0.953306040354193862f, 0.302005949319228029f,
+  -0.953768189885990214f, 0.300543241417273677f,
+  -0.954228095109105556f, 0.299079826308040531f,
+  -0.954685754941338338f, 0.297615707435086141f,
+  -0.955141168305770671f, 0.296150888243624011f,
+  -0.955594334130771106f, 0.294685372180514382f,
+  -0.956045251349996295f, 0.293219162694258961f,
+  -0.956493918902394991f, 0.291752263234989428f,
+  -0.956940335732208824f, 0.290284677254462387f,
+  -0.957384500788975856f, 0.288816408206049757f,
+  -0.957826413027532908f, 0.287347459544729622f,
+  -0.958266071408017672f, 0.285877834727080560f,
+  -0.958703474895871488f, 0.284407537211272099f,
+  -0.959138622461841894f, 0.282936570457055447f,
+  -0.959571513081984517f, 0.281464937925757885f,
+  -0.960002145737665846f, 0.279992643080273440f,
+  -0.960430519415565787f, 0.278519689385053171f,
+  -0.960856633107679547f, 0.277046080306100229f,
+  -0.961280485811320640f, 0.275571819310958310f,
+  -0.961702076529122540f, 0.274096909868706384f,
+  -0.962121404269041469f, 0.272621355449949254f,
+  -0.962538468044359163f, 0.271145159526808122f,
+  -0.962953266873683877f, 0.269668325572915091f,
+  -0.963365799780953935f, 0.268190857063403398f,
+  -0.963776065795439840f, 0.266712757474898476f,
+  -0.964184063951745829f, 0.265234030285511735f,
+  -0.964589793289812647f, 0.263754678974831569f,
+  -0.964993252854920325f, 0.262274707023913700f,
+  -0.965394441697689287f, 0.260794117915275847f,
+  -0.965793358874083574f, 0.259312915132886401f,
+  -0.966190003445412504f, 0.257831102162158987f,
+  -0.966584374478333008f, 0.256348682489943192f,
+  -0.966976471044852071f, 0.254865659604514683f,
+  -0.967366292222328505f, 0.253382036995570104f,
+  -0.967753837093475400f, 0.251897818154217190f,
+  -0.968139104746362333f, 0.250413006572965335f,
+  -0.968522094274417378f, 0.248927605745720093f,
+  -0.968902804776428872f, 0.247441619167773491f,
+  -0.969281235356548421f, 0.245955050335794650f,
+  -0.969657385124292337f, 0.244467902747824484f,
+  -0.970031253194543974f, 0.242980179903264065f,
+  -0.970402838687555502f, 0.241491885302869358f,
+  -0.970772140728950239f, 0.240003022448741776f,
+  -0.971139158449725093f, 0.238513594844318555f,
+  -0.971503890986251784f, 0.237023605994367170f,
+  -0.971866337480279285f, 0.235533059404975736f,
+  -0.972226497078936269f, 0.234041958583543513f,
+  -0.972584368934732213f, 0.232550307038775161f,
+  -0.972939952205560066f, 0.231058108280671332f,
+  -0.973293246054698247f, 0.229565365820518924f,
+  -0.973644249650811866f, 0.228072083170886064f,
+  -0.973992962167955834f, 0.226578263845610167f,
+  -0.974339382785575858f, 0.225083911359792832f,
+  -0.974683510688510668f, 0.223589029229790293f,
+  -0.975025345066994120f, 0.222093620973203648f,
+  -0.975364885116656977f, 0.220597690108873506f,
+  -0.975702130038528459f, 0.219101240156870047f,
+  -0.976037079039039024f, 0.217604274638483725f,
+  -0.976369731330021140f, 0.216106797076219437f,
+  -0.976700086128711731f, 0.214608810993786980f,
+  -0.977028142657754395f, 0.213110319916091417f,
+  -0.977353900145199961f, 0.211611327369227886f,
+  -0.977677357824509929f, 0.210111836880469804f,
+  -0.977998514934557139f, 0.208611851978263513f,
+  -0.978317370719627544f, 0.207111376192218838f,
+  -0.978633924429423097f, 0.205610413053099378f,
+  -0.978948175319062197f, 0.204108966092816840f,
+  -0.979260122649082021f, 0.202607038844421383f,
+  -0.979569765685440519f, 0.201104634842092012f,
+  -0.979877103699517638f, 0.199601757621130915f,
+  -0.980182135968117318f, 0.198098410717953810f,
+  -0.980484861773469385f, 0.196594597670080279f,
+  -0.980785280403230431f, 0.195090322016128609f,
+  -0.981083391150486595f, 0.193585587295803802f,
+  -0.981379193313754561f, 0.192080397049892465f,
+  -0.981672686196983113f, 0.190574754820253073f,
+  -0.981963869109555243f, 0.189068664149806359f,
+  -0.982252741366289372f, 0.187562128582529575f,
+  -0.982539302287441241f, 0.186055151663446910f,
+  -0.982823551198705236f, 0.184547736938619700f,
+  -0.983105487431216285f, 0.183039887955140895f,
+  -0.983385110321551181f, 0.181531608261125216f,
+  -0.983662419211730255f, 0.180022901405699570f,
+  -0.983937413449218923f, 0.178513770938997424f,
+  -0.984210092386929025f, 0.177004220412148944f,
+  -0.984480455383220932f, 0.175494253377271453f,
+  -0.984748501801904208f, 0.173983873387464127f,
+  -0.985014231012239838f, 0.172473083996796117f,
+  -0.985277642388941222f, 0.170961888760301217f,
+  -0.985538735312176062f, 0.169450291233968209f,
+  -0.985797509167567365f, 0.167938294974731284f,
+  -0.986053963346195439f, 0.166425903540464049f,
+  -0.986308097244598558f, 0.164913120489970144f,
+  -0.986559910264775408f, 0.163399949382973281f,
+  -0.986809401814185527f, 0.161886393780111743f,
+  -0.987056571305750974f, 0.160372457242928451f,
+  -0.987301418157858435f, 0.158858143333861473f,
+  -0.987543941794359226f, 0.157343455616238553f,
+  -0.987784141644572178f, 0.155828397654265371f,
+  -0.988022017143283526f, 0.154312973013020077f,
+  -0.988257567730749464f, 0.152797185258443685f,
+  -0.988490792852696587f, 0.151281037957330305f,
+  -0.988721691960323779f, 0.149764534677321454f,
+  -0.988950264510302990f, 0.148247678986896253f,
+  -0.989176509964781014f, 0.146730474455361803f,
+  -0.989400427791380377f, 0.145212924652847353f,
+  -0.989622017463200776f, 0.143695033150294638f,
+  -0.989841278458820528f, 0.142176803519448086f,
+  -0.990058210262297012f, 0.140658239332849544f,
+  -0.990272812363169108f, 0.139139344163826340f,
+  -0.990485084256457093f, 0.137620121586486038f,
+  -0.990695025442664634f, 0.136100575175706479f,
+  -0.990902635427780010f, 0.134580708507126279f,
+  -0.991107913723276890f, 0.133060525157139009f,
+  -0.991310859846115444f, 0.131540028702883338f,
+  -0.991511473318743897f, 0.130019222722233430f,
+  -0.991709753669099525f, 0.128498110793793086f,
+  -0.991905700430609327f, 0.126976696496886060f,
+  -0.992099313142191797f, 0.125454983411546261f,
+  -0.992290591348257256f, 0.123932975118512478f,
+  -0.992479534598709967f, 0.122410675199216348f,
+  -0.992666142448948019f, 0.120888087235777056f,
+  -0.992850414459865105f, 0.119365214810991632f,
+  -0.993032350197851410f, 0.117842061508325088f,
+  -0.993211949234794500f, 0.116318630911904711f,
+  -0.993389211148080653f, 0.114794926606510306f,
+  -0.993564135520595304f, 0.113270952177564416f,
+  -0.993736721940724599f, 0.111746711211126504f,
+  -0.993906970002356061f, 0.110222207293883240f,
+  -0.994074879304879366f, 0.108697444013138744f,
+  -0.994240449453187902f, 0.107172424956809162f,
+  -0.994403680057679096f, 0.105647153713410755f,
+  -0.994564570734255415f, 0.104121633872054573f,
+  -0.994723121104325703f, 0.102595869022436559f,
+  -0.994879330794805616f, 0.101069862754827933f,
+  -0.995033199438118632f, 0.099543618660069277f,
+  -0.995184726672196818f, 0.098017140329560826f,
+  -0.995333912140482280f, 0.096490431355252662f,
+  -0.995480755491926939f, 0.094963495329638908f,
+  -0.995625256380994306f, 0.093436335845747967f,
+  -0.995767414467659817f, 0.091908956497132752f,
+  -0.995907229417411721f, 0.090381360877865288f,
+  -0.996044700901251967f, 0.088853552582524753f,
+  -0.996179828595696981f, 0.087325535206192059f,
+  -0.996312612182778001f, 0.085797312344440158f,
+  -0.996443051350042630f, 0.084268887593324182f,
+  -0.996571145790554835f, 0.082740264549375636f,
+  -0.996696895202896060f, 0.081211446809592663f,
+  -0.996820299291165668f, 0.079682437971430195f,
+  -0.996941357764982161f, 0.078153241632794149f,
+  -0.997060070339482962f, 0.076623861392031686f,
+  -0.997176436735326077f, 0.075094300847921347f,
+  -0.997290456678690207f, 0.073564563599667732f,
+  -0.997402129901275303f, 0.072034653246889471f,
+  -0.997511456140303454f, 0.070504573389613856f,
+  -0.997618435138519555f, 0.068974327628267024f,
+  -0.997723066644191636f, 0.067443919563664176f,
+  -0.997825350411111645f, 0.065913352797003763f,
+  -0.997925286198595995f, 0.064382630929857701f,
+  -0.998022873771486241f, 0.062851757564161490f,
+  -0.998118112900149179f, 0.061320736302208488f,
+  -0.998211003360478188f, 0.059789570746640069f,
+  -0.998301544933892893f, 0.058258264500435794f,
+  -0.998389737407340161f, 0.056726821166908067f,
+  -0.998475580573294774f, 0.055195244349690094f,
+  -0.998559074229759314f, 0.053663537652730520f,
+  -0.998640218180265160f, 0.052131704680283594f,
+  -0.998719012233872938f, 0.050599749036899393f,
+  -0.998795456205172405f, 0.049067674327417966f,
+  -0.998869549914283561f, 0.047535484156959538f,
+  -0.998941293186856871f, 0.046003182130914706f,
+  -0.999010685854073377f, 0.044470771854938584f,
+  -0.999077727752645361f, 0.042938256934941021f,
+  -0.999142418724816905f, 0.041405640977076774f,
+  -0.999204758618363886f, 0.039872927587740130f,
+  -0.999264747286594424f, 0.038340120373552854f,
+  -0.999322384588349544f, 0.036807222941358832f,
+  -0.999377670388002848f, 0.035274238898214232f,
+  -0.999430604555461732f, 0.033741171851377705f,
+  -0.999481186966166946f, 0.032208025408304544f,
+  -0.999529417501093143f, 0.030674803176636865f,
+  -0.999575296046749218f, 0.029141508764193802f,
+  -0.999618822495178638f, 0.027608145778965660f,
+  -0.999659996743959223f, 0.026074717829104099f,
+  -0.999698818696204250f, 0.024541228522912326f,
+  -0.999735288260561683f, 0.023007681468839695f,
+  -0.999769405351215279f, 0.021474080275469667f,
+  -0.999801169887884256f, 0.019940428551514438f,
+  -0.999830581795823403f, 0.018406729905805101f,
+  -0.999857641005823861f, 0.016872987947281835f,
+  -0.999882347454212561f, 0.015339206284988060f,
+  -0.999904701082852787f, 0.013805388528060632f,
+  -0.999924701839144503f, 0.012271538285720007f,
+  -0.999942349676023912f, 0.010737659167264411f,
+  -0.999957644551963898f, 0.009203754782060021f,
+  -0.999970586430974140f, 0.007669828739531138f,
+  -0.999981175282601109f, 0.006135884649154799f,
+  -0.999989411081928403f, 0.004601926120448733f,
+  -0.999995293809576191f, 0.003067956762965977f,
+  -0.999998823451701879f, 0.001533980186285049f,
+  -1.000000000000000000f, 0.000000000000000122f,
+  -0.999998823451701879f, -0.001533980186284804f,
+  -0.999995293809576191f, -0.003067956762965732f,
+  -0.999989411081928403f, -0.004601926120448488f,
+  -0.999981175282601109f, -0.006135884649154554f,
+  -0.999970586430974140f, -0.007669828739530893f,
+  -0.999957644551963898f, -0.009203754782059776f,
+  -0.999942349676023912f, -0.010737659167264166f,
+  -0.999924701839144503f, -0.012271538285719762f,
+  -0.999904701082852898f, -0.013805388528060387f,
+  -0.999882347454212561f, -0.015339206284987816f,
+  -0.999857641005823861f, -0.016872987947281589f,
+  -0.999830581795823403f, -0.018406729905804858f,
+  -0.999801169887884256f, -0.019940428551514192f,
+  -0.999769405351215279f, -0.021474080275469421f,
+  -0.999735288260561683f, -0.023007681468839448f,
+  -0.999698818696204250f, -0.024541228522912080f,
+  -0.999659996743959223f, -0.026074717829103856f,
+  -0.999618822495178638f, -0.027608145778965414f,
+  -0.999575296046749218f, -0.029141508764193556f,
+  -0.999529417501093143f, -0.030674803176636619f,
+  -0.999481186966166946f, -0.032208025408304294f,
+  -0.999430604555461732f, -0.033741171851377455f,
+  -0.999377670388002848f, -0.035274238898213982f,
+  -0.999322384588349544f, -0.036807222941358582f,
+  -0.999264747286594424f, -0.038340120373552611f,
+  -0.999204758618363886f, -0.039872927587739887f,
+  -0.999142418724816905f, -0.041405640977076531f,
+  -0.999077727752645361f, -0.042938256934940779f,
+  -0.999010685854073377f, -0.044470771854938335f,
+  -0.998941293186856871f, -0.046003182130914456f,
+  -0.998869549914283561f, -0.047535484156959296f,
+  -0.998795456205172405f, -0.049067674327417724f,
+  -0.998719012233872938f, -0.050599749036899150f,
+  -0.998640218180265271f, -0.052131704680283351f,
+  -0.998559074229759314f, -0.053663537652730277f,
+  -0.998475580573294774f, -0.055195244349689851f,
+  -0.998389737407340161f, -0.056726821166907818f,
+  -0.998301544933892893f, -0.058258264500435551f,
+  -0.998211003360478188f, -0.059789570746639827f,
+  -0.998118112900149179f, -0.061320736302208245f,
+  -0.998022873771486241f, -0.062851757564161240f,
+  -0.997925286198595995f, -0.064382630929857451f,
+  -0.997825350411111645f, -0.065913352797003527f,
+  -0.997723066644191636f, -0.067443919563663926f,
+  -0.997618435138519555f, -0.068974327628266774f,
+  -0.997511456140303454f, -0.070504573389613606f,
+  -0.997402129901275303f, -0.072034653246889235f,
+  -0.997290456678690207f, -0.073564563599667496f,
+  -0.997176436735326188f, -0.075094300847921097f,
+  -0.997060070339482962f, -0.076623861392031437f,
+  -0.996941357764982161f, -0.078153241632793899f,
+  -0.996820299291165779f, -0.079682437971429945f,
+  -0.996696895202896060f, -0.081211446809592427f,
+  -0.996571145790554835f, -0.082740264549375400f,
+  -0.996443051350042630f, -0.084268887593323932f,
+  -0.996312612182778001f, -0.085797312344439922f,
+  -0.996179828595696981f, -0.087325535206191809f,
+  -0.996044700901251967f, -0.088853552582524503f,
+  -0.995907229417411721f, -0.090381360877865052f,
+  -0.995767414467659817f, -0.091908956497132516f,
+  -0.995625256380994306f, -0.093436335845747731f,
+  -0.995480755491926939f, -0.094963495329638659f,
+  -0.995333912140482280f, -0.096490431355252412f,
+  -0.995184726672196929f, -0.098017140329560590f,
+  -0.995033199438118632f, -0.099543618660069041f,
+  -0.994879330794805616f, -0.101069862754827683f,
+  -0.994723121104325703f, -0.102595869022436309f,
+  -0.994564570734255526f, -0.104121633872054323f,
+  -0.994403680057679096f, -0.105647153713410519f,
+  -0.994240449453187902f, -0.107172424956808912f,
+  -0.994074879304879477f, -0.108697444013138494f,
+  -0.993906970002356061f, -0.110222207293883004f,
+  -0.993736721940724710f, -0.111746711211126254f,
+  -0.993564135520595304f, -0.113270952177564166f,
+  -0.993389211148080653f, -0.114794926606510070f,
+  -0.993211949234794611f, -0.116318630911904475f,
+  -0.993032350197851410f, -0.117842061508324839f,
+  -0.992850414459865105f, -0.119365214810991382f,
+  -0.992666142448948019f, -0.120888087235776820f,
+  -0.992479534598709967f, -0.122410675199216099f,
+  -0.992290591348257367f, -0.123932975118512229f,
+  -0.992099313142191797f, -0.125454983411546012f,
+  -0.991905700430609327f, -0.126976696496885810f,
+  -0.991709753669099525f, -0.128498110793792836f,
+  -0.991511473318744008f, -0.130019222722233180f,
+  -0.991310859846115444f, -0.131540028702883088f,
+  -0.991107913723276890f, -0.133060525157138759f,
+  -0.990902635427780010f, -0.134580708507126057f,
+  -0.990695025442664634f, -0.136100575175706229f,
+  -0.990485084256457093f, -0.137620121586485789f,
+  -0.990272812363169108f, -0.139139344163826117f,
+  -0.990058210262297123f, -0.140658239332849294f,
+  -0.989841278458820528f, -0.142176803519447836f,
+  -0.989622017463200887f, -0.143695033150294388f,
+  -0.989400427791380377f, -0.145212924652847131f,
+  -0.989176509964781014f, -0.146730474455361581f,
+  -0.988950264510302990f, -0.148247678986896031f,
+  -0.988721691960323779f, -0.149764534677321204f,
+  -0.988490792852696698f, -0.151281037957330083f,
+  -0.988257567730749464f, -0.152797185258443435f,
+  -0.988022017143283637f, -0.154312973013019827f,
+  -0.987784141644572178f, -0.155828397654265122f,
+  -0.987543941794359226f, -0.157343455616238304f,
+  -0.987301418157858435f, -0.158858143333861224f,
+  -0.987056571305750974f, -0.160372457242928201f,
+  -0.986809401814185527f, -0.161886393780111493f,
+  -0.986559910264775519f, -0.163399949382973059f,
+  -0.986308097244598669f, -0.164913120489969894f,
+  -0.986053963346195439f, -0.166425903540463827f,
+  -0.985797509167567476f, -0.167938294974731034f,
+  -0.985538735312176062f, -0.169450291233967987f,
+  -0.985277642388941333f, -0.170961888760300967f,
+  -0.985014231012239838f, -0.172473083996795867f,
+  -0.984748501801904208f, -0.173983873387463878f,
+  -0.984480455383220932f, -0.175494253377271203f,
+  -0.984210092386929136f, -0.177004220412148694f,
+  -0.983937413449218923f, -0.178513770938997174f,
+  -0.983662419211730255f, -0.180022901405699348f,
+  -0.983385110321551181f, -0.181531608261124966f,
+  -0.983105487431216396f, -0.183039887955140645f,
+  -0.982823551198705347f, -0.184547736938619478f,
+  -0.982539302287441241f, -0.186055151663446661f,
+  -0.982252741366289484f, -0.187562128582529325f,
+  -0.981963869109555243f, -0.189068664149806109f,
+  -0.981672686196983113f, -0.190574754820252823f,
+  -0.981379193313754672f, -0.192080397049892215f,
+  -0.981083391150486706f, -0.193585587295803552f,
+  -0.980785280403230431f, -0.195090322016128359f,
+  -0.980484861773469385f, -0.196594597670080029f,
+  -0.980182135968117429f, -0.198098410717953560f,
+  -0.979877103699517749f, -0.199601757621130665f,
+  -0.979569765685440519f, -0.201104634842091762f,
+  -0.979260122649082021f, -0.202607038844421133f,
+  -0.978948175319062197f, -0.204108966092816618f,
+  -0.978633924429423208f, -0.205610413053099156f,
+  -0.978317370719627655f, -0.207111376192218588f,
+  -0.977998514934557139f, -0.208611851978263263f,
+  -0.977677357824510040f, -0.210111836880469555f,
+  -0.977353900145199961f, -0.211611327369227664f,
+  -0.977028142657754395f, -0.213110319916091195f,
+  -0.976700086128711842f, -0.214608810993786731f,
+  -0.976369731330021251f, -0.216106797076219215f,
+  -0.976037079039039135f, -0.217604274638483475f,
+  -0.975702130038528570f, -0.219101240156869798f,
+  -0.975364885116656977f, -0.220597690108873257f,
+  -0.975025345066994120f, -0.222093620973203426f,
+  -0.974683510688510668f, -0.223589029229790043f,
+  -0.974339382785575858f, -0.225083911359792610f,
+  -0.973992962167955945f, -0.226578263845609917f,
+  -0.973644249650811866f, -0.228072083170885814f,
+  -0.973293246054698247f, -0.229565365820518702f,
+  -0.972939952205560177f, -0.231058108280671082f,
+  -0.972584368934732324f, -0.232550307038774939f,
+  -0.972226497078936380f, -0.234041958583543264f,
+  -0.971866337480279396f, -0.235533059404975514f,
+  -0.971503890986251895f, -0.237023605994366948f,
+  -0.971139158449725204f, -0.238513594844318333f,
+  -0.970772140728950239f, -0.240003022448741526f,
+  -0.970402838687555502f, -0.241491885302869108f,
+  -0.970031253194543974f, -0.242980179903263815f,
+  -0.969657385124292448f, -0.244467902747824262f,
+  -0.969281235356548532f, -0.245955050335794428f,
+  -0.968902804776428872f, -0.247441619167773269f,
+  -0.968522094274417378f, -0.248927605745719871f,
+  -0.968139104746362444f, -0.250413006572965113f,
+  -0.967753837093475511f, -0.251897818154216968f,
+  -0.967366292222328616f, -0.253382036995569881f,
+  -0.966976471044852182f, -0.254865659604514461f,
+  -0.966584374478333119f, -0.256348682489942914f,
+  -0.966190003445412615f, -0.257831102162158765f,
+  -0.965793358874083685f, -0.259312915132886179f,
+  -0.965394441697689398f, -0.260794117915275625f,
+  -0.964993252854920436f, -0.262274707023913423f,
+  -0.964589793289812758f, -0.263754678974831347f,
+  -0.964184063951745829f, -0.265234030285511513f,
+  -0.963776065795439951f, -0.266712757474898254f,
+  -0.963365799780954046f, -0.268190857063403176f,
+  -0.962953266873683988f, -0.269668325572914813f,
+  -0.962538468044359163f, -0.271145159526807900f,
+  -0.962121404269041580f, -0.272621355449949032f,
+  -0.961702076529122540f, -0.274096909868706162f,
+  -0.961280485811320640f, -0.275571819310958088f,
+  -0.960856633107679547f, -0.277046080306100007f,
+  -0.960430519415565898f, -0.278519689385052893f,
+  -0.960002145737665957f, -0.279992643080273218f,
+  -0.959571513081984628f, -0.281464937925757663f,
+  -0.959138622461842005f, -0.282936570457055170f,
+  -0.958703474895871599f, -0.284407537211271821f,
+  -0.958266071408017783f, -0.285877834727080338f,
+  -0.957826413027532908f, -0.287347459544729400f,
+  -0.957384500788975856f, -0.288816408206049535f,
+  -0.956940335732208935f, -0.290284677254462109f,
+  -0.956493918902395102f, -0.291752263234989206f,
+  -0.956045251349996406f, -0.293219162694258739f,
+  -0.955594334130771106f, -0.294685372180514160f,
+  -0.955141168305770782f, -0.296150888243623789f,
+  -0.954685754941338449f, -0.297615707435085919f,
+  -0.954228095109105667f, -0.299079826308040309f,
+  -0.953768189885990325f, -0.300543241417273455f,
+  -0.953306040354193973f, -0.302005949319227807f,
+  -0.952841647601198716f, -0.303467946572011205f,
+  -0.952375012719765879f, -0.304929229735402429f,
+  -0.951906136807932346f, -0.306389795370860696f,
+  -0.951435020969008449f, -0.307849640041534811f,
+  -0.950961666311575082f, -0.309308760312268782f,
+  -0.950486073949481813f, -0.310767152749611308f,
+  -0.950008245001842999f, -0.312224813921824884f,
+  -0.949528180593036786f, -0.313681740398891185f,
+  -0.949045881852700668f, -0.315137928752522223f,
+  -0.948561349915730267f, -0.316593375556165846f,
+  -0.948074585922276336f, -0.318048077385014671f,
+  -0.947585591017741202f, -0.319502030816015581f,
+  -0.947094366352777217f, -0.320955232427875270f,
+  -0.946600913083283646f, -0.322407678801069630f,
+  -0.946105232370403448f, -0.323859366517852798f,
+  -0.945607325380521280f, -0.325310292162262982f,
+  -0.945107193285260605f, -0.326760452320131567f,
+  -0.944604837261480257f, -0.328209843579092497f,
+  -0.944100258491272770f, -0.329658462528587215f,
+  -0.943593458161960386f, -0.331106305759876263f,
+  -0.943084437466093495f, -0.332553369866044224f,
+  -0.942573197601446977f, -0.333999651442009104f,
+  -0.942059739771017424f, -0.335445147084531492f,
+  -0.941544065183020806f, -0.336889853392220107f,
+  -0.941026175050889369f, -0.338333766965540905f,
+  -0.940506070593268406f, -0.339776884406826796f,
+  -0.939983753034013936f, -0.341219202320282466f,
+  -0.939459223602190030f, -0.342660717311994212f,
+  -0.938932483532064599f, -0.344101425989938814f,
+  -0.938403534063108280f, -0.345541324963988761f,
+  -0.937872376439989885f, -0.346980410845923515f,
+  -0.937339011912574960f, -0.348418680249434565f,
+  -0.936803441735921671f, -0.349856129790134640f,
+  -0.936265667170278260f, -0.351292756085566982f,
+  -0.935725689481080369f, -0.352728555755210726f,
+  -0.935183509938947721f, -0.354163525420490122f,
+  -0.934639129819680781f, -0.355597661704783796f,
+  -0.934092550404258870f, -0.357030961233430089f,
+  -0.933543772978836284f, -0.358463420633736374f,
+  -0.932992798834738957f, -0.359895036534988111f,
+  -0.932439629268462467f, -0.361325805568453950f,
+  -0.931884265581668148f, -0.362755724367397059f,
+  -0.931326709081180426f, -0.364184789567079892f,
+  -0.930766961078983823f, -0.365612997804773576f,
+  -0.930205022892219069f, -0.367040345719767069f,
+  -0.929640895843181214f, -0.368466829953372377f,
+  -0.929074581259315857f, -0.369892447148933878f,
+  -0.928506080473215589f, -0.371317193951837432f,
+  -0.927935394822617776f, -0.372741067009515870f,
+  -0.927362525650401115f, -0.374164062971457823f,
+  -0.926787474304581860f, -0.375586178489217160f,
+  -0.926210242138311490f, -0.377007410216417926f,
+  -0.925630830509872826f, -0.378427754808765393f,
+  -0.925049240782677584f, -0.379847208924051161f,
+  -0.924465474325262715f, -0.381265769222162099f,
+  -0.923879532511286850f, -0.382683432365089671f,
+  -0.923291416719527636f, -0.384100195016935098f,
+  -0.922701128333878628f, -0.385516053843918627f,
+  -0.922108668743345183f, -0.386931005514388526f,
+  -0.921514039342041902f, -0.388345046698826357f,
+  -0.920917241529189523f, -0.389758174069856245f,
+  -0.920318276709110594f, -0.391170384302253815f,
+  -0.919717146291227472f, -0.392581674072951192f,
+  -0.919113851690057770f, -0.393992040061047932f,
+  -0.918508394325212252f, -0.395401478947816298f,
+  -0.917900775621390608f, -0.396809987416710030f,
+  -0.917290997008378017f, -0.398217562153373450f,
+  -0.916679059921042705f, -0.399624199845646844f,
+  -0.916064965799331832f, -0.401029897183575401f,
+  -0.915448716088267833f, -0.402434650859418375f,
+  -0.914830312237946086f, -0.403838457567654185f,
+  -0.914209755703530691f, -0.405241314004989694f,
+  -0.913587047945250808f, -0.406643216870368973f,
+  -0.912962190428398324f, -0.408044162864978355f,
+  -0.912335184623322859f, -0.409444148692257426f,
+  -0.911706032005429878f, -0.410843171057903911f,
+  -0.911074734055176472f, -0.412241226669882610f,
+  -0.910441292258067247f, -0.413638312238434391f,
+  -0.909805708104652222f, -0.415034424476081631f,
+  -0.909167983090522491f, -0.416429560097636930f,
+  -0.908528118716306232f, -0.417823715820212216f,
+  -0.907886116487666150f, -0.419216888363224016f,
+  -0.907241977915295927f, -0.420609074448402342f,
+  -0.906595704514915446f, -0.422000270799799626f,
+  -0.905947297807268570f, -0.423390474143795714f,
+  -0.905296759318118816f, -0.424779681209108639f,
+  -0.904644090578246240f, -0.426167888726799615f,
+  -0.903989293123443449f, -0.427555093430281807f,
+  -0.903332368494511928f, -0.428941292055329382f,
+  -0.902673318237258826f, -0.430326481340082667f,
+  -0.902012143902493291f, -0.431710658025057037f,
+  -0.901348847046022028f, -0.433093818853151846f,
+  -0.900683429228646859f, -0.434475960569655761f,
+  -0.900015892016160279f, -0.435857079922255308f,
+  -0.899346236979341573f, -0.437237173661044032f,
+  -0.898674465693954039f, -0.438616238538527325f,
+  -0.898000579740739879f, -0.439994271309633089f,
+  -0.897324580705418318f, -0.441371268731716671f,
+  -0.896646470178680377f, -0.442747227564569745f,
+  -0.895966249756185218f, -0.444122144570429089f,
+  -0.895283921038557473f, -0.445496016513981741f,
+  -0.894599485631382807f, -0.446868840162373937f,
+  -0.893912945145203253f, -0.448240612285219830f,
+  -0.893224301195515324f, -0.449611329654606651f,
+  -0.892533555402764689f, -0.450980989045103642f,
+  -0.891840709392342723f, -0.452349587233770833f,
+  -0.891145764794583406f, -0.453717121000163537f,
+  -0.890448723244757989f, -0.455083587126343669f,
+  -0.889749586383072777f, -0.456448982396883918f,
+  -0.889048355854664685f, -0.457813303598876953f,
+  -0.888345033309596355f, -0.459176547521943978f,
+  -0.887639620402853935f, -0.460538710958240061f,
+  -0.886932118794342306f, -0.461899790702462509f,
+  -0.886222530148880638f, -0.463259783551860094f,
+  -0.885510856136199953f, -0.464618686306237871f,
+  -0.884797098430937901f, -0.465976495767965959f,
+  -0.884081258712634988f, -0.467333208741988360f,
+  -0.883363338665731801f, -0.468688822035827624f,
+  -0.882643339979562902f, -0.470043332459595453f,
+  -0.881921264348355050f, -0.471396736825997642f,
+  -0.881197113471222204f, -0.472749031950342513f,
+  -0.880470889052160866f, -0.474100214650549856f,
+  -0.879742592800047407f, -0.475450281747155923f,
+  -0.879012226428633636f, -0.476799230063321866f,
+  -0.878279791656541575f, -0.478147056424842953f,
+  -0.877545290207261242f, -0.479493757660153064f,
+  -0.876808723809145762f, -0.480839330600333736f,
+  -0.876070094195406601f, -0.482183772079122663f,
+  -0.875329403104111003f, -0.483527078932918408f,
+  -0.874586652278176224f, -0.484869248000790953f,
+  -0.873841843465366863f, -0.486210276124486362f,
+  -0.873094978418290202f, -0.487550160148435663f,
+  -0.872346058894391541f, -0.488888896919763061f,
+  -0.871595086655950979f, -0.490226483288291159f,
+  -0.870842063470079086f, -0.491562916106549730f,
+  -0.870086991108711461f, -0.492898192229783927f,
+  -0.869329871348606731f, -0.494232308515959784f,
+  -0.868570705971341006f, -0.495565261825772319f,
+  -0.867809496763303323f, -0.496897049022654469f,
+  -0.867046245515692870f, -0.498227666972781535f,
+  -0.866280954024513106f, -0.499557112545081727f,
+  -0.865513624090569089f, -0.500885382611240715f,
+  -0.864744257519462489f, -0.502212474045710566f,
+  -0.863972856121586807f, -0.503538383725717464f,
+  -0.863199421712124160f, -0.504863108531267590f,
+  -0.862423956111040724f, -0.506186645345155006f,
+  -0.861646461143081410f, -0.507508991052970759f,
+  -0.860866938637767309f, -0.508830142543107100f,
+  -0.860085390429390251f, -0.510150096706766587f,
+  -0.859301818357008473f, -0.511468850437970302f,
+  -0.858516224264442962f, -0.512786400633562733f,
+  -0.857728610000272118f, -0.514102744193221550f,
+  -0.856938977417828762f, -0.515417878019462927f,
+  -0.856147328375194694f, -0.516731799017649651f,
+  -0.855353664735196140f, -0.518044504095999225f,
+  -0.854557988365400534f, -0.519355990165589643f,
+  -0.853760301138111521f, -0.520666254140366935f,
+  -0.852960604930363742f, -0.521975292937154278f,
+  -0.852158901623919829f, -0.523283103475656430f,
+  -0.851355193105265307f, -0.524589682678468727f,
+  -0.850549481265603480f, -0.525895027471084631f,
+  -0.849741768000852660f, -0.527199134781901058f,
+  -0.848932055211639724f, -0.528502001542228261f,
+  -0.848120344803297233f, -0.529803624686294605f,
+  -0.847306638685858537f, -0.531104001151254668f,
+  -0.846490938774052126f, -0.532403127877197790f,
+  -0.845673246987299065f, -0.533701001807152964f,
+  -0.844853565249707228f, -0.534997619887096931f,
+  -0.844031895490066519f, -0.536292979065963071f,
+  -0.843208239641845436f, -0.537587076295645505f,
+  -0.842382599643185959f, -0.538879908531008200f,
+  -0.841554977436898444f, -0.540171472729892854f,
+  -0.840725374970458184f, -0.541461765853123222f,
+  -0.839893794195999632f, -0.542750784864515778f,
+  -0.839060237070312742f, -0.544038526730883820f,
+  -0.838224705554838190f, -0.545324988422046131f,
+  -0.837387201615662047f, -0.546610166910834749f,
+  -0.836547727223512005f, -0.547894059173100190f,
+  -0.835706284353752715f, -0.549176662187719544f,
+  -0.834862874986380121f, -0.550457972936604700f,
+  -0.834017501106018133f, -0.551737988404707447f,
+  -0.833170164701913296f, -0.553016705580027357f,
+  -0.832320867767929684f, -0.554294121453620003f,
+  -0.831469612302545458f, -0.555570233019601956f,
+  -0.830616400308846425f, -0.556845037275159882f,
+  -0.829761233794523045f, -0.558118531220556102f,
+  -0.828904114771865097f, -0.559390711859135803f,
+  -0.828045045257755796f, -0.560661576197335920f,
+  -0.827184027273669131f, -0.561931121244689358f,
+  -0.826321062845663645f, -0.563199344013833869f,
+  -0.825456154004377551f, -0.564466241520519385f,
+  -0.824589302785025291f, -0.565731810783613231f,
+  -0.823720511227391539f, -0.566996048825108456f,
+  -0.822849781375826428f, -0.568258952670131490f,
+  -0.821977115279241555f, -0.569520519346947252f,
+  -0.821102514991104759f, -0.570780745886967145f,
+  -0.820225982569434686f, -0.572039629324757049f,
+  -0.819347520076797120f, -0.573297166698041982f,
+  -0.818467129580298769f, -0.574553355047715653f,
+  -0.817584813151583711f, -0.575808191417845339f,
+  -0.816700572866827956f, -0.577061672855679331f,
+  -0.815814410806733892f, -0.578313796411655479f,
+  -0.814926329056526622f, -0.579564559139405744f,
+  -0.814036329705948525f, -0.580813958095764304f,
+  -0.813144414849253594f, -0.582061990340775437f,
+  -0.812250586585203882f, -0.583308652937698402f,
+  -0.811354847017063840f, -0.584553942953015104f,
+  -0.810457198252594768f, -0.585797857456438864f,
+  -0.809557642404051481f, -0.587040393520917747f,
+  -0.808656181588175094f, -0.588281548222645112f,
+  -0.807752817926190358f, -0.589521318641063941f,
+  -0.806847553543799445f, -0.590759701858873942f,
+  -0.805940390571176390f, -0.591996694962040881f,
+  -0.805031331142963547f, -0.593232295039799795f,
+  -0.804120377398265918f, -0.594466499184664210f,
+  -0.803207531480644943f, -0.595699304492433246f,
+  -0.802292795538115722f, -0.596930708062196502f,
+  -0.801376171723140351f, -0.598160706996342162f,
+  -0.800457662192622821f, -0.599389298400564541f,
+  -0.799537269107905235f, -0.600616479383868640f,
+  -0.798614994634760933f, -0.601842247058579916f,
+  -0.797690840943391155f, -0.603066598540348164f,
+  -0.796764810208418939f, -0.604289530948155851f,
+  -0.795836904608883566f, -0.605511041404325434f,
+  -0.794907126328236902f, -0.606731127034524476f,
+  -0.793975477554337283f, -0.607949784967773410f,
+  -0.793041960479443753f, -0.609167012336453095f,
+  -0.792106577300212278f, -0.610382806276309475f,
+  -0.791169330217690314f, -0.611597163926461795f,
+  -0.790230221437310143f, -0.612810082429409708f,
+  -0.789289253168885874f, -0.614021558931038158f,
+  -0.788346427626606339f, -0.615231590580626708f,
+  -0.787401747029031429f, -0.616440174530853646f,
+  -0.786455213599085989f, -0.617647307937803647f,
+  -0.785506829564054043f, -0.618852987960976209f,
+  -0.784556597155575242f, -0.620057211763289207f,
+  -0.783604518609638423f, -0.621259976511087442f,
+  -0.782650596166575840f, -0.622461279374149856f,
+  -0.781694832071059387f, -0.623661117525694642f,
+  -0.780737228572094599f, -0.624859488142386232f,
+  -0.779777787923014554f, -0.626056388404343522f,
+  -0.778816512381476200f, -0.627251815495143861f,
+  -0.777853404209453148f, -0.628445766601832601f,
+  -0.776888465673232442f, -0.629638238914926984f,
+  -0.775921699043407798f, -0.630829229628424248f,
+  -0.774953106594873931f, -0.632018735939808951f,
+  -0.773982690606822787f, -0.633206755050057302f,
+  -0.773010453362737104f, -0.634393284163645266f,
+  -0.772036397150384524f, -0.635578320488556114f,
+  -0.771060524261813707f, -0.636761861236284310f,
+  -0.770082836993348119f, -0.637943903621843944f,
+  -0.769103337645579699f, -0.639124444863775731f,
+  -0.768122028523365641f, -0.640303482184151451f,
+  -0.767138911935820511f, -0.641481012808583051f,
+  -0.766153990196312917f, -0.642657033966226865f,
+  -0.765167265622459070f, -0.643831542889791275f,
+  -0.764178740536116785f, -0.645004536815543816f,
+  -0.763188417263381269f, -0.646176012983316395f,
+  -0.762196298134579120f, -0.647345968636511837f,
+  -0.761202385484261890f, -0.648514401022112330f,
+  -0.760206681651202421f, -0.649681307390683194f,
+  -0.759209188978388183f, -0.650846684996380764f,
+  -0.758209909813015281f, -0.652010531096959500f,
+  -0.757208846506484790f, -0.653172842953776533f,
+  -0.756206001414394646f, -0.654333617831800329f,
+  -0.755201376896536547f, -0.655492852999615350f,
+  -0.754194975316889393f, -0.656650545729428825f,
+  -0.753186799043612631f, -0.657806693297078526f,
+  -0.752176850449042700f, -0.658961292982037317f,
+  -0.751165131909686590f, -0.660114342067420257f,
+  -0.750151645806215073f, -0.661265837839992154f,
+  -0.749136394523459259f, -0.662415777590171784f,
+  -0.748119380450403715f, -0.663564158612039656f,
+  -0.747100605980180132f, -0.664710978203344793f,
+  -0.746080073510064001f, -0.665856233665509389f,
+  -0.745057785441466058f, -0.666999922303637360f,
+  -0.744033744179929291f, -0.668142041426518452f,
+  -0.743007952135121941f, -0.669282588346635787f,
+  -0.741980411720831068f, -0.670421560380172976f,
+  -0.740951125354959106f, -0.671558954847018441f,
+  -0.739920095459516314f, -0.672694769070772747f,
+  -0.738887324460615225f, -0.673829000378755927f,
+  -0.737852814788465983f, -0.674961646102012036f,
+  -0.736816568877370015f, -0.676092703575315812f,
+  -0.735778589165713592f, -0.677222170137180335f,
+  -0.734738878095963721f, -0.678350043129861247f,
+  -0.733697438114660372f, -0.679476319899364856f,
+  -0.732654271672412816f, -0.680600997795453022f,
+  -0.731609381223892741f, -0.681724074171649597f,
+  -0.730562769227827702f, -0.682845546385247970f,
+  -0.729514438146997013f, -0.683965411797315403f,
+  -0.728464390448225418f, -0.685083667772700133f,
+  -0.727412628602375877f, -0.686200311680038477f,
+  -0.726359155084345898f, -0.687315340891759163f,
+  -0.725303972373060879f, -0.688428752784090325f,
+  -0.724247082951467003f, -0.689540544737066829f,
+  -0.723188489306527682f, -0.690650714134534383f,
+  -0.722128193929215456f, -0.691759258364157636f,
+  -0.721066199314508105f, -0.692866174817424629f,
+  -0.720002507961381877f, -0.693971460889653780f,
+  -0.718937122372804494f, -0.695075113980000769f,
+  -0.717870045055731709f, -0.696177131491462986f,
+  -0.716801278521099650f, -0.697277510830886404f,
+  -0.715730825283818706f, -0.698376249408972805f,
+  -0.714658687862768982f, -0.699473344640283878f,
+  -0.713584868780793746f, -0.700568793943248225f,
+  -0.712509370564692324f, -0.701662594740168455f,
+  -0.711432195745216656f, -0.702754744457225078f,
+  -0.710353346857062418f, -0.703845240524484828f,
+  -0.709272826438865689f, -0.704934080375904881f,
+  -0.708190637033195514f, -0.706021261449339521f,
+  -0.707106781186547684f, -0.707106781186547462f,
+  -0.706021261449339743f, -0.708190637033195292f,
+  -0.704934080375905103f, -0.709272826438865467f,
+  -0.703845240524485050f, -0.710353346857062307f,
+  -0.702754744457225300f, -0.711432195745216434f,
+  -0.701662594740168677f, -0.712509370564692213f,
+  -0.700568793943248447f, -0.713584868780793524f,
+  -0.699473344640284100f, -0.714658687862768760f,
+  -0.698376249408973027f, -0.715730825283818484f,
+  -0.697277510830886627f, -0.716801278521099539f,
+  -0.696177131491463208f, -0.717870045055731487f,
+  -0.695075113980000991f, -0.718937122372804382f,
+  -0.693971460889654002f, -0.720002507961381655f,
+  -0.692866174817424851f, -0.721066199314507883f,
+  -0.691759258364157859f, -0.722128193929215234f,
+  -0.690650714134534605f, -0.723188489306527460f,
+  -0.689540544737067052f, -0.724247082951466781f,
+  -0.688428752784090547f, -0.725303972373060657f,
+  -0.687315340891759385f, -0.726359155084345676f,
+  -0.686200311680038699f, -0.727412628602375655f,
+  -0.685083667772700355f, -0.728464390448225196f,
+  -0.683965411797315626f, -0.729514438146996791f,
+  -0.682845546385248192f, -0.730562769227827480f,
+  -0.681724074171649819f, -0.731609381223892519f,
+  -0.680600997795453244f, -0.732654271672412594f,
+  -0.679476319899365078f, -0.733697438114660150f,
+  -0.678350043129861469f, -0.734738878095963499f,
+  -0.677222170137180557f, -0.735778589165713370f,
+  -0.676092703575316034f, -0.736816568877369793f,
+  -0.674961646102012258f, -0.737852814788465761f,
+  -0.673829000378756260f, -0.738887324460615003f,
+  -0.672694769070772969f, -0.739920095459516092f,
+  -0.671558954847018663f, -0.740951125354958884f,
+  -0.670421560380173198f, -0.741980411720830957f,
+  -0.669282588346636120f, -0.743007952135121719f,
+  -0.668142041426518674f, -0.744033744179929069f,
+  -0.666999922303637582f, -0.745057785441465836f,
+  -0.665856233665509611f, -0.746080073510063779f,
+  -0.664710978203345015f, -0.747100605980180021f,
+  -0.663564158612039878f, -0.748119380450403493f,
+  -0.662415777590172006f, -0.749136394523459037f,
+  -0.661265837839992376f, -0.750151645806214962f,
+  -0.660114342067420479f, -0.751165131909686368f,
+  -0.658961292982037539f, -0.752176850449042478f,
+  -0.657806693297078748f, -0.753186799043612409f,
+  -0.656650545729429047f, -0.754194975316889171f,
+  -0.655492852999615572f, -0.755201376896536325f,
+  -0.654333617831800662f, -0.756206001414394424f,
+  -0.653172842953777089f, -0.757208846506484234f,
+  -0.652010531096959722f, -0.758209909813015170f,
+  -0.650846684996380986f, -0.759209188978387961f,
+  -0.649681307390683083f, -0.760206681651202421f,
+  -0.648514401022112219f, -0.761202385484262001f,
+  -0.647345968636512503f, -0.762196298134578565f,
+  -0.646176012983316617f, -0.763188417263381047f,
+  -0.645004536815544038f, -0.764178740536116563f,
+  -0.643831542889791497f, -0.765167265622458959f,
+  -0.642657033966226754f, -0.766153990196313028f,
+  -0.641481012808583606f, -0.767138911935820067f,
+  -0.640303482184152006f, -0.768122028523365086f,
+  -0.639124444863775953f, -0.769103337645579477f,
+  -0.637943903621844166f, -0.770082836993347897f,
+  -0.636761861236284199f, -0.771060524261813818f,
+  -0.635578320488556003f, -0.772036397150384635f,
+  -0.634393284163645932f, -0.773010453362736660f,
+  -0.633206755050057524f, -0.773982690606822565f,
+  -0.632018735939809173f, -0.774953106594873820f,
+  -0.630829229628424581f, -0.775921699043407576f,
+  -0.629638238914926873f, -0.776888465673232553f,
+  -0.628445766601833156f, -0.777853404209452703f,
+  -0.627251815495144416f, -0.778816512381475645f,
+  -0.626056388404343744f, -0.779777787923014332f,
+  -0.624859488142386454f, -0.780737228572094377f,
+  -0.623661117525694531f, -0.781694832071059498f,
+  -0.622461279374149745f, -0.782650596166575840f,
+  -0.621259976511087997f, -0.783604518609637979f,
+  -0.620057211763289429f, -0.784556597155575020f,
+  -0.618852987960976431f, -0.785506829564053821f,
+  -0.617647307937803980f, -0.786455213599085767f,
+  -0.616440174530853535f, -0.787401747029031429f,
+  -0.615231590580627263f, -0.788346427626605895f,
+  -0.614021558931038713f, -0.789289253168885430f,
+  -0.612810082429409930f, -0.790230221437309921f,
+  -0.611597163926462017f, -0.791169330217690092f,
+  -0.610382806276309364f, -0.792106577300212389f,
+  -0.609167012336452984f, -0.793041960479443864f,
+  -0.607949784967774076f, -0.793975477554336839f,
+  -0.606731127034524809f, -0.794907126328236791f,
+  -0.605511041404325656f, -0.795836904608883455f,
+  -0.604289530948156073f, -0.796764810208418717f,
+  -0.603066598540348053f, -0.797690840943391155f,
+  -0.601842247058580471f, -0.798614994634760489f,
+  -0.600616479383869306f, -0.799537269107904791f,
+  -0.599389298400564763f, -0.800457662192622599f,
+  -0.598160706996342384f, -0.801376171723140129f,
+  -0.596930708062196391f, -0.802292795538115722f,
+  -0.595699304492433135f, -0.803207531480645054f,
+  -0.594466499184664876f, -0.804120377398265473f,
+  -0.593232295039800128f, -0.805031331142963436f,
+  -0.591996694962041103f, -0.805940390571176168f,
+  -0.590759701858874275f, -0.806847553543799223f,
+  -0.589521318641063830f, -0.807752817926190469f,
+  -0.588281548222645778f, -0.808656181588174650f,
+  -0.587040393520918302f, -0.809557642404051037f,
+  -0.585797857456439086f, -0.810457198252594657f,
+  -0.584553942953015326f, -0.811354847017063729f,
+  -0.583308652937698291f, -0.812250586585203993f,
+  -0.582061990340775326f, -0.813144414849253705f,
+  -0.580813958095764971f, -0.814036329705948081f,
+  -0.579564559139405966f, -0.814926329056526400f,
+  -0.578313796411655701f, -0.815814410806733670f,
+  -0.577061672855679553f, -0.816700572866827734f,
+  -0.575808191417845228f, -0.817584813151583822f,
+  -0.574553355047716319f, -0.818467129580298325f,
+  -0.573297166698042537f, -0.819347520076796676f,
+  -0.572039629324757271f, -0.820225982569434464f,
+  -0.570780745886967367f, -0.821102514991104648f,
+  -0.569520519346947141f, -0.821977115279241555f,
+  -0.568258952670131379f, -0.822849781375826428f,
+  -0.566996048825109011f, -0.823720511227391095f,
+  -0.565731810783613454f, -0.824589302785025069f,
+  -0.564466241520519607f, -0.825456154004377440f,
+  -0.563199344013834091f, -0.826321062845663423f,
+  -0.561931121244689247f, -0.827184027273669242f,
+  -0.560661576197336475f, -0.828045045257755463f,
+  -0.559390711859136469f, -0.828904114771864653f,
+  -0.558118531220556324f, -0.829761233794522934f,
+  -0.556845037275160104f, -0.830616400308846203f,
+  -0.555570233019602178f, -0.831469612302545236f,
+  -0.554294121453619892f, -0.832320867767929795f,
+  -0.553016705580027912f, -0.833170164701912852f,
+  -0.551737988404707669f, -0.834017501106017911f,
+  -0.550457972936604922f, -0.834862874986380010f,
+  -0.549176662187719766f, -0.835706284353752604f,
+  -0.547894059173100079f, -0.836547727223512116f,
+  -0.546610166910835416f, -0.837387201615661603f,
+  -0.545324988422046797f, -0.838224705554837857f,
+  -0.544038526730884153f, -0.839060237070312520f,
+  -0.542750784864516000f, -0.839893794195999410f,
+  -0.541461765853123445f, -0.840725374970458073f,
+  -0.540171472729892743f, -0.841554977436898555f,
+  -0.538879908531008867f, -0.842382599643185626f,
+  -0.537587076295645727f, -0.843208239641845214f,
+  -0.536292979065963293f, -0.844031895490066297f,
+  -0.534997619887097264f, -0.844853565249707006f,
+  -0.533701001807152853f, -0.845673246987299176f,
+  -0.532403127877198457f, -0.846490938774051793f,
+  -0.531104001151255334f, -0.847306638685858093f,
+  -0.529803624686294938f, -0.848120344803297121f,
+  -0.528502001542228594f, -0.848932055211639613f,
+  -0.527199134781901280f, -0.849741768000852549f,
+  -0.525895027471084520f, -0.850549481265603591f,
+  -0.524589682678469393f, -0.851355193105264862f,
+  -0.523283103475656763f, -0.852158901623919607f,
+  -0.521975292937154500f, -0.852960604930363520f,
+  -0.520666254140367157f, -0.853760301138111410f,
+  -0.519355990165589421f, -0.854557988365400645f,
+  -0.518044504095999891f, -0.855353664735195696f,
+  -0.516731799017650206f, -0.856147328375194250f,
+  -0.515417878019463260f, -0.856938977417828540f,
+  -0.514102744193221772f, -0.857728610000272007f,
+  -0.512786400633562955f, -0.858516224264442851f,
+  -0.511468850437970191f, -0.859301818357008473f,
+  -0.510150096706767253f, -0.860085390429389918f,
+  -0.508830142543107322f, -0.860866938637767087f,
+  -0.507508991052970981f, -0.861646461143081188f,
+  -0.506186645345155339f, -0.862423956111040502f,
+  -0.504863108531267368f, -0.863199421712124271f,
+  -0.503538383725718020f, -0.863972856121586474f,
+  -0.502212474045711121f, -0.864744257519462156f,
+  -0.500885382611241048f, -0.865513624090568978f,
+  -0.499557112545082005f, -0.866280954024512884f,
+  -0.498227666972781813f, -0.867046245515692648f,
+  -0.496897049022654358f, -0.867809496763303323f,
+  -0.495565261825772985f, -0.868570705971340673f,
+  -0.494232308515960062f, -0.869329871348606620f,
+  -0.492898192229784204f, -0.870086991108711350f,
+  -0.491562916106549952f, -0.870842063470078864f,
+  -0.490226483288291048f, -0.871595086655951090f,
+  -0.488888896919763727f, -0.872346058894391208f,
+  -0.487550160148436329f, -0.873094978418289869f,
+  -0.486210276124486640f, -0.873841843465366752f,
+  -0.484869248000791175f, -0.874586652278176113f,
+  -0.483527078932918686f, -0.875329403104110892f,
+  -0.482183772079122552f, -0.876070094195406712f,
+  -0.480839330600334403f, -0.876808723809145429f,
+  -0.479493757660153341f, -0.877545290207261131f,
+  -0.478147056424843231f, -0.878279791656541464f,
+  -0.476799230063322144f, -0.879012226428633414f,
+  -0.475450281747155756f, -0.879742592800047518f,
+  -0.474100214650550522f, -0.880470889052160532f,
+  -0.472749031950343179f, -0.881197113471221871f,
+  -0.471396736825997864f, -0.881921264348354939f,
+  -0.470043332459595731f, -0.882643339979562680f,
+  -0.468688822035827901f, -0.883363338665731579f,
+  -0.467333208741988249f, -0.884081258712635099f,
+  -0.465976495767966625f, -0.884797098430937567f,
+  -0.464618686306238149f, -0.885510856136199731f,
+  -0.463259783551860371f, -0.886222530148880527f,
+  -0.461899790702462787f, -0.886932118794342195f,
+  -0.460538710958239894f, -0.887639620402854046f,
+  -0.459176547521944645f, -0.888345033309596022f,
+  -0.457813303598877619f, -0.889048355854664352f,
+  -0.456448982396884195f, -0.889749586383072666f,
+  -0.455083587126343947f, -0.890448723244757878f,
+  -0.453717121000163814f, -0.891145764794583295f,
+  -0.452349587233770667f, -0.891840709392342834f,
+  -0.450980989045104308f, -0.892533555402764356f,
+  -0.449611329654606928f, -0.893224301195515213f,
+  -0.448240612285220108f, -0.893912945145203142f,
+  -0.446868840162374215f, -0.894599485631382696f,
+  -0.445496016513981630f, -0.895283921038557584f,
+  -0.444122144570429755f, -0.895966249756184885f,
+  -0.442747227564570411f, -0.896646470178680044f,
+  -0.441371268731716948f, -0.897324580705418207f,
+  -0.439994271309633367f, -0.898000579740739768f,
+  -0.438616238538527603f, -0.898674465693953817f,
+  -0.437237173661043921f, -0.899346236979341684f,
+  -0.435857079922255974f, -0.900015892016159946f,
+  -0.434475960569656039f, -0.900683429228646748f,
+  -0.433093818853152124f, -0.901348847046021917f,
+  -0.431710658025057314f, -0.902012143902493180f,
+  -0.430326481340082501f, -0.902673318237258826f,
+  -0.428941292055330048f, -0.903332368494511595f,
+  -0.427555093430282473f, -0.903989293123443116f,
+  -0.426167888726799893f, -0.904644090578246129f,
+  -0.424779681209108917f, -0.905296759318118704f,
+  -0.423390474143795992f, -0.905947297807268459f,
+  -0.422000270799799515f, -0.906595704514915446f,
+  -0.420609074448403009f, -0.907241977915295594f,
+  -0.419216888363224294f, -0.907886116487666039f,
+  -0.417823715820212493f, -0.908528118716306010f,
+  -0.416429560097637208f, -0.909167983090522380f,
+  -0.415034424476081520f, -0.909805708104652333f,
+  -0.413638312238435113f, -0.910441292258066914f,
+  -0.412241226669883276f, -0.911074734055176139f,
+  -0.410843171057904188f, -0.911706032005429767f,
+  -0.409444148692257759f, -0.912335184623322748f,
+  -0.408044162864978632f, -0.912962190428398213f,
+  -0.406643216870368807f, -0.913587047945250919f,
+  -0.405241314004990361f, -0.914209755703530469f,
+  -0.403838457567654463f, -0.914830312237945975f,
+  -0.402434650859418652f, -0.915448716088267722f,
+  -0.401029897183575679f, -0.916064965799331721f,
+  -0.399624199845646733f, -0.916679059921042705f,
+  -0.398217562153374172f, -0.917290997008377684f,
+  -0.396809987416710752f, -0.917900775621390275f,
+  -0.395401478947816576f, -0.918508394325212141f,
+  -0.393992040061048210f, -0.919113851690057659f,
+  -0.392581674072951470f, -0.919717146291227361f,
+  -0.391170384302253704f, -0.920318276709110594f,
+  -0.389758174069856966f, -0.920917241529189301f,
+  -0.388345046698826635f, -0.921514039342041791f,
+  -0.386931005514388804f, -0.922108668743345072f,
+  -0.385516053843918904f, -0.922701128333878517f,
+  -0.384100195016934931f, -0.923291416719527636f,
+  -0.382683432365090337f, -0.923879532511286516f,
+  -0.381265769222162765f, -0.924465474325262493f,
+  -0.379847208924051438f, -0.925049240782677473f,
+  -0.378427754808765726f, -0.925630830509872715f,
+  -0.377007410216418204f, -0.926210242138311379f,
+  -0.375586178489217049f, -0.926787474304581860f,
+  -0.374164062971458489f, -0.927362525650400893f,
+  -0.372741067009516147f, -0.927935394822617665f,
+  -0.371317193951837765f, -0.928506080473215478f,
+  -0.369892447148934156f, -0.929074581259315746f,
+  -0.368466829953372210f, -0.929640895843181325f,
+  -0.367040345719766958f, -0.930205022892219180f,
+  -0.365612997804774298f, -0.930766961078983601f,
+  -0.364184789567080169f, -0.931326709081180315f,
+  -0.362755724367397336f, -0.931884265581668036f,
+  -0.361325805568454228f, -0.932439629268462356f,
+  -0.359895036534987944f, -0.932992798834738957f,
+  -0.358463420633737040f, -0.933543772978835951f,
+  -0.357030961233430366f, -0.934092550404258759f,
+  -0.355597661704784074f, -0.934639129819680670f,
+  -0.354163525420490455f, -0.935183509938947610f,
+  -0.352728555755210615f, -0.935725689481080369f,
+  -0.351292756085566871f, -0.936265667170278371f,
+  -0.349856129790135362f, -0.936803441735921449f,
+  -0.348418680249434842f, -0.937339011912574849f,
+  -0.346980410845923792f, -0.937872376439989774f,
+  -0.345541324963989038f, -0.938403534063108169f,
+  -0.344101425989938647f, -0.938932483532064599f,
+  -0.342660717311994878f, -0.939459223602189697f,
+  -0.341219202320282744f, -0.939983753034013825f,
+  -0.339776884406827073f, -0.940506070593268295f,
+  -0.338333766965541238f, -0.941026175050889258f,
+  -0.336889853392219940f, -0.941544065183020806f,
+  -0.335445147084531381f, -0.942059739771017424f,
+  -0.333999651442009826f, -0.942573197601446755f,
+  -0.332553369866044501f, -0.943084437466093384f,
+  -0.331106305759876540f, -0.943593458161960275f,
+  -0.329658462528587493f, -0.944100258491272659f,
+  -0.328209843579092331f, -0.944604837261480368f,
+  -0.326760452320132289f, -0.945107193285260383f,
+  -0.325310292162263315f, -0.945607325380521169f,
+  -0.323859366517853076f, -0.946105232370403337f,
+  -0.322407678801069908f, -0.946600913083283535f,
+  -0.320955232427875159f, -0.947094366352777217f,
+  -0.319502030816015414f, -0.947585591017741202f,
+  -0.318048077385015393f, -0.948074585922276114f,
+  -0.316593375556166179f, -0.948561349915730156f,
+  -0.315137928752522556f, -0.949045881852700557f,
+  -0.313681740398891462f, -0.949528180593036675f,
+  -0.312224813921824773f, -0.950008245001843110f,
+  -0.310767152749612030f, -0.950486073949481591f,
+  -0.309308760312269060f, -0.950961666311574971f,
+  -0.307849640041535089f, -0.951435020969008338f,
+  -0.306389795370861029f, -0.951906136807932346f,
+  -0.304929229735402318f, -0.952375012719765879f,
+  -0.303467946572011038f, -0.952841647601198716f,
+  -0.302005949319228528f, -0.953306040354193751f,
+  -0.300543241417273732f, -0.953768189885990214f,
+  -0.299079826308040586f, -0.954228095109105556f,
+  -0.297615707435086196f, -0.954685754941338338f,
+  -0.296150888243623678f, -0.955141168305770782f,
+  -0.294685372180514882f, -0.955594334130770884f,
+  -0.293219162694259017f, -0.956045251349996295f,
+  -0.291752263234989484f, -0.956493918902394991f,
+  -0.290284677254462442f, -0.956940335732208824f,
+  -0.288816408206049369f, -0.957384500788975967f,
+  -0.287347459544729289f, -0.957826413027533019f,
+  -0.285877834727081059f, -0.958266071408017561f,
+  -0.284407537211272154f, -0.958703474895871488f,
+  -0.282936570457055503f, -0.959138622461841894f,
+  -0.281464937925757941f, -0.959571513081984517f,
+  -0.279992643080273051f, -0.960002145737665957f,
+  -0.278519689385053615f, -0.960430519415565676f,
+  -0.277046080306100284f, -0.960856633107679547f,
+  -0.275571819310958366f, -0.961280485811320529f,
+  -0.274096909868706440f, -0.961702076529122540f,
+  -0.272621355449948866f, -0.962121404269041580f,
+  -0.271145159526807789f, -0.962538468044359274f,
+  -0.269668325572915535f, -0.962953266873683766f,
+  -0.268190857063403509f, -0.963365799780953935f,
+  -0.266712757474898532f, -0.963776065795439840f,
+  -0.265234030285511790f, -0.964184063951745829f,
+  -0.263754678974831236f, -0.964589793289812758f,
+  -0.262274707023914144f, -0.964993252854920214f,
+  -0.260794117915275903f, -0.965394441697689287f,
+  -0.259312915132886457f, -0.965793358874083574f,
+  -0.257831102162159043f, -0.966190003445412504f,
+  -0.256348682489942803f, -0.966584374478333119f,
+  -0.254865659604514350f, -0.966976471044852182f,
+  -0.253382036995570603f, -0.967366292222328394f,
+  -0.251897818154217246f, -0.967753837093475400f,
+  -0.250413006572965391f, -0.968139104746362333f,
+  -0.248927605745720149f, -0.968522094274417267f,
+  -0.247441619167773130f, -0.968902804776428872f,
+  -0.245955050335795150f, -0.969281235356548310f,
+  -0.244467902747824539f, -0.969657385124292337f,
+  -0.242980179903264121f, -0.970031253194543974f,
+  -0.241491885302869413f, -0.970402838687555502f,
+  -0.240003022448741388f, -0.970772140728950350f,
+  -0.238513594844318194f, -0.971139158449725204f,
+  -0.237023605994367670f, -0.971503890986251673f,
+  -0.235533059404975792f, -0.971866337480279285f,
+  -0.234041958583543569f, -0.972226497078936269f,
+  -0.232550307038775217f, -0.972584368934732213f,
+  -0.231058108280670943f, -0.972939952205560177f,
+  -0.229565365820519424f, -0.973293246054698136f,
+  -0.228072083170886120f, -0.973644249650811866f,
+  -0.226578263845610223f, -0.973992962167955834f,
+  -0.225083911359792915f, -0.974339382785575858f,
+  -0.223589029229789904f, -0.974683510688510668f,
+  -0.222093620973203287f, -0.975025345066994231f,
+  -0.220597690108873978f, -0.975364885116656866f,
+  -0.219101240156870103f, -0.975702130038528459f,
+  -0.217604274638483780f, -0.976037079039039024f,
+  -0.216106797076219492f, -0.976369731330021140f,
+  -0.214608810993786620f, -0.976700086128711842f,
+  -0.213110319916091917f, -0.977028142657754284f,
+  -0.211611327369227969f, -0.977353900145199961f,
+  -0.210111836880469860f, -0.977677357824509929f,
+  -0.208611851978263568f, -0.977998514934557028f,
+  -0.207111376192218477f, -0.978317370719627655f,
+  -0.205610413053099017f, -0.978633924429423208f,
+  -0.204108966092817340f, -0.978948175319062086f,
+  -0.202607038844421439f, -0.979260122649082021f,
+  -0.201104634842092067f, -0.979569765685440519f,
+  -0.199601757621130971f, -0.979877103699517638f,
+  -0.198098410717953421f, -0.980182135968117429f,
+  -0.196594597670080778f, -0.980484861773469274f,
+  -0.195090322016128664f, -0.980785280403230320f,
+  -0.193585587295803857f, -0.981083391150486595f,
+  -0.192080397049892521f, -0.981379193313754561f,
+  -0.190574754820252684f, -0.981672686196983113f,
+  -0.189068664149805971f, -0.981963869109555354f,
+  -0.187562128582530074f, -0.982252741366289372f,
+  -0.186055151663446966f, -0.982539302287441241f,
+  -0.184547736938619783f, -0.982823551198705236f,
+  -0.183039887955140951f, -0.983105487431216285f,
+  -0.181531608261124827f, -0.983385110321551292f,
+  -0.180022901405700070f, -0.983662419211730144f,
+  -0.178513770938997923f, -0.983937413449218812f,
+  -0.177004220412148999f, -0.984210092386929025f,
+  -0.175494253377271509f, -0.984480455383220932f,
+  -0.173983873387463739f, -0.984748501801904208f,
+  -0.172473083996795729f, -0.985014231012239838f,
+  -0.170961888760301689f, -0.985277642388941111f,
+  -0.169450291233968292f, -0.985538735312176062f,
+  -0.167938294974731339f, -0.985797509167567365f,
+  -0.166425903540464104f, -0.986053963346195439f,
+  -0.164913120489969756f, -0.986308097244598669f,
+  -0.163399949382973780f, -0.986559910264775408f,
+  -0.161886393780112242f, -0.986809401814185416f,
+  -0.160372457242928507f, -0.987056571305750974f,
+  -0.158858143333861529f, -0.987301418157858324f,
+  -0.157343455616238193f, -0.987543941794359337f,
+  -0.155828397654264983f, -0.987784141644572178f,
+  -0.154312973013020577f, -0.988022017143283526f,
+  -0.152797185258443741f, -0.988257567730749464f,
+  -0.151281037957330389f, -0.988490792852696587f,
+  -0.149764534677321509f, -0.988721691960323779f,
+  -0.148247678986895892f, -0.988950264510302990f,
+  -0.146730474455362303f, -0.989176509964780903f,
+  -0.145212924652847852f, -0.989400427791380266f,
+  -0.143695033150294693f, -0.989622017463200776f,
+  -0.142176803519448142f, -0.989841278458820528f,
+  -0.140658239332849155f, -0.990058210262297123f,
+  -0.139139344163825979f, -0.990272812363169108f,
+  -0.137620121586486538f, -0.990485084256456982f,
+  -0.136100575175706534f, -0.990695025442664634f,
+  -0.134580708507126362f, -0.990902635427780010f,
+  -0.133060525157139065f, -0.991107913723276890f,
+  -0.131540028702882950f, -0.991310859846115444f,
+  -0.130019222722233929f, -0.991511473318743897f,
+  -0.128498110793793585f, -0.991709753669099525f,
+  -0.126976696496886116f, -0.991905700430609327f,
+  -0.125454983411546317f, -0.992099313142191797f,
+  -0.123932975118512090f, -0.992290591348257367f,
+  -0.122410675199215960f, -0.992479534598710078f,
+  -0.120888087235777569f, -0.992666142448947908f,
+  -0.119365214810991688f, -0.992850414459865105f,
+  -0.117842061508325144f, -0.993032350197851410f,
+  -0.116318630911904766f, -0.993211949234794500f,
+  -0.114794926606509931f, -0.993389211148080653f,
+  -0.113270952177564915f, -0.993564135520595304f,
+  -0.111746711211127003f, -0.993736721940724599f,
+  -0.110222207293883309f, -0.993906970002356061f,
+  -0.108697444013138800f, -0.994074879304879366f,
+  -0.107172424956808773f, -0.994240449453187902f,
+  -0.105647153713410380f, -0.994403680057679096f,
+  -0.104121633872055072f, -0.994564570734255415f,
+  -0.102595869022436614f, -0.994723121104325703f,
+  -0.101069862754827988f, -0.994879330794805616f,
+  -0.099543618660069347f, -0.995033199438118632f,
+  -0.098017140329560451f, -0.995184726672196929f,
+  -0.096490431355253162f, -0.995333912140482169f,
+  -0.094963495329639408f, -0.995480755491926939f,
+  -0.093436335845748036f, -0.995625256380994306f,
+  -0.091908956497132821f, -0.995767414467659817f,
+  -0.090381360877864914f, -0.995907229417411721f,
+  -0.088853552582524364f, -0.996044700901251967f,
+  -0.087325535206192559f, -0.996179828595696870f,
+  -0.085797312344440227f, -0.996312612182778001f,
+  -0.084268887593324238f, -0.996443051350042630f,
+  -0.082740264549375706f, -0.996571145790554835f,
+  -0.081211446809592289f, -0.996696895202896060f,
+  -0.079682437971430695f, -0.996820299291165668f,
+  -0.078153241632794648f, -0.996941357764982050f,
+  -0.076623861392031742f, -0.997060070339482962f,
+  -0.075094300847921402f, -0.997176436735326077f,
+  -0.073564563599667357f, -0.997290456678690207f,
+  -0.072034653246889097f, -0.997402129901275303f,
+  -0.070504573389614356f, -0.997511456140303454f,
+  -0.068974327628267079f, -0.997618435138519555f,
+  -0.067443919563664231f, -0.997723066644191636f,
+  -0.065913352797003832f, -0.997825350411111645f,
+  -0.064382630929857312f, -0.997925286198595995f,
+  -0.062851757564161989f, -0.998022873771486130f,
+  -0.061320736302208995f, -0.998118112900149179f,
+  -0.059789570746640132f, -0.998211003360478188f,
+  -0.058258264500435857f, -0.998301544933892782f,
+  -0.056726821166907686f, -0.998389737407340161f,
+  -0.055195244349689712f, -0.998475580573294774f,
+  -0.053663537652731026f, -0.998559074229759314f,
+  -0.052131704680283657f, -0.998640218180265160f,
+  -0.050599749036899455f, -0.998719012233872938f,
+  -0.049067674327418029f, -0.998795456205172405f,
+  -0.047535484156959157f, -0.998869549914283561f,
+  -0.046003182130915206f, -0.998941293186856871f,
+  -0.044470771854939084f, -0.999010685854073266f,
+  -0.042938256934941084f, -0.999077727752645361f,
+  -0.041405640977076837f, -0.999142418724816905f,
+  -0.039872927587739748f, -0.999204758618363886f,
+  -0.038340120373552472f, -0.999264747286594424f,
+  -0.036807222941359331f, -0.999322384588349433f,
+  -0.035274238898214294f, -0.999377670388002848f,
+  -0.033741171851377760f, -0.999430604555461732f,
+  -0.032208025408304600f, -0.999481186966166946f,
+  -0.030674803176636484f, -0.999529417501093143f,
+  -0.029141508764194309f, -0.999575296046749218f,
+  -0.027608145778966163f, -0.999618822495178638f,
+  -0.026074717829104161f, -0.999659996743959223f,
+  -0.024541228522912389f, -0.999698818696204250f,
+  -0.023007681468839310f, -0.999735288260561683f,
+  -0.021474080275469286f, -0.999769405351215279f,
+  -0.019940428551514944f, -0.999801169887884256f,
+  -0.018406729905805164f, -0.999830581795823403f,
+  -0.016872987947281894f, -0.999857641005823861f,
+  -0.015339206284988121f, -0.999882347454212561f,
+  -0.013805388528060250f, -0.999904701082852898f,
+  -0.012271538285720512f, -0.999924701839144503f,
+  -0.010737659167264916f, -0.999942349676023912f,
+  -0.009203754782060083f, -0.999957644551963898f,
+  -0.007669828739531199f, -0.999970586430974140f,
+  -0.006135884649154416f, -0.999981175282601109f,
+  -0.004601926120448350f, -0.999989411081928403f,
+  -0.003067956762966483f, -0.999995293809576191f,
+  -0.001533980186285110f, -0.999998823451701879f,
+  -0.000000000000000184f, -1.000000000000000000f,
+  0.001533980186284743f, -0.999998823451701879f,
+  0.003067956762966115f, -0.999995293809576191f,
+  0.004601926120447982f, -0.999989411081928403f,
+  0.006135884649154049f, -0.999981175282601109f,
+  0.007669828739530832f, -0.999970586430974140f,
+  0.009203754782059715f, -0.999957644551963898f,
+  0.010737659167264548f, -0.999942349676023912f,
+  0.012271538285720144f, -0.999924701839144503f,
+  0.013805388528059882f, -0.999904701082852898f,
+  0.015339206284987753f, -0.999882347454212561f,
+  0.016872987947281527f, -0.999857641005823861f,
+  0.018406729905804796f, -0.999830581795823403f,
+  0.019940428551514577f, -0.999801169887884256f,
+  0.021474080275468918f, -0.999769405351215279f,
+  0.023007681468838945f, -0.999735288260561683f,
+  0.024541228522912021f, -0.999698818696204250f,
+  0.026074717829103793f, -0.999659996743959223f,
+  0.027608145778965795f, -0.999618822495178638f,
+  0.029141508764193941f, -0.999575296046749218f,
+  0.030674803176636116f, -0.999529417501093143f,
+  0.032208025408304232f, -0.999481186966166946f,
+  0.033741171851377399f, -0.999430604555461732f,
+  0.035274238898213926f, -0.999377670388002848f,
+  0.036807222941358964f, -0.999322384588349544f,
+  0.038340120373552104f, -0.999264747286594535f,
+  0.039872927587739380f, -0.999204758618363886f,
+  0.041405640977076469f, -0.999142418724816905f,
+  0.042938256934940716f, -0.999077727752645361f,
+  0.044470771854938716f, -0.999010685854073377f,
+  0.046003182130914845f, -0.998941293186856871f,
+  0.047535484156958789f, -0.998869549914283561f,
+  0.049067674327417661f, -0.998795456205172405f,
+  0.050599749036899087f, -0.998719012233872938f,
+  0.052131704680283289f, -0.998640218180265271f,
+  0.053663537652730658f, -0.998559074229759314f,
+  0.055195244349689344f, -0.998475580573294774f,
+  0.056726821166907318f, -0.998389737407340161f,
+  0.058258264500435489f, -0.998301544933892893f,
+  0.059789570746639764f, -0.998211003360478188f,
+  0.061320736302208627f, -0.998118112900149179f,
+  0.062851757564161628f, -0.998022873771486241f,
+  0.064382630929856952f, -0.997925286198595995f,
+  0.065913352797003458f, -0.997825350411111645f,
+  0.067443919563663871f, -0.997723066644191636f,
+  0.068974327628266718f, -0.997618435138519555f,
+  0.070504573389613995f, -0.997511456140303454f,
+  0.072034653246888722f, -0.997402129901275303f,
+  0.073564563599666982f, -0.997290456678690207f,
+  0.075094300847921042f, -0.997176436735326188f,
+  0.076623861392031381f, -0.997060070339482962f,
+  0.078153241632794287f, -0.996941357764982161f,
+  0.079682437971430334f, -0.996820299291165668f,
+  0.081211446809591914f, -0.996696895202896060f,
+  0.082740264549375331f, -0.996571145790554835f,
+  0.084268887593323877f, -0.996443051350042630f,
+  0.085797312344439852f, -0.996312612182778001f,
+  0.087325535206192198f, -0.996179828595696870f,
+  0.088853552582524004f, -0.996044700901252078f,
+  0.090381360877864539f, -0.995907229417411721f,
+  0.091908956497132446f, -0.995767414467659817f,
+  0.093436335845747662f, -0.995625256380994306f,
+  0.094963495329639047f, -0.995480755491926939f,
+  0.096490431355252801f, -0.995333912140482280f,
+  0.098017140329560090f, -0.995184726672196929f,
+  0.099543618660068972f, -0.995033199438118632f,
+  0.101069862754827627f, -0.994879330794805616f,
+  0.102595869022436254f, -0.994723121104325703f,
+  0.104121633872054697f, -0.994564570734255415f,
+  0.105647153713410019f, -0.994403680057679096f,
+  0.107172424956808413f, -0.994240449453188013f,
+  0.108697444013138439f, -0.994074879304879477f,
+  0.110222207293882934f, -0.993906970002356061f,
+  0.111746711211126643f, -0.993736721940724599f,
+  0.113270952177564554f, -0.993564135520595304f,
+  0.114794926606509570f, -0.993389211148080764f,
+  0.116318630911904405f, -0.993211949234794611f,
+  0.117842061508324783f, -0.993032350197851410f,
+  0.119365214810991327f, -0.992850414459865105f,
+  0.120888087235777195f, -0.992666142448948019f,
+  0.122410675199215599f, -0.992479534598710078f,
+  0.123932975118511729f, -0.992290591348257367f,
+  0.125454983411545956f, -0.992099313142191797f,
+  0.126976696496885755f, -0.991905700430609327f,
+  0.128498110793793224f, -0.991709753669099525f,
+  0.130019222722233541f, -0.991511473318743897f,
+  0.131540028702882589f, -0.991310859846115444f,
+  0.133060525157138704f, -0.991107913723276890f,
+  0.134580708507125973f, -0.990902635427780010f,
+  0.136100575175706173f, -0.990695025442664634f,
+  0.137620121586486177f, -0.990485084256456982f,
+  0.139139344163825618f, -0.990272812363169219f,
+  0.140658239332848795f, -0.990058210262297123f,
+  0.142176803519447781f, -0.989841278458820528f,
+  0.143695033150294332f, -0.989622017463200887f,
+  0.145212924652847492f, -0.989400427791380377f,
+  0.146730474455361942f, -0.989176509964780903f,
+  0.148247678986895531f, -0.988950264510303101f,
+  0.149764534677321148f, -0.988721691960323779f,
+  0.151281037957330000f, -0.988490792852696698f,
+  0.152797185258443380f, -0.988257567730749464f,
+  0.154312973013020216f, -0.988022017143283526f,
+  0.155828397654264622f, -0.987784141644572289f,
+  0.157343455616237804f, -0.987543941794359337f,
+  0.158858143333861168f, -0.987301418157858435f,
+  0.160372457242928146f, -0.987056571305751085f,
+  0.161886393780111881f, -0.986809401814185416f,
+  0.163399949382973420f, -0.986559910264775408f,
+  0.164913120489969395f, -0.986308097244598780f,
+  0.166425903540463743f, -0.986053963346195550f,
+  0.167938294974730978f, -0.985797509167567476f,
+  0.169450291233967931f, -0.985538735312176062f,
+  0.170961888760301328f, -0.985277642388941222f,
+  0.172473083996795368f, -0.985014231012239949f,
+  0.173983873387463378f, -0.984748501801904319f,
+  0.175494253377271148f, -0.984480455383220932f,
+  0.177004220412148638f, -0.984210092386929136f,
+  0.178513770938997562f, -0.983937413449218923f,
+  0.180022901405699709f, -0.983662419211730255f,
+  0.181531608261124466f, -0.983385110321551292f,
+  0.183039887955140590f, -0.983105487431216396f,
+  0.184547736938619422f, -0.982823551198705347f,
+  0.186055151663446605f, -0.982539302287441241f,
+  0.187562128582529714f, -0.982252741366289372f,
+  0.189068664149805610f, -0.981963869109555354f,
+  0.190574754820252323f, -0.981672686196983224f,
+  0.192080397049892160f, -0.981379193313754672f,
+  0.193585587295803496f, -0.981083391150486706f,
+  0.195090322016128304f, -0.980785280403230431f,
+  0.196594597670080418f, -0.980484861773469274f,
+  0.198098410717953061f, -0.980182135968117541f,
+  0.199601757621130610f, -0.979877103699517749f,
+  0.201104634842091706f, -0.979569765685440630f,
+  0.202607038844421078f, -0.979260122649082021f,
+  0.204108966092816979f, -0.978948175319062197f,
+  0.205610413053098656f, -0.978633924429423319f,
+  0.207111376192218116f, -0.978317370719627766f,
+  0.208611851978263207f, -0.977998514934557139f,
+  0.210111836880469499f, -0.977677357824510040f,
+  0.211611327369227609f, -0.977353900145199961f,
+  0.213110319916091556f, -0.977028142657754284f,
+  0.214608810993786259f, -0.976700086128711953f,
+  0.216106797076219131f, -0.976369731330021251f,
+  0.217604274638483419f, -0.976037079039039135f,
+  0.219101240156869742f, -0.975702130038528570f,
+  0.220597690108873618f, -0.975364885116656977f,
+  0.222093620973202927f, -0.975025345066994231f,
+  0.223589029229789543f, -0.974683510688510779f,
+  0.225083911359792554f, -0.974339382785575969f,
+  0.226578263845609862f, -0.973992962167955945f,
+  0.228072083170885759f, -0.973644249650811866f,
+  0.229565365820519063f, -0.973293246054698136f,
+  0.231058108280670582f, -0.972939952205560288f,
+  0.232550307038774884f, -0.972584368934732324f,
+  0.234041958583543208f, -0.972226497078936380f,
+  0.235533059404975459f, -0.971866337480279396f,
+  0.237023605994367309f, -0.971503890986251784f,
+  0.238513594844317833f, -0.971139158449725315f,
+  0.240003022448741027f, -0.970772140728950461f,
+  0.241491885302869053f, -0.970402838687555502f,
+  0.242980179903263760f, -0.970031253194543974f,
+  0.244467902747824178f, -0.969657385124292448f,
+  0.245955050335794789f, -0.969281235356548421f,
+  0.247441619167772769f, -0.968902804776428983f,
+  0.248927605745719788f, -0.968522094274417378f,
+  0.250413006572965058f, -0.968139104746362444f,
+  0.251897818154216913f, -0.967753837093475511f,
+  0.253382036995570270f, -0.967366292222328505f,
+  0.254865659604513961f, -0.966976471044852293f,
+  0.256348682489942470f, -0.966584374478333230f,
+  0.257831102162158710f, -0.966190003445412615f,
+  0.259312915132886124f, -0.965793358874083685f,
+  0.260794117915275514f, -0.965394441697689398f,
+  0.262274707023913811f, -0.964993252854920325f,
+  0.263754678974830847f, -0.964589793289812869f,
+  0.265234030285511457f, -0.964184063951745940f,
+  0.266712757474898199f, -0.963776065795439951f,
+  0.268190857063403121f, -0.963365799780954046f,
+  0.269668325572915202f, -0.962953266873683877f,
+  0.271145159526807400f, -0.962538468044359385f,
+  0.272621355449948533f, -0.962121404269041691f,
+  0.274096909868706107f, -0.961702076529122651f,
+  0.275571819310958033f, -0.961280485811320640f,
+  0.277046080306099951f, -0.960856633107679659f,
+  0.278519689385053282f, -0.960430519415565787f,
+  0.279992643080272718f, -0.960002145737666068f,
+  0.281464937925757608f, -0.959571513081984628f,
+  0.282936570457055114f, -0.959138622461842005f,
+  0.284407537211271766f, -0.958703474895871599f,
+  0.285877834727080671f, -0.958266071408017672f,
+  0.287347459544728900f, -0.957826413027533019f,
+  0.288816408206049036f, -0.957384500788976078f,
+  0.290284677254462053f, -0.956940335732208935f,
+  0.291752263234989151f, -0.956493918902395102f,
+  0.293219162694258684f, -0.956045251349996406f,
+  0.294685372180514493f, -0.955594334130770995f,
+  0.296150888243623289f, -0.955141168305770893f,
+  0.297615707435085863f, -0.954685754941338449f,
+  0.299079826308040253f, -0.954228095109105667f,
+  0.300543241417273399f, -0.953768189885990325f,
+  0.302005949319228140f, -0.953306040354193862f,
+  0.303467946572010705f, -0.952841647601198827f,
+  0.304929229735401985f, -0.952375012719765990f,
+  0.306389795370860640f, -0.951906136807932457f,
+  0.307849640041534756f, -0.951435020969008449f,
+  0.309308760312268727f, -0.950961666311575082f,
+  0.310767152749611641f, -0.950486073949481702f,
+  0.312224813921824385f, -0.950008245001843221f,
+  0.313681740398891129f, -0.949528180593036786f,
+  0.315137928752522167f, -0.949045881852700668f,
+  0.316593375556165790f, -0.948561349915730267f,
+  0.318048077385015004f, -0.948074585922276225f,
+  0.319502030816015081f, -0.947585591017741313f,
+  0.320955232427874770f, -0.947094366352777328f,
+  0.322407678801069575f, -0.946600913083283646f,
+  0.323859366517852743f, -0.946105232370403448f,
+  0.325310292162262926f, -0.945607325380521280f,
+  0.326760452320131956f, -0.945107193285260494f,
+  0.328209843579091998f, -0.944604837261480479f,
+  0.329658462528587159f, -0.944100258491272770f,
+  0.331106305759876207f, -0.943593458161960386f,
+  0.332553369866044168f, -0.943084437466093495f,
+  0.333999651442009493f, -0.942573197601446866f,
+  0.335445147084531048f, -0.942059739771017535f,
+  0.336889853392219607f, -0.941544065183020917f,
+  0.338333766965540850f, -0.941026175050889369f,
+  0.339776884406826740f, -0.940506070593268406f,
+  0.341219202320282411f, -0.939983753034013936f,
+  0.342660717311994545f, -0.939459223602189808f,
+  0.344101425989938314f, -0.938932483532064710f,
+  0.345541324963988705f, -0.938403534063108280f,
+  0.346980410845923459f, -0.937872376439989885f,
+  0.348418680249434509f, -0.937339011912574960f,
+  0.349856129790135029f, -0.936803441735921560f,
+  0.351292756085566538f, -0.936265667170278482f,
+  0.352728555755210282f, -0.935725689481080480f,
+  0.354163525420490066f, -0.935183509938947721f,
+  0.355597661704783741f, -0.934639129819680781f,
+  0.357030961233430033f, -0.934092550404258870f,
+  0.358463420633736707f, -0.933543772978836173f,
+  0.359895036534987611f, -0.932992798834739068f,
+  0.361325805568453895f, -0.932439629268462578f,
+  0.362755724367397003f, -0.931884265581668148f,
+  0.364184789567079836f, -0.931326709081180537f,
+  0.365612997804773965f, -0.930766961078983712f,
+  0.367040345719766570f, -0.930205022892219291f,
+  0.368466829953371877f, -0.929640895843181436f,
+  0.369892447148933823f, -0.929074581259315968f,
+  0.371317193951837377f, -0.928506080473215589f,
+  0.372741067009515814f, -0.927935394822617887f,
+  0.374164062971458156f, -0.927362525650401004f,
+  0.375586178489216715f, -0.926787474304581971f,
+  0.377007410216417871f, -0.926210242138311490f,
+  0.378427754808765338f, -0.925630830509872826f,
+  0.379847208924051105f, -0.925049240782677584f,
+  0.381265769222162432f, -0.924465474325262604f,
+  0.382683432365090004f, -0.923879532511286627f,
+  0.384100195016934598f, -0.923291416719527858f,
+  0.385516053843918571f, -0.922701128333878740f,
+  0.386931005514388471f, -0.922108668743345183f,
+  0.388345046698826302f, -0.921514039342041902f,
+  0.389758174069856633f, -0.920917241529189412f,
+  0.391170384302253371f, -0.920318276709110816f,
+  0.392581674072951137f, -0.919717146291227472f,
+  0.393992040061047877f, -0.919113851690057881f,
+  0.395401478947816243f, -0.918508394325212252f,
+  0.396809987416710419f, -0.917900775621390386f,
+  0.398217562153373839f, -0.917290997008377795f,
+  0.399624199845646400f, -0.916679059921042816f,
+  0.401029897183575346f, -0.916064965799331832f,
+  0.402434650859418319f, -0.915448716088267833f,
+  0.403838457567654130f, -0.914830312237946197f,
+  0.405241314004990028f, -0.914209755703530580f,
+  0.406643216870368474f, -0.913587047945251030f,
+  0.408044162864978299f, -0.912962190428398324f,
+  0.409444148692257370f, -0.912335184623322859f,
+  0.410843171057903855f, -0.911706032005429878f,
+  0.412241226669882943f, -0.911074734055176250f,
+  0.413638312238434780f, -0.910441292258067136f,
+  0.415034424476081187f, -0.909805708104652444f,
+  0.416429560097636875f, -0.909167983090522491f,
+  0.417823715820212160f, -0.908528118716306232f,
+  0.419216888363223961f, -0.907886116487666261f,
+  0.420609074448402676f, -0.907241977915295816f,
+  0.422000270799799182f, -0.906595704514915557f,
+  0.423390474143795659f, -0.905947297807268681f,
+  0.424779681209108584f, -0.905296759318118927f,
+  0.426167888726799560f, -0.904644090578246240f,
+  0.427555093430282140f, -0.903989293123443338f,
+  0.428941292055329715f, -0.903332368494511706f,
+  0.430326481340082168f, -0.902673318237259048f,
+  0.431710658025056981f, -0.902012143902493291f,
+  0.433093818853151791f, -0.901348847046022139f,
+  0.434475960569655706f, -0.900683429228646859f,
+  0.435857079922255641f, -0.900015892016160168f,
+  0.437237173661043588f, -0.899346236979341795f,
+  0.438616238538527270f, -0.898674465693954039f,
+  0.439994271309633034f, -0.898000579740739990f,
+  0.441371268731716615f, -0.897324580705418318f,
+  0.442747227564570078f, -0.896646470178680155f,
+  0.444122144570429422f, -0.895966249756184996f,
+  0.445496016513981297f, -0.895283921038557695f,
+  0.446868840162373882f, -0.894599485631382807f,
+  0.448240612285219775f, -0.893912945145203364f,
+  0.449611329654606595f, -0.893224301195515324f,
+  0.450980989045104030f, -0.892533555402764578f,
+  0.452349587233770389f, -0.891840709392342945f,
+  0.453717121000163481f, -0.891145764794583406f,
+  0.455083587126343614f, -0.890448723244757989f,
+  0.456448982396883862f, -0.889749586383072888f,
+  0.457813303598877286f, -0.889048355854664574f,
+  0.459176547521944367f, -0.888345033309596244f,
+  0.460538710958239561f, -0.887639620402854157f,
+  0.461899790702462454f, -0.886932118794342306f,
+  0.463259783551860038f, -0.886222530148880749f,
+  0.464618686306237816f, -0.885510856136199953f,
+  0.465976495767966292f, -0.884797098430937679f,
+  0.467333208741987916f, -0.884081258712635321f,
+  0.468688822035827568f, -0.883363338665731801f,
+  0.470043332459595398f, -0.882643339979562902f,
+  0.471396736825997587f, -0.881921264348355050f,
+  0.472749031950342846f, -0.881197113471221982f,
+  0.474100214650550245f, -0.880470889052160643f,
+  0.475450281747155479f, -0.879742592800047629f,
+  0.476799230063321866f, -0.879012226428633636f,
+  0.478147056424842898f, -0.878279791656541575f,
+  0.479493757660153008f, -0.877545290207261353f,
+  0.480839330600334069f, -0.876808723809145651f,
+  0.482183772079122219f, -0.876070094195406934f,
+  0.483527078932918353f, -0.875329403104111003f,
+  0.484869248000790898f, -0.874586652278176224f,
+  0.486210276124486307f, -0.873841843465366863f,
+  0.487550160148435996f, -0.873094978418290091f,
+  0.488888896919763394f, -0.872346058894391430f,
+  0.490226483288290715f, -0.871595086655951312f,
+  0.491562916106549674f, -0.870842063470079086f,
+  0.492898192229783871f, -0.870086991108711461f,
+  0.494232308515959728f, -0.869329871348606731f,
+  0.495565261825772652f, -0.868570705971340784f,
+  0.496897049022654025f, -0.867809496763303545f,
+  0.498227666972781480f, -0.867046245515692870f,
+  0.499557112545081672f, -0.866280954024513106f,
+  0.500885382611240715f, -0.865513624090569089f,
+  0.502212474045710899f, -0.864744257519462378f,
+  0.503538383725717797f, -0.863972856121586585f,
+  0.504863108531267146f, -0.863199421712124382f,
+  0.506186645345155006f, -0.862423956111040724f,
+  0.507508991052970648f, -0.861646461143081410f,
+  0.508830142543106989f, -0.860866938637767309f,
+  0.510150096706766920f, -0.860085390429390140f,
+  0.511468850437969857f, -0.859301818357008695f,
+  0.512786400633562622f, -0.858516224264442962f,
+  0.514102744193221550f, -0.857728610000272229f,
+  0.515417878019462927f, -0.856938977417828762f,
+  0.516731799017649984f, -0.856147328375194472f,
+  0.518044504095999558f, -0.855353664735195918f,
+  0.519355990165589199f, -0.854557988365400756f,
+  0.520666254140366824f, -0.853760301138111521f,
+  0.521975292937154167f, -0.852960604930363742f,
+  0.523283103475656430f, -0.852158901623919829f,
+  0.524589682678469060f, -0.851355193105265085f,
+  0.525895027471084187f, -0.850549481265603702f,
+  0.527199134781900947f, -0.849741768000852660f,
+  0.528502001542228261f, -0.848932055211639724f,
+  0.529803624686294605f, -0.848120344803297344f,
+  0.531104001151255001f, -0.847306638685858315f,
+  0.532403127877198123f, -0.846490938774052015f,
+  0.533701001807152520f, -0.845673246987299287f,
+  0.534997619887096931f, -0.844853565249707228f,
+  0.536292979065962960f, -0.844031895490066519f,
+  0.537587076295645505f, -0.843208239641845436f,
+  0.538879908531008534f, -0.842382599643185848f,
+  0.540171472729892410f, -0.841554977436898777f,
+  0.541461765853123111f, -0.840725374970458295f,
+  0.542750784864515667f, -0.839893794195999632f,
+  0.544038526730883820f, -0.839060237070312742f,
+  0.545324988422046464f, -0.838224705554837968f,
+  0.546610166910835082f, -0.837387201615661825f,
+  0.547894059173099746f, -0.836547727223512227f,
+  0.549176662187719433f, -0.835706284353752715f,
+  0.550457972936604700f, -0.834862874986380121f,
+  0.551737988404707447f, -0.834017501106018133f,
+  0.553016705580027690f, -0.833170164701913074f,
+  0.554294121453619670f, -0.832320867767930017f,
+  0.555570233019601845f, -0.831469612302545458f,
+  0.556845037275159882f, -0.830616400308846425f,
+  0.558118531220555991f, -0.829761233794523156f,
+  0.559390711859136136f, -0.828904114771864875f,
+  0.560661576197336253f, -0.828045045257755685f,
+  0.561931121244689025f, -0.827184027273669353f,
+  0.563199344013833869f, -0.826321062845663645f,
+  0.564466241520519274f, -0.825456154004377662f,
+  0.565731810783613120f, -0.824589302785025291f,
+  0.566996048825108789f, -0.823720511227391317f,
+  0.568258952670131046f, -0.822849781375826650f,
+  0.569520519346946807f, -0.821977115279241777f,
+  0.570780745886967034f, -0.821102514991104870f,
+  0.572039629324756937f, -0.820225982569434686f,
+  0.573297166698042204f, -0.819347520076796898f,
+  0.574553355047715986f, -0.818467129580298547f,
+  0.575808191417844895f, -0.817584813151584044f,
+  0.577061672855679220f, -0.816700572866827956f,
+  0.578313796411655368f, -0.815814410806733892f,
+  0.579564559139405744f, -0.814926329056526622f,
+  0.580813958095764638f, -0.814036329705948303f,
+  0.582061990340775104f, -0.813144414849253927f,
+  0.583308652937697958f, -0.812250586585204215f,
+  0.584553942953015104f, -0.811354847017063951f,
+  0.585797857456438753f, -0.810457198252594879f,
+  0.587040393520918080f, -0.809557642404051259f,
+  0.588281548222645445f, -0.808656181588174872f,
+  0.589521318641063496f, -0.807752817926190692f,
+  0.590759701858873942f, -0.806847553543799445f,
+  0.591996694962040770f, -0.805940390571176390f,
+  0.593232295039799795f, -0.805031331142963658f,
+  0.594466499184664543f, -0.804120377398265695f,
+  0.595699304492432913f, -0.803207531480645276f,
+  0.596930708062196169f, -0.802292795538115944f,
+  0.598160706996342051f, -0.801376171723140351f,
+  0.599389298400564430f, -0.800457662192622821f,
+  0.600616479383868973f, -0.799537269107905013f,
+  0.601842247058580249f, -0.798614994634760711f,
+  0.603066598540347831f, -0.797690840943391377f,
+  0.604289530948155740f, -0.796764810208418939f,
+  0.605511041404325323f, -0.795836904608883677f,
+  0.606731127034524476f, -0.794907126328237013f,
+  0.607949784967773743f, -0.793975477554337061f,
+  0.609167012336452651f, -0.793041960479444086f,
+  0.610382806276309142f, -0.792106577300212611f,
+  0.611597163926461684f, -0.791169330217690314f,
+  0.612810082429409597f, -0.790230221437310143f,
+  0.614021558931038491f, -0.789289253168885652f,
+  0.615231590580627041f, -0.788346427626606117f,
+  0.616440174530853202f, -0.787401747029031762f,
+  0.617647307937803647f, -0.786455213599085989f,
+  0.618852987960976209f, -0.785506829564054043f,
+  0.620057211763289096f, -0.784556597155575242f,
+  0.621259976511087664f, -0.783604518609638201f,
+  0.622461279374149523f, -0.782650596166576062f,
+  0.623661117525694197f, -0.781694832071059720f,
+  0.624859488142386121f, -0.780737228572094599f,
+  0.626056388404343411f, -0.779777787923014554f,
+  0.627251815495144194f, -0.778816512381475978f,
+  0.628445766601832823f, -0.777853404209452925f,
+  0.629638238914926651f, -0.776888465673232775f,
+  0.630829229628424248f, -0.775921699043407798f,
+  0.632018735939808840f, -0.774953106594874042f,
+  0.633206755050057191f, -0.773982690606822787f,
+  0.634393284163645599f, -0.773010453362736882f,
+  0.635578320488555670f, -0.772036397150384857f,
+  0.636761861236283866f, -0.771060524261814040f,
+  0.637943903621843833f, -0.770082836993348119f,
+  0.639124444863775620f, -0.769103337645579699f,
+  0.640303482184151673f, -0.768122028523365419f,
+  0.641481012808583273f, -0.767138911935820289f,
+  0.642657033966226421f, -0.766153990196313250f,
+  0.643831542889791164f, -0.765167265622459181f,
+  0.645004536815543816f, -0.764178740536116896f,
+  0.646176012983316284f, -0.763188417263381269f,
+  0.647345968636512170f, -0.762196298134578898f,
+  0.648514401022111997f, -0.761202385484262223f,
+  0.649681307390682861f, -0.760206681651202754f,
+  0.650846684996380653f, -0.759209188978388183f,
+  0.652010531096959500f, -0.758209909813015392f,
+  0.653172842953776756f, -0.757208846506484567f,
+  0.654333617831800662f, -0.756206001414394424f,
+  0.655492852999615017f, -0.755201376896536880f,
+  0.656650545729428714f, -0.754194975316889393f,
+  0.657806693297078526f, -0.753186799043612631f,
+  0.658961292982037317f, -0.752176850449042700f,
+  0.660114342067420590f, -0.751165131909686368f,
+  0.661265837839991710f, -0.750151645806215406f,
+  0.662415777590171451f, -0.749136394523459592f,
+  0.663564158612039545f, -0.748119380450403715f,
+  0.664710978203344793f, -0.747100605980180243f,
+  0.665856233665509722f, -0.746080073510063779f,
+  0.666999922303637693f, -0.745057785441465836f,
+  0.668142041426518118f, -0.744033744179929624f,
+  0.669282588346635787f, -0.743007952135121941f,
+  0.670421560380172976f, -0.741980411720831179f,
+  0.671558954847018330f, -0.740951125354959106f,
+  0.672694769070772969f, -0.739920095459516092f,
+  0.673829000378755594f, -0.738887324460615558f,
+  0.674961646102011703f, -0.737852814788466316f,
+  0.676092703575315701f, -0.736816568877370015f,
+  0.677222170137180335f, -0.735778589165713592f,
+  0.678350043129861469f, -0.734738878095963388f,
+  0.679476319899365189f, -0.733697438114660150f,
+  0.680600997795452689f, -0.732654271672413149f,
+  0.681724074171649486f, -0.731609381223892852f,
+  0.682845546385247970f, -0.730562769227827702f,
+  0.683965411797315403f, -0.729514438146997013f,
+  0.685083667772700466f, -0.728464390448225085f,
+  0.686200311680038144f, -0.727412628602376210f,
+  0.687315340891758830f, -0.726359155084346342f,
+  0.688428752784090214f, -0.725303972373060990f,
+  0.689540544737066829f, -0.724247082951467003f,
+  0.690650714134534716f, -0.723188489306527349f,
+  0.691759258364157859f, -0.722128193929215234f,
+  0.692866174817424296f, -0.721066199314508438f,
+  0.693971460889653780f, -0.720002507961381877f,
+  0.695075113980000769f, -0.718937122372804605f,
+  0.696177131491462875f, -0.717870045055731820f,
+  0.697277510830886627f, -0.716801278521099428f,
+  0.698376249408972360f, -0.715730825283819039f,
+  0.699473344640283434f, -0.714658687862769315f,
+  0.700568793943248114f, -0.713584868780793746f,
+  0.701662594740168455f, -0.712509370564692435f,
+  0.702754744457225300f, -0.711432195745216434f,
+  0.703845240524485050f, -0.710353346857062196f,
+  0.704934080375904548f, -0.709272826438866022f,
+  0.706021261449339521f, -0.708190637033195625f,
+  0.707106781186547351f, -0.707106781186547684f,
+  0.708190637033195292f, -0.706021261449339854f,
+  0.709272826438865689f, -0.704934080375904881f,
+  0.710353346857061863f, -0.703845240524485383f,
+  0.711432195745216100f, -0.702754744457225633f,
+  0.712509370564692102f, -0.701662594740168677f,
+  0.713584868780793524f, -0.700568793943248447f,
+  0.714658687862769093f, -0.699473344640283767f,
+  0.715730825283818817f, -0.698376249408972694f,
+  0.716801278521099094f, -0.697277510830886960f,
+  0.717870045055731487f, -0.696177131491463208f,
+  0.718937122372804271f, -0.695075113980000991f,
+  0.720002507961381544f, -0.693971460889654002f,
+  0.721066199314508216f, -0.692866174817424629f,
+  0.722128193929214901f, -0.691759258364158192f,
+  0.723188489306527127f, -0.690650714134534938f,
+  0.724247082951466670f, -0.689540544737067163f,
+  0.725303972373060657f, -0.688428752784090547f,
+  0.726359155084346009f, -0.687315340891759052f,
+  0.727412628602375877f, -0.686200311680038477f,
+  0.728464390448224863f, -0.685083667772700800f,
+  0.729514438146996791f, -0.683965411797315737f,
+  0.730562769227827369f, -0.682845546385248192f,
+  0.731609381223892519f, -0.681724074171649819f,
+  0.732654271672412927f, -0.680600997795453022f,
+  0.733697438114659817f, -0.679476319899365522f,
+  0.734738878095963166f, -0.678350043129861802f,
+  0.735778589165713370f, -0.677222170137180668f,
+  0.736816568877369793f, -0.676092703575316034f,
+  0.737852814788465983f, -0.674961646102012036f,
+  0.738887324460615225f, -0.673829000378755927f,
+  0.739920095459515759f, -0.672694769070773302f,
+  0.740951125354958884f, -0.671558954847018663f,
+  0.741980411720830846f, -0.670421560380173309f,
+  0.743007952135121608f, -0.669282588346636120f,
+  0.744033744179929291f, -0.668142041426518452f,
+  0.745057785441465503f, -0.666999922303638026f,
+  0.746080073510063446f, -0.665856233665510056f,
+  0.747100605980179910f, -0.664710978203345126f,
+  0.748119380450403493f, -0.663564158612039878f,
+  0.749136394523459370f, -0.662415777590171784f,
+  0.750151645806215184f, -0.661265837839992043f,
+  0.751165131909686035f, -0.660114342067420923f,
+  0.752176850449042478f, -0.658961292982037650f,
+  0.753186799043612298f, -0.657806693297078859f,
+  0.754194975316889060f, -0.656650545729429047f,
+  0.755201376896536547f, -0.655492852999615350f,
+  0.756206001414394091f, -0.654333617831800995f,
+  0.757208846506484234f, -0.653172842953777089f,
+  0.758209909813015059f, -0.652010531096959722f,
+  0.759209188978387961f, -0.650846684996380986f,
+  0.760206681651202421f, -0.649681307390683194f,
+  0.761202385484261890f, -0.648514401022112330f,
+  0.762196298134578565f, -0.647345968636512503f,
+  0.763188417263381047f, -0.646176012983316617f,
+  0.764178740536116563f, -0.645004536815544149f,
+  0.765167265622458848f, -0.643831542889791497f,
+  0.766153990196312917f, -0.642657033966226754f,
+  0.767138911935819956f, -0.641481012808583606f,
+  0.768122028523365086f, -0.640303482184152006f,
+  0.769103337645579477f, -0.639124444863775953f,
+  0.770082836993347897f, -0.637943903621844166f,
+  0.771060524261813818f, -0.636761861236284199f,
+  0.772036397150384635f, -0.635578320488556003f,
+  0.773010453362736660f, -0.634393284163645932f,
+  0.773982690606822565f, -0.633206755050057524f,
+  0.774953106594873709f, -0.632018735939809173f,
+  0.775921699043407576f, -0.630829229628424581f,
+  0.776888465673232553f, -0.629638238914926984f,
+  0.777853404209452703f, -0.628445766601833156f,
+  0.778816512381475645f, -0.627251815495144527f,
+  0.779777787923014332f, -0.626056388404343744f,
+  0.780737228572094377f, -0.624859488142386454f,
+  0.781694832071059387f, -0.623661117525694531f,
+  0.782650596166575840f, -0.622461279374149856f,
+  0.783604518609637868f, -0.621259976511087997f,
+  0.784556597155575020f, -0.620057211763289540f,
+  0.785506829564053821f, -0.618852987960976542f,
+  0.786455213599085767f, -0.617647307937803980f,
+  0.787401747029031429f, -0.616440174530853535f,
+  0.788346427626605895f, -0.615231590580627374f,
+  0.789289253168885430f, -0.614021558931038824f,
+  0.790230221437309810f, -0.612810082429409930f,
+  0.791169330217690092f, -0.611597163926462017f,
+  0.792106577300212389f, -0.610382806276309475f,
+  0.793041960479443753f, -0.609167012336453095f,
+  0.793975477554336839f, -0.607949784967774076f,
+  0.794907126328236679f, -0.606731127034524809f,
+  0.795836904608883344f, -0.605511041404325656f,
+  0.796764810208418717f, -0.604289530948156073f,
+  0.797690840943391155f, -0.603066598540348164f,
+  0.798614994634760489f, -0.601842247058580582f,
+  0.799537269107904791f, -0.600616479383869306f,
+  0.800457662192622599f, -0.599389298400564763f,
+  0.801376171723140129f, -0.598160706996342384f,
+  0.802292795538115722f, -0.596930708062196502f,
+  0.803207531480645054f, -0.595699304492433246f,
+  0.804120377398265362f, -0.594466499184664876f,
+  0.805031331142963325f, -0.593232295039800128f,
+  0.805940390571176168f, -0.591996694962041103f,
+  0.806847553543799223f, -0.590759701858874275f,
+  0.807752817926190358f, -0.589521318641063830f,
+  0.808656181588174650f, -0.588281548222645778f,
+  0.809557642404051037f, -0.587040393520918413f,
+  0.810457198252594657f, -0.585797857456439086f,
+  0.811354847017063618f, -0.584553942953015437f,
+  0.812250586585203882f, -0.583308652937698291f,
+  0.813144414849253594f, -0.582061990340775437f,
+  0.814036329705948081f, -0.580813958095764971f,
+  0.814926329056526400f, -0.579564559139406077f,
+  0.815814410806733670f, -0.578313796411655812f,
+  0.816700572866827734f, -0.577061672855679553f,
+  0.817584813151583711f, -0.575808191417845228f,
+  0.818467129580298325f, -0.574553355047716319f,
+  0.819347520076796676f, -0.573297166698042648f,
+  0.820225982569434464f, -0.572039629324757382f,
+  0.821102514991104537f, -0.570780745886967367f,
+  0.821977115279241555f, -0.569520519346947141f,
+  0.822849781375826428f, -0.568258952670131379f,
+  0.823720511227391095f, -0.566996048825109122f,
+  0.824589302785025069f, -0.565731810783613565f,
+  0.825456154004377329f, -0.564466241520519607f,
+  0.826321062845663423f, -0.563199344013834202f,
+  0.827184027273669131f, -0.561931121244689358f,
+  0.828045045257755352f, -0.560661576197336586f,
+  0.828904114771864653f, -0.559390711859136469f,
+  0.829761233794522823f, -0.558118531220556435f,
+  0.830616400308846203f, -0.556845037275160215f,
+  0.831469612302545236f, -0.555570233019602178f,
+  0.832320867767929684f, -0.554294121453620003f,
+  0.833170164701912852f, -0.553016705580028023f,
+  0.834017501106017911f, -0.551737988404707780f,
+  0.834862874986379899f, -0.550457972936605033f,
+  0.835706284353752493f, -0.549176662187719766f,
+  0.836547727223512005f, -0.547894059173100079f,
+  0.837387201615661603f, -0.546610166910835416f,
+  0.838224705554837746f, -0.545324988422046797f,
+  0.839060237070312520f, -0.544038526730884153f,
+  0.839893794195999410f, -0.542750784864516000f,
+  0.840725374970458073f, -0.541461765853123445f,
+  0.841554977436898444f, -0.540171472729892743f,
+  0.842382599643185515f, -0.538879908531008867f,
+  0.843208239641845214f, -0.537587076295645838f,
+  0.844031895490066297f, -0.536292979065963404f,
+  0.844853565249707006f, -0.534997619887097264f,
+  0.845673246987299065f, -0.533701001807152853f,
+  0.846490938774051682f, -0.532403127877198568f,
+  0.847306638685858093f, -0.531104001151255445f,
+  0.848120344803297121f, -0.529803624686294938f,
+  0.848932055211639502f, -0.528502001542228594f,
+  0.849741768000852438f, -0.527199134781901391f,
+  0.850549481265603480f, -0.525895027471084520f,
+  0.851355193105264862f, -0.524589682678469393f,
+  0.852158901623919607f, -0.523283103475656763f,
+  0.852960604930363520f, -0.521975292937154500f,
+  0.853760301138111299f, -0.520666254140367268f,
+  0.854557988365400534f, -0.519355990165589532f,
+  0.855353664735195696f, -0.518044504095999891f,
+  0.856147328375194250f, -0.516731799017650317f,
+  0.856938977417828540f, -0.515417878019463260f,
+  0.857728610000272007f, -0.514102744193221883f,
+  0.858516224264442740f, -0.512786400633563066f,
+  0.859301818357008473f, -0.511468850437970302f,
+  0.860085390429389918f, -0.510150096706767253f,
+  0.860866938637767087f, -0.508830142543107433f,
+  0.861646461143081188f, -0.507508991052971092f,
+  0.862423956111040502f, -0.506186645345155339f,
+  0.863199421712124160f, -0.504863108531267479f,
+  0.863972856121586363f, -0.503538383725718131f,
+  0.864744257519462156f, -0.502212474045711232f,
+  0.865513624090568867f, -0.500885382611241048f,
+  0.866280954024512884f, -0.499557112545082005f,
+  0.867046245515692648f, -0.498227666972781869f,
+  0.867809496763303323f, -0.496897049022654413f,
+  0.868570705971340562f, -0.495565261825773040f,
+  0.869329871348606620f, -0.494232308515960117f,
+  0.870086991108711350f, -0.492898192229784260f,
+  0.870842063470078864f, -0.491562916106550007f,
+  0.871595086655951090f, -0.490226483288291104f,
+  0.872346058894391208f, -0.488888896919763727f,
+  0.873094978418289869f, -0.487550160148436384f,
+  0.873841843465366641f, -0.486210276124486696f,
+  0.874586652278176002f, -0.484869248000791231f,
+  0.875329403104110892f, -0.483527078932918741f,
+  0.876070094195406712f, -0.482183772079122608f,
+  0.876808723809145429f, -0.480839330600334458f,
+  0.877545290207261131f, -0.479493757660153397f,
+  0.878279791656541353f, -0.478147056424843286f,
+  0.879012226428633414f, -0.476799230063322199f,
+  0.879742592800047518f, -0.475450281747155812f,
+  0.880470889052160421f, -0.474100214650550578f,
+  0.881197113471221760f, -0.472749031950343235f,
+  0.881921264348354828f, -0.471396736825997920f,
+  0.882643339979562680f, -0.470043332459595786f,
+  0.883363338665731579f, -0.468688822035827957f,
+  0.884081258712635099f, -0.467333208741988304f,
+  0.884797098430937456f, -0.465976495767966681f,
+  0.885510856136199731f, -0.464618686306238204f,
+  0.886222530148880527f, -0.463259783551860427f,
+  0.886932118794342084f, -0.461899790702462842f,
+  0.887639620402853935f, -0.460538710958239950f,
+  0.888345033309596022f, -0.459176547521944700f,
+  0.889048355854664352f, -0.457813303598877674f,
+  0.889749586383072666f, -0.456448982396884251f,
+  0.890448723244757767f, -0.455083587126344002f,
+  0.891145764794583184f, -0.453717121000163870f,
+  0.891840709392342834f, -0.452349587233770722f,
+  0.892533555402764356f, -0.450980989045104363f,
+  0.893224301195515102f, -0.449611329654606984f,
+  0.893912945145203142f, -0.448240612285220164f,
+  0.894599485631382585f, -0.446868840162374270f,
+  0.895283921038557584f, -0.445496016513981685f,
+  0.895966249756184885f, -0.444122144570429811f,
+  0.896646470178679933f, -0.442747227564570467f,
+  0.897324580705418096f, -0.441371268731717004f,
+  0.898000579740739768f, -0.439994271309633422f,
+  0.898674465693953817f, -0.438616238538527659f,
+  0.899346236979341573f, -0.437237173661043976f,
+  0.900015892016159946f, -0.435857079922256030f,
+  0.900683429228646748f, -0.434475960569656094f,
+  0.901348847046021917f, -0.433093818853152179f,
+  0.902012143902493180f, -0.431710658025057370f,
+  0.902673318237258826f, -0.430326481340082556f,
+  0.903332368494511595f, -0.428941292055330103f,
+  0.903989293123443116f, -0.427555093430282529f,
+  0.904644090578246018f, -0.426167888726799948f,
+  0.905296759318118704f, -0.424779681209108972f,
+  0.905947297807268459f, -0.423390474143796047f,
+  0.906595704514915446f, -0.422000270799799571f,
+  0.907241977915295594f, -0.420609074448403064f,
+  0.907886116487666039f, -0.419216888363224349f,
+  0.908528118716306010f, -0.417823715820212549f,
+  0.909167983090522380f, -0.416429560097637264f,
+  0.909805708104652222f, -0.415034424476081576f,
+  0.910441292258066914f, -0.413638312238435168f,
+  0.911074734055176139f, -0.412241226669883332f,
+  0.911706032005429656f, -0.410843171057904244f,
+  0.912335184623322637f, -0.409444148692257814f,
+  0.912962190428398102f, -0.408044162864978688f,
+  0.913587047945250919f, -0.406643216870368862f,
+  0.914209755703530469f, -0.405241314004990416f,
+  0.914830312237945975f, -0.403838457567654519f,
+  0.915448716088267722f, -0.402434650859418708f,
+  0.916064965799331610f, -0.401029897183575734f,
+  0.916679059921042705f, -0.399624199845646788f,
+  0.917290997008377684f, -0.398217562153374227f,
+  0.917900775621390275f, -0.396809987416710808f,
+  0.918508394325212141f, -0.395401478947816631f,
+  0.919113851690057659f, -0.393992040061048265f,
+  0.919717146291227361f, -0.392581674072951525f,
+  0.920318276709110594f, -0.391170384302253760f,
+  0.920917241529189190f, -0.389758174069857022f,
+  0.921514039342041791f, -0.388345046698826690f,
+  0.922108668743344961f, -0.386931005514388859f,
+  0.922701128333878517f, -0.385516053843918960f,
+  0.923291416719527636f, -0.384100195016934987f,
+  0.923879532511286516f, -0.382683432365090392f,
+  0.924465474325262493f, -0.381265769222162820f,
+  0.925049240782677473f, -0.379847208924051494f,
+  0.925630830509872715f, -0.378427754808765782f,
+  0.926210242138311379f, -0.377007410216418259f,
+  0.926787474304581860f, -0.375586178489217104f,
+  0.927362525650400893f, -0.374164062971458544f,
+  0.927935394822617665f, -0.372741067009516203f,
+  0.928506080473215478f, -0.371317193951837821f,
+  0.929074581259315746f, -0.369892447148934211f,
+  0.929640895843181325f, -0.368466829953372266f,
+  0.930205022892219180f, -0.367040345719767014f,
+  0.930766961078983490f, -0.365612997804774353f,
+  0.931326709081180315f, -0.364184789567080225f,
+  0.931884265581668036f, -0.362755724367397392f,
+  0.932439629268462356f, -0.361325805568454284f,
+  0.932992798834738957f, -0.359895036534988000f,
+  0.933543772978835951f, -0.358463420633737095f,
+  0.934092550404258759f, -0.357030961233430422f,
+  0.934639129819680670f, -0.355597661704784129f,
+  0.935183509938947499f, -0.354163525420490510f,
+  0.935725689481080369f, -0.352728555755210671f,
+  0.936265667170278371f, -0.351292756085566926f,
+  0.936803441735921449f, -0.349856129790135417f,
+  0.937339011912574849f, -0.348418680249434898f,
+  0.937872376439989774f, -0.346980410845923848f,
+  0.938403534063108058f, -0.345541324963989094f,
+  0.938932483532064599f, -0.344101425989938703f,
+  0.939459223602189697f, -0.342660717311994933f,
+  0.939983753034013825f, -0.341219202320282800f,
+  0.940506070593268184f, -0.339776884406827129f,
+  0.941026175050889258f, -0.338333766965541294f,
+  0.941544065183020806f, -0.336889853392219996f,
+  0.942059739771017424f, -0.335445147084531436f,
+  0.942573197601446755f, -0.333999651442009882f,
+  0.943084437466093384f, -0.332553369866044557f,
+  0.943593458161960275f, -0.331106305759876596f,
+  0.944100258491272659f, -0.329658462528587548f,
+  0.944604837261480257f, -0.328209843579092386f,
+  0.945107193285260383f, -0.326760452320132344f,
+  0.945607325380521169f, -0.325310292162263370f,
+  0.946105232370403337f, -0.323859366517853131f,
+  0.946600913083283535f, -0.322407678801069963f,
+  0.947094366352777217f, -0.320955232427875214f,
+  0.947585591017741202f, -0.319502030816015470f,
+  0.948074585922276114f, -0.318048077385015449f,
+  0.948561349915730156f, -0.316593375556166234f,
+  0.949045881852700557f, -0.315137928752522611f,
+  0.949528180593036675f, -0.313681740398891518f,
+  0.950008245001843110f, -0.312224813921824829f,
+  0.950486073949481480f, -0.310767152749612086f,
+  0.950961666311574971f, -0.309308760312269171f,
+  0.951435020969008338f, -0.307849640041535144f,
+  0.951906136807932235f, -0.306389795370861084f,
+  0.952375012719765879f, -0.304929229735402374f,
+  0.952841647601198716f, -0.303467946572011094f,
+  0.953306040354193640f, -0.302005949319228584f,
+  0.953768189885990214f, -0.300543241417273788f,
+  0.954228095109105556f, -0.299079826308040642f,
+  0.954685754941338338f, -0.297615707435086252f,
+  0.955141168305770782f, -0.296150888243623733f,
+  0.955594334130770884f, -0.294685372180514937f,
+  0.956045251349996295f, -0.293219162694259072f,
+  0.956493918902394991f, -0.291752263234989540f,
+  0.956940335732208824f, -0.290284677254462498f,
+  0.957384500788975856f, -0.288816408206049424f,
+  0.957826413027532908f, -0.287347459544729344f,
+  0.958266071408017450f, -0.285877834727081115f,
+  0.958703474895871488f, -0.284407537211272210f,
+  0.959138622461841894f, -0.282936570457055558f,
+  0.959571513081984517f, -0.281464937925758052f,
+  0.960002145737665957f, -0.279992643080273107f,
+  0.960430519415565676f, -0.278519689385053670f,
+  0.960856633107679547f, -0.277046080306100340f,
+  0.961280485811320529f, -0.275571819310958421f,
+  0.961702076529122540f, -0.274096909868706495f,
+  0.962121404269041580f, -0.272621355449948977f,
+  0.962538468044359163f, -0.271145159526807844f,
+  0.962953266873683766f, -0.269668325572915590f,
+  0.963365799780953935f, -0.268190857063403565f,
+  0.963776065795439840f, -0.266712757474898587f,
+  0.964184063951745718f, -0.265234030285511846f,
+  0.964589793289812758f, -0.263754678974831291f,
+  0.964993252854920214f, -0.262274707023914200f,
+  0.965394441697689287f, -0.260794117915275958f,
+  0.965793358874083574f, -0.259312915132886512f,
+  0.966190003445412504f, -0.257831102162159154f,
+  0.966584374478333119f, -0.256348682489942858f,
+  0.966976471044852182f, -0.254865659604514405f,
+  0.967366292222328394f, -0.253382036995570659f,
+  0.967753837093475400f, -0.251897818154217301f,
+  0.968139104746362333f, -0.250413006572965446f,
+  0.968522094274417267f, -0.248927605745720204f,
+  0.968902804776428872f, -0.247441619167773186f,
+  0.969281235356548310f, -0.245955050335795206f,
+  0.969657385124292337f, -0.244467902747824595f,
+  0.970031253194543974f, -0.242980179903264176f,
+  0.970402838687555391f, -0.241491885302869469f,
+  0.970772140728950350f, -0.240003022448741443f,
+  0.971139158449725204f, -0.238513594844318250f,
+  0.971503890986251673f, -0.237023605994367725f,
+  0.971866337480279285f, -0.235533059404975875f,
+  0.972226497078936269f, -0.234041958583543624f,
+  0.972584368934732213f, -0.232550307038775300f,
+  0.972939952205560177f, -0.231058108280670998f,
+  0.973293246054698136f, -0.229565365820519479f,
+  0.973644249650811866f, -0.228072083170886175f,
+  0.973992962167955834f, -0.226578263845610278f,
+  0.974339382785575858f, -0.225083911359792971f,
+  0.974683510688510668f, -0.223589029229789960f,
+  0.975025345066994231f, -0.222093620973203343f,
+  0.975364885116656866f, -0.220597690108874062f,
+  0.975702130038528459f, -0.219101240156870158f,
+  0.976037079039039024f, -0.217604274638483836f,
+  0.976369731330021140f, -0.216106797076219548f,
+  0.976700086128711842f, -0.214608810993786675f,
+  0.977028142657754173f, -0.213110319916091973f,
+  0.977353900145199961f, -0.211611327369228025f,
+  0.977677357824509929f, -0.210111836880469915f,
+  0.977998514934557028f, -0.208611851978263624f,
+  0.978317370719627655f, -0.207111376192218533f,
+  0.978633924429423208f, -0.205610413053099073f,
+  0.978948175319062086f, -0.204108966092817395f,
+  0.979260122649082021f, -0.202607038844421494f,
+  0.979569765685440519f, -0.201104634842092123f,
+  0.979877103699517638f, -0.199601757621131026f,
+  0.980182135968117429f, -0.198098410717953477f,
+  0.980484861773469274f, -0.196594597670080834f,
+  0.980785280403230320f, -0.195090322016128720f,
+  0.981083391150486595f, -0.193585587295803913f,
+  0.981379193313754561f, -0.192080397049892576f,
+  0.981672686196983113f, -0.190574754820252740f,
+  0.981963869109555354f, -0.189068664149806026f,
+  0.982252741366289261f, -0.187562128582530130f,
+  0.982539302287441130f, -0.186055151663447021f,
+  0.982823551198705236f, -0.184547736938619839f,
+  0.983105487431216285f, -0.183039887955141006f,
+  0.983385110321551181f, -0.181531608261124883f,
+  0.983662419211730144f, -0.180022901405700125f,
+  0.983937413449218812f, -0.178513770938997979f,
+  0.984210092386929025f, -0.177004220412149055f,
+  0.984480455383220932f, -0.175494253377271564f,
+  0.984748501801904208f, -0.173983873387463794f,
+  0.985014231012239838f, -0.172473083996795784f,
+  0.985277642388941111f, -0.170961888760301772f,
+  0.985538735312175951f, -0.169450291233968348f,
+  0.985797509167567365f, -0.167938294974731395f,
+  0.986053963346195439f, -0.166425903540464187f,
+  0.986308097244598669f, -0.164913120489969811f,
+  0.986559910264775297f, -0.163399949382973864f,
+  0.986809401814185416f, -0.161886393780112298f,
+  0.987056571305750974f, -0.160372457242928562f,
+  0.987301418157858324f, -0.158858143333861584f,
+  0.987543941794359226f, -0.157343455616238248f,
+  0.987784141644572178f, -0.155828397654265066f,
+  0.988022017143283526f, -0.154312973013020632f,
+  0.988257567730749464f, -0.152797185258443796f,
+  0.988490792852696587f, -0.151281037957330444f,
+  0.988721691960323779f, -0.149764534677321592f,
+  0.988950264510302990f, -0.148247678986895948f,
+  0.989176509964780903f, -0.146730474455362386f,
+  0.989400427791380266f, -0.145212924652847936f,
+  0.989622017463200776f, -0.143695033150294749f,
+  0.989841278458820528f, -0.142176803519448197f,
+  0.990058210262297123f, -0.140658239332849211f,
+  0.990272812363169108f, -0.139139344163826034f,
+  0.990485084256456982f, -0.137620121586486593f,
+  0.990695025442664634f, -0.136100575175706590f,
+  0.990902635427780010f, -0.134580708507126418f,
+  0.991107913723276779f, -0.133060525157139120f,
+  0.991310859846115444f, -0.131540028702883005f,
+  0.991511473318743897f, -0.130019222722233985f,
+  0.991709753669099414f, -0.128498110793793641f,
+  0.991905700430609327f, -0.126976696496886171f,
+  0.992099313142191686f, -0.125454983411546372f,
+  0.992290591348257367f, -0.123932975118512159f,
+  0.992479534598709967f, -0.122410675199216029f,
+  0.992666142448947908f, -0.120888087235777625f,
+  0.992850414459864994f, -0.119365214810991757f,
+  0.993032350197851410f, -0.117842061508325199f,
+  0.993211949234794500f, -0.116318630911904836f,
+  0.993389211148080653f, -0.114794926606509987f,
+  0.993564135520595304f, -0.113270952177564971f,
+  0.993736721940724599f, -0.111746711211127059f,
+  0.993906970002356061f, -0.110222207293883365f,
+  0.994074879304879366f, -0.108697444013138869f,
+  0.994240449453187902f, -0.107172424956808843f,
+  0.994403680057679096f, -0.105647153713410435f,
+  0.994564570734255415f, -0.104121633872055128f,
+  0.994723121104325703f, -0.102595869022436684f,
+  0.994879330794805616f, -0.101069862754828058f,
+  0.995033199438118632f, -0.099543618660069402f,
+  0.995184726672196929f, -0.098017140329560506f,
+  0.995333912140482169f, -0.096490431355253231f,
+  0.995480755491926939f, -0.094963495329639477f,
+  0.995625256380994306f, -0.093436335845748092f,
+  0.995767414467659817f, -0.091908956497132877f,
+  0.995907229417411721f, -0.090381360877864969f,
+  0.996044700901251967f, -0.088853552582524420f,
+  0.996179828595696870f, -0.087325535206192628f,
+  0.996312612182778001f, -0.085797312344440282f,
+  0.996443051350042630f, -0.084268887593324307f,
+  0.996571145790554835f, -0.082740264549375761f,
+  0.996696895202896060f, -0.081211446809592344f,
+  0.996820299291165668f, -0.079682437971430750f,
+  0.996941357764982050f, -0.078153241632794718f,
+  0.997060070339482962f, -0.076623861392031811f,
+  0.997176436735326077f, -0.075094300847921472f,
+  0.997290456678690207f, -0.073564563599667412f,
+  0.997402129901275303f, -0.072034653246889152f,
+  0.997511456140303454f, -0.070504573389614425f,
+  0.997618435138519555f, -0.068974327628267135f,
+  0.997723066644191636f, -0.067443919563664287f,
+  0.997825350411111645f, -0.065913352797003888f,
+  0.997925286198595995f, -0.064382630929857368f,
+  0.998022873771486130f, -0.062851757564162059f,
+  0.998118112900149179f, -0.061320736302209057f,
+  0.998211003360478188f, -0.059789570746640187f,
+  0.998301544933892782f, -0.058258264500435912f,
+  0.998389737407340161f, -0.056726821166907741f,
+  0.998475580573294774f, -0.055195244349689775f,
+  0.998559074229759314f, -0.053663537652731082f,
+  0.998640218180265160f, -0.052131704680283719f,
+  0.998719012233872938f, -0.050599749036899518f,
+  0.998795456205172405f, -0.049067674327418091f,
+  0.998869549914283561f, -0.047535484156959219f,
+  0.998941293186856871f, -0.046003182130915268f,
+  0.999010685854073266f, -0.044470771854939146f,
+  0.999077727752645361f, -0.042938256934941139f,
+  0.999142418724816905f, -0.041405640977076899f,
+  0.999204758618363886f, -0.039872927587739811f,
+  0.999264747286594424f, -0.038340120373552534f,
+  0.999322384588349433f, -0.036807222941359394f,
+  0.999377670388002848f, -0.035274238898214350f,
+  0.999430604555461732f, -0.033741171851377823f,
+  0.999481186966166946f, -0.032208025408304662f,
+  0.999529417501093143f, -0.030674803176636543f,
+  0.999575296046749218f, -0.029141508764194368f,
+  0.999618822495178638f, -0.027608145778966225f,
+  0.999659996743959223f, -0.026074717829104220f,
+  0.999698818696204250f, -0.024541228522912448f,
+  0.999735288260561683f, -0.023007681468839372f,
+  0.999769405351215279f, -0.021474080275469345f,
+  0.999801169887884256f, -0.019940428551515003f,
+  0.999830581795823403f, -0.018406729905805226f,
+  0.999857641005823861f, -0.016872987947281957f,
+  0.999882347454212561f, -0.015339206284988182f,
+  0.999904701082852898f, -0.013805388528060311f,
+  0.999924701839144503f, -0.012271538285720572f,
+  0.999942349676023912f, -0.010737659167264976f,
+  0.999957644551963898f, -0.009203754782060144f,
+  0.999970586430974140f, -0.007669828739531261f,
+  0.999981175282601109f, -0.006135884649154477f,
+  0.999989411081928403f, -0.004601926120448411f,
+  0.999995293809576191f, -0.003067956762966544f,
+  0.999998823451701879f, -0.001533980186285172f
+};
+
+#endif /* !defined (ARM_DSP_CONFIG_TABLES) */
+
 /**   
  * @} end of CFFT_CIFFT group   
  */
@@ -142,3 +4378,11 @@ const q31_t armRecipTableQ31[64] = {
   0x4521CCE1, 0x448DB244, 0x43FC0CFA, 0x436CCD78, 0x42DFE4B4, 0x42554426,
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
+
+/*   
+* @brief  Bits of 2/pi, after a zero word, for the reduction of large arguments   
+*/
+const uint32_t armTwoByPiTable[8] = {
+  0x00000000, 0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599,
+  0x3C439041, 0xFE5163AB
+};
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_db_f32.c
+*
+* Description:	Floating-point complex power in decibels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Power of a complex value in decibels.
+ * @param[in] re real part.
+ * @param[in] im imaginary part.
+ * @return 10 * log10(re^2 + im^2).
+ */
+
+static __INLINE float32_t arm_cmplx_mag_db_kernel_f32(
+  float32_t re,
+  float32_t im)
+{
+  float32_t u, y;                                /* mantissa - 1 and polynomial */
+  int32_t e;                                     /* exponent */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } w;                                           /* power and its bit pattern */
+
+  w.f = (re * re) + (im * im);
+
+  if(!(w.f > 0.0f))
+  {
+    /* -inf for zero power, and NaN for NaN input */
+    w.i = (w.f == 0.0f) ? (int32_t) 0xFF800000u : 0x7FC00000;
+    return (w.f);
+  }
+
+  if(w.i >= 0x7F800000)
+  {
+    /* +inf for infinite power */
+    return (w.f);
+  }
+
+  e = 0;
+
+  if(w.i < 0x00800000)
+  {
+    /* Normalize a subnormal power */
+    w.f = w.f * 8388608.0f;
+    e = -23;
+  }
+
+  /* power = m * 2^e with m in [1 2) */
+  e += (w.i >> 23) - 127;
+  w.i = (w.i & 0x007FFFFF) | 0x3F800000;
+
+  /* u = m - 1 with m in [sqrt(0.5) sqrt(2)) */
+  if(w.f > 1.414213562373095f)
+  {
+    u = (0.5f * w.f) - 1.0f;
+    e++;
+  }
+  else
+  {
+    u = w.f - 1.0f;
+  }
+
+  /* 10 * log10(1 + u) = u * (p0 + p1 * u + ... + p6 * u^6) */
+  y = 4.3505040176e-1f;
+  y = (y * u) - 7.9951200962e-1f;
+  y = (y * u) + 9.0933456776e-1f;
+  y = (y * u) - 1.0833155537e+0f;
+  y = (y * u) + 1.4454900795e+0f;
+  y = (y * u) - 2.1714830427e+0f;
+  y = (y * u) + 4.3429731349e+0f;
+
+  /* 10 * log10(power) = 10 * log10(1 + u) + e * 10 * log10(2) */
+  return ((y * u) + ((float32_t) e * 3.0102999566f));
+}
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_db Complex Magnitude in Decibels
+ *
+ * Computes the power of the elements of a complex data vector in decibels, as a
+ * log-magnitude spectrum is displayed:
+ * <pre>
+ * for(n=0; n<numSamples; n++) {
+ *     pDst[n] = 10 * log10(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+ * }
+ * </pre>
+ * which is also <code>20 * log10()</code> of the magnitude.  A full scale real or imaginary
+ * part is 0 dB.
+ *
+ * The logarithm is computed in the same pass as the sum of squares, without a square root
+ * and without a call to <code>log10f()</code>: the power is split into an exponent and a
+ * mantissa in [sqrt(0.5) sqrt(2)), and the logarithm of the mantissa is a minimax polynomial.
+ * The error of the polynomial is below <code>2e-6</code> dB for the floating-point and Q31 versions,
+ * and below <code>6e-4</code> dB for the Q15 version, within the resolution of their output formats.
+ *
+ * The input array has a total of <code>2*numSamples</code> values, interleaved as
+ * <code>{real, imag, real, imag, ...}</code>; the output array has a total of
+ * <code>numSamples</code> values.
+ * There are separate functions for floating-point, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup cmplx_mag_db
+ * @{
+ */
+
+/**
+ * @brief Floating-point complex power in decibels.
+ * @param[in]       *pSrc points to the complex input buffer
+ * @param[out]      *pDst points to the real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * Zero power gives <code>-inf</code>.
+ */
+
+void arm_cmplx_mag_db_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[0] = 10 * log10(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_db_kernel_f32(pSrc[0], pSrc[1]);
+    pDst[1] = arm_cmplx_mag_db_kernel_f32(pSrc[2], pSrc[3]);
+    pDst[2] = arm_cmplx_mag_db_kernel_f32(pSrc[4], pSrc[5]);
+    pDst[3] = arm_cmplx_mag_db_kernel_f32(pSrc[6], pSrc[7]);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C[0] = 10 * log10(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_db_kernel_f32(pSrc[0], pSrc[1]);
+    pSrc += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_db group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_db_q15.c
+*
+* Description:	Q15 complex power in decibels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Power of a complex value in decibels.
+ * @param[in] re real part in 1.15 format.
+ * @param[in] im imaginary part in 1.15 format.
+ * @return 10 * log10(re^2 + im^2) in 8.8 format.
+ */
+
+static __INLINE q15_t arm_cmplx_mag_db_kernel_q15(
+  q15_t re,
+  q15_t im)
+{
+  uint32_t pow, m;                               /* power in 2.30 format, normalized power */
+  int32_t e;                                     /* exponent */
+  q31_t u, p, r;                                 /* m - 1, polynomial and result */
+
+  pow = (uint32_t) (re * re) + (uint32_t) (im * im);
+
+  if(pow == 0u)
+  {
+    /* Most negative value for zero power */
+    return ((q15_t) 0x8000);
+  }
+
+  /* power = (m / 2^31) * 2^e with m / 2^31 in [1 2) */
+  e = (int32_t) __CLZ(pow);
+  m = pow << e;
+  e = 1 - e;
+
+  /* u = m / 2^31 - 1 in [sqrt(0.5) - 1, sqrt(2) - 1), in 1.15 format */
+  if(m > 0xB504F333u)
+  {
+    u = (q31_t) ((m >> 1) - 0x80000000u) >> 16;
+    e++;
+  }
+  else
+  {
+    u = (q31_t) (m - 0x80000000u) >> 16;
+  }
+
+  /* 10 * log10(1 + u) = u * (p0 + p1 * u + p2 * u^2 + p3 * u^3), coefficients in 16.15 format */
+  p = -0x9641;
+  p = 0xCFED + ((p * u) >> 15);
+  p = -0x115CE + ((p * u) >> 15);
+  p = 0x22B08 + ((p * u) >> 15);
+  r = (p * u) >> 15;
+
+  /* 10 * log10(power) = 10 * log10(1 + u) + e * 10 * log10(2), in 16.15 format */
+  r += e * 0x18152;
+
+  /* 16.15 to 8.8 format with rounding */
+  return ((q15_t) ((r + 64) >> 7));
+}
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_db
+ * @{
+ */
+
+/**
+ * @brief Q15 complex power in decibels.
+ * @param[in]       *pSrc points to the complex input buffer
+ * @param[out]      *pDst points to the real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.15 format and the output in 8.8 format, in dB.  The output ranges
+ * from -90.31 dB for the smallest nonzero power to +3.01 dB, and zero power gives the
+ * most negative value, <code>0x8000</code> (-128 dB).
+ */
+
+void arm_cmplx_mag_db_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[0] = 10 * log10(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_db_kernel_q15(pSrc[0], pSrc[1]);
+    pDst[1] = arm_cmplx_mag_db_kernel_q15(pSrc[2], pSrc[3]);
+    pDst[2] = arm_cmplx_mag_db_kernel_q15(pSrc[4], pSrc[5]);
+    pDst[3] = arm_cmplx_mag_db_kernel_q15(pSrc[6], pSrc[7]);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C[0] = 10 * log10(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_db_kernel_q15(pSrc[0], pSrc[1]);
+    pSrc += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_db group
+ */
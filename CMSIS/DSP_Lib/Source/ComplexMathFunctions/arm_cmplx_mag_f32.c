@@ -54,6 +54,17 @@
  * </pre>   
  *   
  * There are separate functions for floating-point, Q15, and Q31 data types.   
+ *
+ * arm_cmplx_mag_fast_f32(), arm_cmplx_mag_fast_q31() and arm_cmplx_mag_fast_q15() compute
+ * an approximate magnitude without a square root, for detectors and displays that do not
+ * need an exact one.  They use the alpha max plus beta min approximation with two sets of
+ * coefficients:
+ * <pre>
+ *     max = max(|real|, |imag|), min = min(|real|, |imag|)
+ *     mag = max(0.99030 * max + 0.19698 * min, 0.83954 * max + 0.56096 * min)
+ * </pre>
+ * whose relative error is below 0.97%.  The fast versions use the same output formats
+ * as the exact ones.
  */
 
 /**   
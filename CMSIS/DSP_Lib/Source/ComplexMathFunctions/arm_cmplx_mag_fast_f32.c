@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_f32.c
+*
+* Description:	Floating-point fast approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Approximate magnitude of a complex value.
+ * @param[in] re real part.
+ * @param[in] im imaginary part.
+ * @return approximate magnitude.
+ */
+
+static __INLINE float32_t arm_cmplx_mag_fast_kernel_f32(
+  float32_t re,
+  float32_t im)
+{
+  float32_t mx, mn, z0, z1;                      /* larger and smaller part, estimates */
+
+  re = (re < 0.0f) ? -re : re;
+  im = (im < 0.0f) ? -im : im;
+  mx = (re > im) ? re : im;
+  mn = (re > im) ? im : re;
+
+  /* Alpha max plus beta min, with two sets of coefficients */
+  z0 = (0.9902996814f * mx) + (0.1969807050f * mn);
+  z1 = (0.8395353105f * mx) + (0.5609596142f * mn);
+
+  return ((z0 > z1) ? z0 : z1);
+}
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief Floating-point fast approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input buffer
+ * @param[out]      *pDst points to the real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ */
+
+void arm_cmplx_mag_fast_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_fast_kernel_f32(pSrc[0], pSrc[1]);
+    pDst[1] = arm_cmplx_mag_fast_kernel_f32(pSrc[2], pSrc[3]);
+    pDst[2] = arm_cmplx_mag_fast_kernel_f32(pSrc[4], pSrc[5]);
+    pDst[3] = arm_cmplx_mag_fast_kernel_f32(pSrc[6], pSrc[7]);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_fast_kernel_f32(pSrc[0], pSrc[1]);
+    pSrc += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
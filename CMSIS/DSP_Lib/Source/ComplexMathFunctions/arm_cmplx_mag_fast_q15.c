@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_q15.c
+*
+* Description:	Q15 fast approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Approximate magnitude of a complex value.
+ * @param[in] re real part in 1.15 format.
+ * @param[in] im imaginary part in 1.15 format.
+ * @return approximate magnitude in 2.14 format.
+ */
+
+static __INLINE q15_t arm_cmplx_mag_fast_kernel_q15(
+  q15_t re,
+  q15_t im)
+{
+  uint32_t a, b, mx, mn;                         /* absolute values, larger and smaller part */
+  uint32_t z0, z1;                               /* estimates in 1.31 format */
+
+  a = (uint32_t) ((re < 0) ? -re : re);
+  b = (uint32_t) ((im < 0) ? -im : im);
+  mx = (a > b) ? a : b;
+  mn = (a > b) ? b : a;
+
+  /* Alpha max plus beta min, with two sets of coefficients in 0.16 format */
+  z0 = (mx * 0xFD84u) + (mn * 0x326Du);
+  z1 = (mx * 0xD6ECu) + (mn * 0x8F9Bu);
+
+  /* 1.31 to 2.14 format */
+  return ((q15_t) (((z0 > z1) ? z0 : z1) >> 17));
+}
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief Q15 fast approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input buffer
+ * @param[out]      *pDst points to the real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.15 format and the output in 2.14 format, as for arm_cmplx_mag_q15().
+ */
+
+void arm_cmplx_mag_fast_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_fast_kernel_q15(pSrc[0], pSrc[1]);
+    pDst[1] = arm_cmplx_mag_fast_kernel_q15(pSrc[2], pSrc[3]);
+    pDst[2] = arm_cmplx_mag_fast_kernel_q15(pSrc[4], pSrc[5]);
+    pDst[3] = arm_cmplx_mag_fast_kernel_q15(pSrc[6], pSrc[7]);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_fast_kernel_q15(pSrc[0], pSrc[1]);
+    pSrc += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_q31.c
+*
+* Description:	Q31 fast approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Approximate magnitude of a complex value.
+ * @param[in] re real part in 1.31 format.
+ * @param[in] im imaginary part in 1.31 format.
+ * @return approximate magnitude in 2.30 format.
+ */
+
+static __INLINE q31_t arm_cmplx_mag_fast_kernel_q31(
+  q31_t re,
+  q31_t im)
+{
+  uint32_t a, b, mx, mn;                         /* absolute values, larger and smaller part */
+  uint64_t z0, z1;                               /* estimates in 1.63 format */
+
+  a = (uint32_t) ((re < 0) ? -(int64_t) re : re);
+  b = (uint32_t) ((im < 0) ? -(int64_t) im : im);
+  mx = (a > b) ? a : b;
+  mn = (a > b) ? b : a;
+
+  /* Alpha max plus beta min, with two sets of coefficients in 0.32 format */
+  z0 = ((uint64_t) mx * 0xFD8447A9u) + ((uint64_t) mn * 0x326D53D6u);
+  z1 = ((uint64_t) mx * 0xD6EBC93Eu) + ((uint64_t) mn * 0x8F9B0C9Du);
+
+  /* 1.63 to 2.30 format */
+  return ((q31_t) (((z0 > z1) ? z0 : z1) >> 33));
+}
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief Q31 fast approximate complex magnitude.
+ * @param[in]       *pSrc points to the complex input buffer
+ * @param[out]      *pDst points to the real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.31 format and the output in 2.30 format, as for arm_cmplx_mag_q31().
+ */
+
+void arm_cmplx_mag_fast_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    pDst[0] = arm_cmplx_mag_fast_kernel_q31(pSrc[0], pSrc[1]);
+    pDst[1] = arm_cmplx_mag_fast_kernel_q31(pSrc[2], pSrc[3]);
+    pDst[2] = arm_cmplx_mag_fast_kernel_q31(pSrc[4], pSrc[5]);
+    pDst[3] = arm_cmplx_mag_fast_kernel_q31(pSrc[6], pSrc[7]);
+
+    pSrc += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C[0] ~= sqrt(A[0] * A[0] + A[1] * A[1]) */
+    *pDst++ = arm_cmplx_mag_fast_kernel_q31(pSrc[0], pSrc[1]);
+    pSrc += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -49,6 +49,7 @@
  * <b>Scaling and Overflow Behavior:</b>   
  * \par   
  * The function implements 1.15 by 1.15 multiplications and finally output is converted into 2.14 format.   
+ * The square roots are computed as a block with arm_vsqrt_q15(), and are truncated.
  */
 
 void arm_cmplx_mag_q15(
@@ -58,6 +59,7 @@ void arm_cmplx_mag_q15(
 {
   q15_t real, imag;                              /* Temporary variables to hold input values */
   q31_t acc0, acc1;                              /* Accumulators */
+  q15_t *pOut = pDst;                            /* Output pointer, for the square roots */
 
 #ifndef ARM_MATH_CM0
 
@@ -78,29 +80,29 @@ void arm_cmplx_mag_q15(
     imag = *pSrc++;
     acc0 = __SMUAD(real, real);
     acc1 = __SMUAD(imag, imag);
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = __SMUAD(real, real);
     acc1 = __SMUAD(imag, imag);
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = __SMUAD(real, real);
     acc1 = __SMUAD(imag, imag);
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = __SMUAD(real, real);
     acc1 = __SMUAD(imag, imag);
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -117,8 +119,8 @@ void arm_cmplx_mag_q15(
     imag = *pSrc++;
     acc0 = __SMUAD(real, real);
     acc1 = __SMUAD(imag, imag);
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -137,8 +139,8 @@ void arm_cmplx_mag_q15(
     acc0 = (real * real);
     acc1 = (imag * imag);
 
-    /* store the result in 2.14 format in the destination buffer. */
-    arm_sqrt_q15((q15_t) (((q63_t) acc0 + acc1) >> 17), pDst++);
+    /* store the sum of squares in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) (((q63_t) acc0 + acc1) >> 17);
 
     /* Decrement the loop counter */
     numSamples--;
@@ -146,6 +148,9 @@ void arm_cmplx_mag_q15(
 
 #endif /* #ifndef ARM_MATH_CM0 */
 
+  /* Square roots of the sums of squares, computed in place as a block */
+  arm_vsqrt_q15(pOut, pOut, (uint32_t) (pDst - pOut));
+
 }
 
 /**   
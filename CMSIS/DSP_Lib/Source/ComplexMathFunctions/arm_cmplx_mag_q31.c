@@ -49,6 +49,7 @@
  * \par   
  * The function implements 1.31 by 1.31 multiplications and finally output is converted into 2.30 format.   
  * Input down scaling is not required.   
+ * The square roots are computed as a block with arm_vsqrt_q31(), and are truncated.
  */
 
 void arm_cmplx_mag_q31(
@@ -58,6 +59,7 @@ void arm_cmplx_mag_q31(
 {
   q31_t real, imag;                              /* Temporary variables to hold input values */
   q31_t acc0, acc1;                              /* Accumulators */
+  q31_t *pOut = pDst;                            /* Output pointer, for the square roots */
 
 #ifndef ARM_MATH_CM0
 
@@ -78,29 +80,29 @@ void arm_cmplx_mag_q31(
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     real = *pSrc++;
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -117,8 +119,8 @@ void arm_cmplx_mag_q31(
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -135,8 +137,8 @@ void arm_cmplx_mag_q31(
     imag = *pSrc++;
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
-    /* store the result in 2.30 format in the destination buffer. */
-    arm_sqrt_q31(acc0 + acc1, pDst++);
+    /* store the sum of squares in 3.29 format in the destination buffer. */
+    *pDst++ = acc0 + acc1;
 
     /* Decrement the loop counter */
     numSamples--;
@@ -144,6 +146,9 @@ void arm_cmplx_mag_q31(
 
 #endif /* #ifndef ARM_MATH_CM0 */
 
+  /* Square roots of the sums of squares, computed in place as a block */
+  arm_vsqrt_q31(pOut, pOut, (uint32_t) (pDst - pOut));
+
 }
 
 /**   
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_f32.c
+*
+* Description:	Floating-point numerically controlled oscillator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup NCO Numerically Controlled Oscillator
+ *
+ * Generates blocks of the complex exponential <code>exp(j * theta[n])</code>, and mixes
+ * real signals with it, for frequency synthesis and digital down-conversion.
+ *
+ * The oscillator keeps a 32-bit phase accumulator, in which a full turn is <code>2^32</code>,
+ * and adds a constant phase increment to it for every sample:
+ * <pre>
+ *     theta[n + 1] = theta[n] + phaseInc    (modulo 2^32)
+ * </pre>
+ * The frequency resolution is <code>fs / 2^32</code>, and the phase wraps exactly, so the
+ * oscillator does not drift however long it runs.
+ *
+ * Instead of a range reduction and a table lookup per sample, as arm_sin_cos_f32() and
+ * arm_sin_cos_q31() do, the output is computed by recursive rotation: each sample is
+ * the previous one multiplied by <code>exp(j * 2 * pi * phaseInc / 2^32)</code>,
+ * which costs four multiplications and two additions.
+ * The rounding errors of the recursion accumulate, so the rotation is renormalised every
+ * <code>NCO_RESYNC_INTERVAL</code> samples, and at the start of every block, by restarting
+ * it from the sine and cosine of the phase accumulator computed with arm_vsin_cos_q31().
+ * Between two restarts the error grows at most linearly, mostly from the rounding of the
+ * rotation of one sample.  The fixed-point rotation saturates, so that a phasor rounded
+ * beyond +1 or -1 does not wrap around.  Over a sweep of the whole frequency range, the
+ * error stays below <code>2e-6</code> for the floating-point version, below
+ * <code>2^-24</code> (128 LSB) for the Q31 version, and within 1 LSB for the Q15 version,
+ * which rotates in Q31 internally.
+ *
+ * The complex outputs are interleaved as <code>{real, imag, real, imag, ...}</code>,
+ * with the real part the cosine and the imaginary part the sine of the phase.
+ * arm_nco_mix_f32(), arm_nco_mix_q31() and arm_nco_mix_q15() multiply a real input with the
+ * oscillator output, as arm_cmplx_mult_real_f32() would, without storing the oscillator
+ * output in a buffer.  For a down-conversion, set a negative frequency.
+ *
+ * \par Instance Structure
+ * The phase accumulator and the rotation of one sample are stored in an instance data
+ * structure.  A separate instance structure must be defined for each oscillator, and
+ * initialized with arm_nco_init_f32(), arm_nco_init_q31() or arm_nco_init_q15().
+ * arm_nco_set_frequency_f32(), arm_nco_set_frequency_q31() and arm_nco_set_frequency_q15()
+ * retune an oscillator without a phase discontinuity.
+ *
+ * \par Frequency and Phase Formats
+ * The floating-point frequency is a fraction of the sample rate and the floating-point phase
+ * a fraction of a turn.  For the fixed-point versions, the frequency in [-1 +1) maps to
+ * <code>[-fs/2 +fs/2)</code> and the phase in [-1 +1) to [-180 180) degrees, as for
+ * arm_sin_cos_q31().
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief Floating-point numerically controlled oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point NCO structure.
+ * @param[out]      *pDst points to the complex output buffer of <code>2*blockSize</code> values.
+ * @param[in]       blockSize number of complex samples to generate.
+ * @return none.
+ */
+
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t re, im, temp;                        /* current sample of the oscillator */
+  float32_t stepCos = S->stepCos;                /* cosine of the phase increment */
+  float32_t stepSin = S->stepSin;                /* sine of the phase increment */
+  q31_t phase, sinVal, cosVal;                   /* phase accumulator, its sine and cosine */
+  uint32_t numSamples, blkCnt;                   /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Number of samples up to the next renormalisation */
+    numSamples = (blockSize < NCO_RESYNC_INTERVAL) ? blockSize : NCO_RESYNC_INTERVAL;
+    blockSize -= numSamples;
+
+    /* Restart the rotation from the phase accumulator */
+    phase = (q31_t) S->phase;
+    arm_vsin_cos_q31(&phase, &sinVal, &cosVal, 1u);
+    re = (float32_t) cosVal * 4.656612873077393e-10f;
+    im = (float32_t) sinVal * 4.656612873077393e-10f;
+
+    S->phase += numSamples * S->phaseInc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numSamples >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = cos(theta[n]), C[2 * n + 1] = sin(theta[n]) */
+      *pDst++ = re;
+      *pDst++ = im;
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      *pDst++ = re;
+      *pDst++ = im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      *pDst++ = re;
+      *pDst++ = im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      *pDst++ = re;
+      *pDst++ = im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = numSamples % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = cos(theta[n]), C[2 * n + 1] = sin(theta[n]) */
+      *pDst++ = re;
+      *pDst++ = im;
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of NCO group
+ */
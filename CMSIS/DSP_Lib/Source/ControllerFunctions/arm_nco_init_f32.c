@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_init_f32.c
+*
+* Description:	Floating-point NCO initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point NCO.
+ * @param[out]    *S points to an instance of the floating-point NCO structure.
+ * @param[in]     frequency frequency as a fraction of the sample rate.
+ * @param[in]     phase initial phase as a fraction of a turn.
+ * @return        none.
+ *
+ * The function sets the phase accumulator, and computes the phase increment and the
+ * rotation of one sample with arm_nco_set_frequency_f32().
+ */
+
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency,
+  float32_t phase)
+{
+  float32_t x;                                   /* phase in turns, scaled by 2^32 */
+
+  /* Fraction of a turn, wrapped to [-0.5 +0.5), to 0.32 format */
+  x = (phase - floorf(phase + 0.5f)) * 4294967296.0f;
+
+  if(x >= 2147483648.0f)
+  {
+    x -= 4294967296.0f;
+  }
+
+  S->phase = (uint32_t) (q31_t) x;
+
+  arm_nco_set_frequency_f32(S, frequency);
+}
+
+/**
+ * @} end of NCO group
+ */
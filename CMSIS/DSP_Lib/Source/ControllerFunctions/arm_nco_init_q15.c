@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_init_q15.c
+*
+* Description:	Q15 NCO initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 NCO.
+ * @param[out]    *S points to an instance of the Q15 NCO structure.
+ * @param[in]     frequency frequency in [-1 +1), mapping to <code>[-fs/2 +fs/2)</code>.
+ * @param[in]     phase initial phase in [-1 +1), mapping to [-180 180) degrees.
+ * @return        none.
+ *
+ * The function sets the phase accumulator, and computes the phase increment and the
+ * rotation of one sample with arm_nco_set_frequency_q15().
+ */
+
+void arm_nco_init_q15(
+  arm_nco_instance_q15 * S,
+  q15_t frequency,
+  q15_t phase)
+{
+  /* [-1 +1) maps to [-0.5 +0.5) turn, in 0.32 format */
+  S->phase = (uint32_t) phase << 16;
+
+  arm_nco_set_frequency_q15(S, frequency);
+}
+
+/**
+ * @} end of NCO group
+ */
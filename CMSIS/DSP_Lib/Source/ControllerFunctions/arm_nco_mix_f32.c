@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_mix_f32.c
+*
+* Description:	Floating-point NCO mixer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief Floating-point mixing of a real signal with a numerically controlled oscillator.
+ * @param[in,out]   *S points to an instance of the floating-point NCO structure.
+ * @param[in]       *pSrc points to the real input buffer.
+ * @param[out]      *pDst points to the complex output buffer of <code>2*blockSize</code> values.
+ * @param[in]       blockSize number of input samples.
+ * @return none.
+ *
+ * The output is <code>pSrc[n] * exp(j * theta[n])</code>, the same as multiplying
+ * the input with the output of arm_nco_f32() using arm_cmplx_mult_real_f32().
+ */
+
+void arm_nco_mix_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in;                                  /* input sample */
+  float32_t re, im, temp;                        /* current sample of the oscillator */
+  float32_t stepCos = S->stepCos;                /* cosine of the phase increment */
+  float32_t stepSin = S->stepSin;                /* sine of the phase increment */
+  q31_t phase, sinVal, cosVal;                   /* phase accumulator, its sine and cosine */
+  uint32_t numSamples, blkCnt;                   /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Number of samples up to the next renormalisation */
+    numSamples = (blockSize < NCO_RESYNC_INTERVAL) ? blockSize : NCO_RESYNC_INTERVAL;
+    blockSize -= numSamples;
+
+    /* Restart the rotation from the phase accumulator */
+    phase = (q31_t) S->phase;
+    arm_vsin_cos_q31(&phase, &sinVal, &cosVal, 1u);
+    re = (float32_t) cosVal * 4.656612873077393e-10f;
+    im = (float32_t) sinVal * 4.656612873077393e-10f;
+
+    S->phase += numSamples * S->phaseInc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numSamples >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = A[n] * cos(theta[n]), C[2 * n + 1] = A[n] * sin(theta[n]) */
+      in = *pSrc++;
+      *pDst++ = in * re;
+      *pDst++ = in * im;
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = in * re;
+      *pDst++ = in * im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = in * re;
+      *pDst++ = in * im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = in * re;
+      *pDst++ = in * im;
+
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = numSamples % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = A[n] * cos(theta[n]), C[2 * n + 1] = A[n] * sin(theta[n]) */
+      in = *pSrc++;
+      *pDst++ = in * re;
+      *pDst++ = in * im;
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = (re * stepCos) - (im * stepSin);
+      im = (re * stepSin) + (im * stepCos);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of NCO group
+ */
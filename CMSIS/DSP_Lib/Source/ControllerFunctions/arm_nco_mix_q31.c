@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_mix_q31.c
+*
+* Description:	Q31 NCO mixer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief Q31 mixing of a real signal with a numerically controlled oscillator.
+ * @param[in,out]   *S points to an instance of the Q31 NCO structure.
+ * @param[in]       *pSrc points to the real input buffer.
+ * @param[out]      *pDst points to the complex output buffer of <code>2*blockSize</code> values.
+ * @param[in]       blockSize number of input samples.
+ * @return none.
+ *
+ * The output is <code>pSrc[n] * exp(j * theta[n])</code>, the same as multiplying
+ * the input with the output of arm_nco_q31() using arm_cmplx_mult_real_q31().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input and the output are in 1.31 format.  Results outside of the allowable
+ * Q31 range [0x80000000 0x7FFFFFFF] are saturated.
+ */
+
+void arm_nco_mix_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in;                                      /* input sample */
+  q31_t re, im, temp;                            /* current sample of the oscillator */
+  q31_t stepCos = S->stepCos;                    /* cosine of the phase increment */
+  q31_t stepSin = S->stepSin;                    /* sine of the phase increment */
+  q31_t phase, sinVal, cosVal;                   /* phase accumulator, its sine and cosine */
+  uint32_t numSamples, blkCnt;                   /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Number of samples up to the next renormalisation */
+    numSamples = (blockSize < NCO_RESYNC_INTERVAL) ? blockSize : NCO_RESYNC_INTERVAL;
+    blockSize -= numSamples;
+
+    /* Restart the rotation from the phase accumulator */
+    phase = (q31_t) S->phase;
+    arm_vsin_cos_q31(&phase, &sinVal, &cosVal, 1u);
+    re = cosVal;
+    im = sinVal;
+
+    S->phase += numSamples * S->phaseInc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numSamples >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = A[n] * cos(theta[n]), C[2 * n + 1] = A[n] * sin(theta[n]) */
+      in = *pSrc++;
+      *pDst++ = clip_q63_to_q31(((q63_t) in * re) >> 31);
+      *pDst++ = clip_q63_to_q31(((q63_t) in * im) >> 31);
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = clip_q63_to_q31((((q63_t) re * stepCos) - ((q63_t) im * stepSin)) >> 31);
+      im = clip_q63_to_q31((((q63_t) re * stepSin) + ((q63_t) im * stepCos)) >> 31);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = clip_q63_to_q31(((q63_t) in * re) >> 31);
+      *pDst++ = clip_q63_to_q31(((q63_t) in * im) >> 31);
+
+      temp = clip_q63_to_q31((((q63_t) re * stepCos) - ((q63_t) im * stepSin)) >> 31);
+      im = clip_q63_to_q31((((q63_t) re * stepSin) + ((q63_t) im * stepCos)) >> 31);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = clip_q63_to_q31(((q63_t) in * re) >> 31);
+      *pDst++ = clip_q63_to_q31(((q63_t) in * im) >> 31);
+
+      temp = clip_q63_to_q31((((q63_t) re * stepCos) - ((q63_t) im * stepSin)) >> 31);
+      im = clip_q63_to_q31((((q63_t) re * stepSin) + ((q63_t) im * stepCos)) >> 31);
+      re = temp;
+
+      in = *pSrc++;
+      *pDst++ = clip_q63_to_q31(((q63_t) in * re) >> 31);
+      *pDst++ = clip_q63_to_q31(((q63_t) in * im) >> 31);
+
+      temp = clip_q63_to_q31((((q63_t) re * stepCos) - ((q63_t) im * stepSin)) >> 31);
+      im = clip_q63_to_q31((((q63_t) re * stepSin) + ((q63_t) im * stepCos)) >> 31);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = numSamples % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+    while(blkCnt > 0u)
+    {
+      /* C[2 * n] = A[n] * cos(theta[n]), C[2 * n + 1] = A[n] * sin(theta[n]) */
+      in = *pSrc++;
+      *pDst++ = clip_q63_to_q31(((q63_t) in * re) >> 31);
+      *pDst++ = clip_q63_to_q31(((q63_t) in * im) >> 31);
+
+      /* exp(j * theta[n + 1]) = exp(j * theta[n]) * exp(j * phaseInc) */
+      temp = clip_q63_to_q31((((q63_t) re * stepCos) - ((q63_t) im * stepSin)) >> 31);
+      im = clip_q63_to_q31((((q63_t) re * stepSin) + ((q63_t) im * stepCos)) >> 31);
+      re = temp;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_set_frequency_f32.c
+*
+* Description:	Floating-point NCO frequency update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Sets the frequency of a floating-point NCO.
+ * @param[in,out] *S points to an instance of the floating-point NCO structure.
+ * @param[in]     frequency frequency as a fraction of the sample rate.
+ * @return        none.
+ *
+ * The phase accumulator is not changed, so the output stays continuous in phase.
+ * The frequency is wrapped to <code>[-0.5 +0.5)</code> and truncated to a multiple of
+ * <code>2^-32</code>.
+ */
+
+void arm_nco_set_frequency_f32(
+  arm_nco_instance_f32 * S,
+  float32_t frequency)
+{
+  q31_t phaseInc, sinVal, cosVal;                /* phase increment, its sine and cosine */
+  float32_t x;                                   /* phase increment in turns, scaled by 2^32 */
+
+  /* Fraction of a turn per sample, wrapped to [-0.5 +0.5), to 0.32 format */
+  x = (frequency - floorf(frequency + 0.5f)) * 4294967296.0f;
+
+  if(x >= 2147483648.0f)
+  {
+    x -= 4294967296.0f;
+  }
+
+  S->phaseInc = (uint32_t) (q31_t) x;
+
+  /* Rotation of one sample */
+  phaseInc = (q31_t) S->phaseInc;
+  arm_vsin_cos_q31(&phaseInc, &sinVal, &cosVal, 1u);
+  S->stepCos = (float32_t) cosVal * 4.656612873077393e-10f;
+  S->stepSin = (float32_t) sinVal * 4.656612873077393e-10f;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_set_frequency_q15.c
+*
+* Description:	Q15 NCO frequency update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Sets the frequency of a Q15 NCO.
+ * @param[in,out] *S points to an instance of the Q15 NCO structure.
+ * @param[in]     frequency frequency in [-1 +1), mapping to <code>[-fs/2 +fs/2)</code>.
+ * @return        none.
+ *
+ * The phase accumulator is not changed, so the output stays continuous in phase.
+ */
+
+void arm_nco_set_frequency_q15(
+  arm_nco_instance_q15 * S,
+  q15_t frequency)
+{
+  q31_t phaseInc, sinVal, cosVal;                /* phase increment, its sine and cosine */
+
+  /* [-1 +1) maps to [-0.5 +0.5) turn per sample, in 0.32 format */
+  S->phaseInc = (uint32_t) frequency << 16;
+
+  /* Rotation of one sample */
+  phaseInc = (q31_t) S->phaseInc;
+  arm_vsin_cos_q31(&phaseInc, &sinVal, &cosVal, 1u);
+
+  /* Keep -1 out of the rotation, so that its 64-bit sums cannot overflow */
+  S->stepCos = (cosVal < -0x7FFFFFFF) ? -0x7FFFFFFF : cosVal;
+  S->stepSin = (sinVal < -0x7FFFFFFF) ? -0x7FFFFFFF : sinVal;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vatan2_f32.c
+*
+* Description:	Floating-point vector four-quadrant arc tangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Four-quadrant arc tangent of floating-point values.
+ * @param[in] y ordinate.
+ * @param[in] x abscissa.
+ * @return atan2(y, x) in radians.
+ */
+
+static __INLINE float32_t arm_vatan2_kernel_f32(
+  float32_t y,
+  float32_t x)
+{
+  float32_t ax = fabsf(x), ay = fabsf(y);        /* absolute values of the inputs */
+  float32_t num, den;                            /* smaller and larger absolute value */
+  float32_t t, z, p, a;                          /* reduced ratio, its square, polynomial and result */
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } w;                                           /* ordinate and its bit pattern */
+
+  if(ay > ax)
+  {
+    num = ax;
+    den = ay;
+  }
+  else
+  {
+    num = ay;
+    den = ax;
+  }
+
+  if(den == 0.0f)
+  {
+    return (0.0f);
+  }
+
+  /* atan(num / den) = a + atan(t) with |t| <= tan(pi/8) */
+  if(num >= (0.414213562373095049f * den))
+  {
+    /* atan(num / den) = pi/4 + atan((num - den) / (num + den)), and exactly pi/4
+     * for equal inputs, infinite ones included.  Above 2^126, num + den could
+     * overflow: both are scaled down by 4, which is exact */
+    if(den > 8.50705917e+37f)
+    {
+      num *= 0.25f;
+      den *= 0.25f;
+    }
+
+    t = (num == den) ? 0.0f : ((num - den) / (num + den));
+    a = 0.785398163397448310f;
+  }
+  else
+  {
+    t = num / den;
+    a = 0.0f;
+  }
+
+  z = t * t;
+
+  p = 8.05374449538e-2f;
+  p = (p * z) - 1.38776856032e-1f;
+  p = (p * z) + 1.99777106478e-1f;
+  p = (p * z) - 3.33329491539e-1f;
+  a += (p * z * t) + t;
+
+  /* Unfold the octant */
+  if(ay > ax)
+  {
+    a = 1.57079632679489662f - a;
+  }
+
+  if(x < 0.0f)
+  {
+    a = 3.14159265358979324f - a;
+  }
+
+  /* The sign of the result is the sign bit of y, -0 included, as for atan2() */
+  w.f = y;
+
+  return (((w.i & 0x80000000u) != 0u) ? -a : a);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector four-quadrant arc tangent.
+ * @param[in]       *pSrcY points to the input buffer of the ordinates
+ * @param[in]       *pSrcX points to the input buffer of the abscissas
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_f32(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_f32(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_f32(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
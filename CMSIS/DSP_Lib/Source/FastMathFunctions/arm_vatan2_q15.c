@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vatan2_q15.c
+*
+* Description:	Q15 vector four-quadrant arc tangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Four-quadrant arc tangent of Q15 values.
+ * @param[in] y ordinate.
+ * @param[in] x abscissa.
+ * @return atan2(y, x) / pi in 1.15 format.
+ */
+
+static __INLINE q15_t arm_vatan2_kernel_q15(
+  q15_t y,
+  q15_t x)
+{
+  q31_t ax, ay;                                  /* absolute values of the inputs */
+  q31_t num, den;                                /* smaller and larger absolute value */
+  q31_t s, s2, p, a;                             /* reduced ratio, its square, polynomial and angle */
+
+  ax = (x < 0) ? -(q31_t) x : x;
+  ay = (y < 0) ? -(q31_t) y : y;
+
+  if(ay > ax)
+  {
+    num = ax;
+    den = ay;
+  }
+  else
+  {
+    num = ay;
+    den = ax;
+  }
+
+  if(den == 0)
+  {
+    return (0);
+  }
+
+  /* atan(num / den) = a + atan(s) with |s| <= tan(pi/8), angles in 15.16 format */
+  if((num << 15) > (den * 0x3505))
+  {
+    /* atan(num / den) = pi/4 + atan((num - den) / (num + den)) */
+    s = ((num - den) * 0x8000) / (num + den);
+    a = 0x4000;
+  }
+  else
+  {
+    s = (num << 15) / den;
+    a = 0;
+  }
+
+  s2 = (s * s) >> 15;
+
+  /* atan(s) / pi = s * (p0 + p1 * s^2 + p2 * s^4), coefficients in 15.16 format */
+  p = 0xE4C;
+  p = -0x1B19 + ((p * s2) >> 15);
+  p = 0x517D + ((p * s2) >> 15);
+  a += (p * s) >> 15;
+
+  /* Unfold the octant */
+  if(ay > ax)
+  {
+    a = 0x8000 - a;
+  }
+
+  if(x < 0)
+  {
+    a = 0x10000 - a;
+  }
+
+  if(y < 0)
+  {
+    a = -a;
+  }
+
+  /* 15.16 to 1.15 format with rounding, and saturation of +pi */
+  return ((q15_t) __SSAT((a + 1) >> 1, 16));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q15 vector four-quadrant arc tangent.
+ * @param[in]       *pSrcY points to the input buffer of the ordinates
+ * @param[in]       *pSrcX points to the input buffer of the abscissas
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The output is the angle divided by pi, in 1.15 format.
+ */
+
+void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_q15(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q15(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q15(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q15(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_q15(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vatan2_q31.c
+*
+* Description:	Q31 vector four-quadrant arc tangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Four-quadrant arc tangent of Q31 values.
+ * @param[in] y ordinate.
+ * @param[in] x abscissa.
+ * @return atan2(y, x) / pi in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vatan2_kernel_q31(
+  q31_t y,
+  q31_t x)
+{
+  uint32_t ax, ay;                               /* absolute values of the inputs */
+  uint32_t num, den;                             /* smaller and larger absolute value */
+  q31_t s, s2, p;                                /* reduced ratio, its square and polynomial */
+  q63_t a;                                       /* angle */
+
+  ax = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  ay = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+
+  if(ay > ax)
+  {
+    num = ax;
+    den = ay;
+  }
+  else
+  {
+    num = ay;
+    den = ax;
+  }
+
+  if(den == 0u)
+  {
+    return (0);
+  }
+
+  /* atan(num / den) = a + atan(s) with |s| <= tan(pi/8) */
+  if(((uint64_t) num << 31) > ((uint64_t) den * 0x3504F334u))
+  {
+    /* atan(num / den) = pi/4 + atan((num - den) / (num + den)) */
+    s = (q31_t) ((((q63_t) num - den) * 0x80000000LL) / ((q63_t) num + den));
+    a = 0x20000000;
+  }
+  else
+  {
+    s = (q31_t) (((q63_t) num << 31) / den);
+    a = 0;
+  }
+
+  s2 = (q31_t) (((q63_t) s * s) >> 31);
+
+  /* atan(s) / pi = s * (p0 + p1 * s^2 + ... + p6 * s^12), coefficients in 1.31 format */
+  p = 0x022A9BA8;
+  p = -0x038F01F1 + (q31_t) (((q63_t) p * s2) >> 31);
+  p = 0x04846297 + (q31_t) (((q63_t) p * s2) >> 31);
+  p = -0x05D1FAEC + (q31_t) (((q63_t) p * s2) >> 31);
+  p = 0x08261331 + (q31_t) (((q63_t) p * s2) >> 31);
+  p = -0x0D94CAF4 + (q31_t) (((q63_t) p * s2) >> 31);
+  p = 0x28BE60DC + (q31_t) (((q63_t) p * s2) >> 31);
+  a += ((q63_t) p * s) >> 31;
+
+  /* Unfold the octant */
+  if(ay > ax)
+  {
+    a = 0x40000000 - a;
+  }
+
+  if(x < 0)
+  {
+    a = 0x80000000LL - a;
+  }
+
+  if(y < 0)
+  {
+    a = -a;
+  }
+
+  /* +pi saturates */
+  return (clip_q63_to_q31(a));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector four-quadrant arc tangent.
+ * @param[in]       *pSrcY points to the input buffer of the ordinates
+ * @param[in]       *pSrcX points to the input buffer of the abscissas
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The output is the angle divided by pi, in 1.31 format.
+ */
+
+void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_q31(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q31(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q31(*pSrcY++, *pSrcX++);
+    *pDst++ = arm_vatan2_kernel_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(Y, X) */
+    *pDst++ = arm_vatan2_kernel_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vcos_f32.c
+*
+* Description:	Floating-point vector cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @brief Reduction of a large floating-point value by multiples of pi/2.
+ * @param[in]  x finite input value in radians, with |x| >= 8192.
+ * @param[out] *pR points to the remainder x - k * pi/2, in [-pi/4 pi/4].
+ * @return k modulo 4.
+ *
+ * x * 2/pi is computed modulo 4 in 2.62 format from the bits of 2/pi that can
+ * affect it, as in the Payne-Hanek reduction, so that the remainder keeps its
+ * accuracy however large x is.
+ */
+
+static __INLINE uint32_t arm_vsin_reduce_f32(
+  float32_t x,
+  float32_t * pR)
+{
+  const uint32_t *pTab;                          /* first word of 2/pi used */
+  uint64_t acc;                                  /* x * 2/pi modulo 4, in 2.62 format */
+  int64_t rem;                                   /* remainder, in 2.62 format */
+  uint32_t m, pos, shift, k;                     /* mantissa, bit position, shift, result */
+  uint32_t w0, w1, w2;                           /* 96 bits of 2/pi */
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } w;                                           /* input and its bit pattern */
+
+  w.f = x;
+
+  /* |x| = m * 2^(e - 150).  The bits of 2/pi of weight 2^(150 - e) and above
+   * only add multiples of 4 to x * 2/pi: start at the next one, which is
+   * bit (e - 120) of the table, whose first word is zero */
+  m = (w.i & 0x007FFFFFu) | 0x00800000u;
+  pos = ((w.i >> 23) & 0xFFu) - 120u;
+  pTab = &armTwoByPiTable[pos >> 5];
+  shift = 32u - (pos & 31u);
+
+  w0 = (uint32_t) ((((uint64_t) pTab[0] << 32) | pTab[1]) >> shift);
+  w1 = (uint32_t) ((((uint64_t) pTab[1] << 32) | pTab[2]) >> shift);
+  w2 = (uint32_t) ((((uint64_t) pTab[2] << 32) | pTab[3]) >> shift);
+
+  /* Top 64 bits of m * (w0:w1:w2) modulo 2^96 */
+  acc = ((uint64_t) (m * w0) << 32) + ((uint64_t) m * w1) + (((uint64_t) m * w2) >> 32);
+
+  /* k = round(x * 2/pi) modulo 4, and r = (x * 2/pi - k) * pi/2 */
+  k = (uint32_t) ((acc + ((uint64_t) 1u << 61)) >> 62);
+  rem = (int64_t) (acc - ((uint64_t) k << 62));
+  *pR = (float32_t) rem * 3.40612158008655459e-19f;
+
+  if((w.i & 0x80000000u) != 0u)
+  {
+    /* sin(-x) = -sin(x) */
+    *pR = -*pR;
+    k = 0u - k;
+  }
+
+  return (k);
+}
+
+/**
+ * @brief Sine of a floating-point value, shifted by a number of quarter turns.
+ * @param[in] x input value in radians.
+ * @param[in] quadrant number of quarter turns added to x: 0 for the sine, 1 for the cosine.
+ * @return sin(x + quadrant * pi/2).
+ */
+
+static __INLINE float32_t arm_vsin_kernel_f32(
+  float32_t x,
+  uint32_t quadrant)
+{
+  float32_t r, z, y;                             /* reduced input, its square and result */
+  int32_t k;                                     /* nearest multiple of pi/2 */
+
+  if(fabsf(x) < 8192.0f)
+  {
+    /* k = round(x * 2/pi) */
+    y = x * 0.636619772367581343f;
+    k = (int32_t) ((y >= 0.0f) ? (y + 0.5f) : (y - 0.5f));
+
+    /* r = x - k * pi/2 in [-pi/4 pi/4], with pi/2 split in three parts so that
+     * the first two products are exact */
+    y = (float32_t) k;
+    r = ((x - (y * 1.5703125f)) - (y * 4.837512969970703125e-4f)) -
+      (y * 7.54978995489188216e-8f);
+  }
+  else if(fabsf(x) <= 3.40282347e+38f)
+  {
+    k = (int32_t) arm_vsin_reduce_f32(x, &r);
+  }
+  else
+  {
+    /* NaN for an infinite or NaN input */
+    return (x - x);
+  }
+
+  z = r * r;
+
+  quadrant += (uint32_t) k;
+
+  if((quadrant & 1u) == 0u)
+  {
+    /* sin(r) */
+    y = -1.9515295891e-4f;
+    y = (y * z) + 8.3321608736e-3f;
+    y = (y * z) - 1.6666654611e-1f;
+    y = (y * z * r) + r;
+  }
+  else
+  {
+    /* cos(r) */
+    y = 2.443315711809948e-5f;
+    y = (y * z) - 1.388731625493765e-3f;
+    y = (y * z) + 4.166664568298827e-2f;
+    y = (y * z * z) - (0.5f * z) + 1.0f;
+  }
+
+  return (((quadrant & 2u) != 0u) ? -y : y);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector cosine.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_f32(*pSrc++, 1u);
+    *pDst++ = arm_vsin_kernel_f32(*pSrc++, 1u);
+    *pDst++ = arm_vsin_kernel_f32(*pSrc++, 1u);
+    *pDst++ = arm_vsin_kernel_f32(*pSrc++, 1u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_f32(*pSrc++, 1u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vcos_q15.c
+*
+* Description:	Q15 vector cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Sine of a phase.
+ * @param[in] phase phase as a fraction of a turn in 0.16 format.
+ * @return sine in 1.15 format.
+ */
+
+static __INLINE q15_t arm_vsin_kernel_q15(
+  uint32_t phase)
+{
+  q31_t w, w2, y;                                /* offset, its square and result */
+  uint32_t quadrant;                             /* nearest quarter turn */
+
+  /* Nearest quarter turn, and offset w from it in quarter turns, in [-0.5 0.5) */
+  phase = (phase + 0x2000u) & 0xFFFFu;
+  quadrant = phase >> 14;
+  w = ((q31_t) (phase & 0x3FFFu) - 0x2000) << 1;
+  w2 = (w * w) >> 15;
+
+  if((quadrant & 1u) == 0u)
+  {
+    /* sin(pi/2 * w) = w * (s0 + s1 * w^2 + s2 * w^4), coefficients in 15.16 format */
+    y = 0x1411;
+    y = -0xA55A + ((y * w2) >> 15);
+    y = 0x19220 + ((y * w2) >> 15);
+    y = (y * w) >> 15;
+  }
+  else
+  {
+    /* cos(pi/2 * w) = c0 + c1 * w^2 + c2 * w^4 + c3 * w^6, coefficients in 15.16 format */
+    y = -0x541;
+    y = 0x40EE + ((y * w2) >> 15);
+    y = -0x13BD4 + ((y * w2) >> 15);
+    y = 0x10000 + ((y * w2) >> 15);
+  }
+
+  /* 15.16 to 1.15 format with rounding, and saturation of +1 */
+  y = __SSAT((y + 1) >> 1, 16);
+
+  return ((q15_t) (((quadrant & 2u) != 0u) ? -y : y));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q15 vector cosine.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input in [0 +1) maps to [0 2*pi), and the output is in 1.15 format.
+ */
+
+void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_q15(((uint32_t) * pSrc++ << 1) + 0x4000u);
+    *pDst++ = arm_vsin_kernel_q15(((uint32_t) * pSrc++ << 1) + 0x4000u);
+    *pDst++ = arm_vsin_kernel_q15(((uint32_t) * pSrc++ << 1) + 0x4000u);
+    *pDst++ = arm_vsin_kernel_q15(((uint32_t) * pSrc++ << 1) + 0x4000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_q15(((uint32_t) * pSrc++ << 1) + 0x4000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
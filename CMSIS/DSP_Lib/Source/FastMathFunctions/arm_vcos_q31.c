@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vcos_q31.c
+*
+* Description:	Q31 vector cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Sine of a phase.
+ * @param[in] phase phase as a fraction of a turn in 0.32 format.
+ * @return sine in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vsin_kernel_q31(
+  uint32_t phase)
+{
+  q31_t w, w2, y;                                /* offset, its square and result */
+  uint32_t quadrant;                             /* nearest quarter turn */
+
+  /* Nearest quarter turn, and offset w from it in quarter turns, in [-0.5 0.5) */
+  phase += 0x20000000u;
+  quadrant = phase >> 30;
+  w = (q31_t) ((phase & 0x3FFFFFFFu) - 0x20000000u) << 1;
+  w2 = (q31_t) (((q63_t) w * w) >> 31);
+
+  if((quadrant & 1u) == 0u)
+  {
+    /* sin(pi/2 * w) = w * (s0 + s1 * w^2 + ... + s4 * w^8), coefficients in 2.30 format */
+    y = 0x000299E6;
+    y = -0x004CB3B2 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = 0x0519AF0E + (q31_t) (((q63_t) y * w2) >> 31);
+    y = -0x295779CC + (q31_t) (((q63_t) y * w2) >> 31);
+    y = 0x6487ED51 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = (q31_t) (((q63_t) y * w) >> 31);
+  }
+  else
+  {
+    /* cos(pi/2 * w) = c0 + c1 * w^2 + ... + c5 * w^10, coefficients in 2.30 format */
+    y = -0x00006899;
+    y = 0x000F0F73 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = -0x0155D3C4 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = 0x103C1F08 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = -0x4EF4F327 + (q31_t) (((q63_t) y * w2) >> 31);
+    y = 0x40000000 + (q31_t) (((q63_t) y * w2) >> 31);
+  }
+
+  /* 2.30 to 1.31 format, with saturation of +1 */
+  y = clip_q63_to_q31((q63_t) y << 1);
+
+  return (((quadrant & 2u) != 0u) ? -y : y);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector cosine.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input in [0 +1) maps to [0 2*pi), and the output is in 1.31 format.
+ */
+
+void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_q31(((uint32_t) * pSrc++ << 1) + 0x40000000u);
+    *pDst++ = arm_vsin_kernel_q31(((uint32_t) * pSrc++ << 1) + 0x40000000u);
+    *pDst++ = arm_vsin_kernel_q31(((uint32_t) * pSrc++ << 1) + 0x40000000u);
+    *pDst++ = arm_vsin_kernel_q31(((uint32_t) * pSrc++ << 1) + 0x40000000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = cos(A) */
+    *pDst++ = arm_vsin_kernel_q31(((uint32_t) * pSrc++ << 1) + 0x40000000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
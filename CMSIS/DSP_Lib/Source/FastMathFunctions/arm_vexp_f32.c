@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vexp_f32.c
+*
+* Description:	Floating-point vector exponential.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Exponential of a floating-point value.
+ * @param[in] x input value.
+ * @return exp(x).
+ */
+
+static __INLINE float32_t arm_vexp_kernel_f32(
+  float32_t x)
+{
+  float32_t r, y;                                /* reduced input and result */
+  int32_t k;                                     /* nearest multiple of ln2 */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale1, scale2;                              /* powers of two of the result */
+
+  if(x > 88.72283905206835f)
+  {
+    /* Overflow: +inf */
+    scale1.i = 0x7F800000;
+    return (scale1.f);
+  }
+
+  if(x < -103.972077083991796f)
+  {
+    /* Underflow: 0 */
+    return (0.0f);
+  }
+
+  if(x != x)
+  {
+    /* NaN */
+    return (x);
+  }
+
+  /* k = round(x / ln2) */
+  y = x * 1.44269504088896341f;
+  k = (int32_t) ((y >= 0.0f) ? (y + 0.5f) : (y - 0.5f));
+
+  /* r = x - k * ln2 in [-ln2/2 ln2/2], with ln2 split in two parts */
+  y = (float32_t) k;
+  r = (x - (y * 0.693359375f)) + (y * 2.12194440e-4f);
+
+  /* exp(r) */
+  y = 1.9875691500e-4f;
+  y = (y * r) + 1.3981999507e-3f;
+  y = (y * r) + 8.3334519073e-3f;
+  y = (y * r) + 4.1665795894e-2f;
+  y = (y * r) + 1.6666665459e-1f;
+  y = (y * r) + 5.0000001201e-1f;
+  y = (y * (r * r)) + r + 1.0f;
+  /* exp(x) = exp(r) * 2^(k/2) * 2^(k - k/2): the two factors are normal numbers,
+   * and the result may be subnormal */
+  scale1.i = ((k >> 1) + 127) << 23;
+  scale2.i = ((k - (k >> 1)) + 127) << 23;
+
+  return ((y * scale1.f) * scale2.f);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector exponential.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_f32(*pSrc++);
+    *pDst++ = arm_vexp_kernel_f32(*pSrc++);
+    *pDst++ = arm_vexp_kernel_f32(*pSrc++);
+    *pDst++ = arm_vexp_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vexp_q15.c
+*
+* Description:	Q15 vector exponential.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Exponential of a Q4.11 value.
+ * @param[in] x input value in 4.11 format.
+ * @return exp(x) in 1.15 format.
+ */
+
+static __INLINE q15_t arm_vexp_kernel_q15(
+  q31_t x)
+{
+  q31_t y;                                       /* x / ln2 in 7.25 format */
+  q31_t f, p;                                    /* fractional part and 2^f */
+  int32_t k;                                     /* integer part */
+  uint32_t shift;                                /* right shift of the result */
+
+  if(x >= 0)
+  {
+    /* exp(x) >= 1 saturates */
+    return (0x7FFF);
+  }
+
+  /* x / ln2 = k + f with k an integer and f in [-0.5 0.5] */
+  y = x * 0x5C55;
+  k = (y + 0x1000000) >> 25;
+  f = (y - (k * 0x2000000)) >> 10;
+
+  /* 2^f = p0 + p1 * f + ... + p4 * f^4, coefficients in 15.16 format */
+  p = 0x279;
+  p = 0xE51 + ((p * f) >> 15);
+  p = 0x3D7F + ((p * f) >> 15);
+  p = 0xB170 + ((p * f) >> 15);
+  p = 0x10000 + ((p * f) >> 15);
+  /* exp(x) = 2^f * 2^k in 1.15 format, with k <= 0 */
+  shift = (uint32_t) (1 - k);
+
+  if(shift > 17u)
+  {
+    return (0);
+  }
+
+  return ((q15_t) __SSAT((p + (1 << (shift - 1u))) >> shift, 16));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q15 vector exponential.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input is in 4.11 format and the output in 1.15 format.
+ */
+
+void arm_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_q15(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q15(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q15(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vexp_q31.c
+*
+* Description:	Q31 vector exponential.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Exponential of a Q5.26 value.
+ * @param[in] x input value in 5.26 format.
+ * @return exp(x) in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vexp_kernel_q31(
+  q31_t x)
+{
+  q63_t y;                                       /* x / ln2 in 8.56 format */
+  q31_t f, p;                                    /* fractional part and 2^f */
+  int32_t k;                                     /* integer part */
+  uint32_t shift;                                /* right shift of the result */
+
+  if(x >= 0)
+  {
+    /* exp(x) >= 1 saturates */
+    return (0x7FFFFFFF);
+  }
+
+  /* x / ln2 = k + f with k an integer and f in [-0.5 0.5] */
+  y = (q63_t) x * 0x5C551D95;
+  k = (int32_t) ((y + ((q63_t) 1 << 55)) >> 56);
+  f = (q31_t) ((y - ((q63_t) k * ((q63_t) 1 << 56))) >> 25);
+
+  /* 2^f = p0 + p1 * f + ... + p7 * f^7, coefficients in 2.30 format */
+  p = 0x00004030;
+  p = 0x000288D9 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x0015D877 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x009D94EC + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x038D611B + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x0F5FDF05 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x2C5C85FE + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x40000000 + (q31_t) (((q63_t) p * f) >> 31);
+  /* exp(x) = 2^f * 2^k, with k <= 0 */
+  if(k == 0)
+  {
+    return (clip_q63_to_q31((q63_t) p << 1));
+  }
+
+  shift = (uint32_t) (-k - 1);
+
+  if(shift > 31u)
+  {
+    return (0);
+  }
+
+  return ((q31_t) (((q63_t) p + (((q63_t) 1 << shift) >> 1)) >> shift));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector exponential.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input is in 5.26 format and the output in 1.31 format.
+ */
+
+void arm_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_q31(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q31(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q31(*pSrc++);
+    *pDst++ = arm_vexp_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vlog_f32.c
+*
+* Description:	Floating-point vector natural logarithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Natural logarithm of a floating-point value.
+ * @param[in] x input value.
+ * @return ln(x).
+ */
+
+static __INLINE float32_t arm_vlog_kernel_f32(
+  float32_t x)
+{
+  float32_t m, y, z, fe;                         /* mantissa, result and temporaries */
+  int32_t e;                                     /* exponent */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } w;                                           /* input and its bit pattern */
+
+  w.f = x;
+
+  if(!(x > 0.0f))
+  {
+    /* ln(0) = -inf, and NaN for negative or NaN input */
+    w.i = (x == 0.0f) ? (int32_t) 0xFF800000u : 0x7FC00000;
+    return (w.f);
+  }
+
+  if(w.i >= 0x7F800000)
+  {
+    /* ln(+inf) = +inf */
+    return (x);
+  }
+
+  e = 0;
+
+  if(w.i < 0x00800000)
+  {
+    /* Normalize a subnormal input */
+    w.f = x * 8388608.0f;
+    e = -23;
+  }
+
+  /* x = m * 2^e with m in [0.5 1) */
+  e += (w.i >> 23) - 126;
+  w.i = (w.i & 0x007FFFFF) | 0x3F000000;
+  m = w.f;
+
+  /* m in [sqrt(0.5) sqrt(2)), and ln(m) = ln(1 + (m - 1)) */
+  if(m < 0.707106781186547524f)
+  {
+    e -= 1;
+    m = (m + m) - 1.0f;
+  }
+  else
+  {
+    m = m - 1.0f;
+  }
+
+  z = m * m;
+
+  y = 7.0376836292e-2f;
+  y = (y * m) - 1.1514610310e-1f;
+  y = (y * m) + 1.1676998740e-1f;
+  y = (y * m) - 1.2420140846e-1f;
+  y = (y * m) + 1.4249322787e-1f;
+  y = (y * m) - 1.6668057665e-1f;
+  y = (y * m) + 2.0000714765e-1f;
+  y = (y * m) - 2.4999993993e-1f;
+  y = (y * m) + 3.3333331174e-1f;
+  y = (y * m) * z;
+
+  /* ln(x) = ln(m) + e * ln2, with ln2 split in two parts */
+  fe = (float32_t) e;
+  y += fe * -2.12194440e-4f;
+  y -= 0.5f * z;
+
+  return ((m + y) + (fe * 0.693359375f));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector natural logarithm.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_f32(*pSrc++);
+    *pDst++ = arm_vlog_kernel_f32(*pSrc++);
+    *pDst++ = arm_vlog_kernel_f32(*pSrc++);
+    *pDst++ = arm_vlog_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vlog_q15.c
+*
+* Description:	Q15 vector natural logarithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Natural logarithm of a Q15 value.
+ * @param[in] x input value in 1.15 format.
+ * @return ln(x) in 4.11 format.
+ */
+
+static __INLINE q15_t arm_vlog_kernel_q15(
+  q15_t x)
+{
+  uint32_t m;                                    /* normalized input */
+  int32_t e;                                     /* exponent */
+  q31_t u, p, r;                                 /* m - 1, polynomial and result */
+
+  if(x <= 0)
+  {
+    /* Most negative value for non-positive input */
+    return ((q15_t) 0x8000);
+  }
+
+  /* x = (m / 2^15) * 2^e with m / 2^15 in [1 2) */
+  e = (int32_t) __CLZ(x) - 16;
+  m = (uint32_t) x << e;
+  e = -e;
+
+  /* u = m / 2^15 - 1 in [sqrt(0.5) - 1, sqrt(2) - 1), in 1.15 format */
+  if(m > 0xB504u)
+  {
+    u = (q31_t) (m >> 1) - 0x8000;
+    e++;
+  }
+  else
+  {
+    u = (q31_t) m - 0x8000;
+  }
+
+  /* ln(1 + u) = u * (p0 + p1 * u + ... + p4 * u^4), coefficients in 15.16 format */
+  p = 0x2C6A;
+  p = -0x4525 + ((p * u) >> 15);
+  p = 0x5631 + ((p * u) >> 15);
+  p = -0x7FDF + ((p * u) >> 15);
+  p = 0xFFFE + ((p * u) >> 15);
+  r = (p * u) >> 15;
+
+  /* ln(x) = ln(1 + u) + e * ln2 */
+  r += e * 0xB172;
+
+  /* 15.16 to 4.11 format with rounding */
+  return ((q15_t) ((r + 16) >> 5));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q15 vector natural logarithm.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input is in 1.15 format and the output in 4.11 format.
+ */
+
+void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_q15(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q15(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q15(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vlog_q31.c
+*
+* Description:	Q31 vector natural logarithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Natural logarithm of a Q31 value.
+ * @param[in] x input value in 1.31 format.
+ * @return ln(x) in 5.26 format.
+ */
+
+static __INLINE q31_t arm_vlog_kernel_q31(
+  q31_t x)
+{
+  uint32_t m;                                    /* normalized input */
+  int32_t e;                                     /* exponent */
+  q31_t u, p;                                    /* m - 1 and polynomial */
+  q63_t r;                                       /* result in 34.30 format */
+
+  if(x <= 0)
+  {
+    /* Most negative value for non-positive input */
+    return ((q31_t) 0x80000000);
+  }
+
+  /* x = (m / 2^31) * 2^e with m / 2^31 in [1 2) */
+  e = (int32_t) __CLZ(x);
+  m = (uint32_t) x << e;
+  e = -e;
+
+  /* u = m / 2^31 - 1 in [sqrt(0.5) - 1, sqrt(2) - 1), in 1.31 format */
+  if(m > 0xB504F333u)
+  {
+    u = (q31_t) ((m >> 1) - 0x80000000u);
+    e++;
+  }
+  else
+  {
+    u = (q31_t) (m - 0x80000000u);
+  }
+
+  /* ln(1 + u) = u * (p0 + p1 * u + ... + p9 * u^9), coefficients in 2.30 format */
+  p = -0x04C4CD67;
+  p = 0x08323C2C + (q31_t) (((q63_t) p * u) >> 31);
+  p = -0x087D81AF + (q31_t) (((q63_t) p * u) >> 31);
+  p = 0x0916787E + (q31_t) (((q63_t) p * u) >> 31);
+  p = -0x0AA11D81 + (q31_t) (((q63_t) p * u) >> 31);
+  p = 0x0CCCF434 + (q31_t) (((q63_t) p * u) >> 31);
+  p = -0x1000423B + (q31_t) (((q63_t) p * u) >> 31);
+  p = 0x155555D6 + (q31_t) (((q63_t) p * u) >> 31);
+  p = -0x1FFFFF84 + (q31_t) (((q63_t) p * u) >> 31);
+  p = 0x3FFFFFFF + (q31_t) (((q63_t) p * u) >> 31);
+  r = ((q63_t) p * u) >> 31;
+
+  /* ln(x) = ln(1 + u) + e * ln2 */
+  r += (q63_t) e * 0x2C5C85FE;
+
+  /* 34.30 to 5.26 format with rounding */
+  return ((q31_t) ((r + 8) >> 4));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector natural logarithm.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input is in 1.31 format and the output in 5.26 format.
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_q31(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q31(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q31(*pSrc++);
+    *pDst++ = arm_vlog_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
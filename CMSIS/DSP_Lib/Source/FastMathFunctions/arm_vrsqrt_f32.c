@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vrsqrt_f32.c
+*
+* Description:	Floating-point vector reciprocal square root.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Reciprocal square root of a floating-point value.
+ * @param[in] x input value.
+ * @return 1/sqrt(x).
+ */
+
+static __INLINE float32_t arm_vrsqrt_kernel_f32(
+  float32_t x)
+{
+  float32_t y, h, scale;                         /* result, half of the input and scale */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } w;                                           /* input and its bit pattern */
+
+  w.f = x;
+  scale = 1.0f;
+
+  if((w.i < 0x00800000) || (w.i >= 0x7F800000))
+  {
+    if(x == 0.0f)
+    {
+      /* 1/sqrt(0) = +inf */
+      w.i = 0x7F800000;
+      return (w.f);
+    }
+
+    if(!(x > 0.0f))
+    {
+      /* NaN for negative or NaN input */
+      w.i = 0x7FC00000;
+      return (w.f);
+    }
+
+    if(w.i >= 0x7F800000)
+    {
+      /* 1/sqrt(+inf) = 0 */
+      return (0.0f);
+    }
+
+    /* Normalize a subnormal input: 1/sqrt(x) = 2^12/sqrt(x * 2^24) */
+    w.f = x * 16777216.0f;
+    scale = 4096.0f;
+  }
+
+  /* Estimate from the bit pattern, with a relative error below 3.5e-2 */
+  h = 0.5f * w.f;
+  w.i = 0x5F375A86 - (w.i >> 1);
+  y = w.f;
+
+  /* Three Newton-Raphson iterations y = y * (1.5 - x/2 * y^2), the last one written as a
+     small correction of y, to round once */
+  y = y * (1.5f - ((h * y) * y));
+  y = y * (1.5f - ((h * y) * y));
+  y = y + (y * (0.5f - ((h * y) * y)));
+
+  return (y * scale);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector reciprocal square root.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The reciprocal square root is computed without a division or a square root, from
+ * an estimate taken from the bit pattern of the input, refined by three Newton-Raphson
+ * iterations.  Zero gives +inf, +inf gives zero, and negative inputs give NaN.
+ */
+
+void arm_vrsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = 1/sqrt(A) */
+    *pDst++ = arm_vrsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vrsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vrsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vrsqrt_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = 1/sqrt(A) */
+    *pDst++ = arm_vrsqrt_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
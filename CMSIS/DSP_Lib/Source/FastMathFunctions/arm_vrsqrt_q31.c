@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vrsqrt_q31.c
+*
+* Description:	Q31 vector reciprocal square root.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * \par
+ * Quadratic estimates of <code>1/(2*sqrt(u))</code> in 3.29 format, for <code>u</code> in
+ * [0.25 0.5) and in [0.5 1), with a relative error below <code>3.6e-3</code>.
+ */
+
+static const q31_t arm_vrsqrt_coef_q31[6] = {
+  0x325B97B9, -0x5C723F70, 0x4A38D1CC,
+  0x239BBB8C, -0x20AF483B, 0x0D1EE6EF
+};
+
+/**
+ * @brief Reciprocal square root of a positive value.
+ * @param[in]  x input value in 1.31 format.
+ * @param[out] *pShift shift of the result.
+ * @return mantissa of the result in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vrsqrt_kernel_q31(
+  q31_t x,
+  uint8_t * pShift)
+{
+  const q31_t *pCoef;                            /* estimate coefficients */
+  q31_t in, u, h, t;                             /* input, normalized input, estimate, temporary */
+  q63_t m;                                       /* mantissa of the result */
+  uint32_t k;                                    /* normalization shift */
+
+  /* Zero or negative inputs are computed as 1 LSB, and their result replaced by the maximum */
+  in = (x > 0) ? x : 1;
+
+  /* in = u * 2^(-2k) with u in [0.25 1) */
+  k = (__CLZ(in) - 1u) >> 1;
+  u = in << (2u * k);
+
+  /* Estimate h = 1/(2*sqrt(u)) on the half of the range that holds u */
+  pCoef = &arm_vrsqrt_coef_q31[3u * ((uint32_t) u >> 30)];
+  h = pCoef[2];
+  h = pCoef[1] + (q31_t) (((q63_t) h * u) >> 31);
+  h = pCoef[0] + (q31_t) (((q63_t) h * u) >> 31);
+
+  /* 3.29 to 2.30 format */
+  h = h << 1;
+
+  /* Three Newton-Raphson iterations h = h * (1.5 - 2 * u * h^2), in 2.30 format */
+  t = (q31_t) (((q63_t) h * h) >> 30);
+  t = (q31_t) (((q63_t) u * t) >> 31);
+  h = (q31_t) (((q63_t) h * (0x60000000 - (t << 1))) >> 30);
+
+  t = (q31_t) (((q63_t) h * h) >> 30);
+  t = (q31_t) (((q63_t) u * t) >> 31);
+  h = (q31_t) (((q63_t) h * (0x60000000 - (t << 1))) >> 30);
+
+  /* The last one computes u * h^2 in 1.31 format, and rounds */
+  t = (q31_t) ((((q63_t) u * h) + 0x20000000) >> 30);
+  t = (q31_t) ((((q63_t) t * h) + 0x20000000) >> 30);
+  m = (((q63_t) h * (0x60000000 - t)) + 0x10000000) >> 29;
+
+  /* 1/sqrt(in) = m * 2^k, with m = 2 * h in (0.5 1] saturated to 1.31 format */
+  *pShift = (x > 0) ? (uint8_t) (k + 1u) : 16u;
+
+  return (((x > 0) && (m < 0x80000000LL)) ? (q31_t) m : 0x7FFFFFFF);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief Q31 vector reciprocal square root.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer of mantissas
+ * @param[out]      *pShift points to the output buffer of shifts
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input and the mantissas are in 1.31 format, and the reciprocal square root of
+ * <code>pSrc[n]</code> is <code>pDst[n] * 2^pShift[n]</code>.
+ * The mantissas are in [0.5 +1).  Zero or negative inputs give the largest result,
+ * <code>0x7FFFFFFF * 2^16</code>.
+ */
+
+void arm_vrsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t * pShift,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = 1/sqrt(A) */
+    *pDst++ = arm_vrsqrt_kernel_q31(*pSrc++, pShift++);
+    *pDst++ = arm_vrsqrt_kernel_q31(*pSrc++, pShift++);
+    *pDst++ = arm_vrsqrt_kernel_q31(*pSrc++, pShift++);
+    *pDst++ = arm_vrsqrt_kernel_q31(*pSrc++, pShift++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = 1/sqrt(A) */
+    *pDst++ = arm_vrsqrt_kernel_q31(*pSrc++, pShift++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsin_cos_f32.c
+*
+* Description:	Floating-point vector sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Reduction of a large floating-point value modulo 360 degrees.
+ * @param[in] x finite input value in degrees, with |x| >= 2^24.
+ * @return x modulo 360, with the sign of x.
+ *
+ * Such a value is an integer, <code>m * 2^e</code>, and its remainder is computed
+ * exactly in integer arithmetic.
+ */
+
+static __INLINE float32_t arm_vsin_cos_reduce_f32(
+  float32_t x)
+{
+  uint32_t m, e, p;                              /* mantissa, exponent and 2^e modulo 360 */
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } w;                                           /* input and its bit pattern */
+
+  w.f = x;
+
+  /* |x| = m * 2^e */
+  m = (w.i & 0x007FFFFFu) | 0x00800000u;
+  e = ((w.i >> 23) & 0xFFu) - 150u;
+
+  p = 1u;
+
+  while(e > 0u)
+  {
+    p = (p * 2u) % 360u;
+    e--;
+  }
+
+  /* Both factors are below 360, so the product cannot overflow */
+  m = ((m % 360u) * p) % 360u;
+
+  return (((w.i & 0x80000000u) != 0u) ? -(float32_t) m : (float32_t) m);
+}
+
+/**
+ * @brief Sine and cosine of a floating-point value in degrees.
+ * @param[in]  x input value in degrees.
+ * @param[out] *pSinVal points to the sine.
+ * @param[out] *pCosVal points to the cosine.
+ */
+
+static __INLINE void arm_vsin_cos_kernel_f32(
+  float32_t x,
+  float32_t * pSinVal,
+  float32_t * pCosVal)
+{
+  float32_t r, z, y, s, c;                       /* reduced input, its square and results */
+  int32_t k;                                     /* nearest multiple of 90 degrees */
+
+  if(!(fabsf(x) < 16777216.0f))
+  {
+    if(!(fabsf(x) <= 3.40282347e+38f))
+    {
+      /* NaN for an infinite or NaN input */
+      *pSinVal = x - x;
+      *pCosVal = x - x;
+      return;
+    }
+
+    x = arm_vsin_cos_reduce_f32(x);
+  }
+
+  /* k = round(x / 90) */
+  y = x * 0.0111111111111111111f;
+  k = (int32_t) ((y >= 0.0f) ? (y + 0.5f) : (y - 0.5f));
+
+  /* r = (x - k * 90) * pi/180 in [-pi/4 pi/4]: the subtraction is exact */
+  r = (x - ((float32_t) k * 90.0f)) * 0.0174532925199432958f;
+  z = r * r;
+
+  /* sin(r) and cos(r) */
+  s = -1.9515295891e-4f;
+  s = (s * z) + 8.3321608736e-3f;
+  s = (s * z) - 1.6666654611e-1f;
+  s = (s * z * r) + r;
+
+  c = 2.443315711809948e-5f;
+  c = (c * z) - 1.388731625493765e-3f;
+  c = (c * z) + 4.166664568298827e-2f;
+  c = (c * z * z) - (0.5f * z) + 1.0f;
+
+  switch ((uint32_t) k & 3u)
+  {
+  case 0u:
+    *pSinVal = s;
+    *pCosVal = c;
+    break;
+  case 1u:
+    *pSinVal = c;
+    *pCosVal = -s;
+    break;
+  case 2u:
+    *pSinVal = -s;
+    *pCosVal = -c;
+    break;
+  default:
+    *pSinVal = -c;
+    *pCosVal = s;
+    break;
+  }
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector sine and cosine of angles in degrees.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pSinVal points to the output buffer of the sines
+ * @param[out]      *pCosVal points to the output buffer of the cosines
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vsin_cos_f32(
+  float32_t * pSrc,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_f32(*pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_f32(*pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_f32(*pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_f32(*pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_f32(*pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
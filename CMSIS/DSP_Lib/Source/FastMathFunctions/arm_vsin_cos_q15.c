@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsin_cos_q15.c
+*
+* Description:	Q15 vector sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Sine and cosine of a phase.
+ * @param[in]  phase phase as a fraction of a turn in 0.16 format.
+ * @param[out] *pSinVal points to the sine in 1.15 format.
+ * @param[out] *pCosVal points to the cosine in 1.15 format.
+ */
+
+static __INLINE void arm_vsin_cos_kernel_q15(
+  uint32_t phase,
+  q15_t * pSinVal,
+  q15_t * pCosVal)
+{
+  q31_t w, w2, s, c;                             /* offset, its square and results */
+  uint32_t quadrant;                             /* nearest quarter turn */
+
+  /* Nearest quarter turn, and offset w from it in quarter turns, in [-0.5 0.5) */
+  phase = (phase + 0x2000u) & 0xFFFFu;
+  quadrant = phase >> 14;
+  w = ((q31_t) (phase & 0x3FFFu) - 0x2000) << 1;
+  w2 = (w * w) >> 15;
+
+  /* sin(pi/2 * w) = w * (s0 + s1 * w^2 + s2 * w^4), coefficients in 15.16 format */
+  s = 0x1411;
+  s = -0xA55A + ((s * w2) >> 15);
+  s = 0x19220 + ((s * w2) >> 15);
+  s = (s * w) >> 15;
+
+  /* cos(pi/2 * w) = c0 + c1 * w^2 + c2 * w^4 + c3 * w^6, coefficients in 15.16 format */
+  c = -0x541;
+  c = 0x40EE + ((c * w2) >> 15);
+  c = -0x13BD4 + ((c * w2) >> 15);
+  c = 0x10000 + ((c * w2) >> 15);
+
+  /* 15.16 to 1.15 format with rounding, and saturation of +1 */
+  s = __SSAT((s + 1) >> 1, 16);
+  c = __SSAT((c + 1) >> 1, 16);
+
+  switch (quadrant)
+  {
+  case 0u:
+    *pSinVal = (q15_t) s;
+    *pCosVal = (q15_t) c;
+    break;
+  case 1u:
+    *pSinVal = (q15_t) c;
+    *pCosVal = (q15_t) - s;
+    break;
+  case 2u:
+    *pSinVal = (q15_t) - s;
+    *pCosVal = (q15_t) - c;
+    break;
+  default:
+    *pSinVal = (q15_t) - c;
+    *pCosVal = (q15_t) s;
+    break;
+  }
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q15 vector sine and cosine.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pSinVal points to the output buffer of the sines
+ * @param[out]      *pCosVal points to the output buffer of the cosines
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input in [-1 +1) maps to [-180 180) degrees, and the outputs are in 1.15 format.
+ */
+
+void arm_vsin_cos_q15(
+  q15_t * pSrc,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_q15((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q15((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q15((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q15((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_q15((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsin_cos_q31.c
+*
+* Description:	Q31 vector sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Sine and cosine of a phase.
+ * @param[in]  phase phase as a fraction of a turn in 0.32 format.
+ * @param[out] *pSinVal points to the sine in 1.31 format.
+ * @param[out] *pCosVal points to the cosine in 1.31 format.
+ */
+
+static __INLINE void arm_vsin_cos_kernel_q31(
+  uint32_t phase,
+  q31_t * pSinVal,
+  q31_t * pCosVal)
+{
+  q31_t w, w2, s, c;                             /* offset, its square and results */
+  uint32_t quadrant;                             /* nearest quarter turn */
+
+  /* Nearest quarter turn, and offset w from it in quarter turns, in [-0.5 0.5) */
+  phase += 0x20000000u;
+  quadrant = phase >> 30;
+  w = (q31_t) ((phase & 0x3FFFFFFFu) - 0x20000000u) << 1;
+  w2 = (q31_t) (((q63_t) w * w) >> 31);
+
+  /* sin(pi/2 * w) = w * (s0 + s1 * w^2 + ... + s4 * w^8), coefficients in 2.30 format */
+  s = 0x000299E6;
+  s = -0x004CB3B2 + (q31_t) (((q63_t) s * w2) >> 31);
+  s = 0x0519AF0E + (q31_t) (((q63_t) s * w2) >> 31);
+  s = -0x295779CC + (q31_t) (((q63_t) s * w2) >> 31);
+  s = 0x6487ED51 + (q31_t) (((q63_t) s * w2) >> 31);
+  s = (q31_t) (((q63_t) s * w) >> 31);
+
+  /* cos(pi/2 * w) = c0 + c1 * w^2 + ... + c5 * w^10, coefficients in 2.30 format */
+  c = -0x00006899;
+  c = 0x000F0F73 + (q31_t) (((q63_t) c * w2) >> 31);
+  c = -0x0155D3C4 + (q31_t) (((q63_t) c * w2) >> 31);
+  c = 0x103C1F08 + (q31_t) (((q63_t) c * w2) >> 31);
+  c = -0x4EF4F327 + (q31_t) (((q63_t) c * w2) >> 31);
+  c = 0x40000000 + (q31_t) (((q63_t) c * w2) >> 31);
+
+  /* 2.30 to 1.31 format, with saturation of +1 */
+  s = clip_q63_to_q31((q63_t) s << 1);
+  c = clip_q63_to_q31((q63_t) c << 1);
+
+  switch (quadrant)
+  {
+  case 0u:
+    *pSinVal = s;
+    *pCosVal = c;
+    break;
+  case 1u:
+    *pSinVal = c;
+    *pCosVal = -s;
+    break;
+  case 2u:
+    *pSinVal = -s;
+    *pCosVal = -c;
+    break;
+  default:
+    *pSinVal = -c;
+    *pCosVal = s;
+    break;
+  }
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector sine and cosine.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pSinVal points to the output buffer of the sines
+ * @param[out]      *pCosVal points to the output buffer of the cosines
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input in [-1 +1) maps to [-180 180) degrees, and the outputs are in 1.31 format.
+ */
+
+void arm_vsin_cos_q31(
+  q31_t * pSrc,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_q31((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q31((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q31((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+    arm_vsin_cos_kernel_q31((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* sin(A) and cos(A) */
+    arm_vsin_cos_kernel_q31((uint32_t) * pSrc++, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
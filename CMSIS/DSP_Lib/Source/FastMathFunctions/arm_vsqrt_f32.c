@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsqrt_f32.c
+*
+* Description:	Floating-point vector square root.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Square root of a floating-point value.
+ * @param[in] x input value.
+ * @return sqrt(x), and zero for <code>x <= 0</code>.
+ */
+
+static __INLINE float32_t arm_vsqrt_kernel_f32(
+  float32_t x)
+{
+  /* Zero for negative inputs, as for arm_sqrt_f32() */
+  x = (x > 0.0f) ? x : 0.0f;
+
+#if (__FPU_USED == 1) && defined ( __CC_ARM   )
+  return (__sqrtf(x));
+#else
+  return (sqrtf(x));
+#endif
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector square root.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The output is zero for zero, negative or NaN inputs, as for arm_sqrt_f32().
+ * The square root instruction of the floating-point unit is used when it is available,
+ * so the result is correctly rounded.
+ */
+
+void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A), with zero for A <= 0 */
+    *pDst++ = arm_vsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_f32(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A), with zero for A <= 0 */
+    *pDst++ = arm_vsqrt_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsqrt_q31.c
+*
+* Description:	Q31 vector square root.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * \par
+ * Quadratic estimates of <code>1/(2*sqrt(u))</code> in 3.29 format, for <code>u</code> in
+ * [0.25 0.5) and in [0.5 1), with a relative error below <code>3.6e-3</code>.
+ */
+
+static const q31_t arm_vsqrt_coef_q31[6] = {
+  0x325B97B9, -0x5C723F70, 0x4A38D1CC,
+  0x239BBB8C, -0x20AF483B, 0x0D1EE6EF
+};
+
+/**
+ * @brief Square root of a positive value.
+ * @param[in] x input value in 1.31 format.
+ * @return square root in 1.31 format, truncated, and zero for <code>x <= 0</code>.
+ */
+
+static __INLINE q31_t arm_vsqrt_kernel_q31(
+  q31_t x)
+{
+  const q31_t *pCoef;                            /* estimate coefficients */
+  q63_t q, rem;                                  /* square root and remainder */
+  q31_t in, u, h, t;                             /* input, normalized input, estimate, temporary */
+  uint32_t k;                                    /* normalization shift */
+
+  /* Zero or negative inputs are computed as 1 LSB, and their result replaced by zero */
+  in = (x > 0) ? x : 1;
+
+  /* in = u * 2^(-2k) with u in [0.25 1) */
+  k = (__CLZ(in) - 1u) >> 1;
+  u = in << (2u * k);
+
+  /* Estimate h = 1/(2*sqrt(u)) on the half of the range that holds u */
+  pCoef = &arm_vsqrt_coef_q31[3u * ((uint32_t) u >> 30)];
+  h = pCoef[2];
+  h = pCoef[1] + (q31_t) (((q63_t) h * u) >> 31);
+  h = pCoef[0] + (q31_t) (((q63_t) h * u) >> 31);
+
+  /* 3.29 to 2.30 format */
+  h = h << 1;
+
+  /* Two Newton-Raphson iterations h = h * (1.5 - 2 * u * h^2), in 2.30 format */
+  t = (q31_t) (((q63_t) h * h) >> 30);
+  t = (q31_t) (((q63_t) u * t) >> 31);
+  h = (q31_t) (((q63_t) h * (0x60000000 - (t << 1))) >> 30);
+
+  t = (q31_t) (((q63_t) h * h) >> 30);
+  t = (q31_t) (((q63_t) u * t) >> 31);
+  h = (q31_t) (((q63_t) h * (0x60000000 - (t << 1))) >> 30);
+
+  /* sqrt(u) = 2 * u * h, refined with q = q + (u - q^2) * h, in 1.31 format */
+  q = ((q63_t) u * h) >> 29;
+  rem = ((q63_t) u << 31) - (q * q);
+  q += ((rem >> 16) * h) >> 45;
+
+  /* sqrt(in) = sqrt(u) * 2^-k, corrected to the truncated square root */
+  q = q >> k;
+  rem = ((q63_t) in << 31) - (q * q);
+  q = (q - (rem < 0)) + (rem > (q << 1));
+
+  return ((x > 0) ? (q31_t) q : 0);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief Q31 vector square root.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input and the output are in 1.31 format.  The output is the square root truncated
+ * to 1.31 format, and is zero for zero or negative inputs.
+ */
+
+void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A), with zero for A <= 0 */
+    *pDst++ = arm_vsqrt_kernel_q31(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_q31(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_q31(*pSrc++);
+    *pDst++ = arm_vsqrt_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A), with zero for A <= 0 */
+    *pDst++ = arm_vsqrt_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vtanh_f32.c
+*
+* Description:	Floating-point vector hyperbolic tangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Exponential of a floating-point value in [1 19].
+ * @param[in] x input value.
+ * @return exp(x).
+ */
+
+static __INLINE float32_t arm_vtanh_exp_f32(
+  float32_t x)
+{
+  float32_t r, y;                                /* reduced input and result */
+  int32_t k;                                     /* nearest multiple of ln2 */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                       /* power of two of the result */
+
+  /* k = round(x / ln2) */
+  y = x * 1.44269504088896341f;
+  k = (int32_t) ((y >= 0.0f) ? (y + 0.5f) : (y - 0.5f));
+
+  /* r = x - k * ln2 in [-ln2/2 ln2/2], with ln2 split in two parts */
+  y = (float32_t) k;
+  r = (x - (y * 0.693359375f)) + (y * 2.12194440e-4f);
+
+  /* exp(r) */
+  y = 1.9875691500e-4f;
+  y = (y * r) + 1.3981999507e-3f;
+  y = (y * r) + 8.3334519073e-3f;
+  y = (y * r) + 4.1665795894e-2f;
+  y = (y * r) + 1.6666665459e-1f;
+  y = (y * r) + 5.0000001201e-1f;
+  y = (y * (r * r)) + r + 1.0f;
+  scale.i = (k + 127) << 23;
+
+  return (y * scale.f);
+}
+
+/**
+ * @brief Hyperbolic tangent of a floating-point value.
+ * @param[in] x input value.
+ * @return tanh(x).
+ */
+
+static __INLINE float32_t arm_vtanh_kernel_f32(
+  float32_t x)
+{
+  float32_t ax = fabsf(x);                       /* absolute value of the input */
+  float32_t y, z;                                /* result and temporary */
+
+  if(ax > 9.0f)
+  {
+    /* tanh(x) rounds to +-1 */
+    y = 1.0f;
+  }
+  else if(ax >= 0.625f)
+  {
+    /* tanh(|x|) = 1 - 2 / (exp(2|x|) + 1) */
+    y = 1.0f - (2.0f / (arm_vtanh_exp_f32(ax + ax) + 1.0f));
+  }
+  else
+  {
+    /* Odd polynomial for small inputs, which also returns NaN for NaN input */
+    z = x * x;
+
+    y = -5.70498872745e-3f;
+    y = (y * z) + 2.06390887954e-2f;
+    y = (y * z) - 5.37397155531e-2f;
+    y = (y * z) + 1.33314422036e-1f;
+    y = (y * z) - 3.33332819422e-1f;
+
+    return ((y * z * x) + x);
+  }
+
+  return ((x < 0.0f) ? -y : y);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector hyperbolic tangent.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_vtanh_kernel_f32(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_f32(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_f32(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_vtanh_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vtanh_q31.c
+*
+* Description:	Q31 vector hyperbolic tangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Exponential of a Q5.26 value.
+ * @param[in] x input value in 5.26 format.
+ * @return exp(x) in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vtanh_exp_q31(
+  q31_t x)
+{
+  q63_t y;                                       /* x / ln2 in 8.56 format */
+  q31_t f, p;                                    /* fractional part and 2^f */
+  int32_t k;                                     /* integer part */
+  uint32_t shift;                                /* right shift of the result */
+
+  if(x >= 0)
+  {
+    /* exp(x) >= 1 saturates */
+    return (0x7FFFFFFF);
+  }
+
+  /* x / ln2 = k + f with k an integer and f in [-0.5 0.5] */
+  y = (q63_t) x * 0x5C551D95;
+  k = (int32_t) ((y + ((q63_t) 1 << 55)) >> 56);
+  f = (q31_t) ((y - ((q63_t) k * ((q63_t) 1 << 56))) >> 25);
+
+  /* 2^f = p0 + p1 * f + ... + p7 * f^7, coefficients in 2.30 format */
+  p = 0x00004030;
+  p = 0x000288D9 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x0015D877 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x009D94EC + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x038D611B + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x0F5FDF05 + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x2C5C85FE + (q31_t) (((q63_t) p * f) >> 31);
+  p = 0x40000000 + (q31_t) (((q63_t) p * f) >> 31);
+  /* exp(x) = 2^f * 2^k, with k <= 0 */
+  if(k == 0)
+  {
+    return (clip_q63_to_q31((q63_t) p << 1));
+  }
+
+  shift = (uint32_t) (-k - 1);
+
+  if(shift > 31u)
+  {
+    return (0);
+  }
+
+  return ((q31_t) (((q63_t) p + (((q63_t) 1 << shift) >> 1)) >> shift));
+}
+
+/**
+ * @brief Hyperbolic tangent of a Q5.26 value.
+ * @param[in] x input value in 5.26 format.
+ * @return tanh(x) in 1.31 format.
+ */
+
+static __INLINE q31_t arm_vtanh_kernel_q31(
+  q31_t x)
+{
+  q31_t ax, e;                                   /* absolute value and exp(-2|x|) */
+  q63_t t;                                       /* tanh(|x|) */
+
+  /* |tanh(x)| > 1 - 2^-31 for |x| >= 11 */
+  if(x >= 0x2C000000)
+  {
+    return (0x7FFFFFFF);
+  }
+
+  if(x <= -0x2C000000)
+  {
+    return (-0x7FFFFFFF);
+  }
+
+  ax = (x < 0) ? -x : x;
+
+  /* tanh(|x|) = (1 - e) / (1 + e) with e = exp(-2|x|) */
+  e = arm_vtanh_exp_q31(-(ax << 1));
+  t = (((q63_t) 0x80000000LL - e) * 0x80000000LL) / ((q63_t) 0x80000000LL + e);
+  t = clip_q63_to_q31(t);
+
+  return ((q31_t) ((x < 0) ? -t : t));
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup VectorMath
+ * @{
+ */
+
+/**
+ * @brief Q31 vector hyperbolic tangent.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[out]      *pDst points to the output buffer
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * The input is in 5.26 format and the output in 1.31 format.
+ */
+
+void arm_vtanh_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_vtanh_kernel_q31(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_q31(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_q31(*pSrc++);
+    *pDst++ = arm_vtanh_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_vtanh_kernel_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VectorMath group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_multichannel_init_q31.c
+*
+* Description:	Initialization function for the Q31 multichannel
+*               Biquad cascade DirectFormI(DF1) filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeMultichannel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 multichannel Biquad cascade DF1 filter.
+ * @param[in,out] *S           points to an instance of the filter data structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of channels.
+ * @param[in]     planarFlag   selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+ * @param[in]     *pCoeffs     points to the filter coefficients.
+ * @param[in]     *pState      points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the accumulator result. Varies according to the coefficients format
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+ * <pre>
+ *     {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+ * </pre>
+ * as for arm_biquad_cascade_df1_init_q31(), and are shared by all the channels.
+ * The <code>pCoeffs</code> array contains a total of <code>5*numStages</code> values.
+ *
+ * \par
+ * The <code>pState</code> is a pointer to state array of length <code>4*numStages*numChannels</code>.
+ * For every stage, the 4 state variables <code>{x[n-1], x[n-2], y[n-1], y[n-2]}</code> of channel 0
+ * come first, then those of channel 1, and so on.
+ * The state of a channel for a stage is that of arm_biquad_cascade_df1_q31() for the same stage.
+ */
+
+void arm_biquad_cascade_df1_multichannel_init_q31(
+  arm_biquad_cascade_df1_multichannel_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  uint8_t planarFlag,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint8_t postShift)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign number of channels and data layout */
+  S->numChannels = numChannels;
+  S->planarFlag = planarFlag;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 4 * numStages * numChannels */
+  memset(pState, 0, (4u * (uint32_t) numStages * numChannels) * sizeof(q31_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeMultichannel group
+ */
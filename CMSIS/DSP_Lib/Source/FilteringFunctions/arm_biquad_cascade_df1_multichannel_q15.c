@@ -0,0 +1,586 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_multichannel_q15.c
+*
+* Description:	Processing function for the Q15 multichannel
+*               Biquad cascade DirectFormI(DF1) filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_biquad_cascade_df1_multichannel_q15(): one stage of
+ * eight interleaved channels.  Every channel has a 64-bit lane, the samples
+ * sit sign-extended in the low half of the lane and _mm256_mul_epi32() forms
+ * the full products, so that the 64-bit sums are those of the scalar code.
+ * The low 32 bits of the shifted sum do not depend on the sign fill, which
+ * lets a logical shift stand for the arithmetic one.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_biquad_cascade_df1_multichannel_q15_avx2(
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pIn,
+  q15_t * pOut,
+  uint32_t numChannels,
+  uint32_t blockSize,
+  int32_t shift)
+{
+  __m256i b0 = _mm256_set1_epi64x(pCoeffs[0]);   /* Filter coefficients */
+  __m256i b1 = _mm256_set1_epi64x(pCoeffs[2]);
+  __m256i b2 = _mm256_set1_epi64x(pCoeffs[3]);
+  __m256i a1 = _mm256_set1_epi64x(pCoeffs[4]);
+  __m256i a2 = _mm256_set1_epi64x(pCoeffs[5]);
+  __m256i satMin = _mm256_set1_epi32(-32768);    /* Saturation bounds */
+  __m256i satMax = _mm256_set1_epi32(32767);
+  __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  __m128i sh = _mm_cvtsi32_si128(shift);
+  __m256i Xn1, Xn2, Yn1, Yn2;                    /* State of channels 0 to 3 */
+  __m256i Xn11, Xn21, Yn11, Yn21;                /* State of channels 4 to 7 */
+  __m256i Xn, Xn_1, acc0, acc1;                  /* Inputs and outputs */
+  __m128i out;
+  int64_t state[4][8];                           /* State of the lanes on exit */
+  uint32_t sample = blockSize, i;                /* Loop counters */
+
+  Xn1 = _mm256_setr_epi64x(pState[0], pState[4], pState[8], pState[12]);
+  Xn2 = _mm256_setr_epi64x(pState[1], pState[5], pState[9], pState[13]);
+  Yn1 = _mm256_setr_epi64x(pState[2], pState[6], pState[10], pState[14]);
+  Yn2 = _mm256_setr_epi64x(pState[3], pState[7], pState[11], pState[15]);
+  Xn11 = _mm256_setr_epi64x(pState[16], pState[20], pState[24], pState[28]);
+  Xn21 = _mm256_setr_epi64x(pState[17], pState[21], pState[25], pState[29]);
+  Yn11 = _mm256_setr_epi64x(pState[18], pState[22], pState[26], pState[30]);
+  Yn21 = _mm256_setr_epi64x(pState[19], pState[23], pState[27], pState[31]);
+
+  while(sample > 0u)
+  {
+    Xn = _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i *) pIn));
+    Xn_1 = _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i *) (pIn + 4)));
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc0 = _mm256_add_epi64(_mm256_mul_epi32(b0, Xn), _mm256_mul_epi32(b1, Xn1));
+    acc1 = _mm256_add_epi64(_mm256_mul_epi32(b0, Xn_1), _mm256_mul_epi32(b1, Xn11));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(b2, Xn2));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(b2, Xn21));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(a2, Yn2));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(a2, Yn21));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(a1, Yn1));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(a1, Yn11));
+
+    /* out = __SSAT((acc >> shift), 16) in the low half of every lane */
+    acc0 = _mm256_min_epi32(_mm256_max_epi32(_mm256_srl_epi64(acc0, sh), satMin), satMax);
+    acc1 = _mm256_min_epi32(_mm256_max_epi32(_mm256_srl_epi64(acc1, sh), satMin), satMax);
+
+    out = _mm_packs_epi32(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(acc0, lowHalves)),
+                          _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(acc1, lowHalves)));
+    _mm_storeu_si128((__m128i *) pOut, out);
+
+    /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = acc0;
+    Xn21 = Xn11;
+    Xn11 = Xn_1;
+    Yn21 = Yn11;
+    Yn11 = acc1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm256_storeu_si256((__m256i *) & state[0][0], Xn1);
+  _mm256_storeu_si256((__m256i *) & state[0][4], Xn11);
+  _mm256_storeu_si256((__m256i *) & state[1][0], Xn2);
+  _mm256_storeu_si256((__m256i *) & state[1][4], Xn21);
+  _mm256_storeu_si256((__m256i *) & state[2][0], Yn1);
+  _mm256_storeu_si256((__m256i *) & state[2][4], Yn11);
+  _mm256_storeu_si256((__m256i *) & state[3][0], Yn2);
+  _mm256_storeu_si256((__m256i *) & state[3][4], Yn21);
+
+  for (i = 0u; i < 8u; i++)
+  {
+    pState[(4u * i) + 0u] = (q15_t) state[0][i];
+    pState[(4u * i) + 1u] = (q15_t) state[1][i];
+    pState[(4u * i) + 2u] = (q15_t) state[2][i];
+    pState[(4u * i) + 3u] = (q15_t) state[3][i];
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_biquad_cascade_df1_multichannel_q15(): one stage of
+ * four interleaved channels, two 64-bit lanes per vector.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_biquad_cascade_df1_multichannel_q15_sse41(
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pIn,
+  q15_t * pOut,
+  uint32_t numChannels,
+  uint32_t blockSize,
+  int32_t shift)
+{
+  __m128i b0 = _mm_set1_epi64x(pCoeffs[0]);      /* Filter coefficients */
+  __m128i b1 = _mm_set1_epi64x(pCoeffs[2]);
+  __m128i b2 = _mm_set1_epi64x(pCoeffs[3]);
+  __m128i a1 = _mm_set1_epi64x(pCoeffs[4]);
+  __m128i a2 = _mm_set1_epi64x(pCoeffs[5]);
+  __m128i satMin = _mm_set1_epi32(-32768);       /* Saturation bounds */
+  __m128i satMax = _mm_set1_epi32(32767);
+  __m128i sh = _mm_cvtsi32_si128(shift);
+  __m128i Xn1, Xn2, Yn1, Yn2;                    /* State of channels 0 and 1 */
+  __m128i Xn11, Xn21, Yn11, Yn21;                /* State of channels 2 and 3 */
+  __m128i in, Xn, Xn_1, acc0, acc1;              /* Inputs and outputs */
+  int64_t state[4][4];                           /* State of the lanes on exit */
+  uint32_t sample = blockSize, i;                /* Loop counters */
+
+  Xn1 = _mm_set_epi64x(pState[4], pState[0]);
+  Xn2 = _mm_set_epi64x(pState[5], pState[1]);
+  Yn1 = _mm_set_epi64x(pState[6], pState[2]);
+  Yn2 = _mm_set_epi64x(pState[7], pState[3]);
+  Xn11 = _mm_set_epi64x(pState[12], pState[8]);
+  Xn21 = _mm_set_epi64x(pState[13], pState[9]);
+  Yn11 = _mm_set_epi64x(pState[14], pState[10]);
+  Yn21 = _mm_set_epi64x(pState[15], pState[11]);
+
+  while(sample > 0u)
+  {
+    in = _mm_loadl_epi64((const __m128i *) pIn);
+    Xn = _mm_cvtepi16_epi64(in);
+    Xn_1 = _mm_cvtepi16_epi64(_mm_srli_si128(in, 4));
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc0 = _mm_add_epi64(_mm_mul_epi32(b0, Xn), _mm_mul_epi32(b1, Xn1));
+    acc1 = _mm_add_epi64(_mm_mul_epi32(b0, Xn_1), _mm_mul_epi32(b1, Xn11));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(b2, Xn2));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(b2, Xn21));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(a2, Yn2));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(a2, Yn21));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(a1, Yn1));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(a1, Yn11));
+
+    /* out = __SSAT((acc >> shift), 16) in the low half of every lane */
+    acc0 = _mm_min_epi32(_mm_max_epi32(_mm_srl_epi64(acc0, sh), satMin), satMax);
+    acc1 = _mm_min_epi32(_mm_max_epi32(_mm_srl_epi64(acc1, sh), satMin), satMax);
+
+    in = _mm_unpacklo_epi64(_mm_shuffle_epi32(acc0, 0x08), _mm_shuffle_epi32(acc1, 0x08));
+    _mm_storel_epi64((__m128i *) pOut, _mm_packs_epi32(in, in));
+
+    /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = acc0;
+    Xn21 = Xn11;
+    Xn11 = Xn_1;
+    Yn21 = Yn11;
+    Yn11 = acc1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm_storeu_si128((__m128i *) & state[0][0], Xn1);
+  _mm_storeu_si128((__m128i *) & state[0][2], Xn11);
+  _mm_storeu_si128((__m128i *) & state[1][0], Xn2);
+  _mm_storeu_si128((__m128i *) & state[1][2], Xn21);
+  _mm_storeu_si128((__m128i *) & state[2][0], Yn1);
+  _mm_storeu_si128((__m128i *) & state[2][2], Yn11);
+  _mm_storeu_si128((__m128i *) & state[3][0], Yn2);
+  _mm_storeu_si128((__m128i *) & state[3][2], Yn21);
+
+  for (i = 0u; i < 4u; i++)
+  {
+    pState[(4u * i) + 0u] = (q15_t) state[0][i];
+    pState[(4u * i) + 1u] = (q15_t) state[1][i];
+    pState[(4u * i) + 2u] = (q15_t) state[2][i];
+    pState[(4u * i) + 3u] = (q15_t) state[3][i];
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeMultichannel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 multichannel Biquad cascade DF1 filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples per channel to process.
+ * @return none.
+ *
+ * \par
+ * The channels are interleaved when <code>S->planarFlag</code> is 0, and stored one after the
+ * other, <code>blockSize</code> samples each, when it is 1.
+ * The coefficients of a stage are loaded once and used for all the channels.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The computations are those of arm_biquad_cascade_df1_q15(): the products are accumulated
+ * in a 64-bit accumulator, which is shifted by <code>15 - postShift</code> bits and saturated
+ * to 1.15 format.  The output of each channel is the same as that of arm_biquad_cascade_df1_q15()
+ * run on that channel.
+ */
+
+void arm_biquad_cascade_df1_multichannel_q15(
+  const arm_biquad_cascade_df1_multichannel_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  q15_t *px, *py;                                /*  Input and output pointers of a channel       */
+  q63_t acc;                                     /*  Accumulator                                  */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                                   */
+  uint32_t numChannels = S->numChannels;         /*  Number of channels                           */
+  uint32_t sampleStride, channelStride;          /*  Offsets between samples and between channels */
+  uint32_t sample, ch, stage = S->numStages;     /*  Loop counters                                */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t *pCoeffs_q31;                            /*  32-bit coefficient pointer                   */
+  q31_t *pState_q31;                             /*  32-bit state pointer                         */
+  q31_t b0, b1, a1;                              /*  Packed filter coefficients                   */
+  q31_t state_in, state_out;                     /*  Packed state of the first channel of a pair  */
+  q31_t state_in1, state_out1;                   /*  Packed state of the second channel of a pair */
+  q31_t in, in1, out, out1;                      /*  Inputs and outputs of a pair                 */
+  q63_t acc1;                                    /*  Accumulator of the second channel            */
+  uint32_t chCnt;                                /*  Loop counter                                 */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                          */
+  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables                       */
+  q15_t Xn;                                      /*  Temporary input                              */
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  if(S->planarFlag == 0u)
+  {
+    /* Interleaved channels */
+    sampleStride = numChannels;
+    channelStride = 1u;
+  }
+  else
+  {
+    /* Planar channels */
+    sampleStride = 1u;
+    channelStride = blockSize;
+  }
+
+  do
+  {
+    ch = 0u;
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+    /* Run the below code on x86 hosts.  The kernels run on interleaved channels only */
+    if(S->planarFlag == 0u)
+    {
+#if defined (ARM_MATH_HOST_AVX2)
+      if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+      {
+        for (; (ch + 8u) <= numChannels; ch += 8u)
+        {
+          arm_biquad_cascade_df1_multichannel_q15_avx2(pCoeffs, pState + (4u * ch), pIn + ch, pDst + ch,
+                                                       numChannels, blockSize, shift);
+        }
+      }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+      if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+      {
+        for (; (ch + 4u) <= numChannels; ch += 4u)
+        {
+          arm_biquad_cascade_df1_multichannel_q15_sse41(pCoeffs, pState + (4u * ch), pIn + ch, pDst + ch,
+                                                        numChannels, blockSize, shift);
+        }
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Read the b0 and 0, the b1 and b2, and the a1 and a2 coefficients using SIMD */
+    pCoeffs_q31 = (q31_t *) (pCoeffs);
+    b0 = pCoeffs_q31[0];
+    b1 = pCoeffs_q31[1];
+    a1 = pCoeffs_q31[2];
+
+    /* Filter two channels at a time: the coefficients stay in registers
+     ** and the state of each channel is kept as two packed words */
+    chCnt = (numChannels - ch) >> 1u;
+
+    while(chCnt > 0u)
+    {
+      /* Read the packed state values x[n-1], x[n-2] and y[n-1], y[n-2] of both channels */
+      pState_q31 = (q31_t *) (pState + (4u * ch));
+      state_in = pState_q31[0];
+      state_out = pState_q31[1];
+      state_in1 = pState_q31[2];
+      state_out1 = pState_q31[3];
+
+      px = pIn + (ch * channelStride);
+      py = pDst + (ch * channelStride);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs */
+        in = px[0];
+        in1 = px[channelStride];
+
+        /* out =  b0 * x[n] + 0 * 0 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        out = __SMUAD(b0, in);
+        out1 = __SMUAD(b0, in1);
+
+#else
+
+        out = __SMUADX(b0, in);
+        out1 = __SMUADX(b0, in1);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* acc =  b1 * x[n-1] + b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        acc1 = __SMLALD(b1, state_in1, out1);
+
+        /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+        acc1 = __SMLALD(a1, state_out1, acc1);
+
+        /* The result is converted from 3.29 to 1.31 if postShift = 1, and then saturation is applied */
+        out = __SSAT((acc >> shift), 16);
+        out1 = __SSAT((acc1 >> shift), 16);
+
+        /* Store the outputs in the destination buffer. */
+        py[0] = (q15_t) out;
+        py[channelStride] = (q15_t) out1;
+
+        /* Every time after the output is computed state should be updated. */
+        /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+        state_in1 = __PKHBT(in1, state_in1, 16);
+        state_out1 = __PKHBT(out1, state_out1, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+        state_in1 = __PKHBT(state_in1 >> 16, in1, 16);
+        state_out1 = __PKHBT(state_out1 >> 16, out1, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        px += sampleStride;
+        py += sampleStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState_q31[0] = state_in;
+      pState_q31[1] = state_out;
+      pState_q31[2] = state_in1;
+      pState_q31[3] = state_out1;
+
+      ch += 2u;
+
+      /* decrement the loop counter */
+      chCnt--;
+    }
+
+    /* Remaining channel */
+    if(ch < numChannels)
+    {
+      pState_q31 = (q31_t *) (pState + (4u * ch));
+      state_in = pState_q31[0];
+      state_out = pState_q31[1];
+
+      px = pIn + (ch * channelStride);
+      py = pDst + (ch * channelStride);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        in = *px;
+
+        /* out =  b0 * x[n] + 0 * 0 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        out = __SMUAD(b0, in);
+
+#else
+
+        out = __SMUADX(b0, in);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        /* acc =  b1 * x[n-1] + b2 * x[n-2] + out */
+        acc = __SMLALD(b1, state_in, out);
+        /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+        acc = __SMLALD(a1, state_out, acc);
+
+        /* The result is converted from 3.29 to 1.31 if postShift = 1, and then saturation is applied */
+        out = __SSAT((acc >> shift), 16);
+
+        /* Store the output in the destination buffer. */
+        *py = (q15_t) out;
+
+        /* Every time after the output is computed state should be updated. */
+        /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+        px += sampleStride;
+        py += sampleStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState_q31[0] = state_in;
+      pState_q31[1] = state_out;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+
+    while(ch < numChannels)
+    {
+      /* Reading the state values */
+      Xn1 = pState[(4u * ch) + 0u];
+      Xn2 = pState[(4u * ch) + 1u];
+      Yn1 = pState[(4u * ch) + 2u];
+      Yn2 = pState[(4u * ch) + 3u];
+
+      px = pIn + (ch * channelStride);
+      py = pDst + (ch * channelStride);
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 *Xn;
+        acc += (q31_t) b1 *Xn1;
+        acc += (q31_t) b2 *Xn2;
+        acc += (q31_t) a1 *Yn1;
+        acc += (q31_t) a2 *Yn2;
+
+        /* The result is converted to 1.15 and saturated */
+        acc = __SSAT((acc >> shift), 16);
+
+        /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *py = (q15_t) acc;
+
+        px += sampleStride;
+        py += sampleStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[(4u * ch) + 0u] = Xn1;
+      pState[(4u * ch) + 1u] = Xn2;
+      pState[(4u * ch) + 2u] = Yn1;
+      pState[(4u * ch) + 3u] = Yn2;
+
+      ch++;
+    }
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    /* Coefficients and state variables of the next stage */
+    pCoeffs += 6u;
+    pState += 4u * numChannels;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeMultichannel group
+ */
@@ -0,0 +1,442 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_multichannel_q31.c
+*
+* Description:	Processing function for the Q31 multichannel
+*               Biquad cascade DirectFormI(DF1) filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_biquad_cascade_df1_multichannel_q31(): one stage of
+ * eight interleaved channels, one channel per 64-bit lane.  The low 32 bits
+ * of the shifted 64-bit sum are the output, as in the scalar code.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_biquad_cascade_df1_multichannel_q31_avx2(
+  const q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pIn,
+  q31_t * pOut,
+  uint32_t numChannels,
+  uint32_t blockSize,
+  uint32_t shift)
+{
+  __m256i b0 = _mm256_set1_epi64x(pCoeffs[0]);   /* Filter coefficients */
+  __m256i b1 = _mm256_set1_epi64x(pCoeffs[1]);
+  __m256i b2 = _mm256_set1_epi64x(pCoeffs[2]);
+  __m256i a1 = _mm256_set1_epi64x(pCoeffs[3]);
+  __m256i a2 = _mm256_set1_epi64x(pCoeffs[4]);
+  __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  __m128i sh = _mm_cvtsi32_si128((int32_t) shift);
+  __m256i Xn1, Xn2, Yn1, Yn2;                    /* State of channels 0 to 3 */
+  __m256i Xn11, Xn21, Yn11, Yn21;                /* State of channels 4 to 7 */
+  __m256i Xn, Xn_1, acc0, acc1;                  /* Inputs and outputs */
+  int64_t state[4][8];                           /* State of the lanes on exit */
+  uint32_t sample = blockSize, i;                /* Loop counters */
+
+  Xn1 = _mm256_setr_epi64x(pState[0], pState[4], pState[8], pState[12]);
+  Xn2 = _mm256_setr_epi64x(pState[1], pState[5], pState[9], pState[13]);
+  Yn1 = _mm256_setr_epi64x(pState[2], pState[6], pState[10], pState[14]);
+  Yn2 = _mm256_setr_epi64x(pState[3], pState[7], pState[11], pState[15]);
+  Xn11 = _mm256_setr_epi64x(pState[16], pState[20], pState[24], pState[28]);
+  Xn21 = _mm256_setr_epi64x(pState[17], pState[21], pState[25], pState[29]);
+  Yn11 = _mm256_setr_epi64x(pState[18], pState[22], pState[26], pState[30]);
+  Yn21 = _mm256_setr_epi64x(pState[19], pState[23], pState[27], pState[31]);
+
+  while(sample > 0u)
+  {
+    Xn = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *) pIn));
+    Xn_1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *) (pIn + 4)));
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc0 = _mm256_add_epi64(_mm256_mul_epi32(b0, Xn), _mm256_mul_epi32(b1, Xn1));
+    acc1 = _mm256_add_epi64(_mm256_mul_epi32(b0, Xn_1), _mm256_mul_epi32(b1, Xn11));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(b2, Xn2));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(b2, Xn21));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(a2, Yn2));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(a2, Yn21));
+    acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(a1, Yn1));
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(a1, Yn11));
+
+    /* out = (q31_t) (acc >> shift) in the low half of every lane */
+    acc0 = _mm256_srl_epi64(acc0, sh);
+    acc1 = _mm256_srl_epi64(acc1, sh);
+
+    _mm_storeu_si128((__m128i *) pOut, _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(acc0, lowHalves)));
+    _mm_storeu_si128((__m128i *) (pOut + 4), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(acc1, lowHalves)));
+
+    /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = acc0;
+    Xn21 = Xn11;
+    Xn11 = Xn_1;
+    Yn21 = Yn11;
+    Yn11 = acc1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm256_storeu_si256((__m256i *) & state[0][0], Xn1);
+  _mm256_storeu_si256((__m256i *) & state[0][4], Xn11);
+  _mm256_storeu_si256((__m256i *) & state[1][0], Xn2);
+  _mm256_storeu_si256((__m256i *) & state[1][4], Xn21);
+  _mm256_storeu_si256((__m256i *) & state[2][0], Yn1);
+  _mm256_storeu_si256((__m256i *) & state[2][4], Yn11);
+  _mm256_storeu_si256((__m256i *) & state[3][0], Yn2);
+  _mm256_storeu_si256((__m256i *) & state[3][4], Yn21);
+
+  for (i = 0u; i < 8u; i++)
+  {
+    pState[(4u * i) + 0u] = (q31_t) state[0][i];
+    pState[(4u * i) + 1u] = (q31_t) state[1][i];
+    pState[(4u * i) + 2u] = (q31_t) state[2][i];
+    pState[(4u * i) + 3u] = (q31_t) state[3][i];
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_biquad_cascade_df1_multichannel_q31(): one stage of
+ * four interleaved channels, two 64-bit lanes per vector.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_biquad_cascade_df1_multichannel_q31_sse41(
+  const q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pIn,
+  q31_t * pOut,
+  uint32_t numChannels,
+  uint32_t blockSize,
+  uint32_t shift)
+{
+  __m128i b0 = _mm_set1_epi64x(pCoeffs[0]);      /* Filter coefficients */
+  __m128i b1 = _mm_set1_epi64x(pCoeffs[1]);
+  __m128i b2 = _mm_set1_epi64x(pCoeffs[2]);
+  __m128i a1 = _mm_set1_epi64x(pCoeffs[3]);
+  __m128i a2 = _mm_set1_epi64x(pCoeffs[4]);
+  __m128i sh = _mm_cvtsi32_si128((int32_t) shift);
+  __m128i Xn1, Xn2, Yn1, Yn2;                    /* State of channels 0 and 1 */
+  __m128i Xn11, Xn21, Yn11, Yn21;                /* State of channels 2 and 3 */
+  __m128i Xn, Xn_1, acc0, acc1;                  /* Inputs and outputs */
+  int64_t state[4][4];                           /* State of the lanes on exit */
+  uint32_t sample = blockSize, i;                /* Loop counters */
+
+  Xn1 = _mm_set_epi64x(pState[4], pState[0]);
+  Xn2 = _mm_set_epi64x(pState[5], pState[1]);
+  Yn1 = _mm_set_epi64x(pState[6], pState[2]);
+  Yn2 = _mm_set_epi64x(pState[7], pState[3]);
+  Xn11 = _mm_set_epi64x(pState[12], pState[8]);
+  Xn21 = _mm_set_epi64x(pState[13], pState[9]);
+  Yn11 = _mm_set_epi64x(pState[14], pState[10]);
+  Yn21 = _mm_set_epi64x(pState[15], pState[11]);
+
+  while(sample > 0u)
+  {
+    Xn = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *) pIn));
+    Xn_1 = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *) (pIn + 2)));
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc0 = _mm_add_epi64(_mm_mul_epi32(b0, Xn), _mm_mul_epi32(b1, Xn1));
+    acc1 = _mm_add_epi64(_mm_mul_epi32(b0, Xn_1), _mm_mul_epi32(b1, Xn11));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(b2, Xn2));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(b2, Xn21));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(a2, Yn2));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(a2, Yn21));
+    acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(a1, Yn1));
+    acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(a1, Yn11));
+
+    /* out = (q31_t) (acc >> shift) in the low half of every lane */
+    acc0 = _mm_srl_epi64(acc0, sh);
+    acc1 = _mm_srl_epi64(acc1, sh);
+
+    _mm_storeu_si128((__m128i *) pOut,
+                     _mm_unpacklo_epi64(_mm_shuffle_epi32(acc0, 0x08), _mm_shuffle_epi32(acc1, 0x08)));
+
+    /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = acc0;
+    Xn21 = Xn11;
+    Xn11 = Xn_1;
+    Yn21 = Yn11;
+    Yn11 = acc1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm_storeu_si128((__m128i *) & state[0][0], Xn1);
+  _mm_storeu_si128((__m128i *) & state[0][2], Xn11);
+  _mm_storeu_si128((__m128i *) & state[1][0], Xn2);
+  _mm_storeu_si128((__m128i *) & state[1][2], Xn21);
+  _mm_storeu_si128((__m128i *) & state[2][0], Yn1);
+  _mm_storeu_si128((__m128i *) & state[2][2], Yn11);
+  _mm_storeu_si128((__m128i *) & state[3][0], Yn2);
+  _mm_storeu_si128((__m128i *) & state[3][2], Yn21);
+
+  for (i = 0u; i < 4u; i++)
+  {
+    pState[(4u * i) + 0u] = (q31_t) state[0][i];
+    pState[(4u * i) + 1u] = (q31_t) state[1][i];
+    pState[(4u * i) + 2u] = (q31_t) state[2][i];
+    pState[(4u * i) + 3u] = (q31_t) state[3][i];
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeMultichannel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 multichannel Biquad cascade DF1 filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples per channel to process.
+ * @return none.
+ *
+ * \par
+ * The channels are interleaved when <code>S->planarFlag</code> is 0, and stored one after the
+ * other, <code>blockSize</code> samples each, when it is 1.
+ * The coefficients of a stage are loaded once and used for all the channels.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The computations are those of arm_biquad_cascade_df1_q31(): the products are accumulated
+ * in a 64-bit accumulator, which is shifted by <code>31 - postShift</code> bits and truncated
+ * to 1.31 format.  The output of each channel is the same as that of arm_biquad_cascade_df1_q31()
+ * run on that channel.
+ */
+
+void arm_biquad_cascade_df1_multichannel_q31(
+  const arm_biquad_cascade_df1_multichannel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  q31_t *px, *py;                                /*  input and output pointers of a channel */
+  q63_t acc;                                     /*  accumulator                   */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  uint32_t shift = 32u - ((uint32_t) S->postShift + 1u);        /*  Shift to be applied to the output */
+  uint32_t numChannels = S->numChannels;         /*  Number of channels            */
+  uint32_t sampleStride, channelStride;          /*  Offsets between samples and between channels */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                 */
+
+  if(S->planarFlag == 0u)
+  {
+    /* Interleaved channels */
+    sampleStride = numChannels;
+    channelStride = 1u;
+  }
+  else
+  {
+    /* Planar channels */
+    sampleStride = 1u;
+    channelStride = blockSize;
+  }
+
+  do
+  {
+    ch = 0u;
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+    /* Run the below code on x86 hosts.  The kernels run on interleaved channels only */
+    if(S->planarFlag == 0u)
+    {
+#if defined (ARM_MATH_HOST_AVX2)
+      if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+      {
+        for (; (ch + 8u) <= numChannels; ch += 8u)
+        {
+          arm_biquad_cascade_df1_multichannel_q31_avx2(pCoeffs, pState + (4u * ch), pIn + ch, pDst + ch,
+                                                       numChannels, blockSize, shift);
+        }
+      }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+      if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+      {
+        for (; (ch + 4u) <= numChannels; ch += 4u)
+        {
+          arm_biquad_cascade_df1_multichannel_q31_sse41(pCoeffs, pState + (4u * ch), pIn + ch, pDst + ch,
+                                                        numChannels, blockSize, shift);
+        }
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+    /* Reading the coefficients, once for all the channels */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    while(ch < numChannels)
+    {
+      /* Reading the state values */
+      Xn1 = pState[(4u * ch) + 0u];
+      Xn2 = pState[(4u * ch) + 1u];
+      Yn1 = pState[(4u * ch) + 2u];
+      Yn2 = pState[(4u * ch) + 3u];
+
+      px = pIn + (ch * channelStride);
+      py = pDst + (ch * channelStride);
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Compute 2 outputs at a time: the output state variables swap roles
+       ** instead of being moved.  The loop below computes the remaining sample. */
+      sample = blockSize >> 1u;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = px[0];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* The result is converted to 1.31, Yn2 variable is reused */
+        Yn2 = (q31_t) (acc >> shift);
+
+        /* Store the output in the destination buffer. */
+        py[0] = Yn2;
+
+        /* Read the second input, Xn2 variable is reused */
+        Xn2 = px[sampleStride];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn2;
+        acc += (q63_t) b1 *Xn;
+        acc += (q63_t) b2 *Xn1;
+        acc += (q63_t) a1 *Yn2;
+        acc += (q63_t) a2 *Yn1;
+
+        /* The result is converted to 1.31, Yn1 variable is reused */
+        Yn1 = (q31_t) (acc >> shift);
+
+        /* Store the output in the destination buffer. */
+        py[sampleStride] = Yn1;
+
+        /* Xn1 = x[n], Xn2 = x[n-1].  Yn1 and Yn2 already hold y[n] and y[n-1] */
+        Xn1 = Xn2;
+        Xn2 = Xn;
+
+        px += 2u * sampleStride;
+        py += 2u * sampleStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      sample = blockSize & 0x1u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      sample = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* The result is converted to 1.31  */
+        acc = acc >> shift;
+
+        /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *py = (q31_t) acc;
+
+        px += sampleStride;
+        py += sampleStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[(4u * ch) + 0u] = Xn1;
+      pState[(4u * ch) + 1u] = Xn2;
+      pState[(4u * ch) + 2u] = Yn1;
+      pState[(4u * ch) + 3u] = Yn2;
+
+      ch++;
+    }
+
+    /* Coefficients and state variables of the next stage */
+    pCoeffs += 5u;
+    pState += 4u * numChannels;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeMultichannel group
+ */
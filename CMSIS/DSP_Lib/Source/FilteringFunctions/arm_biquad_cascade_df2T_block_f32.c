@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_block_f32.c
+*
+* Description:	Processing function for the floating-point block
+*               state-space transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+/*
+ * SSE4.1 kernel of arm_biquad_cascade_df2T_block_f32(): blkCnt blocks of 4
+ * samples of one stage.  The low vector holds the 4 outputs of a block and the
+ * high vector the state variables after the block.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_biquad_cascade_df2T_block_f32_sse41(
+  const float32_t * pK,
+  float32_t * pState,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blkCnt)
+{
+  __m128 d1 = _mm_set1_ps(pState[0]);            /* State variables */
+  __m128 d2 = _mm_set1_ps(pState[1]);
+  __m128 x;                                      /* Broadcast input */
+  __m128 accLo, accHi;                           /* Outputs and next state variables */
+
+  while(blkCnt > 0u)
+  {
+    x = _mm_set1_ps(pIn[0]);
+    accLo = _mm_mul_ps(x, _mm_loadu_ps(pK));
+    accHi = _mm_mul_ps(x, _mm_loadu_ps(pK + 4));
+
+    x = _mm_set1_ps(pIn[1]);
+    accLo = _mm_add_ps(accLo, _mm_mul_ps(x, _mm_loadu_ps(pK + 8)));
+    accHi = _mm_add_ps(accHi, _mm_mul_ps(x, _mm_loadu_ps(pK + 12)));
+
+    x = _mm_set1_ps(pIn[2]);
+    accLo = _mm_add_ps(accLo, _mm_mul_ps(x, _mm_loadu_ps(pK + 16)));
+    accHi = _mm_add_ps(accHi, _mm_mul_ps(x, _mm_loadu_ps(pK + 20)));
+
+    x = _mm_set1_ps(pIn[3]);
+    accLo = _mm_add_ps(accLo, _mm_mul_ps(x, _mm_loadu_ps(pK + 24)));
+    accHi = _mm_add_ps(accHi, _mm_mul_ps(x, _mm_loadu_ps(pK + 28)));
+
+    accLo = _mm_add_ps(accLo, _mm_mul_ps(d1, _mm_loadu_ps(pK + 32)));
+    accHi = _mm_add_ps(accHi, _mm_mul_ps(d1, _mm_loadu_ps(pK + 36)));
+
+    accLo = _mm_add_ps(accLo, _mm_mul_ps(d2, _mm_loadu_ps(pK + 40)));
+    accHi = _mm_add_ps(accHi, _mm_mul_ps(d2, _mm_loadu_ps(pK + 44)));
+
+    _mm_storeu_ps(pOut, accLo);
+
+    d1 = _mm_shuffle_ps(accHi, accHi, 0x00);
+    d2 = _mm_shuffle_ps(accHi, accHi, 0x55);
+
+    pIn += 4u;
+    pOut += 4u;
+
+    blkCnt--;
+  }
+
+  pState[0] = _mm_cvtss_f32(d1);
+  pState[1] = _mm_cvtss_f32(d2);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point block state-space transposed direct form II Biquad cascade filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * This function computes the same filter as arm_biquad_cascade_df2T_f32() for a single channel
+ * without its sample by sample dependency.  Over a block of 4 samples, the outputs
+ * <code>y[n]</code> to <code>y[n+3]</code> and the state variables after the block are linear
+ * combinations of the inputs <code>x[n]</code> to <code>x[n+3]</code> and of the state variables
+ * before the block:
+ * <pre>
+ *    {y[n], ..., y[n+3], d1', d2'} = x[n] * K0 + x[n+1] * K1 + x[n+2] * K2 + x[n+3] * K3 + d1 * K4 + d2 * K5
+ * </pre>
+ * where <code>K0</code> to <code>K5</code> are the rows of the block coefficients computed by
+ * arm_biquad_cascade_df2T_block_init_f32().  The 4 outputs are independent of each other and
+ * only the state update carries from one block to the next, which suits processors
+ * with SIMD units and deep pipelines.  Each block costs 36 multiply-accumulates against 20 for
+ * four samples of the recursion.
+ * \par
+ * The remaining <code>blockSize % 4</code> samples are computed with the recursion.
+ * The results differ from those of arm_biquad_cascade_df2T_f32() by rounding only.
+ * The state array has the layout of arm_biquad_cascade_df2T_f32(), so that an instance
+ * can switch between both functions.
+ */
+
+void arm_biquad_cascade_df2T_block_f32(
+  const arm_biquad_cascade_df2T_block_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut = pDst;                        /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *pK = S->pBlockCoeffs;               /*  block coefficient pointer */
+  float32_t acc0, acc1;                          /*  Simulates the accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn, Xn1, Xn2, Xn3;                   /*  temporary inputs          */
+  float32_t d1, d2;                              /*  state variables           */
+  uint32_t blkCnt, sample, stage = S->numStages; /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Blocks of 4 samples */
+    blkCnt = blockSize >> 2u;
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+    /* Run the below code on x86 hosts */
+    if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+    {
+      arm_biquad_cascade_df2T_block_f32_sse41(pK, pState, pIn, pOut, blkCnt);
+
+      pIn += 4u * blkCnt;
+      pOut += 4u * blkCnt;
+      blkCnt = 0u;
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+    /*Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    while(blkCnt > 0u)
+    {
+      /* Read the four inputs */
+      Xn = pIn[0];
+      Xn1 = pIn[1];
+      Xn2 = pIn[2];
+      Xn3 = pIn[3];
+
+      /* y[n + k] = x[n] * K0[k] + x[n+1] * K1[k] + x[n+2] * K2[k] + x[n+3] * K3[k] + d1 * K4[k] + d2 * K5[k] */
+      pOut[0] = (Xn * pK[0]) + (Xn1 * pK[8]) + (Xn2 * pK[16]) + (Xn3 * pK[24]) + (d1 * pK[32]) + (d2 * pK[40]);
+      pOut[1] = (Xn * pK[1]) + (Xn1 * pK[9]) + (Xn2 * pK[17]) + (Xn3 * pK[25]) + (d1 * pK[33]) + (d2 * pK[41]);
+      pOut[2] = (Xn * pK[2]) + (Xn1 * pK[10]) + (Xn2 * pK[18]) + (Xn3 * pK[26]) + (d1 * pK[34]) + (d2 * pK[42]);
+      pOut[3] = (Xn * pK[3]) + (Xn1 * pK[11]) + (Xn2 * pK[19]) + (Xn3 * pK[27]) + (d1 * pK[35]) + (d2 * pK[43]);
+
+      /* State variables after the block */
+      acc0 = (Xn * pK[4]) + (Xn1 * pK[12]) + (Xn2 * pK[20]) + (Xn3 * pK[28]) + (d1 * pK[36]) + (d2 * pK[44]);
+      acc1 = (Xn * pK[5]) + (Xn1 * pK[13]) + (Xn2 * pK[21]) + (Xn3 * pK[29]) + (d1 * pK[37]) + (d2 * pK[45]);
+
+      d1 = acc0;
+      d2 = acc1;
+
+      pIn += 4u;
+      pOut += 4u;
+
+      /* decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 samples with the recursion */
+    sample = blockSize & 0x3u;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc0 = (b0 * Xn) + d1;
+
+      /* Store the result in the accumulator in the destination buffer. */
+      *pOut++ = acc0;
+
+      /* Every time after the output is computed state should be updated. */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (b2 * Xn) + (a2 * acc0);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* Block coefficients of the next stage */
+    pK += 48u;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /*Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
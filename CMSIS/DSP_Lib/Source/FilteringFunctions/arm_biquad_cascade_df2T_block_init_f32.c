@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_block_init_f32.c
+*
+* Description:	Initialization function for the floating-point block
+*               state-space transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point block state-space transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S             points to an instance of the filter data structure.
+ * @param[in]     numStages      number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs       points to the filter coefficients.
+ * @param[out]    *pBlockCoeffs  points to the block coefficients computed from pCoeffs.
+ * @param[in]     *pState        points to the state buffer.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * <code>pCoeffs</code> and <code>pState</code> are ordered as for arm_biquad_cascade_df2T_init_f32().
+ * <code>pBlockCoeffs</code> is an array of <code>48*numStages</code> values filled by this function.
+ * For every stage it holds 6 rows of 8 values, one row for each of the inputs
+ * <code>x[n]</code> to <code>x[n+3]</code> and for the state variables <code>d1</code> and <code>d2</code>.
+ * The row gives the contribution of that value to the outputs <code>y[n]</code> to <code>y[n+3]</code>
+ * and to the state variables after <code>x[n+3]</code>, followed by two zeros.
+ * The rows are computed in double precision by running the difference equation of the stage
+ * over 4 samples.
+ * \par
+ * <code>pBlockCoeffs</code> must be computed again when <code>pCoeffs</code> is changed.
+ */
+
+void arm_biquad_cascade_df2T_block_init_f32(
+  arm_biquad_cascade_df2T_block_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pBlockCoeffs,
+  float32_t * pState)
+{
+  float32_t *pK = pBlockCoeffs;                  /* Block coefficient pointer */
+  float64_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float64_t Xn, acc0, d1, d2;                    /* Input, output and state of the stage */
+  uint32_t stage, row, n;                        /* Loop counters */
+
+  for (stage = 0u; stage < numStages; stage++)
+  {
+    b0 = (float64_t) pCoeffs[(5u * stage) + 0u];
+    b1 = (float64_t) pCoeffs[(5u * stage) + 1u];
+    b2 = (float64_t) pCoeffs[(5u * stage) + 2u];
+    a1 = (float64_t) pCoeffs[(5u * stage) + 3u];
+    a2 = (float64_t) pCoeffs[(5u * stage) + 4u];
+
+    /* Response to a unit x[n + row] for rows 0 to 3, to a unit d1 and d2 for rows 4 and 5 */
+    for (row = 0u; row < 6u; row++)
+    {
+      d1 = (row == 4u) ? 1.0 : 0.0;
+      d2 = (row == 5u) ? 1.0 : 0.0;
+
+      for (n = 0u; n < 4u; n++)
+      {
+        Xn = (row == n) ? 1.0 : 0.0;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc0 = (b0 * Xn) + d1;
+
+        pK[n] = (float32_t) acc0;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc0);
+      }
+
+      pK[4] = (float32_t) d1;
+      pK[5] = (float32_t) d2;
+      pK[6] = 0.0f;
+      pK[7] = 0.0f;
+
+      pK += 8u;
+    }
+  }
+
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign coefficient pointers */
+  S->pCoeffs = pCoeffs;
+  S->pBlockCoeffs = pBlockCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages */
+  memset(pState, 0, (2u * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
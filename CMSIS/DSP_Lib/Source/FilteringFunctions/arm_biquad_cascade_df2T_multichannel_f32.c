@@ -0,0 +1,431 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_multichannel_f32.c
+*
+* Description:	Processing function for the floating-point multichannel
+*               transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_biquad_cascade_df2T_multichannel_f32(): one stage of
+ * sixteen channels, one channel per lane.  The two vectors hide the latency
+ * of the recursion of each other.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_biquad_cascade_df2T_multichannel_f32_avx2(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t numChannels,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  __m256 b0 = _mm256_set1_ps(pCoeffs[0]);        /* Filter coefficients */
+  __m256 b1 = _mm256_set1_ps(pCoeffs[1]);
+  __m256 b2 = _mm256_set1_ps(pCoeffs[2]);
+  __m256 a1 = _mm256_set1_ps(pCoeffs[3]);
+  __m256 a2 = _mm256_set1_ps(pCoeffs[4]);
+  __m256 d1 = _mm256_loadu_ps(pState);           /* State variables of channels 0 to 7 */
+  __m256 d2 = _mm256_loadu_ps(pState + numChannels);
+  __m256 d11 = _mm256_loadu_ps(pState + 8);      /* State variables of channels 8 to 15 */
+  __m256 d21 = _mm256_loadu_ps(pState + numChannels + 8);
+  __m256 Xn, Xn1, acc0, acc1;                    /* Input and output samples */
+  uint32_t sample = blockSize;                   /* Loop counter */
+
+  while(sample > 0u)
+  {
+    Xn = _mm256_loadu_ps(pIn);
+    Xn1 = _mm256_loadu_ps(pIn + 8);
+
+    /* y[n] = b0 * x[n] + d1 */
+    acc0 = _mm256_add_ps(_mm256_mul_ps(b0, Xn), d1);
+    acc1 = _mm256_add_ps(_mm256_mul_ps(b0, Xn1), d11);
+
+    _mm256_storeu_ps(pOut, acc0);
+    _mm256_storeu_ps(pOut + 8, acc1);
+
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    d1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b1, Xn), _mm256_mul_ps(a1, acc0)), d2);
+    d11 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b1, Xn1), _mm256_mul_ps(a1, acc1)), d21);
+
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    d2 = _mm256_add_ps(_mm256_mul_ps(b2, Xn), _mm256_mul_ps(a2, acc0));
+    d21 = _mm256_add_ps(_mm256_mul_ps(b2, Xn1), _mm256_mul_ps(a2, acc1));
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm256_storeu_ps(pState, d1);
+  _mm256_storeu_ps(pState + numChannels, d2);
+  _mm256_storeu_ps(pState + 8, d11);
+  _mm256_storeu_ps(pState + numChannels + 8, d21);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_biquad_cascade_df2T_multichannel_f32(): one stage of
+ * eight channels, one channel per lane.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_biquad_cascade_df2T_multichannel_f32_sse41(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t numChannels,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  __m128 b0 = _mm_set1_ps(pCoeffs[0]);           /* Filter coefficients */
+  __m128 b1 = _mm_set1_ps(pCoeffs[1]);
+  __m128 b2 = _mm_set1_ps(pCoeffs[2]);
+  __m128 a1 = _mm_set1_ps(pCoeffs[3]);
+  __m128 a2 = _mm_set1_ps(pCoeffs[4]);
+  __m128 d1 = _mm_loadu_ps(pState);              /* State variables of channels 0 to 3 */
+  __m128 d2 = _mm_loadu_ps(pState + numChannels);
+  __m128 d11 = _mm_loadu_ps(pState + 4);         /* State variables of channels 4 to 7 */
+  __m128 d21 = _mm_loadu_ps(pState + numChannels + 4);
+  __m128 Xn, Xn1, acc0, acc1;                    /* Input and output samples */
+  uint32_t sample = blockSize;                   /* Loop counter */
+
+  while(sample > 0u)
+  {
+    Xn = _mm_loadu_ps(pIn);
+    Xn1 = _mm_loadu_ps(pIn + 4);
+
+    /* y[n] = b0 * x[n] + d1 */
+    acc0 = _mm_add_ps(_mm_mul_ps(b0, Xn), d1);
+    acc1 = _mm_add_ps(_mm_mul_ps(b0, Xn1), d11);
+
+    _mm_storeu_ps(pOut, acc0);
+    _mm_storeu_ps(pOut + 4, acc1);
+
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    d1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b1, Xn), _mm_mul_ps(a1, acc0)), d2);
+    d11 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b1, Xn1), _mm_mul_ps(a1, acc1)), d21);
+
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    d2 = _mm_add_ps(_mm_mul_ps(b2, Xn), _mm_mul_ps(a2, acc0));
+    d21 = _mm_add_ps(_mm_mul_ps(b2, Xn1), _mm_mul_ps(a2, acc1));
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  _mm_storeu_ps(pState, d1);
+  _mm_storeu_ps(pState + numChannels, d2);
+  _mm_storeu_ps(pState + 4, d11);
+  _mm_storeu_ps(pState + numChannels + 4, d21);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadCascadeMultichannel Multichannel Biquad Cascade IIR Filters
+ *
+ * These functions filter several channels with one Biquad cascade.
+ * The recursion of a Biquad stage makes every output sample depend on the previous one,
+ * so that a single channel cannot be computed faster than the latency of a multiply
+ * and two additions per sample and stage.  The channels, on the other hand, are independent:
+ * the multichannel functions run one channel per register (or per SIMD lane on processors
+ * with vector units) and the same instructions compute a group of channels at a time.
+ * This suits stereo and surround equalizers and microphone arrays, where each channel
+ * goes through the same filter.
+ *
+ * \par
+ * The floating-point function uses the transposed direct form II and the Q15 and Q31
+ * functions the direct form I.  The result of each channel is the same as that of a separate
+ * Biquad cascade (see \ref BiquadCascadeDF2T and \ref BiquadCascadeDF1) running on that channel.
+ *
+ * \par Data layout:
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> samples of
+ * each of the <code>numChannels</code> channels, interleaved:
+ * <pre>
+ *    {x0[0], x1[0], ..., xC[0], x0[1], x1[1], ..., xC[blockSize-1]}
+ * </pre>
+ * The Q15 and Q31 functions also accept planar data, selected by the <code>planarFlag</code>
+ * of the instance, where the channels follow each other:
+ * <pre>
+ *    {x0[0], x0[1], ..., x0[blockSize-1], x1[0], ..., xC[blockSize-1]}
+ * </pre>
+ * \par
+ * <code>pCoeffs</code> points to the coefficients of the single channel filter,
+ * in the order of \ref BiquadCascadeDF2T or \ref BiquadCascadeDF1.
+ * \par
+ * For the floating-point function, <code>pState</code> points to a state array of size <code>2*numStages*numChannels</code>.
+ * The state variables of a stage are stored with the channels adjacent:
+ * <pre>
+ *     {d11[0], d11[1], ..., d11[C], d12[0], ..., d12[C], d21[0], ...}
+ * </pre>
+ * where <code>d1x[c]</code> refers to the state variables of the first Biquad for channel <code>c</code>.
+ * The Q15 and Q31 functions use a state array of size <code>4*numStages*numChannels</code>
+ * that holds the state of each channel in the order of \ref BiquadCascadeDF1.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each group of channels.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ *
+ * \par Init Functions
+ * There is also an associated initialization function.
+ * The initialization function performs following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ *
+ * \par
+ * Use of the initialization function is optional.
+ * However, if the initialization function is used, then the instance structure cannot be placed into a const data section.
+ * To place an instance structure into a const data section, the instance structure must be manually initialized.
+ * Set the values in the state buffer to zeros before static initialization.
+ * For example, to statically initialize the instance structure use
+ * <pre>
+ *     arm_biquad_cascade_df2T_multichannel_instance_f32 S1 = {numStages, numChannels, pState, pCoeffs};
+ *     arm_biquad_cascade_df1_multichannel_instance_q15 S2 = {numStages, numChannels, planarFlag, pState, pCoeffs, postShift};
+ *     arm_biquad_cascade_df1_multichannel_instance_q31 S3 = {numStages, numChannels, planarFlag, pState, pCoeffs, postShift};
+ * </pre>
+ */
+
+/**
+ * @addtogroup BiquadCascadeMultichannel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+ * @param[in]  *S        points to an instance of the filter data structure.
+ * @param[in]  *pSrc     points to the block of interleaved input data.
+ * @param[out] *pDst     points to the block of interleaved output data.
+ * @param[in]  blockSize number of samples per channel to process.
+ * @return none.
+ */
+
+void arm_biquad_cascade_df2T_multichannel_f32(
+  const arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *px, *py;                            /*  input and output pointers of a channel */
+  float32_t acc0;                                /*  Simulates the accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn;                                  /*  temporary input           */
+  float32_t d1, d2;                              /*  state variables           */
+  uint32_t numChannels = S->numChannels;         /*  Number of channels        */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                    /*  Accumulators of channels 1 to 3 of a group */
+  float32_t Xn1, Xn2, Xn3;                       /*  Inputs of channels 1 to 3 of a group */
+  float32_t d11, d12, d13, d21, d22, d23;        /*  State variables of channels 1 to 3 of a group */
+  uint32_t chCnt;                                /*  loop counter              */
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    ch = 0u;
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+    /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+    if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+    {
+      for (; (ch + 16u) <= numChannels; ch += 16u)
+      {
+        arm_biquad_cascade_df2T_multichannel_f32_avx2(pCoeffs, pState + ch, numChannels,
+                                                      pIn + ch, pDst + ch, blockSize);
+      }
+    }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+    if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+    {
+      for (; (ch + 8u) <= numChannels; ch += 8u)
+      {
+        arm_biquad_cascade_df2T_multichannel_f32_sse41(pCoeffs, pState + ch, numChannels,
+                                                       pIn + ch, pDst + ch, blockSize);
+      }
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Filter four channels at a time: the coefficients are loaded once
+     ** and used for the four channels */
+    chCnt = (numChannels - ch) >> 2u;
+
+    while(chCnt > 0u)
+    {
+      /* Reading the state values of the four channels */
+      d1 = pState[ch];
+      d11 = pState[ch + 1u];
+      d12 = pState[ch + 2u];
+      d13 = pState[ch + 3u];
+      d2 = pState[numChannels + ch];
+      d21 = pState[numChannels + ch + 1u];
+      d22 = pState[numChannels + ch + 2u];
+      d23 = pState[numChannels + ch + 3u];
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs of the four channels */
+        Xn = px[0];
+        Xn1 = px[1];
+        Xn2 = px[2];
+        Xn3 = px[3];
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc0 = (b0 * Xn) + d1;
+        acc1 = (b0 * Xn1) + d11;
+        acc2 = (b0 * Xn2) + d12;
+        acc3 = (b0 * Xn3) + d13;
+
+        /* Store the results in the destination buffer. */
+        py[0] = acc0;
+        py[1] = acc1;
+        py[2] = acc2;
+        py[3] = acc3;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+        d11 = ((b1 * Xn1) + (a1 * acc1)) + d21;
+        d12 = ((b1 * Xn2) + (a1 * acc2)) + d22;
+        d13 = ((b1 * Xn3) + (a1 * acc3)) + d23;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc0);
+        d21 = (b2 * Xn1) + (a2 * acc1);
+        d22 = (b2 * Xn2) + (a2 * acc2);
+        d23 = (b2 * Xn3) + (a2 * acc3);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch] = d1;
+      pState[ch + 1u] = d11;
+      pState[ch + 2u] = d12;
+      pState[ch + 3u] = d13;
+      pState[numChannels + ch] = d2;
+      pState[numChannels + ch + 1u] = d21;
+      pState[numChannels + ch + 2u] = d22;
+      pState[numChannels + ch + 3u] = d23;
+
+      ch += 4u;
+
+      /* decrement the loop counter */
+      chCnt--;
+    }
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    /* Remaining channels, and all channels on Cortex-M0 */
+    while(ch < numChannels)
+    {
+      /*Reading the state values */
+      d1 = pState[ch];
+      d2 = pState[numChannels + ch];
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc0 = (b0 * Xn) + d1;
+
+        /* Store the result in the accumulator in the destination buffer. */
+        *py = acc0;
+
+        /* Every time after the output is computed state should be updated. */
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc0);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch] = d1;
+      pState[numChannels + ch] = d2;
+
+      ch++;
+    }
+
+    /* Coefficients and state variables of the next stage */
+    pCoeffs += 5u;
+    pState += 2u * numChannels;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeMultichannel group
+ */
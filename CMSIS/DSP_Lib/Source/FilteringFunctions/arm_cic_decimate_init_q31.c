@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_decimate_init_q31.c
+*
+* Description:	Q31 CIC decimator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC_Decimate
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CIC decimator.
+ * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     numStages   number of integrator and comb stages.
+ * @param[in]     R           decimation factor.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+ * <code>blockSize</code> is not a multiple of <code>R</code>, or ARM_MATH_ARGUMENT_ERROR if the gain
+ * <code>R^numStages</code> exceeds 2^32.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*numStages</code> 64-bit words.
+ */
+
+arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t R,
+  q63_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint64_t gain = 1u;                            /* R^numStages */
+  uint32_t shift = 0u;                           /* ceil(log2(gain)) */
+  uint32_t k;                                    /* Loop counter */
+
+  if((numStages == 0u) || (R == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if((blockSize % R) != 0u)
+  {
+    /* Set status as ARM_MATH_LENGTH_ERROR */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Gain of the filter.  It must not exceed 2^32 for the result to fit in the 64-bit state */
+    for (k = 0u; (k < numStages) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      gain *= R;
+
+      if(gain > ((uint64_t) 1u << 32u))
+      {
+        status = ARM_MATH_ARGUMENT_ERROR;
+      }
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /* Smallest shift for which 2^shift >= gain */
+    while(((uint64_t) 1u << shift) < gain)
+    {
+      shift++;
+    }
+
+    S->numStages = numStages;
+    S->R = R;
+    S->postShift = (uint8_t) shift;
+
+    /* Clear the integrators and the comb delays */
+    memset(pState, 0, 2u * (uint32_t) numStages * sizeof(q63_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CIC_Decimate group
+ */
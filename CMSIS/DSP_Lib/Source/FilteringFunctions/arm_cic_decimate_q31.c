@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_decimate_q31.c
+*
+* Description:	Q31 CIC decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CIC_Decimate Cascaded Integrator-Comb (CIC) Decimator
+ *
+ * A CIC decimator is a moving average filter of length <code>R</code>, applied
+ * <code>numStages</code> times, followed by decimation by <code>R</code>.
+ * It is computed without any multiplication: <code>numStages</code> integrators
+ * run at the input rate and <code>numStages</code> combs run at the output rate.
+ * This makes it a cheap first stage for large decimation factors, ahead of
+ * FIR decimators that run at the lower rate (see \ref FIR_Multistage_Decimate).
+ *
+ * \par Algorithm
+ * The transfer function is
+ * <pre>
+ *    H(z) = ((1 - z^-R) / (1 - z^-1))^numStages
+ * </pre>
+ * and its frequency response, with f relative to the input sample rate, is
+ * <pre>
+ *    |H(f)| = |sin(pi*f*R) / sin(pi*f)|^numStages
+ * </pre>
+ * The gain at DC is <code>R^numStages</code>.  The output is shifted right by
+ * <code>postShift = ceil(log2(R^numStages))</code> bits, so the DC gain is 1 when
+ * <code>R</code> is a power of 2 and between 0.5 and 1 otherwise.
+ * \par
+ * The response droops within the passband.  The droop is usually compensated
+ * by the last FIR stage, which is designed with the inverse response in the passband.
+ * \par
+ * <code>blockSize</code> must be a multiple of <code>R</code>.
+ *
+ * \par Instance Structure
+ * The state variables for a filter are stored in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * <code>pState</code> points to an array of <code>2*numStages</code> 64-bit values:
+ * the integrators followed by the comb delays.
+ *
+ * \par Initialization Function
+ * The initialization function sets the values of the internal structure fields,
+ * computes <code>postShift</code> and zeros out the values in the state buffer.
+ * It checks that <code>blockSize</code> is a multiple of <code>R</code> and that
+ * the gain <code>R^numStages</code> does not exceed 2^32.
+ *
+ * \par Fixed-Point Behavior
+ * The integrators and combs use 64-bit modulo arithmetic.  The integrators
+ * overflow and wrap around in normal operation; the combs undo the wrap around
+ * exactly because the final result, at most 31+32 bits, fits in 64 bits.
+ * The result is truncated by the post shift and is never saturated.
+ */
+
+/**
+ * @addtogroup CIC_Decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 CIC decimator.
+ * @param[in]  *S          points to an instance of the Q31 CIC decimator structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data, of length <code>blockSize/R</code>.
+ * @param[in]  blockSize   number of input samples to process per call, a multiple of <code>R</code>.
+ * @return     none.
+ */
+
+void arm_cic_decimate_q31(
+  const arm_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint64_t *pInteg = (uint64_t *) S->pState;     /* Integrators */
+  uint64_t *pComb = pInteg + S->numStages;       /* Comb delays */
+  uint64_t acc, prev;                            /* Stage values */
+  uint32_t numStages = S->numStages;             /* Number of stages */
+  uint32_t R = S->R;                             /* Decimation factor */
+  uint32_t blkCnt, i, k;                         /* Loop counters */
+
+  /* Number of output samples */
+  blkCnt = blockSize / R;
+
+  while(blkCnt > 0u)
+  {
+    /* Integrators, at the input rate.  R is at least 1, so acc is always set */
+    i = R;
+
+    do
+    {
+      acc = (uint64_t) (q63_t) *pSrc++;
+
+      for (k = 0u; k < numStages; k++)
+      {
+        acc += pInteg[k];
+        pInteg[k] = acc;
+      }
+
+      i--;
+    } while(i > 0u);
+
+    /* Combs, at the output rate: y = x - x[n-1] */
+    for (k = 0u; k < numStages; k++)
+    {
+      prev = pComb[k];
+      pComb[k] = acc;
+      acc -= prev;
+    }
+
+    /* Normalize the gain and store the result in the destination buffer */
+    *pDst++ = (q31_t) (((q63_t) acc) >> S->postShift);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CIC_Decimate group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_conv_fft_f32.c
+*
+* Description:	Convolution of floating-point sequences using partitioned fast convolution.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv
+ * @{
+ */
+
+/**
+ * @brief Convolution of floating-point sequences using partitioned fast convolution.
+ * @param[in]  *pSrcA    points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  *pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] *pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  partSize  partition length, any power of two from 16 to 2048.
+ * @param[in]  *pScratch points to scratch buffer of size <code>2*partSize*(2*numParts+3)</code>,
+ *                       where <code>numParts = ceil(min(srcALen, srcBLen)/partSize)</code>.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>partSize</code>
+ * is not a supported value or the shorter sequence is longer than 65535 samples.
+ *
+ * \par
+ * The result is the same as that of arm_conv_f32(), up to rounding, but it is
+ * computed with the FFT-based filter of arm_fir_fft_f32(): the shorter sequence
+ * is the impulse response and the longer sequence, followed by zeros, is filtered.
+ * The cost grows with <code>(srcALen+srcBLen)*log2(partSize)</code> plus
+ * <code>(srcALen+srcBLen)*min(srcALen, srcBLen)/partSize</code> instead of
+ * <code>srcALen*srcBLen</code>.  A partition length close to the length of the
+ * shorter sequence is usually the fastest choice.
+ */
+
+arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint16_t partSize,
+  float32_t * pScratch)
+{
+  arm_fir_fft_instance_f32 S;                    /* FFT-based FIR filter instance */
+  float32_t *pIn1, *pIn2;                        /* Longer and shorter input sequences */
+  float32_t *pState, *pBuf;                      /* State and block buffers */
+  float32_t *pOut = pDst;                        /* Output pointer */
+  uint32_t srcLen1, srcLen2;                     /* Lengths of the longer and shorter sequences */
+  uint32_t numParts, fftLen;                     /* Partitions of the shorter sequence, FFT length */
+  uint32_t outLen, inCnt, outCnt, i;             /* Sample counters */
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;   /* Status of the function */
+
+  /* The shorter sequence is the impulse response of the filter */
+  if(srcALen >= srcBLen)
+  {
+    pIn1 = pSrcA;
+    pIn2 = pSrcB;
+    srcLen1 = srcALen;
+    srcLen2 = srcBLen;
+  }
+  else
+  {
+    pIn1 = pSrcB;
+    pIn2 = pSrcA;
+    srcLen1 = srcBLen;
+    srcLen2 = srcALen;
+  }
+
+  if((srcLen2 == 0u) || (srcLen2 > 0xFFFFu) || (partSize == 0u))
+  {
+    return (status);
+  }
+
+  fftLen = 2u * (uint32_t) partSize;
+  numParts = (srcLen2 + partSize - 1u) / partSize;
+
+  /* Scratch layout: coefficient spectra followed by the filter state */
+  pState = pScratch + (fftLen * numParts);
+
+  /* The filter coefficients are in time reversed order.  They are placed at
+   ** the start of the state buffer, which the initialization only clears after
+   ** the coefficient spectra are computed */
+  for (i = 0u; i < srcLen2; i++)
+  {
+    pState[i] = pIn2[(srcLen2 - 1u) - i];
+  }
+
+  status = arm_fir_fft_init_f32(&S, (uint16_t) srcLen2, pState, pScratch, pState, partSize);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /* The last block buffer of the filter state is free between calls and
+     ** holds the zero padded blocks at the end of the input */
+    pBuf = pState + (fftLen * (numParts + 2u));
+
+    outLen = (srcLen1 + srcLen2) - 1u;
+    inCnt = srcLen1;
+    outCnt = outLen;
+
+    /* Whole blocks of the input are filtered directly.  The output is never
+     ** shorter than the input, so their results fit into pDst */
+    i = inCnt - (inCnt % partSize);
+
+    arm_fir_fft_f32(&S, pIn1, pOut, i);
+
+    pIn1 += i;
+    pOut += i;
+    inCnt -= i;
+    outCnt -= i;
+
+    /* Remaining blocks, with the end of the input and zeros */
+    while(outCnt > 0u)
+    {
+      i = (inCnt < partSize) ? inCnt : partSize;
+
+      arm_copy_f32(pIn1, pBuf, i);
+      arm_fill_f32(0.0f, pBuf + i, partSize - i);
+
+      pIn1 += i;
+      inCnt -= i;
+
+      arm_fir_fft_f32(&S, pBuf, pBuf, partSize);
+
+      i = (outCnt < partSize) ? outCnt : partSize;
+
+      arm_copy_f32(pBuf, pOut, i);
+
+      pOut += i;
+      outCnt -= i;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Conv group
+ */
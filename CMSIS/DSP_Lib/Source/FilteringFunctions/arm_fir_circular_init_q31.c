@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circular_init_q31.c
+*
+* Description:	Q31 FIR filter initialization function with a circular state buffer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @param[in,out] *S points to an instance of the Q31 circular FIR filter structure.
+ * @param[in] 	  numTaps  Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in] 	  blockSize maximum number of samples that are processed per call.
+ * @return The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps+blockSize-1</code> exceeds 65535.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> samples, where <code>blockSize</code> is the
+ * largest number of input samples processed by a call to <code>arm_fir_circular_q31()</code>.
+ * The buffer holds two copies of the delay line, and <code>numTaps+blockSize-1</code> must not exceed 65535.
+ */
+
+arm_status arm_fir_circular_init_q31(
+  arm_fir_circular_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /* The length of the delay line is stored in 16 bits */
+  if(blockSize > (65536u - numTaps))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Length of the delay line.  The oldest sample is at the start */
+    S->stateLength = (uint16_t) (numTaps + (blockSize - 1u));
+    S->stateIndex = 0u;
+
+    /* Clear both copies of the delay line */
+    memset(pState, 0, 2u * (uint32_t) S->stateLength * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR group
+ */
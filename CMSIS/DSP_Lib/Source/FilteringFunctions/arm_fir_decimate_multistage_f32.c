@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_decimate_multistage_f32.c
+*
+* Description:	Floating-point multistage decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multistage_Decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multistage decimator.
+ * @param[in]  *S          points to an instance of the floating-point multistage decimator structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data.
+ * @param[in]  blockSize   number of input samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The output has <code>blockSize</code> divided by the overall decimation factor samples.
+ */
+
+void arm_fir_decimate_multistage_f32(
+  const arm_fir_decimate_multistage_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Input of the current stage */
+  float32_t *pOut;                               /* Output of the current stage */
+  float32_t *pBuf1, *pBuf2;                      /* Intermediate buffers */
+  uint32_t numStages = S->numStages;             /* Number of FIR stages */
+  uint32_t blkCnt = blockSize;                   /* Input length of the current stage */
+  uint32_t stage;                                /* Loop counter */
+
+  /* The first stage writes to the start of the scratch buffer, the second stage after it */
+  pBuf1 = S->pScratch;
+  pBuf2 = pBuf1 + (blkCnt / S->pStages[0].M);
+
+  for (stage = 0u; stage < numStages; stage++)
+  {
+    /* The last stage writes to the destination, the others alternate between the two buffers */
+    pOut = (stage == (numStages - 1u)) ? pDst : pBuf1;
+
+    arm_fir_decimate_f32(&S->pStages[stage], pIn, pOut, blkCnt);
+
+    blkCnt = blkCnt / S->pStages[stage].M;
+
+    pIn = pOut;
+    pBuf1 = pBuf2;
+    pBuf2 = pOut;
+  }
+}
+
+/**
+ * @} end of FIR_Multistage_Decimate group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_decimate_multistage_init_f32.c
+*
+* Description:	Floating-point multistage decimator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multistage_Decimate
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point multistage decimator.
+ * @param[in,out] *S          points to an instance of the floating-point multistage decimator structure.
+ * @param[in]     numStages   number of FIR decimator stages.
+ * @param[in]     *pStages    points to the array of <code>numStages</code> initialized FIR decimators.
+ * @param[in]     *pScratch   points to the scratch buffer.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+ * <code>blockSize</code> is not a multiple of the overall decimation factor, or ARM_MATH_ARGUMENT_ERROR
+ * if there is no stage at all.
+ *
+ * <b>Description:</b>
+ * \par
+ * FIR stage <code>i</code> must have been initialized with a block size of
+ * <code>blockSize</code> divided by the decimation factors of the stages
+ * <code>0</code> to <code>i-1</code>.
+ * The instances are referenced, not copied.
+ */
+
+arm_status arm_fir_decimate_multistage_init_f32(
+  arm_fir_decimate_multistage_instance_f32 * S,
+  uint8_t numStages,
+  const arm_fir_decimate_instance_f32 * pStages,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t blkCnt = blockSize;                   /* Input length of the current stage */
+  uint32_t stage;                                /* Loop counter */
+
+  if(numStages == 0u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Every stage must get a multiple of its decimation factor */
+    for (stage = 0u; stage < numStages; stage++)
+    {
+      if((blkCnt % pStages[stage].M) != 0u)
+      {
+        status = ARM_MATH_LENGTH_ERROR;
+      }
+
+      blkCnt = blkCnt / pStages[stage].M;
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    S->numStages = numStages;
+    S->pStages = pStages;
+    S->pScratch = pScratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Multistage_Decimate group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_decimate_multistage_q31.c
+*
+* Description:	Q31 multistage decimator processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Multistage_Decimate Multistage Decimator
+ *
+ * These functions decimate by a large factor with a cascade of decimators.
+ * A single FIR decimator by <code>M</code> needs a transition band of width
+ * about <code>1/M</code> of its input rate, so its length, and its cost per output
+ * sample, grow in proportion to <code>M</code>.  In a cascade the early stages
+ * run at high rates but only have to reject the bands that alias into the final
+ * passband, so they are short; the sharp filter runs last, at a low rate.
+ *
+ * \par
+ * The Q31 cascade may start with a CIC decimator (see \ref CIC_Decimate), which
+ * uses no multiplications at all.  The floating-point cascade only has FIR stages.
+ * Each FIR stage is an ordinary FIR decimator instance (see \ref FIR_decimate),
+ * initialized with the block size it sees: <code>blockSize</code> divided by the
+ * decimation factors of the stages before it.
+ *
+ * \par
+ * arm_fir_decimate_plan_f32() chooses the decimation factors of the stages and
+ * estimates their lengths, so that the number of multiply-accumulates per output
+ * sample is as low as possible.
+ *
+ * \par Scratch Buffer
+ * The outputs of the intermediate stages are kept in <code>pScratch</code>.
+ * With <code>D1</code> and <code>D2</code> the decimation factors of the first two
+ * stages, CIC front end included, the scratch buffer is of length
+ * <code>blockSize/D1 + blockSize/(D1*D2)</code>.
+ *
+ * \par Initialization Functions
+ * The initialization functions set the values of the internal structure fields
+ * and check that <code>blockSize</code> is a multiple of the overall decimation factor.
+ */
+
+/**
+ * @addtogroup FIR_Multistage_Decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 multistage decimator.
+ * @param[in]  *S          points to an instance of the Q31 multistage decimator structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data.
+ * @param[in]  blockSize   number of input samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The output has <code>blockSize</code> divided by the overall decimation factor samples.
+ */
+
+void arm_fir_decimate_multistage_q31(
+  const arm_fir_decimate_multistage_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /* Input of the current stage */
+  q31_t *pOut;                                   /* Output of the current stage */
+  q31_t *pBuf1, *pBuf2;                          /* Intermediate buffers */
+  uint32_t numStages = S->numStages;             /* Number of FIR stages */
+  uint32_t blkCnt = blockSize;                   /* Input length of the current stage */
+  uint32_t stage;                                /* Loop counter */
+
+  /* The output of the first stage is at the start of the scratch buffer */
+  pBuf1 = S->pScratch;
+
+  if(S->pCic != NULL)
+  {
+    blkCnt = blockSize / S->pCic->R;
+
+    /* A CIC decimator alone writes directly to the destination */
+    pOut = (numStages == 0u) ? pDst : pBuf1;
+
+    arm_cic_decimate_q31(S->pCic, pIn, pOut, blockSize);
+
+    pIn = pOut;
+    pBuf2 = pBuf1;
+    pBuf1 = pBuf1 + blkCnt;
+  }
+  else
+  {
+    pBuf2 = pBuf1 + (blkCnt / S->pStages[0].M);
+  }
+
+  for (stage = 0u; stage < numStages; stage++)
+  {
+    /* The last stage writes to the destination, the others alternate between the two buffers */
+    pOut = (stage == (numStages - 1u)) ? pDst : pBuf1;
+
+    arm_fir_decimate_q31(&S->pStages[stage], pIn, pOut, blkCnt);
+
+    blkCnt = blkCnt / S->pStages[stage].M;
+
+    pIn = pOut;
+    pBuf1 = pBuf2;
+    pBuf2 = pOut;
+  }
+}
+
+/**
+ * @} end of FIR_Multistage_Decimate group
+ */
@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_decimate_plan_f32.c
+*
+* Description:	Stage factor planner for multistage decimators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multistage_Decimate
+ * @{
+ */
+
+/* Largest number of divisors of the FIR decimation factor that are searched */
+#define ARM_DECIMATE_PLAN_MAX_DIVISORS   64u
+
+/*
+ * @brief  Attenuation of a CIC decimator, in dB.
+ * @param[in]  f          frequency, relative to the input sample rate.
+ * @param[in]  R          decimation factor.
+ * @param[in]  numStages  number of stages.
+ * @return attenuation relative to the gain at DC.
+ */
+
+static float32_t arm_cic_attenuation_f32(
+  float32_t f,
+  uint32_t R,
+  uint32_t numStages)
+{
+  float32_t num = sinf(PI * f * (float32_t) R);
+  float32_t den = (float32_t) R * sinf(PI * f);
+
+  return -20.0f * (float32_t) numStages * log10f(fabsf(num / den) + 1.0e-30f);
+}
+
+/*
+ * @brief  Gain limit of arm_cic_decimate_init_q31().
+ * @param[in]  R          decimation factor.
+ * @param[in]  numStages  number of stages.
+ * @return 1 if the gain R^numStages does not exceed 2^32, 0 otherwise.
+ */
+
+static uint32_t arm_cic_gain_fits(
+  uint32_t R,
+  uint32_t numStages)
+{
+  uint64_t gain = 1u;                            /* Gain of the CIC filter */
+  uint32_t k;                                    /* Loop counter */
+
+  for (k = 0u; k < numStages; k++)
+  {
+    gain *= R;
+
+    if(gain > ((uint64_t) 1u << 32u))
+    {
+      return (0u);
+    }
+  }
+
+  return (1u);
+}
+
+/*
+ * @brief  Estimated cost of a cascade of FIR decimators.
+ * @param[in]  *pFactors   decimation factors of the stages, first stage first.
+ * @param[in]  numStages   number of stages.
+ * @param[in]  M           product of the decimation factors.
+ * @param[in]  passband    passband edge, relative to the output sample rate.
+ * @param[in]  attenuation stopband attenuation in dB.
+ * @param[out] *pTaps      estimated number of taps of each stage.
+ * @return multiply-accumulates per output sample, or a negative value if a stage is too long.
+ *
+ * Stage i only has to remove the bands that alias into the final passband,
+ * so its stopband starts at its output rate minus the passband edge.
+ * The lengths are estimated with the formula of Kaiser.
+ */
+
+static float32_t arm_fir_decimate_plan_cost_f32(
+  const uint32_t * pFactors,
+  uint32_t numStages,
+  uint32_t M,
+  float32_t passband,
+  float32_t attenuation,
+  uint16_t * pTaps)
+{
+  float32_t rateIn = (float32_t) M;              /* Input rate of the stage, in units of the output rate */
+  float32_t rateOut;                             /* Output rate of the stage */
+  float32_t transition;                          /* Transition band, relative to the input rate */
+  float32_t taps;                                /* Estimated number of taps */
+  float32_t cost = 0.0f;                         /* Multiply-accumulates per output sample */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0u; i < numStages; i++)
+  {
+    rateOut = rateIn / (float32_t) pFactors[i];
+
+    transition = ((rateOut - passband) - passband) / rateIn;
+
+    taps = ceilf((attenuation - 7.95f) / (14.36f * transition)) + 1.0f;
+
+    if(taps > 65535.0f)
+    {
+      return (-1.0f);
+    }
+
+    pTaps[i] = (uint16_t) taps;
+
+    /* The stage computes rateOut outputs per output sample of the cascade */
+    cost += taps * rateOut;
+
+    rateIn = rateOut;
+  }
+
+  return (cost);
+}
+
+/**
+ * @brief  Chooses the stage factors of a multistage decimator.
+ * @param[out] *pPlan        points to the plan.
+ * @param[in]  M             overall decimation factor.
+ * @param[in]  maxStages     largest number of FIR stages, at most ARM_DECIMATE_PLAN_MAX_STAGES.
+ * @param[in]  cicStages     number of stages of the CIC front end, 0 for none.
+ * @param[in]  passband      passband edge, as a fraction of the output sample rate, below 0.5.
+ * @param[in]  attenuation   stopband attenuation in dB.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range
+ * or no plan fits the limits of the FIR decimators.
+ *
+ * \par
+ * The function searches all the ways of writing <code>M</code> as the product of a
+ * CIC decimation factor and of up to <code>maxStages</code> FIR decimation factors,
+ * and returns the one with the fewest multiply-accumulates per output sample.
+ * The FIR factors are at most 255, the largest factor of arm_fir_decimate_init_f32().
+ * \par
+ * Every stage keeps the signal in the passband <code>[0, passband]</code> free of
+ * aliases attenuated by less than <code>attenuation</code> dB.  Aliases may fall into
+ * the transition band between <code>passband</code> and half the output sample rate.
+ * A CIC front end is used only if its own rejection of these aliases reaches
+ * <code>attenuation</code>; the multiply-free CIC then takes the largest such factor.
+ * The CIC factor also keeps the gain <code>R^cicStages</code> within the 2^32 limit of
+ * arm_cic_decimate_init_q31(), so that the front end of a plan can always be initialized.
+ * There is always at least one FIR stage, which should compensate the passband
+ * droop of the CIC front end reported in <code>cicDroop</code>.
+ * \par
+ * The numbers of taps are estimates for equiripple designs.  The coefficients
+ * themselves are designed with the usual filter design tools.
+ */
+
+arm_status arm_fir_decimate_plan_f32(
+  arm_fir_decimate_plan_instance * pPlan,
+  uint32_t M,
+  uint8_t maxStages,
+  uint8_t cicStages,
+  float32_t passband,
+  float32_t attenuation)
+{
+  uint32_t divisors[ARM_DECIMATE_PLAN_MAX_DIVISORS];     /* Divisors of the FIR decimation factor */
+  uint32_t index[ARM_DECIMATE_PLAN_MAX_STAGES];          /* Divisor of each stage but the last */
+  uint32_t factors[ARM_DECIMATE_PLAN_MAX_STAGES];        /* Decimation factors of the stages */
+  uint16_t taps[ARM_DECIMATE_PLAN_MAX_STAGES];           /* Estimated numbers of taps */
+  float32_t cost, bestCost = -1.0f;                      /* Multiply-accumulates per output sample */
+  uint32_t R, Mf, rest;                                  /* CIC factor, FIR factor, remaining factor */
+  uint32_t numDivisors, numStages, i, d;                 /* Counters */
+
+  if((M < 2u) || (maxStages == 0u) || (maxStages > ARM_DECIMATE_PLAN_MAX_STAGES) ||
+     (passband <= 0.0f) || (passband >= 0.5f) || (attenuation <= 8.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (R = 1u; (R < M) && (R <= 0xFFFFu); R++)
+  {
+    if((M % R) != 0u)
+    {
+      continue;
+    }
+
+    if(R > 1u)
+    {
+      /* The CIC front end alone must reject the aliases of the passband
+       ** around its output rate, and its gain must fit arm_cic_decimate_init_q31().
+       ** Frequencies are relative to the input rate. */
+      if((cicStages == 0u) || (arm_cic_gain_fits(R, cicStages) == 0u) ||
+         (arm_cic_attenuation_f32((1.0f / (float32_t) R) - (passband / (float32_t) M), R,
+                                  cicStages) < attenuation))
+      {
+        continue;
+      }
+    }
+
+    Mf = M / R;
+
+    /* Divisors of Mf that fit in a FIR decimator */
+    numDivisors = 0u;
+
+    for (d = 2u; (d <= Mf) && (d <= 255u) && (numDivisors < ARM_DECIMATE_PLAN_MAX_DIVISORS); d++)
+    {
+      if((Mf % d) == 0u)
+      {
+        divisors[numDivisors] = d;
+        numDivisors++;
+      }
+    }
+
+    /* Without divisors Mf can only be a single stage */
+    for (numStages = 1u; (numStages <= maxStages) && ((numStages == 1u) || (numDivisors > 0u)); numStages++)
+    {
+      /* Odometer over the factors of the first numStages - 1 stages.
+       ** The last stage gets the remaining factor. */
+      for (i = 0u; i < numStages; i++)
+      {
+        index[i] = 0u;
+      }
+
+      do
+      {
+        rest = Mf;
+
+        for (i = 0u; (i + 1u) < numStages; i++)
+        {
+          factors[i] = divisors[index[i]];
+
+          rest = ((rest % factors[i]) == 0u) ? (rest / factors[i]) : 0u;
+        }
+
+        factors[numStages - 1u] = rest;
+
+        if((rest >= 2u) && (rest <= 255u))
+        {
+          cost = arm_fir_decimate_plan_cost_f32(factors, numStages, Mf, passband, attenuation, taps);
+
+          /* Strictly cheaper plans only, so that fewer stages win ties */
+          if((cost >= 0.0f) && ((bestCost < 0.0f) || (cost < bestCost)))
+          {
+            bestCost = cost;
+
+            pPlan->cicFactor = (uint16_t) R;
+            pPlan->numStages = (uint8_t) numStages;
+            pPlan->macsPerOutput = cost;
+            pPlan->cicDroop = (R > 1u) ?
+              arm_cic_attenuation_f32(passband / (float32_t) M, R, cicStages) : 0.0f;
+
+            for (i = 0u; i < numStages; i++)
+            {
+              pPlan->M[i] = (uint8_t) factors[i];
+              pPlan->numTaps[i] = taps[i];
+            }
+          }
+        }
+
+        /* Next combination of factors */
+        i = 0u;
+
+        while((i + 1u) < numStages)
+        {
+          index[i]++;
+
+          if(index[i] < numDivisors)
+          {
+            break;
+          }
+
+          index[i] = 0u;
+          i++;
+        }
+      } while((i + 1u) < numStages);
+    }
+  }
+
+  return ((bestCost < 0.0f) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Multistage_Decimate group
+ */
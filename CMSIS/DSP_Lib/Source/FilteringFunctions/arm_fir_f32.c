@@ -35,6 +35,251 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_fir_f32(): 8 outputs per vector, 32 outputs at a time.
+ * Each output adds its products in the order of the portable code, so the
+ * results are the same.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_fir_f32_avx2(
+  const arm_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc;                                 /* Accumulator of the remaining outputs */
+  __m256 acc0, acc1, acc2, acc3, c0;             /* Accumulators and broadcast coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Copy the new input samples after the previous frame (numTaps - 1) samples */
+  arm_copy_f32(pSrc, pState + (numTaps - 1u), blockSize);
+
+  /* Compute 32 outputs at a time */
+  blkCnt = blockSize >> 5u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = _mm256_setzero_ps();
+    acc1 = _mm256_setzero_ps();
+    acc2 = _mm256_setzero_ps();
+    acc3 = _mm256_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      /* Output n gets b[k] * x[n + k] */
+      c0 = _mm256_broadcast_ss(pb++);
+
+      acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(px), c0));
+      acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(px + 8), c0));
+      acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(_mm256_loadu_ps(px + 16), c0));
+      acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(_mm256_loadu_ps(px + 24), c0));
+
+      px++;
+
+      tapCnt--;
+    }
+
+    _mm256_storeu_ps(pDst, acc0);
+    _mm256_storeu_ps(pDst + 8, acc1);
+    _mm256_storeu_ps(pDst + 16, acc2);
+    _mm256_storeu_ps(pDst + 24, acc3);
+
+    pState += 32u;
+    pDst += 32u;
+
+    blkCnt--;
+  }
+
+  /* Compute 8 outputs at a time */
+  blkCnt = (blockSize & 31u) >> 3u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = _mm256_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(px++), _mm256_broadcast_ss(pb++)));
+
+      tapCnt--;
+    }
+
+    _mm256_storeu_ps(pDst, acc0);
+
+    pState += 8u;
+    pDst += 8u;
+
+    blkCnt--;
+  }
+
+  /* Compute the remaining outputs one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+    acc = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      acc += *px++ * *pb++;
+
+      tapCnt--;
+    }
+
+    *pDst++ = acc;
+
+    pState++;
+
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  arm_copy_f32(pState, S->pState, numTaps - 1u);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+#if defined (ARM_MATH_HOST_AVX512)
+
+/*
+ * AVX-512 kernel of arm_fir_f32(): 16 outputs per vector, 64 outputs at a time.
+ */
+
+ARM_HOST_TARGET("avx512f")
+static void arm_fir_f32_avx512(
+  const arm_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc;                                 /* Accumulator of the remaining outputs */
+  __m512 acc0, acc1, acc2, acc3, c0;             /* Accumulators and broadcast coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Copy the new input samples after the previous frame (numTaps - 1) samples */
+  arm_copy_f32(pSrc, pState + (numTaps - 1u), blockSize);
+
+  /* Compute 64 outputs at a time */
+  blkCnt = blockSize >> 6u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = _mm512_setzero_ps();
+    acc1 = _mm512_setzero_ps();
+    acc2 = _mm512_setzero_ps();
+    acc3 = _mm512_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      /* Output n gets b[k] * x[n + k] */
+      c0 = _mm512_set1_ps(*pb++);
+
+      acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(_mm512_loadu_ps(px), c0));
+      acc1 = _mm512_add_ps(acc1, _mm512_mul_ps(_mm512_loadu_ps(px + 16), c0));
+      acc2 = _mm512_add_ps(acc2, _mm512_mul_ps(_mm512_loadu_ps(px + 32), c0));
+      acc3 = _mm512_add_ps(acc3, _mm512_mul_ps(_mm512_loadu_ps(px + 48), c0));
+
+      px++;
+
+      tapCnt--;
+    }
+
+    _mm512_storeu_ps(pDst, acc0);
+    _mm512_storeu_ps(pDst + 16, acc1);
+    _mm512_storeu_ps(pDst + 32, acc2);
+    _mm512_storeu_ps(pDst + 48, acc3);
+
+    pState += 64u;
+    pDst += 64u;
+
+    blkCnt--;
+  }
+
+  /* Compute 16 outputs at a time */
+  blkCnt = (blockSize & 63u) >> 4u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = _mm512_setzero_ps();
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(_mm512_loadu_ps(px++), _mm512_set1_ps(*pb++)));
+
+      tapCnt--;
+    }
+
+    _mm512_storeu_ps(pDst, acc0);
+
+    pState += 16u;
+    pDst += 16u;
+
+    blkCnt--;
+  }
+
+  /* Compute the remaining outputs one at a time */
+  blkCnt = blockSize & 15u;
+
+  while(blkCnt > 0u)
+  {
+    acc = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      acc += *px++ * *pb++;
+
+      tapCnt--;
+    }
+
+    *pDst++ = acc;
+
+    pState++;
+
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  arm_copy_f32(pState, S->pState, numTaps - 1u);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX512) */
+
+
 /**   
  * @ingroup groupFilters   
  */
@@ -140,6 +385,25 @@ void arm_fir_f32(
   uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
 
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX512)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX512))
+  {
+    arm_fir_f32_avx512(S, pSrc, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX512) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_fir_f32_avx2(S, pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
 #ifndef ARM_MATH_CM0
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
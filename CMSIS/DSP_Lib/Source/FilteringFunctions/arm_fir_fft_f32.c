@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_f32.c
+*
+* Description:	Floating-point FFT-based FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_FFT FFT-based Finite Impulse Response (FIR) Filter
+ *
+ * This function computes the same output as arm_fir_f32(), but filters in the
+ * frequency domain.  The direct form filter costs <code>numTaps</code>
+ * multiply-accumulates per sample.  The FFT-based filter costs about
+ * two FFTs of length <code>2*partSize</code> and <code>numTaps/partSize</code>
+ * complex multiplications per block of <code>partSize</code> samples, which is
+ * much less for filters of several hundred taps or more.
+ *
+ * \par Algorithm
+ * The coefficients are split into <code>numParts = ceil(numTaps/partSize)</code>
+ * partitions of <code>partSize</code> taps (uniformly partitioned overlap-save).
+ * The spectrum of each partition, zero padded to <code>2*partSize</code> points,
+ * is computed once by the initialization function.
+ * For every block of <code>partSize</code> input samples the filter:
+ * - computes the spectrum X of the last <code>2*partSize</code> input samples
+ *   and stores it in a frequency domain delay line of <code>numParts</code> spectra.
+ * - accumulates the products of the partition spectra with the spectra of the
+ *   delay line: <code>Y = H0*X[t] + H1*X[t-1] + ... + H(numParts-1)*X[t-numParts+1]</code>.
+ * - computes the inverse FFT of Y and outputs its last <code>partSize</code> samples.
+ * \par
+ * The spectra are in the packed format of arm_rfft_fast_f32().
+ * The delay between input and output is the same as for arm_fir_f32(), but
+ * samples are processed in blocks of <code>partSize</code>, so the latency of a
+ * real-time system is one partition.  A short partition gives a low latency and
+ * a long partition gives a low cost per sample.
+ *
+ * \par Instance Structure
+ * The coefficient spectra and state variables of the filter are referenced by an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * The coefficient spectra may be shared by several filters with the same coefficients and partition length.
+ *
+ * \par Initialization Function
+ * The initialization function computes the coefficient spectra, initializes the
+ * FFT instances and zeros out the state buffer.  It must be used.
+ * <code>pCoeffSpec</code> is of length <code>2*partSize*numParts</code> and
+ * <code>pState</code> is of length <code>2*partSize*(numParts+3)</code>.
+ *
+ * \par Matched Filters
+ * The coefficients are in time reversed order as for arm_fir_f32().  Passing a
+ * template in natural order as <code>pCoeffs</code> therefore gives its
+ * correlation with the input, that is a matched filter.
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/*
+ * @brief  Accumulates the product of two packed spectra.
+ * @param[in]     *pA       points to the first spectrum.
+ * @param[in]     *pB       points to the second spectrum.
+ * @param[in,out] *pAcc     points to the accumulator spectrum.
+ * @param[in]     numBins   number of complex values of the packed spectra.
+ * @return none.
+ *
+ * The first complex value holds the real DC and Nyquist bins, which are
+ * multiplied separately.
+ */
+
+static void arm_fir_fft_cmplx_mac_f32(
+  float32_t * pA,
+  float32_t * pB,
+  float32_t * pAcc,
+  uint32_t numBins)
+{
+  float32_t a, b, c, d;                          /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* DC and Nyquist bins */
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+
+  pA += 2u;
+  pB += 2u;
+  pAcc += 2u;
+
+  blkCnt = numBins - 1u;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* numBins is a power of 2, the remaining numBins - 1 values are processed
+   ** 4 at a time with 3 left over */
+  blkCnt = (numBins - 1u) >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* acc += (a + jb) * (c + jd) = (ac - bd) + j(ad + bc) */
+    a = pA[0];
+    b = pA[1];
+    c = pB[0];
+    d = pB[1];
+    pAcc[0] += (a * c) - (b * d);
+    pAcc[1] += (a * d) + (b * c);
+
+    a = pA[2];
+    b = pA[3];
+    c = pB[2];
+    d = pB[3];
+    pAcc[2] += (a * c) - (b * d);
+    pAcc[3] += (a * d) + (b * c);
+
+    a = pA[4];
+    b = pA[5];
+    c = pB[4];
+    d = pB[5];
+    pAcc[4] += (a * c) - (b * d);
+    pAcc[5] += (a * d) + (b * c);
+
+    a = pA[6];
+    b = pA[7];
+    c = pB[6];
+    d = pB[7];
+    pAcc[6] += (a * c) - (b * d);
+    pAcc[7] += (a * d) + (b * c);
+
+    pA += 8u;
+    pB += 8u;
+    pAcc += 8u;
+
+    blkCnt--;
+  }
+
+  blkCnt = (numBins - 1u) % 0x4u;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    a = *pA++;
+    b = *pA++;
+    c = *pB++;
+    d = *pB++;
+    pAcc[0] += (a * c) - (b * d);
+    pAcc[1] += (a * d) + (b * c);
+    pAcc += 2u;
+
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point FFT-based FIR filter.
+ * @param[in,out] *S          points to an instance of the floating-point FFT-based FIR structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of samples to process, a multiple of <code>partSize</code>.
+ * @return        none.
+ *
+ * \par
+ * The input block is read before the output is written, so <code>pSrc</code>
+ * and <code>pDst</code> may point to the same buffer.
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partSize = S->partSize;               /* Partition length */
+  uint32_t fftLen = 2u * partSize;               /* FFT length */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  float32_t *pFdl = S->pState;                   /* Frequency domain delay line */
+  float32_t *pIn = pFdl + (fftLen * numParts);   /* Last fftLen input samples */
+  float32_t *pWork = pIn + fftLen;               /* FFT working buffer */
+  float32_t *pAcc = pWork + fftLen;              /* Accumulated output spectrum */
+  float32_t *pH, *pX;                            /* Partition and delay line spectra */
+  uint32_t index, p, blkCnt;                     /* Loop counters */
+
+  blkCnt = blockSize / partSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Shift the input buffer by one partition and append the new samples */
+    arm_copy_f32(pIn + partSize, pIn, partSize);
+    arm_copy_f32(pSrc, pIn + partSize, partSize);
+
+    /* The newest spectrum replaces the oldest one of the delay line */
+    index = (S->partIndex == 0u) ? (numParts - 1u) : (S->partIndex - 1u);
+    S->partIndex = (uint16_t) index;
+
+    /* The forward transform uses its input as working memory */
+    arm_copy_f32(pIn, pWork, fftLen);
+    arm_rfft_fast_f32(&S->rfft, pWork, pFdl + (index * fftLen));
+
+    /* Y = sum of H[p] * X[t - p] */
+    arm_fill_f32(0.0f, pAcc, fftLen);
+
+    pH = S->pCoeffSpec;
+
+    for (p = 0u; p < numParts; p++)
+    {
+      pX = pFdl + (index * fftLen);
+
+      arm_fir_fft_cmplx_mac_f32(pH, pX, pAcc, partSize);
+
+      pH += fftLen;
+
+      /* Older spectra are at the following slots, modulo numParts */
+      index++;
+
+      if(index == numParts)
+      {
+        index = 0u;
+      }
+    }
+
+    /* The last partSize samples of the inverse transform are free of circular aliasing */
+    arm_rfft_fast_f32(&S->rifft, pAcc, pWork);
+    arm_copy_f32(pWork + partSize, pDst, partSize);
+
+    pSrc += partSize;
+    pDst += partSize;
+
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
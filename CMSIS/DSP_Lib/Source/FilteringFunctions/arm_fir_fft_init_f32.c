@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_init_f32.c
+*
+* Description:	Floating-point FFT-based FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @param[in,out] *S          points to an instance of the floating-point FFT-based FIR structure.
+ * @param[in]     numTaps     number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients.
+ * @param[out]    *pCoeffSpec points to the buffer for the coefficient spectra.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     partSize    partition length, any power of two from 16 to 2048.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>partSize</code> is not a supported value.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * as for arm_fir_f32():
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * The coefficients are only read by this function.
+ * \par
+ * With <code>numParts = ceil(numTaps/partSize)</code>, <code>pCoeffSpec</code> is of length
+ * <code>2*partSize*numParts</code> and <code>pState</code> is of length
+ * <code>2*partSize*(numParts+3)</code>.
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffSpec,
+  float32_t * pState,
+  uint16_t partSize)
+{
+  arm_status status;                             /* Status of the FFT initializations */
+  float32_t *pWork;                              /* FFT working buffer */
+  uint32_t fftLen = 2u * (uint32_t) partSize;    /* FFT length */
+  uint32_t numParts, p, n, k;                    /* Loop counters */
+
+  /* The FFT length must be a power of 2 from 32 to 4096 */
+  status = arm_rfft_fast_init_f32(&S->rfft, fftLen, 0u);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_fast_init_f32(&S->rifft, fftLen, 1u);
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    numParts = ((uint32_t) numTaps + partSize - 1u) / partSize;
+
+    S->numTaps = numTaps;
+    S->partSize = partSize;
+    S->numParts = (uint16_t) numParts;
+    S->partIndex = 0u;
+    S->pCoeffSpec = pCoeffSpec;
+    S->pState = pState;
+
+    /* The working buffer of the processing function follows the delay line and the input buffer */
+    pWork = pState + (fftLen * (numParts + 1u));
+
+    for (p = 0u; p < numParts; p++)
+    {
+      /* Partition p holds b[p*partSize] to b[p*partSize + partSize - 1], zero padded to fftLen */
+      for (n = 0u; n < partSize; n++)
+      {
+        k = (p * partSize) + n;
+
+        pWork[n] = (k < numTaps) ? pCoeffs[(numTaps - 1u) - k] : 0.0f;
+      }
+
+      arm_fill_f32(0.0f, pWork + partSize, partSize);
+
+      arm_rfft_fast_f32(&S->rfft, pWork, pCoeffSpec + (p * fftLen));
+    }
+
+    /* Clear the state buffer.  This is done after the coefficients are read,
+     ** so that arm_conv_fft_f32() can pass them in the state buffer */
+    memset(pState, 0, fftLen * (numParts + 3u) * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
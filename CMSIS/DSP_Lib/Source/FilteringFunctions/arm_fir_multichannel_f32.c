@@ -0,0 +1,307 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multichannel_f32.c
+*
+* Description:	Floating-point multichannel FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Multichannel Multichannel Finite Impulse Response (FIR) Filters
+ *
+ * These functions filter several channels with one set of coefficients,
+ * for Q15 and floating-point data types.
+ * The result of each channel is the same as that of a separate FIR filter
+ * (see \ref FIR) running on that channel, but each coefficient is loaded once
+ * and applied to a group of channels while it is held in a register.
+ * When many channels share one filter, as in sensor and microphone arrays,
+ * this removes most of the coefficient loads of the per-channel filters.
+ *
+ * \par Data layout:
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> samples of
+ * each of the <code>numChannels</code> channels.  With <code>planarFlag=0</code>
+ * the channels are interleaved:
+ * <pre>
+ *    {x0[0], x1[0], ..., xC[0], x0[1], x1[1], ..., xC[blockSize-1]}
+ * </pre>
+ * With <code>planarFlag=1</code> the channels are stored one after the other:
+ * <pre>
+ *    {x0[0], x0[1], ..., x0[blockSize-1], x1[0], ..., xC[blockSize-1]}
+ * </pre>
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,
+ * stored in time reversed order as for \ref FIR.
+ * \par
+ * <code>pState</code> points to a state array of size
+ * <code>numChannels * (numTaps + blockSize - 1)</code>.  The state is kept in
+ * interleaved order whatever the input layout, so that the samples of
+ * neighbouring channels are adjacent in memory.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each group of channels.
+ * There are separate instance structure declarations for each of the 2 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ *
+ * \par
+ * Use of the initialization function is optional.
+ * However, if the initialization function is used, then the instance structure cannot be placed into a const data section.
+ * To place an instance structure into a const data section, the instance structure must be manually initialized.
+ * Set the values in the state buffer to zeros before static initialization.
+ * <pre>
+ *arm_fir_multichannel_instance_f32 S = {numTaps, numChannels, planarFlag, pState, pCoeffs};
+ *arm_fir_multichannel_instance_q15 S = {numTaps, numChannels, planarFlag, pState, pCoeffs};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 function uses the same 64-bit accumulation as arm_fir_q15() and
+ * gives the same results.
+ */
+
+/**
+ * @addtogroup FIR_Multichannel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multichannel FIR filter.
+ * @param[in]   *S          points to an instance of the floating-point multichannel FIR structure.
+ * @param[in]   *pSrc       points to the block of input data.
+ * @param[out]  *pDst       points to the block of output data.
+ * @param[in]   blockSize   number of samples per channel to process.
+ * @return      none.
+ */
+
+void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t *pOut;                               /* Output pointer */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of channels */
+  uint32_t sampleStride, channelStride;          /* Output offsets between samples and between channels */
+  uint32_t n, ch, i, tapCnt, blkCnt;             /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t c0;                                  /* Coefficient */
+  uint32_t chCnt;                                /* Loop counter */
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples of every channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u) * numChannels]);
+
+  if(S->planarFlag == 0u)
+  {
+    /* Interleaved input: copy the block as it is */
+    blkCnt = blockSize * numChannels;
+
+    while(blkCnt > 0u)
+    {
+      *pStateCurnt++ = *pSrc++;
+      blkCnt--;
+    }
+
+    sampleStride = numChannels;
+    channelStride = 1u;
+  }
+  else
+  {
+    /* Planar input: interleave the channels into the state buffer */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      px = pStateCurnt + ch;
+
+      for (n = 0u; n < blockSize; n++)
+      {
+        *px = *pSrc++;
+        px += numChannels;
+      }
+    }
+
+    sampleStride = 1u;
+    channelStride = blockSize;
+  }
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    ch = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Filter four channels at a time: each coefficient is loaded once
+     ** and used for the four channels */
+    chCnt = numChannels >> 2u;
+
+    while(chCnt > 0u)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Oldest sample of channel ch for output n */
+      px = pState + ch;
+
+      /* Initialize coefficient pointer */
+      pb = pCoeffs;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        /* acc[c] +=  b[numTaps-1-k] * x[n-numTaps+1+k] for the four channels */
+        c0 = *pb++;
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      /* Store the results of the four channels */
+      pOut = pDst + (n * sampleStride) + (ch * channelStride);
+      pOut[0] = acc0;
+      pOut[channelStride] = acc1;
+      pOut[2u * channelStride] = acc2;
+      pOut[3u * channelStride] = acc3;
+
+      ch += 4u;
+      chCnt--;
+    }
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    /* Remaining channels, and all channels on Cortex-M0 */
+    while(ch < numChannels)
+    {
+      acc0 = 0.0f;
+      px = pState + ch;
+      pb = pCoeffs;
+
+      for (i = 0u; i < numTaps; i++)
+      {
+        acc0 += *px * *pb++;
+        px += numChannels;
+      }
+
+      pDst[(n * sampleStride) + (ch * channelStride)] = acc0;
+
+      ch++;
+    }
+
+    /* Advance the state pointer by one sample of all channels */
+    pState = pState + numChannels;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples of every channel to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = (numTaps - 1u) * numChannels;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = tapCnt >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+
+    blkCnt--;
+  }
+
+  tapCnt = tapCnt % 0x4u;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Multichannel group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multichannel_init_q15.c
+*
+* Description:	Q15 multichannel FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multichannel
+ * @{
+ */
+
+/**
+ * @details
+ *
+ * @param[in,out] *S points to an instance of the Q15 multichannel FIR filter structure.
+ * @param[in] 	  numTaps  Number of filter coefficients in the filter.
+ * @param[in] 	  numChannels  Number of channels filtered with the same coefficients.
+ * @param[in] 	  planarFlag  flag that selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in] 	  blockSize number of samples per channel that are processed per call.
+ * @return 		  none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>numChannels*(numTaps+blockSize-1)</code> samples, where <code>blockSize</code> is the number of input samples per channel processed by each call to <code>arm_fir_multichannel_q15()</code>.
+ */
+
+void arm_fir_multichannel_init_q15(
+  arm_fir_multichannel_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  uint8_t planarFlag,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign number of channels */
+  S->numChannels = numChannels;
+
+  /* Assign data layout flag */
+  S->planarFlag = planarFlag;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and the size of state buffer is numChannels*(blockSize + numTaps - 1) */
+  memset(pState, 0,
+         (uint32_t) numChannels * (numTaps + (blockSize - 1u)) * sizeof(q15_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of FIR_Multichannel group
+ */
@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multichannel_q15.c
+*
+* Description:	Q15 multichannel FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Multichannel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 multichannel FIR filter.
+ * @param[in]   *S          points to an instance of the Q15 multichannel FIR structure.
+ * @param[in]   *pSrc       points to the block of input data.
+ * @param[out]  *pDst       points to the block of output data.
+ * @param[in]   blockSize   number of samples per channel to process.
+ * @return      none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ * The results are the same as those of arm_fir_q15() applied to each channel.
+ */
+
+void arm_fir_multichannel_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q15_t *pOut;                                   /* Output pointer */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of channels */
+  uint32_t sampleStride, channelStride;          /* Output offsets between samples and between channels */
+  uint32_t n, ch, i, tapCnt, blkCnt;             /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q63_t acc1, acc2, acc3;                        /* Accumulators */
+  q15_t c0;                                      /* Coefficient */
+  uint32_t chCnt;                                /* Loop counter */
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples of every channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u) * numChannels]);
+
+  if(S->planarFlag == 0u)
+  {
+    /* Interleaved input: copy the block as it is */
+    blkCnt = blockSize * numChannels;
+
+    while(blkCnt > 0u)
+    {
+      *pStateCurnt++ = *pSrc++;
+      blkCnt--;
+    }
+
+    sampleStride = numChannels;
+    channelStride = 1u;
+  }
+  else
+  {
+    /* Planar input: interleave the channels into the state buffer */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      px = pStateCurnt + ch;
+
+      for (n = 0u; n < blockSize; n++)
+      {
+        *px = *pSrc++;
+        px += numChannels;
+      }
+    }
+
+    sampleStride = 1u;
+    channelStride = blockSize;
+  }
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    ch = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Filter four channels at a time: each coefficient is loaded once
+     ** and used for the four channels */
+    chCnt = numChannels >> 2u;
+
+    while(chCnt > 0u)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Oldest sample of channel ch for output n */
+      px = pState + ch;
+
+      /* Initialize coefficient pointer */
+      pb = pCoeffs;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = numTaps >> 2u;
+
+      while(tapCnt > 0u)
+      {
+        /* acc[c] +=  b[numTaps-1-k] * x[n-numTaps+1+k] for the four channels */
+        c0 = *pb++;
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+        px += numChannels;
+
+        c0 = *pb++;
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = numTaps % 0x4u;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *pb++;
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+        px += numChannels;
+
+        tapCnt--;
+      }
+
+      /* Store the results of the four channels */
+      pOut = pDst + (n * sampleStride) + (ch * channelStride);
+      /* The results are in 34.30 format.  Convert to 1.15 with saturation */
+      pOut[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut[channelStride] = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pOut[2u * channelStride] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pOut[3u * channelStride] = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+      ch += 4u;
+      chCnt--;
+    }
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    /* Remaining channels, and all channels on Cortex-M0 */
+    while(ch < numChannels)
+    {
+      acc0 = 0;
+      px = pState + ch;
+      pb = pCoeffs;
+
+      for (i = 0u; i < numTaps; i++)
+      {
+        acc0 += (q31_t) * px * *pb++;
+        px += numChannels;
+      }
+
+      pDst[(n * sampleStride) + (ch * channelStride)] =
+        (q15_t) (__SSAT((acc0 >> 15), 16));
+
+      ch++;
+    }
+
+    /* Advance the state pointer by one sample of all channels */
+    pState = pState + numChannels;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples of every channel to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = (numTaps - 1u) * numChannels;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = tapCnt >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pState)++;
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pState)++;
+
+    blkCnt--;
+  }
+
+  tapCnt = tapCnt % 0x4u;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_Multichannel group
+ */
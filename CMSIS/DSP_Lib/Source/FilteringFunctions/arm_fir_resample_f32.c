@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_f32.c
+*
+* Description:	Floating-point polyphase FIR sample rate converter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Sample Rate Converter
+ *
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>.
+ * Conceptually, the signal is upsampled by <code>L</code> with an FIR interpolator
+ * (see \ref FIR_Interpolate) and every <code>M</code>-th sample of the result is kept.
+ * The functions only compute the samples that are kept: each output sample
+ * is one polyphase component of the filter applied to the input, so the
+ * cost per output sample is <code>numTaps/L</code> multiply-accumulates,
+ * whatever the values of <code>L</code> and <code>M</code>.
+ *
+ * \par
+ * For example, 44.1 kHz is converted to 48 kHz with <code>L=160</code> and <code>M=147</code>.
+ * Chaining arm_fir_interpolate_f32() and arm_fir_decimate_f32() for this ratio computes
+ * 160 interpolated samples for every input sample and keeps fewer than one of them.
+ *
+ * \par Algorithm
+ * Output sample <code>m</code> corresponds to sample <code>t = m*M</code> of the upsampled signal,
+ * that is to input sample <code>n = floor(t/L)</code> and phase <code>p = t mod L</code>:
+ * <pre>
+ *    y[m] = b[p]*x[n] + b[p+L]*x[n-1] + ... + b[p+(phaseLength-1)*L]*x[n-phaseLength+1]
+ * </pre>
+ * The output is the same as that of arm_fir_interpolate_f32() with the same coefficients,
+ * keeping the outputs <code>0, M, 2*M, ...</code>.
+ * \par
+ * <code>blockSize</code> input samples give <code>blockSize*L/M</code> output samples.
+ * <code>blockSize</code> must be a multiple of <code>M</code>, so that every block starts
+ * with phase 0.
+ * \par
+ * The coefficients are in the layout of the FIR interpolator: a filter of
+ * <code>numTaps = L*phaseLength</code> taps designed for the upsampled rate,
+ * with a cutoff frequency below both the input and the output Nyquist frequencies
+ * and a gain of <code>L</code>, stored in time reversed order.
+ * <code>pState</code> points to a state array of size <code>phaseLength+blockSize-1</code>.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that <code>numTaps</code> is a multiple of <code>L</code> and <code>blockSize</code> a multiple of <code>M</code>.
+ *
+ * \par
+ * Use of the initialization function is optional.
+ * However, if the initialization function is used, then the instance structure cannot be placed into a const data section.
+ * To place an instance structure into a const data section, the instance structure must be manually initialized.
+ * Set the values in the state buffer to zeros before static initialization.
+ * <pre>
+ *arm_fir_resample_instance_f32 S = {L, M, phaseLength, pCoeffs, pState};
+ *arm_fir_resample_instance_q31 S = {L, M, phaseLength, pCoeffs, pState};
+ *arm_fir_resample_instance_q15 S = {L, M, phaseLength, pCoeffs, pState};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 and Q15 functions use the same accumulation and scaling as
+ * arm_fir_interpolate_q31() and arm_fir_interpolate_q15() and give the same results.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR sample rate converter.
+ * @param[in]  *S          points to an instance of the floating-point FIR sample rate converter structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data, of length <code>blockSize*L/M</code>.
+ * @param[in]  blockSize   number of input samples to process per call, a multiple of <code>M</code>.
+ * @return     none.
+ */
+
+void arm_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *ptr1, *ptr2;                        /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0;                                /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stepN = S->M / L, stepP = S->M % L;   /* Input and phase increments per output sample */
+  uint32_t n, p;                                 /* Input index and phase of the current output sample */
+  uint32_t blkCnt, tapCnt;                       /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_f32(pSrc, pStateCurnt, blockSize);
+
+  /* Number of output samples */
+  blkCnt = (blockSize * L) / S->M;
+
+  /* The first output sample of the block is phase 0 of the first input sample */
+  n = 0u;
+  p = 0u;
+
+  while(blkCnt > 0u)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0.0f;
+
+    /* The oldest input sample of the window */
+    ptr1 = pState + n;
+
+    /* The coefficients of phase p, in time reversed order with a stride of L */
+    ptr2 = pCoeffs + ((L - 1u) - p);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum0 += ptr1[0] * ptr2[0];
+      ptr2 += L;
+      sum0 += ptr1[1] * ptr2[0];
+      ptr2 += L;
+      sum0 += ptr1[2] * ptr2[0];
+      ptr2 += L;
+      sum0 += ptr1[3] * ptr2[0];
+      ptr2 += L;
+
+      ptr1 += 4u;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    while(tapCnt > 0u)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += *(ptr1++) * (*ptr2);
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      ptr2 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = sum0;
+
+    /* Advance by M samples of the upsampled signal */
+    n += stepN;
+    p += stepP;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  arm_copy_f32(pState + blockSize, S->pState, phaseLen - 1u);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
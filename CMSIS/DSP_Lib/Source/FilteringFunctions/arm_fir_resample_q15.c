@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_q15.c
+*
+* Description:	Q15 polyphase FIR sample rate converter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR sample rate converter.
+ * @param[in]  *S          points to an instance of the Q15 FIR sample rate converter structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data, of length <code>blockSize*L/M</code>.
+ * @param[in]  blockSize   number of input samples to process per call, a multiple of <code>M</code>.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+void arm_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stepN = S->M / L, stepP = S->M % L;   /* Input and phase increments per output sample */
+  uint32_t n, p;                                 /* Input index and phase of the current output sample */
+  uint32_t blkCnt, tapCnt;                       /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q15_t c0, c1;                                  /* Coefficients */
+  q31_t c, x;                                    /* Packed coefficients and input samples */
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_q15(pSrc, pStateCurnt, blockSize);
+
+  /* Number of output samples */
+  blkCnt = (blockSize * L) / S->M;
+
+  /* The first output sample of the block is phase 0 of the first input sample */
+  n = 0u;
+  p = 0u;
+
+  while(blkCnt > 0u)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0;
+
+    /* The oldest input sample of the window */
+    ptr1 = pState + n;
+
+    /* The coefficients of phase p, in time reversed order with a stride of L */
+    ptr2 = pCoeffs + ((L - 1u) - p);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      /* Read two coefficients of the phase */
+      c0 = *(ptr2);
+      ptr2 += L;
+      c1 = *(ptr2);
+      ptr2 += L;
+
+      /* Pack the coefficients */
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      c = __PKHBT(c0, c1, 16);
+
+#else
+
+      c = __PKHBT(c1, c0, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      /* Read two consecutive input samples */
+      x = *__SIMD32(ptr1)++;
+
+      /* Perform the multiply-accumulate */
+      sum0 = __SMLALD(x, c, sum0);
+
+      /* Read two coefficients of the phase */
+      c0 = *(ptr2);
+      ptr2 += L;
+      c1 = *(ptr2);
+      ptr2 += L;
+
+      /* Pack the coefficients */
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      c = __PKHBT(c0, c1, 16);
+
+#else
+
+      c = __PKHBT(c1, c0, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      /* Read two consecutive input samples */
+      x = *__SIMD32(ptr1)++;
+
+      /* Perform the multiply-accumulate */
+      sum0 = __SMLALD(x, c, sum0);
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    while(tapCnt > 0u)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += (q31_t) *(ptr1++) * (*ptr2);
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      ptr2 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+
+    /* Advance by M samples of the upsampled signal */
+    n += stepN;
+    p += stepP;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  arm_copy_q15(pState + blockSize, S->pState, phaseLen - 1u);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_q31.c
+*
+* Description:	Q31 polyphase FIR sample rate converter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR sample rate converter.
+ * @param[in]  *S          points to an instance of the Q31 FIR sample rate converter structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data, of length <code>blockSize*L/M</code>.
+ * @param[in]  blockSize   number of input samples to process per call, a multiple of <code>M</code>.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+ */
+
+void arm_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stepN = S->M / L, stepP = S->M % L;   /* Input and phase increments per output sample */
+  uint32_t n, p;                                 /* Input index and phase of the current output sample */
+  uint32_t blkCnt, tapCnt;                       /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  arm_copy_q31(pSrc, pStateCurnt, blockSize);
+
+  /* Number of output samples */
+  blkCnt = (blockSize * L) / S->M;
+
+  /* The first output sample of the block is phase 0 of the first input sample */
+  n = 0u;
+  p = 0u;
+
+  while(blkCnt > 0u)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0;
+
+    /* The oldest input sample of the window */
+    ptr1 = pState + n;
+
+    /* The coefficients of phase p, in time reversed order with a stride of L */
+    ptr2 = pCoeffs + ((L - 1u) - p);
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum0 += (q63_t) ptr1[0] * ptr2[0];
+      ptr2 += L;
+      sum0 += (q63_t) ptr1[1] * ptr2[0];
+      ptr2 += L;
+      sum0 += (q63_t) ptr1[2] * ptr2[0];
+      ptr2 += L;
+      sum0 += (q63_t) ptr1[3] * ptr2[0];
+      ptr2 += L;
+
+      ptr1 += 4u;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /*   #ifndef ARM_MATH_CM0 */
+
+    while(tapCnt > 0u)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += (q63_t) *(ptr1++) * (*ptr2);
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      ptr2 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = (q31_t) (sum0 >> 31);
+
+    /* Advance by M samples of the upsampled signal */
+    n += stepN;
+    p += stepP;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  arm_copy_q31(pState + blockSize, S->pState, phaseLen - 1u);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_f32.c
+*
+* Description:	Floating-point Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky Decomposition
+ *
+ * Decomposes a symmetric positive definite matrix <code>A</code> into
+ * <code>A = L * L'</code>, where <code>L</code> is lower triangular with a positive diagonal.
+ *
+ * \par Algorithm
+ * The rows of <code>L</code> are computed from the first to the last
+ * (Cholesky-Banachiewicz):
+ * <pre>
+ *     L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k = 0..j-1)) / L(j,j)      for j < i
+ *     L(i,i) = sqrt(A(i,i) - sum(L(i,k) * L(i,k), k = 0..i-1))
+ * </pre>
+ * Both sums run over contiguous rows of <code>L</code>.  Only the lower triangle of
+ * <code>A</code> is read and the upper triangle of the output is set to zero, so the
+ * decomposition can be computed in place by passing the same matrix as input and output.
+ * If the argument of a square root is not positive, the matrix is not positive definite
+ * and the functions return <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * The system <code>A * X = B</code> is then solved by arm_mat_cholesky_solve_f32(),
+ * with <code>N^3 / 6</code> multiply-accumulates for the decomposition and
+ * <code>N^2</code> for each right-hand side, against <code>N^3</code> for the inverse
+ * computed by arm_mat_inverse_f32().
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the input symmetric positive definite matrix structure
+ * @param[out]      *pDst points to the output lower triangular matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square or of the same size, <code>ARM_MATH_SINGULAR</code> if the
+ * input matrix is not positive definite or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* row pointers of L */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      pLi = pOut + (i * numRows);
+      pLj = pOut + (j * numRows);
+
+      sum = pIn[(i * numRows) + j];
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = j >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* sum -= L(i,k) * L(j,k) */
+        sum -= pLi[0] * pLj[0];
+        sum -= pLi[1] * pLj[1];
+        sum -= pLi[2] * pLj[2];
+        sum -= pLi[3] * pLj[3];
+
+        pLi += 4u;
+        pLj += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = j % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum -= *pLi++ * *pLj++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* pLi points to L(i,j) and pLj to L(j,j) */
+      if(j < i)
+      {
+        *pLi = sum / *pLj;
+      }
+      else if(sum > 0.0f)
+      {
+        arm_sqrt_f32(sum, pLi);
+      }
+      else
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+    }
+
+    /* Clear the upper triangle of row i */
+    for (j = i + 1u; j < numRows; j++)
+    {
+      pOut[(i * numRows) + j] = 0.0f;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_q31.c
+*
+* Description:	Q31 Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Square root of a positive 2.62 value, returned in 1.31 format.
+ */
+
+static uint32_t arm_mat_cholesky_sqrt_q62(
+  uint64_t in)
+{
+  uint64_t res = 0u;                             /* root computed so far */
+  uint64_t bit = (uint64_t) 1u << 62;            /* current bit of the square */
+
+  /* Digit by digit method: one bit of the root per step */
+  while(bit > in)
+  {
+    bit >>= 2u;
+  }
+
+  while(bit != 0u)
+  {
+    if(in >= (res + bit))
+    {
+      in -= res + bit;
+      res = (res >> 1u) + bit;
+    }
+    else
+    {
+      res >>= 1u;
+    }
+
+    bit >>= 2u;
+  }
+
+  return ((uint32_t) res);
+}
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 Cholesky decomposition.
+ * @param[in]       *pSrc points to the input symmetric positive definite matrix structure
+ * @param[out]      *pDst points to the output lower triangular matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square or of the same size, <code>ARM_MATH_SINGULAR</code> if the
+ * input matrix is not positive definite or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input and the output are in 1.31 format.  The sums of products are accumulated
+ * exactly in a 64-bit accumulator in 2.62 format: since
+ * <code>L(i,0)^2 + ... + L(i,i)^2 = A(i,i)</code>, they cannot overflow for a positive
+ * definite input.  The diagonal is the square root of the 2.62 accumulator, truncated
+ * to 1.31 format, and the elements below the diagonal are the 2.62 accumulator divided
+ * by the diagonal element of their column, saturated to 1.31 format.
+ * A diagonal element that truncates to zero makes the function return
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q31_t *pLi, *pLj;                              /* row pointers of L */
+  q63_t sum;                                     /* accumulator */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      pLi = pOut + (i * numRows);
+      pLj = pOut + (j * numRows);
+
+      /* Convert A(i,j) from 1.31 to 2.62 format */
+      sum = (q63_t) pIn[(i * numRows) + j] << 31;
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = j >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* sum -= L(i,k) * L(j,k) */
+        sum -= (q63_t) pLi[0] * pLj[0];
+        sum -= (q63_t) pLi[1] * pLj[1];
+        sum -= (q63_t) pLi[2] * pLj[2];
+        sum -= (q63_t) pLi[3] * pLj[3];
+
+        pLi += 4u;
+        pLj += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = j % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum -= (q63_t) * pLi++ * *pLj++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* pLi points to L(i,j) and pLj to L(j,j) */
+      if(j < i)
+      {
+        /* 2.62 / 1.31 gives 1.31 */
+        *pLi = clip_q63_to_q31(sum / *pLj);
+      }
+      else if(sum > 0)
+      {
+        *pLi = (q31_t) arm_mat_cholesky_sqrt_q62((uint64_t) sum);
+
+        if(*pLi == 0)
+        {
+          return (ARM_MATH_SINGULAR);
+        }
+      }
+      else
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+    }
+
+    /* Clear the upper triangle of row i */
+    for (j = i + 1u; j < numRows; j++)
+    {
+      pOut[(i * numRows) + j] = 0;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_solve_f32.c
+*
+* Description:	Floating-point linear system solution with a Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point linear system solution with a Cholesky decomposition.
+ * @param[in]       *pSrcL points to the lower triangular matrix structure computed by arm_mat_cholesky_f32()
+ * @param[in]       *pSrcB points to the matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal
+ * element of <code>pSrcL</code> is zero or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The function solves <code>L * Y = B</code> by forward substitution and
+ * <code>L' * X = Y</code> by back substitution, reading <code>L'</code> from the
+ * columns of <code>pSrcL</code>.  <code>pSrcB</code> and <code>pDst</code> may point
+ * to the same matrix.
+ */
+
+arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL;                                 /* row or column pointer of pSrcL */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcB->numRows;             /* number of equations */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the forward substitution */
+
+  /* Forward substitution L * Y = B, which also checks the sizes */
+  status = arm_mat_solve_lower_triangular_f32(pSrcL, pSrcB, pDst);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* Back substitution L' * X = Y, one column of right-hand sides at a time */
+  for (j = 0u; j < numCols; j++)
+  {
+    for (i = numRows; i > 0u; i--)
+    {
+      /* Column i - 1 of L below the diagonal and column j of X below row i - 1 */
+      pL = pSrcL->pData + ((i - 1u) * numRows) + (i - 1u);
+      pX = pDst->pData + ((i - 1u) * numCols) + j;
+
+      sum = *pX;
+
+      for (k = 1u; k <= (numRows - i); k++)
+      {
+        /* sum -= L(i-1+k,i-1) * X(i-1+k,j) */
+        sum -= pL[k * numRows] * pX[k * numCols];
+      }
+
+      *pX = sum / *pL;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
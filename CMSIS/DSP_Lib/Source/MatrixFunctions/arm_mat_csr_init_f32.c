@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_csr_init_f32.c
+*
+* Description:	Floating-point sparse CSR matrix initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSparse Sparse Matrix Functions
+ *
+ * Functions on sparse matrices stored in compressed sparse row (CSR) form.
+ * The nonzero elements are stored row by row in <code>pData</code>, with their column
+ * indices in <code>pColIdx</code>.  The nonzero elements of row <code>i</code> are at the
+ * offsets <code>pRowPtr[i]</code> to <code>pRowPtr[i+1]-1</code>, so that
+ * <code>pRowPtr</code> has <code>numRows + 1</code> values and
+ * <code>pRowPtr[numRows]</code> is the number of nonzero elements, up to 65535.
+ * For example the matrix
+ * <pre>
+ *     | 5  0  0  1 |
+ *     | 0  0  2  0 |
+ *     | 0  3  0  4 |
+ * </pre>
+ * is stored as
+ * <pre>
+ *     pRowPtr = { 0, 2, 3, 5 }
+ *     pColIdx = { 0, 3, 2, 1, 3 }
+ *     pData   = { 5, 1, 2, 3, 4 }
+ * </pre>
+ * The products of a sparse and a dense matrix or vector take one multiply-accumulate
+ * per nonzero element and per column of the dense operand, and do not read the zeros.
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief  Floating-point sparse CSR matrix initialization.
+ * @param[in,out] *S             points to an instance of the sparse matrix structure.
+ * @param[in]     nRows          number of rows in the matrix.
+ * @param[in]     nColumns       number of columns in the matrix.
+ * @param[in]     *pRowPtr       points to the array of <code>nRows + 1</code> row offsets.
+ * @param[in]     *pColIdx       points to the array of column indices of the nonzero elements.
+ * @param[in]     *pData	       points to the array of nonzero elements.
+ * @return        none
+ */
+
+void arm_mat_csr_init_f32(
+  arm_matrix_instance_csr_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  const uint16_t * pRowPtr,
+  const uint16_t * pColIdx,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign the row offsets and column indices */
+  S->pRowPtr = pRowPtr;
+  S->pColIdx = pColIdx;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_csr_mult_f32.c
+*
+* Description:	Floating-point sparse CSR matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse CSR matrix multiplication.
+ * @param[in]       *pSrcA points to the first input sparse matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Row <code>i</code> of <code>A * B</code> is the sum of the rows <code>k</code> of
+ * <code>B</code> scaled by the nonzero elements <code>A(i,k)</code>.
+ * <code>pSrcB</code> and <code>pDst</code> must not point to the same data.
+ */
+
+arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_instance_csr_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pIn = pSrcA->pData;           /* nonzero elements pointer */
+  const uint16_t *pCol = pSrcA->pColIdx;         /* column indices pointer */
+  const uint16_t *pRowPtr = pSrcA->pRowPtr;      /* row offsets pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pBk, *pDi;                          /* row pointers of B and of the output */
+  float32_t a;                                   /* Temporary nonzero element */
+  uint32_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint32_t numCols = pSrcB->numCols;             /* number of columns of B */
+  uint32_t i, k, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) || (pSrcA->numRows != pDst->numRows)
+     || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  memset(pOut, 0, (numRows * numCols) * sizeof(float32_t));
+
+  for (i = 0u; i < numRows; i++)
+  {
+    for (k = pRowPtr[i]; k < pRowPtr[i + 1u]; k++)
+    {
+      a = *pIn++;
+      pBk = pSrcB->pData + ((uint32_t) *pCol++ * numCols);
+      pDi = pOut + (i * numCols);
+
+      /* Apply loop unrolling and compute 4 outputs at a time. */
+      blkCnt = numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* D(i,:) += A(i,k) * B(k,:) */
+        pDi[0] += a * pBk[0];
+        pDi[1] += a * pBk[1];
+        pDi[2] += a * pBk[2];
+        pDi[3] += a * pBk[3];
+
+        pBk += 4u;
+        pDi += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining outputs */
+      blkCnt = numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        *pDi++ += a * *pBk++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
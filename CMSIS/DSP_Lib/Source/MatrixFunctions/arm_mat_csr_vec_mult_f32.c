@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_csr_vec_mult_f32.c
+*
+* Description:	Floating-point sparse CSR matrix vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse CSR matrix vector multiplication.
+ * @param[in]       *pSrcA points to the input sparse matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * <code>pVec</code> and <code>pDst</code> must not overlap.
+ */
+
+void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_instance_csr_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const float32_t *pIn = pSrcA->pData;           /* nonzero elements pointer */
+  const uint16_t *pCol = pSrcA->pColIdx;         /* column indices pointer */
+  const uint16_t *pRowPtr = pSrcA->pRowPtr;      /* row offsets pointer */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcA->numRows;             /* number of rows of the matrix */
+  uint32_t i, blkCnt;                            /* loop counters */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    sum = 0.0f;
+
+    /* Apply loop unrolling and compute 4 MACs simultaneously. */
+    blkCnt = (uint32_t) (pRowPtr[i + 1u] - pRowPtr[i]) >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* y(i) += A(i,k) * x(k) over the nonzero elements of row i */
+      sum += pIn[0] * pVec[pCol[0]];
+      sum += pIn[1] * pVec[pCol[1]];
+      sum += pIn[2] * pVec[pCol[2]];
+      sum += pIn[3] * pVec[pCol[3]];
+
+      pIn += 4u;
+      pCol += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining MACs */
+    blkCnt = (uint32_t) (pRowPtr[i + 1u] - pRowPtr[i]) % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      sum += *pIn++ * pVec[*pCol++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = sum;
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_diag_init_f32.c
+*
+* Description:	Floating-point diagonal matrix initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixDiag Diagonal Matrix Functions
+ *
+ * Functions on diagonal <code>N x N</code> matrices, of which only the
+ * <code>N</code> diagonal elements are stored:
+ * <pre>
+ *     A(i,i) = pData[i],    A(i,j) = 0 for j != i
+ * </pre>
+ * A product with a diagonal matrix scales the rows or the columns of the other
+ * operand, which costs <code>N</code> multiplications per row instead of the
+ * <code>N^2</code> multiply-accumulates of the dense product, and reads
+ * <code>N</code> values instead of <code>N^2</code>.
+ *
+ * \par
+ * arm_mat_diag_mult_f32() computes <code>D * B</code>, arm_mat_mult_diag_f32()
+ * computes <code>A * D</code> and arm_mat_diag_vec_mult_f32() computes <code>D * x</code>.
+ * All of them can work in-place.
+ */
+
+/**
+ * @addtogroup MatrixDiag
+ * @{
+ */
+
+/**
+ * @brief  Floating-point diagonal matrix initialization.
+ * @param[in,out] *S             points to an instance of the diagonal matrix structure.
+ * @param[in]     nRows          number of rows and columns of the matrix.
+ * @param[in]     *pData	       points to the array of <code>nRows</code> diagonal elements.
+ * @return        none
+ */
+
+void arm_mat_diag_init_f32(
+  arm_matrix_instance_diag_f32 * S,
+  uint16_t nRows,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixDiag group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_diag_mult_f32.c
+*
+* Description:	Floating-point diagonal matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixDiag
+ * @{
+ */
+
+/**
+ * @brief Floating-point diagonal matrix multiplication.
+ * @param[in]       *pSrcD points to the input diagonal matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * The function computes <code>D * B</code> by scaling row <code>i</code> of <code>B</code>
+ * by <code>D(i,i)</code>.  <code>pSrcB</code> and <code>pDst</code> may point to the same data.
+ */
+
+arm_status arm_mat_diag_mult_f32(
+  const arm_matrix_instance_diag_f32 * pSrcD,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pD = pSrcD->pData;                  /* input diagonal pointer D */
+  float32_t *pB = pSrcB->pData;                  /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t numRows = pSrcD->numRows;             /* number of rows of D */
+  uint32_t numCols = pSrcB->numCols;             /* number of columns of B */
+  uint32_t i;                                    /* loop counter */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcD->numRows != pSrcB->numRows) || (pDst->numRows != pSrcB->numRows)
+     || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* C(i,:) = D(i,i) * B(i,:) */
+    arm_scale_f32(pB, *pD++, pOut, numCols);
+
+    pB += numCols;
+    pOut += numCols;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixDiag group
+ */
@@ -0,0 +1,48 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_diag_vec_mult_f32.c
+*
+* Description:	Floating-point diagonal matrix vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixDiag
+ * @{
+ */
+
+/**
+ * @brief Floating-point diagonal matrix vector multiplication.
+ * @param[in]       *pSrcD points to the input diagonal matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numRows</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * <code>y(i) = D(i,i) * x(i)</code>, an element-by-element product.  <code>pVec</code>
+ * and <code>pDst</code> may point to the same buffer.
+ */
+
+void arm_mat_diag_vec_mult_f32(
+  const arm_matrix_instance_diag_f32 * pSrcD,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  /* y = D * x */
+  arm_mult_f32(pSrcD->pData, (float32_t *) pVec, pDst, pSrcD->numRows);
+}
+
+/**
+ * @} end of MatrixDiag group
+ */
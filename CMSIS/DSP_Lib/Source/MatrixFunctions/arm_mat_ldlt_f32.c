@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_f32.c
+*
+* Description:	Floating-point LDL' decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDL' Decomposition
+ *
+ * Decomposes a symmetric matrix <code>A</code> into <code>A = L * D * L'</code>, where
+ * <code>L</code> is lower triangular with a unit diagonal and <code>D</code> is diagonal.
+ * Unlike the Cholesky decomposition it needs no square root, and it also exists for
+ * symmetric matrices that are not positive definite as long as no pivot
+ * <code>D(i)</code> is zero.  No pivoting is done, so the matrix should be positive
+ * definite or otherwise well conditioned.
+ *
+ * \par Algorithm
+ * The rows of <code>L</code> are computed from the first to the last.  Row <code>i</code>
+ * first holds <code>W(i,j) = L(i,j) * D(j)</code>:
+ * <pre>
+ *     W(i,j) = A(i,j) - sum(W(i,k) * L(j,k), k = 0..j-1)      for j < i
+ *     L(i,j) = W(i,j) / D(j)
+ *     D(i)   = A(i,i) - sum(W(i,k) * L(i,k), k = 0..i-1)
+ * </pre>
+ * The output holds <code>L</code> below the diagonal and <code>D</code> on the diagonal,
+ * and its upper triangle is set to zero.  Only the lower triangle of <code>A</code> is
+ * read, so that the decomposition can be computed in place.
+ * If a pivot is zero, the functions return <code>ARM_MATH_SINGULAR</code>.
+ * The system <code>A * X = B</code> is then solved by arm_mat_ldlt_solve_f32().
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL' decomposition.
+ * @param[in]       *pSrc points to the input symmetric matrix structure
+ * @param[out]      *pDst points to the output matrix structure of L and D
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square or of the same size, <code>ARM_MATH_SINGULAR</code> if a
+ * pivot is zero or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pWi, *pLj;                          /* row pointers of W and L */
+  float32_t sum, d;                              /* accumulator and pivot */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* W(i,j) for j < i */
+    for (j = 0u; j < i; j++)
+    {
+      pWi = pOut + (i * numRows);
+      pLj = pOut + (j * numRows);
+
+      sum = pIn[(i * numRows) + j];
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = j >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* sum -= W(i,k) * L(j,k) */
+        sum -= pWi[0] * pLj[0];
+        sum -= pWi[1] * pLj[1];
+        sum -= pWi[2] * pLj[2];
+        sum -= pWi[3] * pLj[3];
+
+        pWi += 4u;
+        pLj += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = j % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum -= *pWi++ * *pLj++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      *pWi = sum;
+    }
+
+    /* L(i,j) = W(i,j) / D(j) and the pivot D(i) */
+    d = pIn[(i * numRows) + i];
+    pWi = pOut + (i * numRows);
+
+    for (j = 0u; j < i; j++)
+    {
+      sum = pWi[j];
+      pWi[j] = sum / pOut[(j * numRows) + j];
+      d -= sum * pWi[j];
+    }
+
+    if(d == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    pWi[i] = d;
+
+    /* Clear the upper triangle of row i */
+    for (j = i + 1u; j < numRows; j++)
+    {
+      pWi[j] = 0.0f;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_solve_f32.c
+*
+* Description:	Floating-point linear system solution with an LDL' decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point linear system solution with an LDL' decomposition.
+ * @param[in]       *pSrcLD points to the matrix structure of L and D computed by arm_mat_ldlt_f32()
+ * @param[in]       *pSrcB points to the matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if a pivot is
+ * zero or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The function solves <code>L * Z = B</code> by forward substitution, scales the rows
+ * of <code>Z</code> by <code>1 / D</code> and solves <code>L' * X = D^-1 * Z</code> by
+ * back substitution.  <code>pSrcB</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLD,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pLD = pSrcLD->pData;                /* decomposition data pointer */
+  float32_t *pL;                                 /* row or column pointer of L */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcB->numRows;             /* number of equations */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcLD->numRows != pSrcLD->numCols) || (pSrcLD->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Solve one column of right-hand sides at a time */
+  for (j = 0u; j < numCols; j++)
+  {
+    /* Forward substitution L * Z = B and scaling by 1 / D */
+    for (i = 0u; i < numRows; i++)
+    {
+      pL = pLD + (i * numRows);
+      pX = pDst->pData + j;
+
+      sum = pSrcB->pData[(i * numCols) + j];
+
+      for (k = 0u; k < i; k++)
+      {
+        /* sum -= L(i,k) * Z(k,j) */
+        sum -= pL[k] * pX[k * numCols];
+      }
+
+      /* The later rows use Z(i,j) before it is scaled */
+      pX[i * numCols] = sum;
+    }
+
+    for (i = 0u; i < numRows; i++)
+    {
+      if(pLD[(i * numRows) + i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      pDst->pData[(i * numCols) + j] /= pLD[(i * numRows) + i];
+    }
+
+    /* Back substitution L' * X = D^-1 * Z */
+    for (i = numRows; i > 0u; i--)
+    {
+      /* Column i - 1 of L below the diagonal and column j of X below row i - 1 */
+      pL = pLD + ((i - 1u) * numRows) + (i - 1u);
+      pX = pDst->pData + ((i - 1u) * numCols) + j;
+
+      sum = *pX;
+
+      for (k = 1u; k <= (numRows - i); k++)
+      {
+        /* sum -= L(i-1+k,i-1) * X(i-1+k,j) */
+        sum -= pL[k * numRows] * pX[k * numCols];
+      }
+
+      *pX = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_lu_f32.c
+*
+* Description:	Floating-point LU decomposition with partial pivoting.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLU LU Decomposition
+ *
+ * Decomposes a square matrix <code>A</code> into <code>P * A = L * U</code>, where
+ * <code>P</code> is a permutation matrix, <code>L</code> is lower triangular with a unit
+ * diagonal and <code>U</code> is upper triangular.
+ *
+ * \par Algorithm
+ * Gaussian elimination with partial pivoting: at step <code>k</code>, the row with the
+ * largest magnitude in column <code>k</code> on or below the diagonal is exchanged with
+ * row <code>k</code>, and multiples of row <code>k</code> are subtracted from the rows
+ * below it.  The multipliers are the elements of <code>L</code>.
+ * The output holds <code>L</code> below the diagonal, without its unit diagonal, and
+ * <code>U</code> on and above the diagonal.  The permutation is returned in an array
+ * <code>pPerm</code> of <code>N</code> values: row <code>i</code> of <code>P * A</code> is
+ * row <code>pPerm[i]</code> of <code>A</code>.
+ * If a whole column has no nonzero pivot, the matrix is singular and the function returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * The system <code>A * X = B</code> is then solved by arm_mat_lu_solve_f32().
+ * The decomposition takes <code>N^3 / 3</code> multiply-accumulates, a third of the
+ * Gauss-Jordan elimination of arm_mat_inverse_f32().
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point LU decomposition with partial pivoting.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pDst points to the output matrix structure of L and U
+ * @param[out]      *pPerm points to the row permutation array of <code>numRows</code> values
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square or of the same size, <code>ARM_MATH_SINGULAR</code> if the
+ * input matrix is singular or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPerm)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowK, *pRowI;                      /* pivot row and current row pointers */
+  float32_t maxVal, val, invPivot, l, Xchg;      /* Temporary values */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i, j, k, p, blkCnt;                   /* loop counters and pivot row */
+  uint16_t tmp;                                  /* Temporary permutation index */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* The decomposition is computed in place in pDst */
+  if(pDst->pData != pSrc->pData)
+  {
+    memcpy(pA, pSrc->pData, (numRows * numRows) * sizeof(float32_t));
+  }
+
+  for (i = 0u; i < numRows; i++)
+  {
+    pPerm[i] = (uint16_t) i;
+  }
+
+  for (k = 0u; k < numRows; k++)
+  {
+    /* Search the largest pivot in column k */
+    p = k;
+    maxVal = 0.0f;
+
+    for (i = k; i < numRows; i++)
+    {
+      val = pA[(i * numRows) + k];
+      val = (val > 0.0f) ? val : -val;
+
+      if(val > maxVal)
+      {
+        maxVal = val;
+        p = i;
+      }
+    }
+
+    if(maxVal == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    /* Exchange rows k and p */
+    pRowK = pA + (k * numRows);
+
+    if(p != k)
+    {
+      pRowI = pA + (p * numRows);
+
+      for (j = 0u; j < numRows; j++)
+      {
+        Xchg = pRowK[j];
+        pRowK[j] = pRowI[j];
+        pRowI[j] = Xchg;
+      }
+
+      tmp = pPerm[k];
+      pPerm[k] = pPerm[p];
+      pPerm[p] = tmp;
+    }
+
+    invPivot = 1.0f / pRowK[k];
+
+    /* Eliminate column k from the rows below the pivot */
+    for (i = k + 1u; i < numRows; i++)
+    {
+      pRowI = pA + (i * numRows) + k;
+
+      l = *pRowI * invPivot;
+      *pRowI++ = l;
+
+      pRowK = pA + (k * numRows) + k + 1u;
+
+      /* Apply loop unrolling and compute 4 outputs at a time. */
+      blkCnt = (numRows - k - 1u) >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* A(i,j) -= L(i,k) * U(k,j) */
+        pRowI[0] -= l * pRowK[0];
+        pRowI[1] -= l * pRowK[1];
+        pRowI[2] -= l * pRowK[2];
+        pRowI[3] -= l * pRowK[3];
+
+        pRowI += 4u;
+        pRowK += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining outputs */
+      blkCnt = (numRows - k - 1u) % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        *pRowI++ -= l * *pRowK++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixLU group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_lu_solve_f32.c
+*
+* Description:	Floating-point linear system solution with an LU decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point linear system solution with an LU decomposition.
+ * @param[in]       *pSrcLU points to the matrix structure of L and U computed by arm_mat_lu_f32()
+ * @param[in]       *pPerm points to the row permutation array computed by arm_mat_lu_f32()
+ * @param[in]       *pSrcB points to the matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal
+ * element of <code>U</code> is zero or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The function copies the rows of <code>pSrcB</code> in the order of the permutation,
+ * solves <code>L * Y = P * B</code> by forward substitution and <code>U * X = Y</code>
+ * with arm_mat_solve_upper_triangular_f32().  <code>pSrcB</code> and <code>pDst</code>
+ * must not point to the same data.
+ */
+
+arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLU,
+  const uint16_t * pPerm,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL;                                 /* row pointer of L */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcB->numRows;             /* number of equations */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcLU->numRows != pSrcLU->numCols) || (pSrcLU->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Permute the rows of the right-hand sides */
+  for (i = 0u; i < numRows; i++)
+  {
+    memcpy(pDst->pData + (i * numCols), pSrcB->pData + ((uint32_t) pPerm[i] * numCols),
+           numCols * sizeof(float32_t));
+  }
+
+  /* Forward substitution L * Y = P * B with the unit diagonal of L */
+  for (j = 0u; j < numCols; j++)
+  {
+    for (i = 1u; i < numRows; i++)
+    {
+      pL = pSrcLU->pData + (i * numRows);
+      pX = pDst->pData + j;
+
+      sum = pX[i * numCols];
+
+      for (k = 0u; k < i; k++)
+      {
+        /* sum -= L(i,k) * Y(k,j) */
+        sum -= pL[k] * pX[k * numCols];
+      }
+
+      pX[i * numCols] = sum;
+    }
+  }
+
+  /* Back substitution U * X = Y */
+  return (arm_mat_solve_upper_triangular_f32(pSrcLU, pDst, pDst));
+}
+
+/**
+ * @} end of MatrixLU group
+ */
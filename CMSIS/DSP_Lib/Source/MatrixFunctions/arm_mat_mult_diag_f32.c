@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_diag_f32.c
+*
+* Description:	Floating-point multiplication by a diagonal matrix.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixDiag
+ * @{
+ */
+
+/**
+ * @brief Floating-point multiplication by a diagonal matrix.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcD points to the input diagonal matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * The function computes <code>A * D</code> by scaling column <code>j</code> of <code>A</code>
+ * by <code>D(j,j)</code>, one row at a time.  <code>pSrcA</code> and <code>pDst</code> may point
+ * to the same data.
+ */
+
+arm_status arm_mat_mult_diag_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_diag_f32 * pSrcD,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrcA->pData;                  /* input data matrix pointer A */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint32_t numCols = pSrcA->numCols;             /* number of columns of A */
+  uint32_t i;                                    /* loop counter */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcD->numRows) || (pDst->numRows != pSrcA->numRows)
+     || (pDst->numCols != pSrcA->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* C(i,j) = A(i,j) * D(j,j) */
+    arm_mult_f32(pA, pSrcD->pData, pOut, numCols);
+
+    pA += numCols;
+    pOut += numCols;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixDiag group
+ */
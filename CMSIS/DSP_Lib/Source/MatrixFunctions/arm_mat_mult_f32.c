@@ -35,6 +35,572 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_mat_mult_f32(): a row of pSrcA times 32 or 8 columns of
+ * pSrcB at a time.  Every output adds its products in the order of the
+ * portable code, so the results are the same.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_f32_avx2(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* input data pointers of the row and the columns */
+  float32_t sum;                                 /* Accumulator of the remaining columns */
+  __m256 acc0, acc1, acc2, acc3, a0;             /* Accumulators and broadcast element of A */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, colCnt;                     /* loop counters */
+
+  for (row = 0u; row < numRowsA; row++)
+  {
+    col = 0u;
+
+    /* Compute 32 columns at a time */
+    for (; (col + 32u) <= numColsB; col += 32u)
+    {
+      acc0 = _mm256_setzero_ps();
+      acc1 = _mm256_setzero_ps();
+      acc2 = _mm256_setzero_ps();
+      acc3 = _mm256_setzero_ps();
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        /* c(m,n) += a(m,k) * b(k,n) */
+        a0 = _mm256_broadcast_ss(pIn1++);
+
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(a0, _mm256_loadu_ps(pIn2)));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(a0, _mm256_loadu_ps(pIn2 + 8)));
+        acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(a0, _mm256_loadu_ps(pIn2 + 16)));
+        acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(a0, _mm256_loadu_ps(pIn2 + 24)));
+
+        pIn2 += numColsB;
+      }
+
+      _mm256_storeu_ps(pOut + col, acc0);
+      _mm256_storeu_ps(pOut + col + 8, acc1);
+      _mm256_storeu_ps(pOut + col + 16, acc2);
+      _mm256_storeu_ps(pOut + col + 24, acc3);
+    }
+
+    /* Compute 8 columns at a time */
+    for (; (col + 8u) <= numColsB; col += 8u)
+    {
+      acc0 = _mm256_setzero_ps();
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_broadcast_ss(pIn1++), _mm256_loadu_ps(pIn2)));
+
+        pIn2 += numColsB;
+      }
+
+      _mm256_storeu_ps(pOut + col, acc0);
+    }
+
+    /* Compute the remaining columns one at a time */
+    for (; col < numColsB; col++)
+    {
+      sum = 0.0f;
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        sum += *pIn1++ * (*pIn2);
+        pIn2 += numColsB;
+      }
+
+      pOut[col] = sum;
+    }
+
+    /* Update the pointers to the next row */
+    pInA += numColsA;
+    pOut += numColsB;
+  }
+}
+
+
+/*
+ * Blocked multiplication of the x86 kernels of arm_mat_mult_f32().  pSrcB is
+ * cut into panels of up to 256 rows and nr columns, which are copied to a
+ * contiguous buffer (columns past the end of pSrcB are set to zero) so that
+ * they stay in the level 1 cache while all the rows of pSrcA are multiplied
+ * with them.  A micro-kernel keeps a tile of 6 rows and nr columns of the
+ * product in registers and adds it to pDst, where the sums of the previous
+ * panels are stored.  Every output adds its products in the order of the
+ * portable code, so the results are the same.  The row kernels above are
+ * faster as long as pSrcB fits in the level 1 cache.
+ */
+
+#define ARM_MAT_MULT_F32_KC   256u               /* rows of the panels of pSrcB */
+#define ARM_MAT_MULT_F32_MR   6u                 /* rows of the micro-kernel tile */
+#define ARM_MAT_MULT_F32_MAX  4096u              /* largest pSrcB of the row kernels */
+
+/*
+ * Micro-kernel: adds the products of numRows (1 or ARM_MAT_MULT_F32_MR) rows
+ * of pSrcA, starting at pA with a stride of lda, with a panel of kc rows of
+ * pSrcB to the tile at pC with a stride of ldc.  The tile is cleared first
+ * when first is set.
+ */
+typedef void (*arm_mat_mult_f32_kernel)(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t first);
+
+static void arm_mat_mult_f32_blocked(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  uint32_t nr,
+  arm_mat_mult_f32_kernel kernelRows,
+  arm_mat_mult_f32_kernel kernelRow)
+{
+  float32_t packB[ARM_MAT_MULT_F32_KC * 32u];    /* packed panel of pSrcB */
+  float32_t tile[ARM_MAT_MULT_F32_MR * 32u];     /* tile of the last columns */
+  float32_t *pB, *pC;                            /* panel and output pointers */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t col, row, k, mr, nc, kc, r, j;        /* loop counters and block sizes */
+
+  for (col = 0u; col < numColsB; col += nr)
+  {
+    nc = ((numColsB - col) < nr) ? (numColsB - col) : nr;
+
+    /* At least one panel, so that pDst is cleared when numColsA is zero */
+    k = 0u;
+
+    do
+    {
+      kc = ((numColsA - k) < ARM_MAT_MULT_F32_KC) ? (numColsA - k) : ARM_MAT_MULT_F32_KC;
+
+      /* Pack the panel of pSrcB */
+      pB = packB;
+
+      for (r = 0u; r < kc; r++)
+      {
+        memcpy(pB, pSrcB->pData + ((k + r) * numColsB) + col, nc * sizeof(float32_t));
+
+        for (j = nc; j < nr; j++)
+        {
+          pB[j] = 0.0f;
+        }
+
+        pB += nr;
+      }
+
+      /* Multiply all the rows of pSrcA with the panel */
+      for (row = 0u; row < numRowsA; row += mr)
+      {
+        mr = ((numRowsA - row) < ARM_MAT_MULT_F32_MR) ? 1u : ARM_MAT_MULT_F32_MR;
+        pC = pDst->pData + (row * numColsB) + col;
+
+        if(nc == nr)
+        {
+          /* Full tiles are added to pDst in place */
+          ((mr == 1u) ? kernelRow : kernelRows)(pSrcA->pData + (row * numColsA) + k, numColsA,
+                                                packB, kc, pC, numColsB, (k == 0u));
+        }
+        else
+        {
+          /* The last columns go through a tile of nr columns */
+          for (r = 0u; r < mr; r++)
+          {
+            memcpy(tile + (r * nr), pC + (r * numColsB), nc * sizeof(float32_t));
+          }
+
+          ((mr == 1u) ? kernelRow : kernelRows)(pSrcA->pData + (row * numColsA) + k, numColsA,
+                                                packB, kc, tile, nr, (k == 0u));
+
+          for (r = 0u; r < mr; r++)
+          {
+            memcpy(pC + (r * numColsB), tile + (r * nr), nc * sizeof(float32_t));
+          }
+        }
+      }
+
+      k += ARM_MAT_MULT_F32_KC;
+
+    } while(k < numColsA);
+  }
+}
+
+/*
+ * AVX2 micro-kernels of arm_mat_mult_f32(): 6 rows or 1 row by 16 columns.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_f32_avx2_6x16(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t first)
+{
+  __m256 c00, c01, c10, c11, c20, c21;           /* Tile of the product */
+  __m256 c30, c31, c40, c41, c50, c51;
+  __m256 b0, b1, a;                              /* Row of the panel and broadcast element of A */
+  uint32_t k;                                    /* loop counter */
+
+  if(first != 0u)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_ps();
+    c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_ps();
+  }
+  else
+  {
+    c00 = _mm256_loadu_ps(pC);
+    c01 = _mm256_loadu_ps(pC + 8);
+    c10 = _mm256_loadu_ps(pC + ldc);
+    c11 = _mm256_loadu_ps(pC + ldc + 8);
+    c20 = _mm256_loadu_ps(pC + (2u * ldc));
+    c21 = _mm256_loadu_ps(pC + (2u * ldc) + 8);
+    c30 = _mm256_loadu_ps(pC + (3u * ldc));
+    c31 = _mm256_loadu_ps(pC + (3u * ldc) + 8);
+    c40 = _mm256_loadu_ps(pC + (4u * ldc));
+    c41 = _mm256_loadu_ps(pC + (4u * ldc) + 8);
+    c50 = _mm256_loadu_ps(pC + (5u * ldc));
+    c51 = _mm256_loadu_ps(pC + (5u * ldc) + 8);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    /* c(m,n) += a(m,k) * b(k,n) */
+    b0 = _mm256_loadu_ps(pB);
+    b1 = _mm256_loadu_ps(pB + 8);
+
+    a = _mm256_broadcast_ss(pA + k);
+    c00 = _mm256_add_ps(c00, _mm256_mul_ps(a, b0));
+    c01 = _mm256_add_ps(c01, _mm256_mul_ps(a, b1));
+
+    a = _mm256_broadcast_ss(pA + lda + k);
+    c10 = _mm256_add_ps(c10, _mm256_mul_ps(a, b0));
+    c11 = _mm256_add_ps(c11, _mm256_mul_ps(a, b1));
+
+    a = _mm256_broadcast_ss(pA + (2u * lda) + k);
+    c20 = _mm256_add_ps(c20, _mm256_mul_ps(a, b0));
+    c21 = _mm256_add_ps(c21, _mm256_mul_ps(a, b1));
+
+    a = _mm256_broadcast_ss(pA + (3u * lda) + k);
+    c30 = _mm256_add_ps(c30, _mm256_mul_ps(a, b0));
+    c31 = _mm256_add_ps(c31, _mm256_mul_ps(a, b1));
+
+    a = _mm256_broadcast_ss(pA + (4u * lda) + k);
+    c40 = _mm256_add_ps(c40, _mm256_mul_ps(a, b0));
+    c41 = _mm256_add_ps(c41, _mm256_mul_ps(a, b1));
+
+    a = _mm256_broadcast_ss(pA + (5u * lda) + k);
+    c50 = _mm256_add_ps(c50, _mm256_mul_ps(a, b0));
+    c51 = _mm256_add_ps(c51, _mm256_mul_ps(a, b1));
+
+    pB += 16;
+  }
+
+  _mm256_storeu_ps(pC, c00);
+  _mm256_storeu_ps(pC + 8, c01);
+  _mm256_storeu_ps(pC + ldc, c10);
+  _mm256_storeu_ps(pC + ldc + 8, c11);
+  _mm256_storeu_ps(pC + (2u * ldc), c20);
+  _mm256_storeu_ps(pC + (2u * ldc) + 8, c21);
+  _mm256_storeu_ps(pC + (3u * ldc), c30);
+  _mm256_storeu_ps(pC + (3u * ldc) + 8, c31);
+  _mm256_storeu_ps(pC + (4u * ldc), c40);
+  _mm256_storeu_ps(pC + (4u * ldc) + 8, c41);
+  _mm256_storeu_ps(pC + (5u * ldc), c50);
+  _mm256_storeu_ps(pC + (5u * ldc) + 8, c51);
+}
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_f32_avx2_1x16(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t first)
+{
+  __m256 c00, c01, a;                            /* Tile of the product and broadcast element of A */
+  uint32_t k;                                    /* loop counter */
+
+  (void) lda;
+  (void) ldc;
+
+  if(first != 0u)
+  {
+    c00 = c01 = _mm256_setzero_ps();
+  }
+  else
+  {
+    c00 = _mm256_loadu_ps(pC);
+    c01 = _mm256_loadu_ps(pC + 8);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    a = _mm256_broadcast_ss(pA + k);
+    c00 = _mm256_add_ps(c00, _mm256_mul_ps(a, _mm256_loadu_ps(pB)));
+    c01 = _mm256_add_ps(c01, _mm256_mul_ps(a, _mm256_loadu_ps(pB + 8)));
+
+    pB += 16;
+  }
+
+  _mm256_storeu_ps(pC, c00);
+  _mm256_storeu_ps(pC + 8, c01);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+#if defined (ARM_MATH_HOST_AVX512)
+
+/*
+ * AVX-512 kernel of arm_mat_mult_f32(): a row of pSrcA times 64 or 16 columns
+ * of pSrcB at a time.
+ */
+
+ARM_HOST_TARGET("avx512f")
+static void arm_mat_mult_f32_avx512(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* input data pointers of the row and the columns */
+  float32_t sum;                                 /* Accumulator of the remaining columns */
+  __m512 acc0, acc1, acc2, acc3, a0;             /* Accumulators and broadcast element of A */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, colCnt;                     /* loop counters */
+
+  for (row = 0u; row < numRowsA; row++)
+  {
+    col = 0u;
+
+    /* Compute 64 columns at a time */
+    for (; (col + 64u) <= numColsB; col += 64u)
+    {
+      acc0 = _mm512_setzero_ps();
+      acc1 = _mm512_setzero_ps();
+      acc2 = _mm512_setzero_ps();
+      acc3 = _mm512_setzero_ps();
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        /* c(m,n) += a(m,k) * b(k,n) */
+        a0 = _mm512_set1_ps(*pIn1++);
+
+        acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(a0, _mm512_loadu_ps(pIn2)));
+        acc1 = _mm512_add_ps(acc1, _mm512_mul_ps(a0, _mm512_loadu_ps(pIn2 + 16)));
+        acc2 = _mm512_add_ps(acc2, _mm512_mul_ps(a0, _mm512_loadu_ps(pIn2 + 32)));
+        acc3 = _mm512_add_ps(acc3, _mm512_mul_ps(a0, _mm512_loadu_ps(pIn2 + 48)));
+
+        pIn2 += numColsB;
+      }
+
+      _mm512_storeu_ps(pOut + col, acc0);
+      _mm512_storeu_ps(pOut + col + 16, acc1);
+      _mm512_storeu_ps(pOut + col + 32, acc2);
+      _mm512_storeu_ps(pOut + col + 48, acc3);
+    }
+
+    /* Compute 16 columns at a time */
+    for (; (col + 16u) <= numColsB; col += 16u)
+    {
+      acc0 = _mm512_setzero_ps();
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        acc0 = _mm512_add_ps(acc0, _mm512_mul_ps(_mm512_set1_ps(*pIn1++), _mm512_loadu_ps(pIn2)));
+
+        pIn2 += numColsB;
+      }
+
+      _mm512_storeu_ps(pOut + col, acc0);
+    }
+
+    /* Compute the remaining columns one at a time */
+    for (; col < numColsB; col++)
+    {
+      sum = 0.0f;
+
+      pIn1 = pInA;
+      pIn2 = pSrcB->pData + col;
+
+      for (colCnt = numColsA; colCnt > 0u; colCnt--)
+      {
+        sum += *pIn1++ * (*pIn2);
+        pIn2 += numColsB;
+      }
+
+      pOut[col] = sum;
+    }
+
+    /* Update the pointers to the next row */
+    pInA += numColsA;
+    pOut += numColsB;
+  }
+}
+
+
+
+/*
+ * AVX-512 micro-kernels of arm_mat_mult_f32(): 6 rows or 1 row by 32 columns.
+ */
+
+ARM_HOST_TARGET("avx512f")
+static void arm_mat_mult_f32_avx512_6x32(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t first)
+{
+  __m512 c00, c01, c10, c11, c20, c21;           /* Tile of the product */
+  __m512 c30, c31, c40, c41, c50, c51;
+  __m512 b0, b1, a;                              /* Row of the panel and broadcast element of A */
+  uint32_t k;                                    /* loop counter */
+
+  if(first != 0u)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = _mm512_setzero_ps();
+    c30 = c31 = c40 = c41 = c50 = c51 = _mm512_setzero_ps();
+  }
+  else
+  {
+    c00 = _mm512_loadu_ps(pC);
+    c01 = _mm512_loadu_ps(pC + 16);
+    c10 = _mm512_loadu_ps(pC + ldc);
+    c11 = _mm512_loadu_ps(pC + ldc + 16);
+    c20 = _mm512_loadu_ps(pC + (2u * ldc));
+    c21 = _mm512_loadu_ps(pC + (2u * ldc) + 16);
+    c30 = _mm512_loadu_ps(pC + (3u * ldc));
+    c31 = _mm512_loadu_ps(pC + (3u * ldc) + 16);
+    c40 = _mm512_loadu_ps(pC + (4u * ldc));
+    c41 = _mm512_loadu_ps(pC + (4u * ldc) + 16);
+    c50 = _mm512_loadu_ps(pC + (5u * ldc));
+    c51 = _mm512_loadu_ps(pC + (5u * ldc) + 16);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    /* c(m,n) += a(m,k) * b(k,n) */
+    b0 = _mm512_loadu_ps(pB);
+    b1 = _mm512_loadu_ps(pB + 16);
+
+    a = _mm512_set1_ps(pA[k]);
+    c00 = _mm512_add_ps(c00, _mm512_mul_ps(a, b0));
+    c01 = _mm512_add_ps(c01, _mm512_mul_ps(a, b1));
+
+    a = _mm512_set1_ps(pA[lda + k]);
+    c10 = _mm512_add_ps(c10, _mm512_mul_ps(a, b0));
+    c11 = _mm512_add_ps(c11, _mm512_mul_ps(a, b1));
+
+    a = _mm512_set1_ps(pA[(2u * lda) + k]);
+    c20 = _mm512_add_ps(c20, _mm512_mul_ps(a, b0));
+    c21 = _mm512_add_ps(c21, _mm512_mul_ps(a, b1));
+
+    a = _mm512_set1_ps(pA[(3u * lda) + k]);
+    c30 = _mm512_add_ps(c30, _mm512_mul_ps(a, b0));
+    c31 = _mm512_add_ps(c31, _mm512_mul_ps(a, b1));
+
+    a = _mm512_set1_ps(pA[(4u * lda) + k]);
+    c40 = _mm512_add_ps(c40, _mm512_mul_ps(a, b0));
+    c41 = _mm512_add_ps(c41, _mm512_mul_ps(a, b1));
+
+    a = _mm512_set1_ps(pA[(5u * lda) + k]);
+    c50 = _mm512_add_ps(c50, _mm512_mul_ps(a, b0));
+    c51 = _mm512_add_ps(c51, _mm512_mul_ps(a, b1));
+
+    pB += 32;
+  }
+
+  _mm512_storeu_ps(pC, c00);
+  _mm512_storeu_ps(pC + 16, c01);
+  _mm512_storeu_ps(pC + ldc, c10);
+  _mm512_storeu_ps(pC + ldc + 16, c11);
+  _mm512_storeu_ps(pC + (2u * ldc), c20);
+  _mm512_storeu_ps(pC + (2u * ldc) + 16, c21);
+  _mm512_storeu_ps(pC + (3u * ldc), c30);
+  _mm512_storeu_ps(pC + (3u * ldc) + 16, c31);
+  _mm512_storeu_ps(pC + (4u * ldc), c40);
+  _mm512_storeu_ps(pC + (4u * ldc) + 16, c41);
+  _mm512_storeu_ps(pC + (5u * ldc), c50);
+  _mm512_storeu_ps(pC + (5u * ldc) + 16, c51);
+}
+
+ARM_HOST_TARGET("avx512f")
+static void arm_mat_mult_f32_avx512_1x32(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t kc,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t first)
+{
+  __m512 c00, c01, a;                            /* Tile of the product and broadcast element of A */
+  uint32_t k;                                    /* loop counter */
+
+  (void) lda;
+  (void) ldc;
+
+  if(first != 0u)
+  {
+    c00 = c01 = _mm512_setzero_ps();
+  }
+  else
+  {
+    c00 = _mm512_loadu_ps(pC);
+    c01 = _mm512_loadu_ps(pC + 16);
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    a = _mm512_set1_ps(pA[k]);
+    c00 = _mm512_add_ps(c00, _mm512_mul_ps(a, _mm512_loadu_ps(pB)));
+    c01 = _mm512_add_ps(c01, _mm512_mul_ps(a, _mm512_loadu_ps(pB + 16)));
+
+    pB += 32;
+  }
+
+  _mm512_storeu_ps(pC, c00);
+  _mm512_storeu_ps(pC + 16, c01);
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX512) */
+
+
 /**   
  * @ingroup groupMatrix   
  */
@@ -89,7 +655,8 @@ arm_status arm_mat_mult_f32(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  uint16_t col, j, row = numRowsA, colCnt;       /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -107,6 +674,44 @@ arm_status arm_mat_mult_f32(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
+#if defined (ARM_MATH_HOST_AVX2)
+
+    /* Run the below code on x86 hosts when pSrcB has at least one vector of columns.   
+     ** Large matrices are multiplied by blocks. */
+#if defined (ARM_MATH_HOST_AVX512)
+    if((numColsB >= 16u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX512))
+    {
+      if((numColsB >= 32u) && (((uint32_t) numColsA * numColsB) > ARM_MAT_MULT_F32_MAX))
+      {
+        arm_mat_mult_f32_blocked(pSrcA, pSrcB, pDst, 32u, arm_mat_mult_f32_avx512_6x32,
+                                 arm_mat_mult_f32_avx512_1x32);
+      }
+      else
+      {
+        arm_mat_mult_f32_avx512(pSrcA, pSrcB, pDst);
+      }
+
+      return (ARM_MATH_SUCCESS);
+    }
+#endif /* #if defined (ARM_MATH_HOST_AVX512) */
+
+    if((numColsB >= 8u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+    {
+      if((numColsB >= 16u) && (((uint32_t) numColsA * numColsB) > ARM_MAT_MULT_F32_MAX))
+      {
+        arm_mat_mult_f32_blocked(pSrcA, pSrcB, pDst, 16u, arm_mat_mult_f32_avx2_6x16,
+                                 arm_mat_mult_f32_avx2_1x16);
+      }
+      else
+      {
+        arm_mat_mult_f32_avx2(pSrcA, pSrcB, pDst);
+      }
+
+      return (ARM_MATH_SUCCESS);
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -183,7 +788,8 @@ arm_status arm_mat_mult_f32(
   /* Run the below code for Cortex-M0 */
 
   float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsA, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
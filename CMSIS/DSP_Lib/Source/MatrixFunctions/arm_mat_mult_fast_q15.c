@@ -29,6 +29,250 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * Blocked AVX2 kernel of arm_mat_mult_fast_q15().  pSrcB is cut into panels of
+ * up to 256 rows and 16 columns, which are copied to a contiguous buffer with
+ * the elements of two consecutive rows interleaved (columns past the end of
+ * pSrcB and a last odd row are completed with zeros), so that one
+ * _mm256_madd_epi16() computes two multiply-accumulates of 8 outputs like
+ * __SMLAD().  Each panel is multiplied with blocks of up to 48 rows of pSrcA by
+ * a micro-kernel that keeps a tile of 6 rows and 16 columns of sums in
+ * registers, and the sums of the panels are added up in a buffer of 16
+ * columns.  The 32-bit additions wrap around as in the portable code, so the
+ * results are the same.  pState is not used.
+ */
+
+#define ARM_MAT_MULT_Q15_KC   256u               /* rows of the panels of pSrcB */
+#define ARM_MAT_MULT_Q15_MC   48u                /* rows of the blocks of pSrcA */
+#define ARM_MAT_MULT_Q15_MR   6u                 /* rows of the micro-kernel tile */
+#define ARM_MAT_MULT_Q15_NR   16u                /* columns of the panels and tiles */
+
+/*
+ * Micro-kernel: adds the products of ARM_MAT_MULT_Q15_MR rows of pSrcA,
+ * starting at pA with a stride of lda, with a panel of kc rows to the tile at
+ * pC.  The tile is cleared first when first is set.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_fast_q15_avx2_6x16(
+  const q15_t * pA,
+  uint32_t lda,
+  const q31_t * pB,
+  uint32_t kc,
+  q31_t * pC,
+  uint32_t first)
+{
+  __m256i c00, c01, c10, c11, c20, c21;          /* Tile of the product */
+  __m256i c30, c31, c40, c41, c50, c51;
+  __m256i b0, b1, a;                             /* Rows of the panel and broadcast elements of A */
+  uint32_t k;                                    /* loop counter */
+
+  if(first != 0u)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_si256();
+    c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_si256();
+  }
+  else
+  {
+    c00 = _mm256_loadu_si256((const __m256i *) pC);
+    c01 = _mm256_loadu_si256((const __m256i *) (pC + 8));
+    c10 = _mm256_loadu_si256((const __m256i *) (pC + 16));
+    c11 = _mm256_loadu_si256((const __m256i *) (pC + 24));
+    c20 = _mm256_loadu_si256((const __m256i *) (pC + 32));
+    c21 = _mm256_loadu_si256((const __m256i *) (pC + 40));
+    c30 = _mm256_loadu_si256((const __m256i *) (pC + 48));
+    c31 = _mm256_loadu_si256((const __m256i *) (pC + 56));
+    c40 = _mm256_loadu_si256((const __m256i *) (pC + 64));
+    c41 = _mm256_loadu_si256((const __m256i *) (pC + 72));
+    c50 = _mm256_loadu_si256((const __m256i *) (pC + 80));
+    c51 = _mm256_loadu_si256((const __m256i *) (pC + 88));
+  }
+
+  for (k = 0u; k < kc; k += 2u)
+  {
+    /* c(m,n) += a(m,k) * b(k,n) + a(m,k+1) * b(k+1,n) */
+    b0 = _mm256_loadu_si256((const __m256i *) pB);
+    b1 = _mm256_loadu_si256((const __m256i *) (pB + 8));
+
+    /* The last odd element of the rows is paired with zero */
+    if((k + 1u) < kc)
+    {
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + k));
+      c00 = _mm256_add_epi32(c00, _mm256_madd_epi16(a, b0));
+      c01 = _mm256_add_epi32(c01, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + lda + k));
+      c10 = _mm256_add_epi32(c10, _mm256_madd_epi16(a, b0));
+      c11 = _mm256_add_epi32(c11, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + (2u * lda) + k));
+      c20 = _mm256_add_epi32(c20, _mm256_madd_epi16(a, b0));
+      c21 = _mm256_add_epi32(c21, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + (3u * lda) + k));
+      c30 = _mm256_add_epi32(c30, _mm256_madd_epi16(a, b0));
+      c31 = _mm256_add_epi32(c31, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + (4u * lda) + k));
+      c40 = _mm256_add_epi32(c40, _mm256_madd_epi16(a, b0));
+      c41 = _mm256_add_epi32(c41, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32(*(const q31_t *) (pA + (5u * lda) + k));
+      c50 = _mm256_add_epi32(c50, _mm256_madd_epi16(a, b0));
+      c51 = _mm256_add_epi32(c51, _mm256_madd_epi16(a, b1));
+    }
+    else
+    {
+      a = _mm256_set1_epi32((uint16_t) pA[k]);
+      c00 = _mm256_add_epi32(c00, _mm256_madd_epi16(a, b0));
+      c01 = _mm256_add_epi32(c01, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32((uint16_t) pA[lda + k]);
+      c10 = _mm256_add_epi32(c10, _mm256_madd_epi16(a, b0));
+      c11 = _mm256_add_epi32(c11, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32((uint16_t) pA[(2u * lda) + k]);
+      c20 = _mm256_add_epi32(c20, _mm256_madd_epi16(a, b0));
+      c21 = _mm256_add_epi32(c21, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32((uint16_t) pA[(3u * lda) + k]);
+      c30 = _mm256_add_epi32(c30, _mm256_madd_epi16(a, b0));
+      c31 = _mm256_add_epi32(c31, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32((uint16_t) pA[(4u * lda) + k]);
+      c40 = _mm256_add_epi32(c40, _mm256_madd_epi16(a, b0));
+      c41 = _mm256_add_epi32(c41, _mm256_madd_epi16(a, b1));
+
+      a = _mm256_set1_epi32((uint16_t) pA[(5u * lda) + k]);
+      c50 = _mm256_add_epi32(c50, _mm256_madd_epi16(a, b0));
+      c51 = _mm256_add_epi32(c51, _mm256_madd_epi16(a, b1));
+    }
+
+    pB += 16;
+  }
+
+  _mm256_storeu_si256((__m256i *) pC, c00);
+  _mm256_storeu_si256((__m256i *) (pC + 8), c01);
+  _mm256_storeu_si256((__m256i *) (pC + 16), c10);
+  _mm256_storeu_si256((__m256i *) (pC + 24), c11);
+  _mm256_storeu_si256((__m256i *) (pC + 32), c20);
+  _mm256_storeu_si256((__m256i *) (pC + 40), c21);
+  _mm256_storeu_si256((__m256i *) (pC + 48), c30);
+  _mm256_storeu_si256((__m256i *) (pC + 56), c31);
+  _mm256_storeu_si256((__m256i *) (pC + 64), c40);
+  _mm256_storeu_si256((__m256i *) (pC + 72), c41);
+  _mm256_storeu_si256((__m256i *) (pC + 80), c50);
+  _mm256_storeu_si256((__m256i *) (pC + 88), c51);
+}
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_fast_q15_avx2(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst)
+{
+  q31_t packB[(ARM_MAT_MULT_Q15_KC / 2u) * ARM_MAT_MULT_Q15_NR];  /* packed panel of pSrcB */
+  q31_t tile[ARM_MAT_MULT_Q15_MC * ARM_MAT_MULT_Q15_NR];         /* sums of a block of rows */
+  __m256i c0, c1, a;                             /* Sums of a remaining row and broadcast elements of A */
+  q15_t *pA;                                     /* row pointer of pSrcA */
+  q15_t lo, hi;                                  /* elements of two rows of pSrcB */
+  q31_t *pB, *pC;                                /* panel and tile pointers */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t col, row, k, mc, nc, kc, r, j;        /* loop counters and block sizes */
+
+  for (col = 0u; col < numColsB; col += ARM_MAT_MULT_Q15_NR)
+  {
+    nc = ((numColsB - col) < ARM_MAT_MULT_Q15_NR) ? (numColsB - col) : ARM_MAT_MULT_Q15_NR;
+
+    for (row = 0u; row < numRowsA; row += ARM_MAT_MULT_Q15_MC)
+    {
+      mc = ((numRowsA - row) < ARM_MAT_MULT_Q15_MC) ? (numRowsA - row) : ARM_MAT_MULT_Q15_MC;
+
+      /* At least one panel, so that the tile is cleared when numColsA is zero */
+      k = 0u;
+
+      do
+      {
+        kc = ((numColsA - k) < ARM_MAT_MULT_Q15_KC) ? (numColsA - k) : ARM_MAT_MULT_Q15_KC;
+
+        /* Pack the panel of pSrcB, which is kept for all the blocks of rows when it is the only one */
+        if((row == 0u) || (numColsA > ARM_MAT_MULT_Q15_KC))
+        {
+          pB = packB;
+
+          for (r = 0u; r < kc; r += 2u)
+          {
+            for (j = 0u; j < ARM_MAT_MULT_Q15_NR; j++)
+            {
+              lo = (j < nc) ? pSrcB->pData[((k + r) * numColsB) + col + j] : 0;
+              hi = ((j < nc) && ((r + 1u) < kc)) ? pSrcB->pData[((k + r + 1u) * numColsB) + col + j] : 0;
+
+              pB[j] = (q31_t) (((uint32_t) (uint16_t) hi << 16) | (uint16_t) lo);
+            }
+
+            pB += ARM_MAT_MULT_Q15_NR;
+          }
+        }
+
+        /* Multiply the block of rows of pSrcA with the panel */
+        for (r = 0u; (r + ARM_MAT_MULT_Q15_MR) <= mc; r += ARM_MAT_MULT_Q15_MR)
+        {
+          arm_mat_mult_fast_q15_avx2_6x16(pSrcA->pData + ((row + r) * numColsA) + k, numColsA, packB, kc,
+                                          tile + (r * ARM_MAT_MULT_Q15_NR), (k == 0u));
+        }
+
+        for (; r < mc; r++)
+        {
+          pA = pSrcA->pData + ((row + r) * numColsA) + k;
+          pB = packB;
+          pC = tile + (r * ARM_MAT_MULT_Q15_NR);
+
+          if(k == 0u)
+          {
+            c0 = c1 = _mm256_setzero_si256();
+          }
+          else
+          {
+            c0 = _mm256_loadu_si256((const __m256i *) pC);
+            c1 = _mm256_loadu_si256((const __m256i *) (pC + 8));
+          }
+
+          for (j = 0u; j < kc; j += 2u)
+          {
+            a = ((j + 1u) < kc) ? _mm256_set1_epi32(*(const q31_t *) (pA + j)) :
+              _mm256_set1_epi32((uint16_t) pA[j]);
+            c0 = _mm256_add_epi32(c0, _mm256_madd_epi16(a, _mm256_loadu_si256((const __m256i *) pB)));
+            c1 = _mm256_add_epi32(c1, _mm256_madd_epi16(a, _mm256_loadu_si256((const __m256i *) (pB + 8))));
+
+            pB += ARM_MAT_MULT_Q15_NR;
+          }
+
+          _mm256_storeu_si256((__m256i *) pC, c0);
+          _mm256_storeu_si256((__m256i *) (pC + 8), c1);
+        }
+
+        k += ARM_MAT_MULT_Q15_KC;
+
+      } while(k < numColsA);
+
+      /* Store the valid columns in 1.15 format in pDst */
+      for (r = 0u; r < mc; r++)
+      {
+        for (j = 0u; j < nc; j++)
+        {
+          pDst->pData[((row + r) * numColsB) + col + j] = (q15_t) (tile[(r * ARM_MAT_MULT_Q15_NR) + j] >> 15);
+        }
+      }
+    }
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
 /**   
  * @ingroup groupMatrix   
  */
@@ -88,7 +332,8 @@ arm_status arm_mat_mult_fast_q15(
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
   uint16_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix A    */
-  uint16_t col, i = 0u, row = numRowsB, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsB, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -106,6 +351,17 @@ arm_status arm_mat_mult_fast_q15(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
+#if defined (ARM_MATH_HOST_AVX2)
+
+    /* Run the below code on x86 hosts when pSrcB has at least one vector of columns */
+    if((numColsB >= 8u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+    {
+      arm_mat_mult_fast_q15_avx2(pSrcA, pSrcB, pDst);
+      return (ARM_MATH_SUCCESS);
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
     /* Matrix transpose */
     do
     {
@@ -84,7 +84,8 @@ arm_status arm_mat_mult_fast_q31(
   uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A    */
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  uint16_t col, j, row = numRowsA, colCnt;       /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 
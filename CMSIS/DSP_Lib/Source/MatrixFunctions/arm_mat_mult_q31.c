@@ -35,6 +35,213 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * Blocked AVX2 kernel of arm_mat_mult_q31().  pSrcB is cut into panels of up
+ * to 256 rows and 8 columns, which are copied to a contiguous buffer as 64-bit
+ * values (columns past the end of pSrcB are set to zero) so that they stay in
+ * the level 1 cache.  Each panel is multiplied with blocks of up to 48 rows of
+ * pSrcA by a micro-kernel that keeps a tile of 6 rows and 8 columns of 2.62
+ * sums in registers, and the sums of the panels are added up in a buffer of
+ * 8 columns.  The additions wrap around as in the portable code, so the
+ * results are the same.
+ */
+
+#define ARM_MAT_MULT_Q31_KC   256u               /* rows of the panels of pSrcB */
+#define ARM_MAT_MULT_Q31_MC   48u                /* rows of the blocks of pSrcA */
+#define ARM_MAT_MULT_Q31_MR   6u                 /* rows of the micro-kernel tile */
+#define ARM_MAT_MULT_Q31_NR   8u                 /* columns of the panels and tiles */
+
+/*
+ * Micro-kernel: adds the products of ARM_MAT_MULT_Q31_MR rows of pSrcA,
+ * starting at pA with a stride of lda, with a panel of kc rows to the tile at
+ * pC.  The tile is cleared first when first is set.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_q31_avx2_6x8(
+  const q31_t * pA,
+  uint32_t lda,
+  const q63_t * pB,
+  uint32_t kc,
+  q63_t * pC,
+  uint32_t first)
+{
+  __m256i c00, c01, c10, c11, c20, c21;          /* Tile of the product */
+  __m256i c30, c31, c40, c41, c50, c51;
+  __m256i b0, b1, a;                             /* Row of the panel and broadcast element of A */
+  uint32_t k;                                    /* loop counter */
+
+  if(first != 0u)
+  {
+    c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_si256();
+    c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_si256();
+  }
+  else
+  {
+    c00 = _mm256_loadu_si256((const __m256i *) pC);
+    c01 = _mm256_loadu_si256((const __m256i *) (pC + 4));
+    c10 = _mm256_loadu_si256((const __m256i *) (pC + 8));
+    c11 = _mm256_loadu_si256((const __m256i *) (pC + 12));
+    c20 = _mm256_loadu_si256((const __m256i *) (pC + 16));
+    c21 = _mm256_loadu_si256((const __m256i *) (pC + 20));
+    c30 = _mm256_loadu_si256((const __m256i *) (pC + 24));
+    c31 = _mm256_loadu_si256((const __m256i *) (pC + 28));
+    c40 = _mm256_loadu_si256((const __m256i *) (pC + 32));
+    c41 = _mm256_loadu_si256((const __m256i *) (pC + 36));
+    c50 = _mm256_loadu_si256((const __m256i *) (pC + 40));
+    c51 = _mm256_loadu_si256((const __m256i *) (pC + 44));
+  }
+
+  for (k = 0u; k < kc; k++)
+  {
+    /* c(m,n) += (q63_t) a(m,k) * b(k,n) */
+    b0 = _mm256_loadu_si256((const __m256i *) pB);
+    b1 = _mm256_loadu_si256((const __m256i *) (pB + 4));
+
+    a = _mm256_set1_epi32(pA[k]);
+    c00 = _mm256_add_epi64(c00, _mm256_mul_epi32(a, b0));
+    c01 = _mm256_add_epi64(c01, _mm256_mul_epi32(a, b1));
+
+    a = _mm256_set1_epi32(pA[lda + k]);
+    c10 = _mm256_add_epi64(c10, _mm256_mul_epi32(a, b0));
+    c11 = _mm256_add_epi64(c11, _mm256_mul_epi32(a, b1));
+
+    a = _mm256_set1_epi32(pA[(2u * lda) + k]);
+    c20 = _mm256_add_epi64(c20, _mm256_mul_epi32(a, b0));
+    c21 = _mm256_add_epi64(c21, _mm256_mul_epi32(a, b1));
+
+    a = _mm256_set1_epi32(pA[(3u * lda) + k]);
+    c30 = _mm256_add_epi64(c30, _mm256_mul_epi32(a, b0));
+    c31 = _mm256_add_epi64(c31, _mm256_mul_epi32(a, b1));
+
+    a = _mm256_set1_epi32(pA[(4u * lda) + k]);
+    c40 = _mm256_add_epi64(c40, _mm256_mul_epi32(a, b0));
+    c41 = _mm256_add_epi64(c41, _mm256_mul_epi32(a, b1));
+
+    a = _mm256_set1_epi32(pA[(5u * lda) + k]);
+    c50 = _mm256_add_epi64(c50, _mm256_mul_epi32(a, b0));
+    c51 = _mm256_add_epi64(c51, _mm256_mul_epi32(a, b1));
+
+    pB += 8;
+  }
+
+  _mm256_storeu_si256((__m256i *) pC, c00);
+  _mm256_storeu_si256((__m256i *) (pC + 4), c01);
+  _mm256_storeu_si256((__m256i *) (pC + 8), c10);
+  _mm256_storeu_si256((__m256i *) (pC + 12), c11);
+  _mm256_storeu_si256((__m256i *) (pC + 16), c20);
+  _mm256_storeu_si256((__m256i *) (pC + 20), c21);
+  _mm256_storeu_si256((__m256i *) (pC + 24), c30);
+  _mm256_storeu_si256((__m256i *) (pC + 28), c31);
+  _mm256_storeu_si256((__m256i *) (pC + 32), c40);
+  _mm256_storeu_si256((__m256i *) (pC + 36), c41);
+  _mm256_storeu_si256((__m256i *) (pC + 40), c50);
+  _mm256_storeu_si256((__m256i *) (pC + 44), c51);
+}
+
+ARM_HOST_TARGET("avx2")
+static void arm_mat_mult_q31_avx2(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  q63_t packB[ARM_MAT_MULT_Q31_KC * ARM_MAT_MULT_Q31_NR];        /* packed panel of pSrcB */
+  q63_t tile[ARM_MAT_MULT_Q31_MC * ARM_MAT_MULT_Q31_NR];         /* sums of a block of rows */
+  __m256i c0, c1, a;                             /* Sums of a remaining row and broadcast element of A */
+  q31_t *pA;                                     /* row pointer of pSrcA */
+  q63_t *pB, *pC;                                /* panel and tile pointers */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t col, row, k, mc, nc, kc, r, j;        /* loop counters and block sizes */
+
+  for (col = 0u; col < numColsB; col += ARM_MAT_MULT_Q31_NR)
+  {
+    nc = ((numColsB - col) < ARM_MAT_MULT_Q31_NR) ? (numColsB - col) : ARM_MAT_MULT_Q31_NR;
+
+    for (row = 0u; row < numRowsA; row += ARM_MAT_MULT_Q31_MC)
+    {
+      mc = ((numRowsA - row) < ARM_MAT_MULT_Q31_MC) ? (numRowsA - row) : ARM_MAT_MULT_Q31_MC;
+
+      /* At least one panel, so that the tile is cleared when numColsA is zero */
+      k = 0u;
+
+      do
+      {
+        kc = ((numColsA - k) < ARM_MAT_MULT_Q31_KC) ? (numColsA - k) : ARM_MAT_MULT_Q31_KC;
+
+        /* Pack the panel of pSrcB, which is kept for all the blocks of rows when it is the only one */
+        if((row == 0u) || (numColsA > ARM_MAT_MULT_Q31_KC))
+        {
+          pB = packB;
+
+          for (r = 0u; r < kc; r++)
+          {
+            for (j = 0u; j < ARM_MAT_MULT_Q31_NR; j++)
+            {
+              pB[j] = (j < nc) ? (q63_t) pSrcB->pData[((k + r) * numColsB) + col + j] : 0;
+            }
+
+            pB += ARM_MAT_MULT_Q31_NR;
+          }
+        }
+
+        /* Multiply the block of rows of pSrcA with the panel */
+        for (r = 0u; (r + ARM_MAT_MULT_Q31_MR) <= mc; r += ARM_MAT_MULT_Q31_MR)
+        {
+          arm_mat_mult_q31_avx2_6x8(pSrcA->pData + ((row + r) * numColsA) + k, numColsA, packB, kc,
+                                    tile + (r * ARM_MAT_MULT_Q31_NR), (k == 0u));
+        }
+
+        for (; r < mc; r++)
+        {
+          pA = pSrcA->pData + ((row + r) * numColsA) + k;
+          pB = packB;
+          pC = tile + (r * ARM_MAT_MULT_Q31_NR);
+
+          if(k == 0u)
+          {
+            c0 = c1 = _mm256_setzero_si256();
+          }
+          else
+          {
+            c0 = _mm256_loadu_si256((const __m256i *) pC);
+            c1 = _mm256_loadu_si256((const __m256i *) (pC + 4));
+          }
+
+          for (j = 0u; j < kc; j++)
+          {
+            a = _mm256_set1_epi32(pA[j]);
+            c0 = _mm256_add_epi64(c0, _mm256_mul_epi32(a, _mm256_loadu_si256((const __m256i *) pB)));
+            c1 = _mm256_add_epi64(c1, _mm256_mul_epi32(a, _mm256_loadu_si256((const __m256i *) (pB + 4))));
+
+            pB += ARM_MAT_MULT_Q31_NR;
+          }
+
+          _mm256_storeu_si256((__m256i *) pC, c0);
+          _mm256_storeu_si256((__m256i *) (pC + 4), c1);
+        }
+
+        k += ARM_MAT_MULT_Q31_KC;
+
+      } while(k < numColsA);
+
+      /* Convert the sums from 2.62 to 1.31 format and store the valid columns in pDst */
+      for (r = 0u; r < mc; r++)
+      {
+        for (j = 0u; j < nc; j++)
+        {
+          pDst->pData[((row + r) * numColsB) + col + j] = (q31_t) (tile[(r * ARM_MAT_MULT_Q31_NR) + j] >> 31);
+        }
+      }
+    }
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
 /**   
  * @ingroup groupMatrix   
  */
@@ -89,7 +296,8 @@ arm_status arm_mat_mult_q31(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  uint16_t col, j, row = numRowsA, colCnt;       /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 
@@ -107,6 +315,17 @@ arm_status arm_mat_mult_q31(
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
+#if defined (ARM_MATH_HOST_AVX2)
+
+    /* Run the below code on x86 hosts when pSrcB has at least one vector of columns */
+    if((numColsB >= 4u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+    {
+      arm_mat_mult_q31_avx2(pSrcA, pSrcB, pDst);
+      return (ARM_MATH_SUCCESS);
+    }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -189,7 +408,8 @@ arm_status arm_mat_mult_q31(
   /* Run the below code for Cortex-M0 */
 
   q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsA, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* output and row offset */
   arm_status status;                             /* status of matrix multiplication */
 
 
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_trans_f32.c
+*
+* Description:	Floating-point multiplication by a transposed matrix.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixMultTrans Matrix Multiplication by a Transpose
+ *
+ * Computes <code>A * B'</code>, where <code>A</code> is an <code>M x N</code> and
+ * <code>B</code> a <code>P x N</code> matrix, without storing <code>B'</code>.
+ * Each output element is the product of a row of <code>A</code> and a row of
+ * <code>B</code>, which are both contiguous in memory.
+ * Replacing arm_mat_trans_f32() followed by arm_mat_mult_f32() saves the transposed
+ * copy and its memory traffic.
+ */
+
+/**
+ * @addtogroup MatrixMultTrans
+ * @{
+ */
+
+/**
+ * @brief Floating-point multiplication by a transposed matrix.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure, which is transposed
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+
+arm_status arm_mat_mult_trans_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrcA->pData;                  /* input data matrix pointer A */
+  float32_t *pB = pSrcB->pData;                  /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pAi, *pBj;                          /* row pointers of A and B */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of A */
+  uint32_t numRowsB = pSrcB->numRows;            /* number of rows of B */
+  uint32_t numCols = pSrcA->numCols;             /* number of columns of A and B */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numCols) || (pSrcA->numRows != pDst->numRows)
+     || (pSrcB->numRows != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRowsA; i++)
+  {
+    for (j = 0u; j < numRowsB; j++)
+    {
+      pAi = pA + (i * numCols);
+      pBj = pB + (j * numCols);
+      sum = 0.0f;
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* D(i,j) = A(i,:) * B(j,:)' */
+        sum += pAi[0] * pBj[0];
+        sum += pAi[1] * pBj[1];
+        sum += pAi[2] * pBj[2];
+        sum += pAi[3] * pBj[3];
+
+        pAi += 4u;
+        pBj += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum += *pAi++ * *pBj++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      *pOut++ = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixMultTrans group
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_f32.c
+*
+* Description:	Floating-point Householder QR decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition
+ *
+ * Decomposes an <code>M x N</code> matrix <code>A</code>, with <code>M >= N</code>, into
+ * <code>A = Q * R</code>, where <code>Q</code> is an <code>M x M</code> orthogonal matrix
+ * and <code>R</code> is upper triangular.
+ *
+ * \par Algorithm
+ * <code>Q</code> is the product of <code>N</code> Householder reflections
+ * <code>H(k) = I - tau(k) * v(k) * v(k)'</code>.  Reflection <code>k</code> sets the
+ * elements of column <code>k</code> below the diagonal to zero; <code>v(k)</code> is zero
+ * above row <code>k</code> and one on row <code>k</code>.
+ * The output holds <code>R</code> on and above the diagonal and the elements of the
+ * vectors <code>v(k)</code> below row <code>k</code> below the diagonal, and the factors
+ * <code>tau(k)</code> are returned in an array <code>pTau</code> of <code>N</code> values
+ * (the layout of the LAPACK function <code>xGEQRF</code>).
+ * If a diagonal element of <code>R</code> is zero, the columns of <code>A</code> are
+ * linearly dependent: the decomposition is completed and the function returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * The least squares solution of <code>A * X = B</code> is then computed by
+ * arm_mat_qr_solve_f32().  It is more accurate than the normal equations, which
+ * square the condition number of <code>A</code>.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point Householder QR decomposition.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pDst points to the output matrix structure of R and of the reflections
+ * @param[out]      *pTau points to the array of <code>numCols</code> factors of the reflections
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * input matrix has more columns than rows or if the size of the output matrix does not
+ * match, <code>ARM_MATH_SINGULAR</code> if <code>R</code> has a zero on the diagonal or
+ * <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ * The elements of <code>pTau</code> after <code>k</code> are used as scratch while
+ * reflection <code>k</code> is applied.
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRow, *pW;                          /* row and scratch pointers */
+  float32_t alpha, beta, xnorm, tau, scale, v;   /* Temporary values of the reflection */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t i, j, k, blkCnt;                      /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows < pSrc->numCols) || (pDst->numRows != pSrc->numRows)
+     || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* The decomposition is computed in place in pDst */
+  if(pDst->pData != pSrc->pData)
+  {
+    memcpy(pA, pSrc->pData, (numRows * numCols) * sizeof(float32_t));
+  }
+
+  for (k = 0u; k < numCols; k++)
+  {
+    /* Norm of column k below the diagonal */
+    alpha = pA[(k * numCols) + k];
+    xnorm = 0.0f;
+
+    for (i = k + 1u; i < numRows; i++)
+    {
+      v = pA[(i * numCols) + k];
+      xnorm += v * v;
+    }
+
+    if(xnorm == 0.0f)
+    {
+      /* Column k is already reduced: H(k) = I */
+      pTau[k] = 0.0f;
+
+      if(alpha == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+
+      continue;
+    }
+
+    /* beta = -sign(alpha) * norm(column k), R(k,k) = beta and v = x / (alpha - beta) */
+    arm_sqrt_f32((alpha * alpha) + xnorm, &beta);
+    beta = (alpha >= 0.0f) ? -beta : beta;
+
+    tau = (beta - alpha) / beta;
+    scale = 1.0f / (alpha - beta);
+
+    pA[(k * numCols) + k] = beta;
+
+    for (i = k + 1u; i < numRows; i++)
+    {
+      pA[(i * numCols) + k] *= scale;
+    }
+
+    /* Apply H(k) to the columns after k: w = A' * v, A = A - tau * v * w' */
+    pW = pTau + k + 1u;
+
+    memcpy(pW, pA + (k * numCols) + k + 1u, (numCols - k - 1u) * sizeof(float32_t));
+
+    for (i = k + 1u; i < numRows; i++)
+    {
+      pRow = pA + (i * numCols) + k;
+      v = *pRow++;
+
+      for (j = 0u; j < (numCols - k - 1u); j++)
+      {
+        pW[j] += v * pRow[j];
+      }
+    }
+
+    for (i = k; i < numRows; i++)
+    {
+      pRow = pA + (i * numCols) + k;
+      v = (i == k) ? tau : (tau * *pRow);
+      pRow++;
+
+      /* Apply loop unrolling and compute 4 outputs at a time. */
+      blkCnt = (numCols - k - 1u) >> 2u;
+      j = 0u;
+
+      while(blkCnt > 0u)
+      {
+        /* A(i,j) -= tau * v(i) * w(j) */
+        pRow[j] -= v * pW[j];
+        pRow[j + 1u] -= v * pW[j + 1u];
+        pRow[j + 2u] -= v * pW[j + 2u];
+        pRow[j + 3u] -= v * pW[j + 3u];
+
+        j += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining outputs */
+      for (; j < (numCols - k - 1u); j++)
+      {
+        pRow[j] -= v * pW[j];
+      }
+    }
+
+    pTau[k] = tau;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
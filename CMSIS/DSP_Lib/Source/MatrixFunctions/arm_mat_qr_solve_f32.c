@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_solve_f32.c
+*
+* Description:	Floating-point least squares solution with a QR decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point least squares solution with a QR decomposition.
+ * @param[in]       *pSrcQR points to the matrix structure computed by arm_mat_qr_f32()
+ * @param[in]       *pTau points to the factors of the reflections computed by arm_mat_qr_f32()
+ * @param[in]       *pSrcB points to the <code>M x P</code> matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the <code>M x P</code> output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if <code>R</code>
+ * has a zero on the diagonal or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The function computes <code>Q' * B</code> in <code>pDst</code> by applying the
+ * reflections in turn, and solves <code>R * X = (Q' * B)</code> on its first
+ * <code>N</code> rows with arm_mat_solve_upper_triangular_f32().
+ * The first <code>N</code> rows of <code>pDst</code> then hold the <code>N x P</code>
+ * solution, which minimizes the norm of <code>A * X - B</code>, and the norm of the
+ * last <code>M - N</code> rows is the norm of the residual.
+ * <code>pSrcB</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  arm_matrix_instance_f32 R;                     /* upper N x N part of pSrcQR */
+  arm_matrix_instance_f32 X;                     /* first N rows of pDst */
+  float32_t *pV;                                 /* column pointer of the reflection */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t w;                                   /* product of v and a column of pDst */
+  uint32_t numRows = pSrcQR->numRows;            /* number of equations */
+  uint32_t numCols = pSrcQR->numCols;            /* number of unknowns */
+  uint32_t numRhs = pSrcB->numCols;              /* number of right-hand sides */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcQR->numRows < pSrcQR->numCols) || (pSrcQR->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(pDst->pData != pSrcB->pData)
+  {
+    memcpy(pDst->pData, pSrcB->pData, (numRows * numRhs) * sizeof(float32_t));
+  }
+
+  /* Q' * B = H(N-1) * ... * H(0) * B */
+  for (k = 0u; k < numCols; k++)
+  {
+    if(pTau[k] == 0.0f)
+    {
+      continue;
+    }
+
+    for (j = 0u; j < numRhs; j++)
+    {
+      pV = pSrcQR->pData + (k * numCols) + k;
+      pX = pDst->pData + (k * numRhs) + j;
+
+      /* w = tau * v' * x, with v(k) = 1 */
+      w = pX[0];
+
+      for (i = 1u; i < (numRows - k); i++)
+      {
+        w += pV[i * numCols] * pX[i * numRhs];
+      }
+
+      w *= pTau[k];
+
+      /* x = x - w * v */
+      pX[0] -= w;
+
+      for (i = 1u; i < (numRows - k); i++)
+      {
+        pX[i * numRhs] -= w * pV[i * numCols];
+      }
+    }
+  }
+
+  /* Back substitution R * X = (Q' * B) on the first N rows */
+  R.numRows = (uint16_t) numCols;
+  R.numCols = (uint16_t) numCols;
+  R.pData = pSrcQR->pData;
+
+  X.numRows = (uint16_t) numCols;
+  X.numCols = (uint16_t) numRhs;
+  X.pData = pDst->pData;
+
+  return (arm_mat_solve_upper_triangular_f32(&R, &X, &X));
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_lower_triangular_f32.c
+*
+* Description:	Floating-point forward substitution.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Triangular Solvers
+ *
+ * Solve <code>L * X = B</code> or <code>U * X = B</code> where <code>L</code> is a
+ * lower and <code>U</code> an upper triangular <code>N x N</code> matrix and <code>B</code>
+ * an <code>N x P</code> matrix of right-hand sides.
+ *
+ * \par Algorithm
+ * Forward substitution computes the rows of <code>X</code> from the first to the last:
+ * <pre>
+ *     X(i,j) = (B(i,j) - sum(L(i,k) * X(k,j), k = 0..i-1)) / L(i,i)
+ * </pre>
+ * and back substitution from the last to the first:
+ * <pre>
+ *     X(i,j) = (B(i,j) - sum(U(i,k) * X(k,j), k = i+1..N-1)) / U(i,i)
+ * </pre>
+ * Only the triangle of the coefficient matrix that is used is read, so that the
+ * factors computed in place by arm_mat_cholesky_f32() and the functions of the
+ * other decompositions can be passed directly.
+ * <code>B</code> and <code>X</code> may be the same matrix, in which case the solution
+ * overwrites the right-hand sides.
+ * If a diagonal element of the coefficient matrix is zero, the functions return
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * Solving a linear system with a decomposition and the triangular solvers is faster
+ * and more accurate than multiplying by the inverse computed by arm_mat_inverse_f32().
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point forward substitution.
+ * @param[in]       *pSrcL points to the lower triangular matrix structure
+ * @param[in]       *pSrcB points to the matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal
+ * element of <code>pSrcL</code> is zero or <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL;                                 /* row pointer of pSrcL */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcB->numRows;             /* number of equations */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcL->numRows != pSrcL->numCols) || (pSrcL->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Solve one column of right-hand sides at a time */
+  for (j = 0u; j < numCols; j++)
+  {
+    for (i = 0u; i < numRows; i++)
+    {
+      /* Row i of L and column j of the solved rows of X */
+      pL = pSrcL->pData + (i * numRows);
+      pX = pDst->pData + j;
+
+      sum = pSrcB->pData[(i * numCols) + j];
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = i >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* sum -= L(i,k) * X(k,j) */
+        sum -= pL[0] * pX[0];
+        sum -= pL[1] * pX[numCols];
+        sum -= pL[2] * pX[2u * numCols];
+        sum -= pL[3] * pX[3u * numCols];
+
+        pL += 4u;
+        pX += 4u * numCols;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = i % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum -= *pL++ * *pX;
+        pX += numCols;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* pL points to the diagonal element */
+      if(*pL == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      *pX = sum / *pL;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
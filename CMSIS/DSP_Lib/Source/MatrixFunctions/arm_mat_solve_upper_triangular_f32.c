@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_upper_triangular_f32.c
+*
+* Description:	Floating-point back substitution.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point back substitution.
+ * @param[in]       *pSrcU points to the upper triangular matrix structure
+ * @param[in]       *pSrcB points to the matrix structure of the right-hand sides
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * sizes of the matrices do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal
+ * element of <code>pSrcU</code> is zero or <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pU;                                 /* row pointer of pSrcU */
+  float32_t *pX;                                 /* column pointer of pDst */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcB->numRows;             /* number of equations */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcU->numRows != pSrcU->numCols) || (pSrcU->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Solve one column of right-hand sides at a time */
+  for (j = 0u; j < numCols; j++)
+  {
+    /* Rows from the last to the first */
+    for (i = numRows; i > 0u; i--)
+    {
+      /* Diagonal element of row i - 1 of U and element of X below it */
+      pU = pSrcU->pData + ((i - 1u) * numRows) + (i - 1u);
+      pX = pDst->pData + (i * numCols) + j;
+
+      if(*pU == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      sum = pSrcB->pData[((i - 1u) * numCols) + j];
+      pU++;
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = (numRows - i) >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* sum -= U(i,k) * X(k,j) */
+        sum -= pU[0] * pX[0];
+        sum -= pU[1] * pX[numCols];
+        sum -= pU[2] * pX[2u * numCols];
+        sum -= pU[3] * pX[3u * numCols];
+
+        pU += 4u;
+        pX += 4u * numCols;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = (numRows - i) % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum -= *pU++ * *pX;
+        pX += numCols;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      pDst->pData[((i - 1u) * numCols) + j] = sum / pSrcU->pData[((i - 1u) * numRows) + (i - 1u)];
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_abat_f32.c
+*
+* Description:	Floating-point symmetric product A * S * A'.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point symmetric product A * S * A'.
+ * @param[in]       *pSrcA points to the <code>M x N</code> input matrix structure
+ * @param[in]       *pSrcS points to the <code>N x N</code> input packed symmetric matrix structure
+ * @param[out]      *pDst points to the <code>M x M</code> output packed symmetric matrix structure
+ * @param[in]       *pScratch points to a scratch buffer of <code>N</code> values
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * For each row <code>i</code> of <code>A</code>, the function computes
+ * <code>t = S * A(i,:)'</code> in the scratch buffer with arm_mat_sym_vec_mult_f32(),
+ * and the lower triangle <code>D(i,j) = A(j,:) * t</code> for <code>j <= i</code>.
+ * Neither <code>A * S</code> nor <code>A'</code> is stored, and only the
+ * <code>M * (M + 1) / 2</code> independent outputs are computed.
+ */
+
+arm_status arm_mat_sym_abat_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_sym_f32 * pSrcS,
+  arm_matrix_instance_sym_f32 * pDst,
+  float32_t * pScratch)
+{
+  float32_t *pA = pSrcA->pData;                  /* input data matrix pointer A */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pAj, *pT;                           /* row pointer of A and scratch pointer */
+  float32_t sum;                                 /* accumulator */
+  uint32_t numRows = pSrcA->numRows;             /* number of rows of A */
+  uint32_t numCols = pSrcA->numCols;             /* number of columns of A */
+  uint32_t i, j, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcS->numRows) || (pSrcA->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* t = S * A(i,:)' */
+    arm_mat_sym_vec_mult_f32(pSrcS, pA + (i * numCols), pScratch);
+
+    for (j = 0u; j <= i; j++)
+    {
+      pAj = pA + (j * numCols);
+      pT = pScratch;
+      sum = 0.0f;
+
+      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      blkCnt = numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* D(i,j) = A(j,:) * t */
+        sum += pAj[0] * pT[0];
+        sum += pAj[1] * pT[1];
+        sum += pAj[2] * pT[2];
+        sum += pAj[3] * pT[3];
+
+        pAj += 4u;
+        pT += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining MACs */
+      blkCnt = numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        sum += *pAj++ * *pT++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      *pOut++ = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSym group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_add_f32.c
+*
+* Description:	Floating-point packed symmetric matrix addition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point packed symmetric matrix addition.
+ * @param[in]       *pSrcA points to the first input packed symmetric matrix structure
+ * @param[in]       *pSrcB points to the second input packed symmetric matrix structure
+ * @param[out]      *pDst points to output packed symmetric matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * The packed triangles are added with arm_add_f32().
+ */
+
+arm_status arm_mat_sym_add_f32(
+  const arm_matrix_instance_sym_f32 * pSrcA,
+  const arm_matrix_instance_sym_f32 * pSrcB,
+  arm_matrix_instance_sym_f32 * pDst)
+{
+  uint32_t numRows = pSrcA->numRows;             /* number of rows of the matrices */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcB->numRows) || (pSrcA->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  arm_add_f32(pSrcA->pData, pSrcB->pData, pDst->pData, (numRows * (numRows + 1u)) >> 1u);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSym group
+ */
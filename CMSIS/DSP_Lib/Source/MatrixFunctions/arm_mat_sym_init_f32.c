@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_init_f32.c
+*
+* Description:	Floating-point packed symmetric matrix initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSym Symmetric Matrix Functions
+ *
+ * Functions on symmetric <code>N x N</code> matrices stored in packed form.
+ * Only the lower triangle is stored, row by row, in an array of
+ * <code>N * (N + 1) / 2</code> values:
+ * <pre>
+ *     A(i,j) = A(j,i) = pData[i * (i + 1) / 2 + j]     for j <= i
+ * </pre>
+ * The packed form halves the memory of a covariance matrix, and the functions read
+ * each stored element once, so that they also move about half of the data of the
+ * functions on dense matrices.
+ *
+ * \par
+ * arm_mat_sym_pack_f32() and arm_mat_sym_unpack_f32() convert between the packed and
+ * the dense forms.  arm_mat_sym_abat_f32() computes <code>A * S * A'</code>, which is
+ * symmetric, directly in packed form: together with arm_mat_sym_add_f32() it computes
+ * the covariance propagation <code>F * P * F' + Q</code> of a Kalman filter.
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief  Floating-point packed symmetric matrix initialization.
+ * @param[in,out] *S             points to an instance of the packed symmetric matrix structure.
+ * @param[in]     nRows          number of rows and columns of the matrix.
+ * @param[in]     *pData	       points to the array of <code>nRows * (nRows + 1) / 2</code> values.
+ * @return        none
+ */
+
+void arm_mat_sym_init_f32(
+  arm_matrix_instance_sym_f32 * S,
+  uint16_t nRows,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Data pointer */
+  S->pData = pData;
+}
+
+/**
+ * @} end of MatrixSym group
+ */
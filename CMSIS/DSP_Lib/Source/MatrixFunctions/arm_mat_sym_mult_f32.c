@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_mult_f32.c
+*
+* Description:	Floating-point packed symmetric matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point packed symmetric matrix multiplication.
+ * @param[in]       *pSrcS points to the input packed symmetric matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * The function computes <code>S * B</code> with row operations: each stored element
+ * <code>S(i,k)</code> below the diagonal adds <code>S(i,k)</code> times row <code>k</code>
+ * of <code>B</code> to row <code>i</code> of the output and <code>S(i,k)</code> times row
+ * <code>i</code> of <code>B</code> to row <code>k</code>, so that the packed triangle is
+ * read once.  <code>pSrcB</code> and <code>pDst</code> must not point to the same data.
+ */
+
+arm_status arm_mat_sym_mult_f32(
+  const arm_matrix_instance_sym_f32 * pSrcS,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pS = pSrcS->pData;                  /* input data matrix pointer S */
+  float32_t *pB = pSrcB->pData;                  /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pBi, *pBk, *pDi, *pDk;              /* row pointers of B and of the output */
+  float32_t s;                                   /* Temporary element of S */
+  uint32_t numRows = pSrcS->numRows;             /* number of rows of S */
+  uint32_t numCols = pSrcB->numCols;             /* number of columns of B */
+  uint32_t i, k, blkCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcS->numRows != pSrcB->numRows) || (pDst->numRows != pSrcB->numRows)
+     || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* D(i,:) = S(i,i) * B(i,:) starts row i, the rows above are already started */
+    arm_scale_f32(pB + (i * numCols), pS[i], pOut + (i * numCols), numCols);
+
+    for (k = 0u; k < i; k++)
+    {
+      s = *pS++;
+
+      pBi = pB + (i * numCols);
+      pBk = pB + (k * numCols);
+      pDi = pOut + (i * numCols);
+      pDk = pOut + (k * numCols);
+
+      /* Apply loop unrolling and compute 4 outputs at a time. */
+      blkCnt = numCols >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        /* D(i,:) += S(i,k) * B(k,:) and D(k,:) += S(i,k) * B(i,:) */
+        pDi[0] += s * pBk[0];
+        pDk[0] += s * pBi[0];
+        pDi[1] += s * pBk[1];
+        pDk[1] += s * pBi[1];
+        pDi[2] += s * pBk[2];
+        pDk[2] += s * pBi[2];
+        pDi[3] += s * pBk[3];
+        pDk[3] += s * pBi[3];
+
+        pBi += 4u;
+        pBk += 4u;
+        pDi += 4u;
+        pDk += 4u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Compute the remaining outputs */
+      blkCnt = numCols % 0x4u;
+
+      while(blkCnt > 0u)
+      {
+        *pDi++ += s * *pBk++;
+        *pDk++ += s * *pBi++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+
+    /* Skip the diagonal element */
+    pS++;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSym group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_pack_f32.c
+*
+* Description:	Floating-point conversion of a dense matrix to packed symmetric form.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of a dense matrix to packed symmetric form.
+ * @param[in]       *pSrc points to the input square matrix structure
+ * @param[out]      *pDst points to the output packed symmetric matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Only the lower triangle of <code>pSrc</code> is read.
+ */
+
+arm_status arm_mat_sym_pack_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_sym_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i;                                    /* loop counter */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Copy the first i + 1 elements of each row */
+  for (i = 0u; i < numRows; i++)
+  {
+    memcpy(pOut, pIn, (i + 1u) * sizeof(float32_t));
+
+    pOut += i + 1u;
+    pIn += numRows;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSym group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_unpack_f32.c
+*
+* Description:	Floating-point conversion of a packed symmetric matrix to dense form.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of a packed symmetric matrix to dense form.
+ * @param[in]       *pSrc points to the input packed symmetric matrix structure
+ * @param[out]      *pDst points to the output square matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+
+arm_status arm_mat_sym_unpack_f32(
+  const arm_matrix_instance_sym_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t in;                                  /* Temporary input value */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t i, j;                                 /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    /* Write A(i,j) and its mirror A(j,i) */
+    for (j = 0u; j < i; j++)
+    {
+      in = *pIn++;
+      pOut[(i * numRows) + j] = in;
+      pOut[(j * numRows) + i] = in;
+    }
+
+    pOut[(i * numRows) + i] = *pIn++;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSym group
+ */
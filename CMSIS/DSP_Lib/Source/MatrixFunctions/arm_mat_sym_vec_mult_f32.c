@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_vec_mult_f32.c
+*
+* Description:	Floating-point packed symmetric matrix vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSym
+ * @{
+ */
+
+/**
+ * @brief Floating-point packed symmetric matrix vector multiplication.
+ * @param[in]       *pSrcS points to the input packed symmetric matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numRows</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * Each stored element <code>S(i,k)</code> below the diagonal is used twice, for
+ * <code>y(i) += S(i,k) * x(k)</code> and <code>y(k) += S(i,k) * x(i)</code>, so that the
+ * packed triangle is read once.  <code>pVec</code> and <code>pDst</code> must not overlap.
+ */
+
+void arm_mat_sym_vec_mult_f32(
+  const arm_matrix_instance_sym_f32 * pSrcS,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pS = pSrcS->pData;                  /* input data matrix pointer */
+  const float32_t *pX;                           /* input vector pointer */
+  float32_t *pY;                                 /* output vector pointer */
+  float32_t sum, xi;                             /* accumulator and x(i) */
+  uint32_t numRows = pSrcS->numRows;             /* number of rows of the matrix */
+  uint32_t i, blkCnt;                            /* loop counters */
+
+  for (i = 0u; i < numRows; i++)
+  {
+    pX = pVec;
+    pY = pDst;
+    xi = pVec[i];
+    sum = 0.0f;
+
+    /* Apply loop unrolling and compute 4 MACs simultaneously. */
+    blkCnt = i >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* y(i) += S(i,k) * x(k) and y(k) += S(i,k) * x(i) */
+      sum += pS[0] * pX[0];
+      pY[0] += pS[0] * xi;
+      sum += pS[1] * pX[1];
+      pY[1] += pS[1] * xi;
+      sum += pS[2] * pX[2];
+      pY[2] += pS[2] * xi;
+      sum += pS[3] * pX[3];
+      pY[3] += pS[3] * xi;
+
+      pS += 4u;
+      pX += 4u;
+      pY += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Compute the remaining MACs */
+    blkCnt = i % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      sum += *pS * *pX++;
+      *pY++ += *pS++ * xi;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* The diagonal element S(i,i) starts y(i), which the later rows update */
+    *pY = sum + (*pS++ * xi);
+  }
+}
+
+/**
+ * @} end of MatrixSym group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_vec_mult_f32.c
+*
+* Description:	Floating-point matrix and vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixVectMult Matrix Vector Multiplication
+ *
+ * Multiplies an <code>M x N</code> matrix by a vector of <code>N</code> values:
+ * <pre>
+ *     pDst[i] = sum(A(i,k) * pVec[k], k = 0..N-1)     for i = 0..M-1
+ * </pre>
+ * Each output is the product of a contiguous row of the matrix and the vector.
+ * The functions process 4 rows at a time, so that every value of the vector that is
+ * loaded is used for 4 multiply-accumulates, and do not need the column loop and the
+ * size checking of the matrix multiplication functions.
+ * <code>pVec</code> and <code>pDst</code> must not overlap.
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pInA = pSrcMat->pData;              /* input data matrix pointer */
+  float32_t *pA0, *pA1, *pA2, *pA3;              /* row pointers of the matrix */
+  const float32_t *pX;                           /* input vector pointer */
+  float32_t sum0, sum1, sum2, sum3;              /* accumulators */
+  float32_t x;                                   /* Temporary vector value */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+
+  /* Compute 4 outputs at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pA0 = pInA;
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    pX = pVec;
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      /* Each value of the vector is multiplied by 4 rows */
+      x = *pX++;
+
+      sum0 += *pA0++ * x;
+      sum1 += *pA1++ * x;
+      sum2 += *pA2++ * x;
+      sum3 += *pA3++ * x;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    /* Update the pointer to the next 4 rows */
+    pInA += 4u * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Compute the remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+  while(row > 0u)
+  {
+    pX = pVec;
+    sum0 = 0.0f;
+
+    /* Apply loop unrolling and compute 4 MACs simultaneously. */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      sum0 += pInA[0] * pX[0];
+      sum0 += pInA[1] * pX[1];
+      sum0 += pInA[2] * pX[2];
+      sum0 += pInA[3] * pX[3];
+
+      pInA += 4u;
+      pX += 4u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Compute the remaining MACs */
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sum0 += *pInA++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = sum0;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
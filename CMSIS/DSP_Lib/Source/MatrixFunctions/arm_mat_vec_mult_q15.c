@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_vec_mult_q15.c
+*
+* Description:	Q15 matrix and vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.  The inputs are in
+ * 1.15 format and multiplications yield a 2.30 result.  The 2.30 intermediate results
+ * are accumulated in a 64-bit accumulator in 34.30 format.  This approach provides 33
+ * guard bits and there is no risk of overflow.  The 34.30 result is then truncated to
+ * 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.
+ * \par
+ * On Cortex-M4 and Cortex-M3, pairs of values are multiplied with <code>__SMLALD</code>.
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  q15_t *pInA = pSrcMat->pData;                  /* input data matrix pointer */
+  q15_t *pA0, *pA1, *pA2, *pA3;                  /* row pointers of the matrix */
+  const q15_t *pX;                               /* input vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t inV;                                     /* Temporary pair of vector values */
+
+#endif /*    #ifndef ARM_MATH_CM0    */
+
+  /* Compute 4 outputs at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pA0 = pInA;
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      /* Each pair of vector values is multiplied by 4 rows */
+      inV = *__SIMD32(pX)++;
+
+      sum0 = __SMLALD(*__SIMD32(pA0)++, inV, sum0);
+      sum1 = __SMLALD(*__SIMD32(pA1)++, inV, sum1);
+      sum2 = __SMLALD(*__SIMD32(pA2)++, inV, sum2);
+      sum3 = __SMLALD(*__SIMD32(pA3)++, inV, sum3);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Compute the last column of an odd number of columns */
+    colCnt = numCols & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    colCnt = numCols;
+
+#endif /*    #ifndef ARM_MATH_CM0    */
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) * pA0++ * *pX;
+      sum1 += (q31_t) * pA1++ * *pX;
+      sum2 += (q31_t) * pA2++ * *pX;
+      sum3 += (q31_t) * pA3++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the results from 34.30 to 1.15 format with saturation */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((sum1 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((sum2 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((sum3 >> 15), 16));
+
+    /* Update the pointer to the next 4 rows */
+    pInA += 4u * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Compute the remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+  while(row > 0u)
+  {
+    pX = pVec;
+    sum0 = 0;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      sum0 = __SMLALD(*__SIMD32(pInA)++, *__SIMD32(pX)++, sum0);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Compute the last column of an odd number of columns */
+    colCnt = numCols & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    colCnt = numCols;
+
+#endif /*    #ifndef ARM_MATH_CM0    */
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) * pInA++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the result from 34.30 to 1.15 format with saturation */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_vec_mult_q31.c
+*
+* Description:	Q31 matrix and vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q31 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate
+ * multiplication results but provides only a single guard bit.  There is no saturation
+ * on intermediate additions.  Thus, if the accumulator overflows it wraps around and
+ * distorts the result.  The input signals should be scaled down by log2(numCols) bits
+ * to avoid overflows.  The 2.62 accumulator is right shifted by 31 bits to yield a
+ * 1.31 result, as in arm_mat_mult_q31().
+ */
+
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  q31_t *pInA = pSrcMat->pData;                  /* input data matrix pointer */
+  q31_t *pA0, *pA1, *pA2, *pA3;                  /* row pointers of the matrix */
+  const q31_t *pX;                               /* input vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  q31_t x;                                       /* Temporary vector value */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+
+  /* Compute 4 outputs at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pA0 = pInA;
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      /* Each value of the vector is multiplied by 4 rows */
+      x = *pX++;
+
+      sum0 += (q63_t) * pA0++ * x;
+      sum1 += (q63_t) * pA1++ * x;
+      sum2 += (q63_t) * pA2++ * x;
+      sum3 += (q63_t) * pA3++ * x;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the results from 2.62 to 1.31 format */
+    *pDst++ = (q31_t) (sum0 >> 31);
+    *pDst++ = (q31_t) (sum1 >> 31);
+    *pDst++ = (q31_t) (sum2 >> 31);
+    *pDst++ = (q31_t) (sum3 >> 31);
+
+    /* Update the pointer to the next 4 rows */
+    pInA += 4u * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Compute the remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+  while(row > 0u)
+  {
+    pX = pVec;
+    sum0 = 0;
+
+    /* Apply loop unrolling and compute 4 MACs simultaneously. */
+    colCnt = numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q63_t) pInA[0] * pX[0];
+      sum0 += (q63_t) pInA[1] * pX[1];
+      sum0 += (q63_t) pInA[2] * pX[2];
+      sum0 += (q63_t) pInA[3] * pX[3];
+
+      pInA += 4u;
+      pX += 4u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Compute the remaining MACs */
+    colCnt = numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q63_t) * pInA++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format */
+    *pDst++ = (q31_t) (sum0 >> 31);
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
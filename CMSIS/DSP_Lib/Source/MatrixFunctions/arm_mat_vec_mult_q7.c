@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_vec_mult_q7.c
+*
+* Description:	Q7 matrix and vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> values
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> values
+ * @return     		none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 32-bit internal accumulator.  The inputs are in
+ * 1.7 format and multiplications yield a 2.14 result.  The 2.14 intermediate results
+ * are accumulated in a 32-bit accumulator in 18.14 format, which cannot overflow for
+ * the up to 65535 columns of a matrix.  The 18.14 result is then truncated to 18.7
+ * format by discarding the low 7 bits and then saturated to 1.7 format.
+ * \par
+ * On Cortex-M4 and Cortex-M3, the values are extended to pairs of 16-bit values, as in
+ * arm_dot_prod_q7(), and multiplied with <code>__SMLAD</code>.  Each pair of vector
+ * values is extended once for 4 rows.
+ */
+
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  const q7_t * pVec,
+  q7_t * pDst)
+{
+  q7_t *pInA = pSrcMat->pData;                   /* input data matrix pointer */
+  q7_t *pA0, *pA1, *pA2, *pA3;                   /* row pointers of the matrix */
+  const q7_t *pX;                                /* input vector pointer */
+  q31_t sum0, sum1, sum2, sum3;                  /* accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t inV, inA;                                /* Temporary packed pairs */
+
+#endif /*    #ifndef ARM_MATH_CM0    */
+
+  /* Compute 4 outputs at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pA0 = pInA;
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      /* Each pair of vector values is packed once and multiplied by 4 rows */
+      inV = ((q31_t) (q15_t) pX[0] & 0x0000FFFF) | ((q31_t) (q15_t) pX[1] << 16);
+      pX += 2u;
+
+      inA = ((q31_t) (q15_t) pA0[0] & 0x0000FFFF) | ((q31_t) (q15_t) pA0[1] << 16);
+      sum0 = __SMLAD(inA, inV, sum0);
+      inA = ((q31_t) (q15_t) pA1[0] & 0x0000FFFF) | ((q31_t) (q15_t) pA1[1] << 16);
+      sum1 = __SMLAD(inA, inV, sum1);
+      inA = ((q31_t) (q15_t) pA2[0] & 0x0000FFFF) | ((q31_t) (q15_t) pA2[1] << 16);
+      sum2 = __SMLAD(inA, inV, sum2);
+      inA = ((q31_t) (q15_t) pA3[0] & 0x0000FFFF) | ((q31_t) (q15_t) pA3[1] << 16);
+      sum3 = __SMLAD(inA, inV, sum3);
+
+      pA0 += 2u;
+      pA1 += 2u;
+      pA2 += 2u;
+      pA3 += 2u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Compute the last column of an odd number of columns */
+    colCnt = numCols & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    colCnt = numCols;
+
+#endif /*    #ifndef ARM_MATH_CM0    */
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) ((q15_t) * pA0++ * *pX);
+      sum1 += (q31_t) ((q15_t) * pA1++ * *pX);
+      sum2 += (q31_t) ((q15_t) * pA2++ * *pX);
+      sum3 += (q31_t) ((q15_t) * pA3++ * *pX++);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the results from 18.14 to 1.7 format with saturation */
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum1 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum2 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum3 >> 7), 8);
+
+    /* Update the pointer to the next 4 rows */
+    pInA += 4u * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Compute the remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+  while(row > 0u)
+  {
+    pX = pVec;
+    sum0 = 0;
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) ((q15_t) * pInA++ * *pX++);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the result from 18.14 to 1.7 format with saturation */
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_f32.c
+*
+* Description:	Floating-point moving average.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Floating-point moving average.
+ * @param[in,out] *S points to an instance of the floating-point moving average structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+
+ */
+
+void arm_moving_average_f32(
+  arm_moving_average_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* state buffer pointer */
+  float32_t sum = S->sum;                        /* running sum */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* position of the oldest sample */
+  float32_t invLength = 1.0f / (float32_t) windowLength;/* 1 / windowLength */
+  float32_t in, old;                             /* new sample and sample that leaves the window */
+  uint32_t blkCnt = blockSize, i;                /* loop counters */
+
+  while(blkCnt > 0u)
+  {
+    /* Replace the oldest sample of the window by the new one */
+    in = *pSrc++;
+    old = pState[stateIndex];
+    pState[stateIndex] = in;
+
+    sum += in - old;
+
+    if(++stateIndex == windowLength)
+    {
+      stateIndex = 0u;
+      /* Compute the running sum again from the state buffer, so that the rounding
+       * errors of the updates do not build up */
+      sum = 0.0f;
+
+      for (i = 0u; i < windowLength; i++)
+      {
+        sum += pState[i];
+      }
+    }
+
+    *pDst++ = sum * invLength;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the running sum for the next call */
+  S->sum = sum;
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_init_f32.c
+*
+* Description:	Floating-point moving average and RMS initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point moving average and moving RMS.
+ * @param[in,out] *S points to an instance of the floating-point moving average structure.
+ * @param[in]     windowLength number of samples <code>W</code> in the window.
+ * @param[in]     *pState points to the state buffer of <code>windowLength</code> samples.
+ * @return        The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if
+ * <code>windowLength</code> is zero, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The state buffer and the running sum are cleared.
+ */
+
+arm_status arm_moving_average_init_f32(
+  arm_moving_average_instance_f32 * S,
+  uint16_t windowLength,
+  float32_t * pState)
+{
+  if(windowLength == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length and the state buffer */
+  S->windowLength = windowLength;
+  S->pState = pState;
+
+  /* Clear the state buffer and the running sum */
+  memset(pState, 0, windowLength * sizeof(float32_t));
+  S->stateIndex = 0u;
+  S->sum = 0.0f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_init_q7.c
+*
+* Description:	Q7 moving average and RMS initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q7 moving average and moving RMS.
+ * @param[in,out] *S points to an instance of the Q7 moving average structure.
+ * @param[in]     windowLength number of samples <code>W</code> in the window.
+ * @param[in]     *pState points to the state buffer of <code>windowLength</code> samples.
+ * @return        The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if
+ * <code>windowLength</code> is zero, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The state buffer and the running sum are cleared.
+ *
+ * The function also computes the reciprocal of the window length used to scale the
+ * running sums, so that the processing functions do not divide.
+ */
+
+arm_status arm_moving_average_init_q7(
+  arm_moving_average_instance_q7 * S,
+  uint16_t windowLength,
+  q7_t * pState)
+{
+  uint32_t shift;                                /* shift of the reciprocal */
+
+  if(windowLength == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length and the state buffer */
+  S->windowLength = windowLength;
+  S->pState = pState;
+
+  /* Clear the state buffer and the running sum */
+  memset(pState, 0, windowLength * sizeof(q7_t));
+  S->stateIndex = 0u;
+  S->sum = 0;
+
+  /* 1 / windowLength = recip * 2^-(30 + shift), with recip in 2.30 format in [0.5, 1) or 1 */
+  shift = 0u;
+
+  while(((uint32_t) 1u << shift) < windowLength)
+  {
+    shift++;
+  }
+
+  S->shift = (uint8_t) shift;
+  S->recip = (q31_t) (((uint64_t) 1u << (30u + shift)) / windowLength);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_q7.c
+*
+* Description:	Q7 moving average.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Q7 moving average.
+ * @param[in,out] *S points to an instance of the Q7 moving average structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.7 format.  The sum of the samples is kept exactly in a 32-bit
+ * accumulator.  The mean is computed with the reciprocal of the window length and truncated to 1.7 format.
+ */
+
+void arm_moving_average_q7(
+  arm_moving_average_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  q7_t *pState = S->pState;                      /* state buffer pointer */
+  q31_t sum = S->sum;                            /* running sum */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* position of the oldest sample */
+  q63_t recip = S->recip;                        /* reciprocal of the window length */
+  uint32_t shift = S->shift;                     /* shift of the reciprocal */
+  q7_t in, old;                                  /* new sample and sample that leaves the window */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Replace the oldest sample of the window by the new one */
+    in = *pSrc++;
+    old = pState[stateIndex];
+    pState[stateIndex] = in;
+
+    sum += (q31_t) in - old;
+
+    if(++stateIndex == windowLength)
+    {
+      stateIndex = 0u;
+    }
+
+    /* sum / windowLength = (sum * recip) >> (30 + shift) */
+    *pDst++ = (q7_t) (((q63_t) sum * recip) >> (30u + shift));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the running sum for the next call */
+  S->sum = sum;
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_max_f32.c
+*
+* Description:	Floating-point sliding window maximum.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SlidingWindow Sliding Window Statistics
+ *
+ * Computes the minimum, maximum, mean and RMS value of the last <code>W</code> samples
+ * of a stream, for each new sample.  The functions keep a state between calls, like
+ * the filters, so that a window that moves by a hop of <code>H</code> samples costs
+ * <code>O(H)</code> operations instead of a new scan of <code>W</code> samples with
+ * arm_max_f32() or arm_mean_f32().
+ *
+ * \par Minimum and maximum
+ * arm_moving_max_f32() and arm_moving_min_f32() keep a monotonic queue of the samples of
+ * the window that can still become the extreme value: a new sample removes the samples
+ * of the queue that it dominates, and the oldest sample of the queue leaves it when it
+ * leaves the window.  Each sample is added and removed at most once, so that the cost
+ * per sample is constant on average.  The extreme value of the window is the oldest
+ * sample of the queue.
+ * The queue needs two arrays of <code>W</code> values: the sample values and their
+ * indices, which count the samples processed since the initialization and wrap around
+ * at <code>2^32</code>.  The functions also return the index of each extreme value,
+ * or of its first occurrence if it appears several times in the window, as
+ * arm_max_f32() does within a buffer.
+ * Until <code>W</code> samples have been processed, the window only contains the
+ * samples received so far.
+ *
+ * \par Mean and RMS value
+ * arm_moving_average_f32() and arm_moving_rms_f32() keep the last <code>W</code> samples
+ * in a circular state buffer and the running sum of the samples or of their squares:
+ * each new sample adds its contribution and removes that of the sample that leaves the
+ * window.  The state buffer is cleared by the initialization, so that the first
+ * <code>W - 1</code> outputs are those of a window padded with zeros, as for an FIR
+ * filter with <code>W</code> coefficients equal to <code>1/W</code>.
+ * The fixed-point sums are exact integers.  The floating-point sums are computed again
+ * from the state buffer each time the window has moved by <code>W</code> samples, so
+ * that rounding errors do not build up.  An instance of the moving average is used by
+ * either arm_moving_average_f32() or arm_moving_rms_f32(), not both.
+ *
+ * \par Instance Structure
+ * The window length, the state and the running values are stored in an instance data
+ * structure.  A separate instance structure must be defined for each window, and
+ * initialized with arm_moving_minmax_init_f32() or arm_moving_average_init_f32().
+ * There are separate instance structures and functions for floating-point, Q31, Q15 and
+ * Q7 data types.
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Floating-point sliding window maximum.
+ * @param[in,out] *S points to an instance of the floating-point sliding window minimum and maximum structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of maximum values of the windows ending at each input sample.
+ * @param[out]    *pIndex points to the block of indices of the maximum values, or is NULL.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ */
+
+void arm_moving_max_f32(
+  arm_moving_minmax_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t * pIndex,
+  uint32_t blockSize)
+{
+  float32_t *pValues = S->pValues;               /* values of the queue */
+  uint32_t *pIndices = S->pIndices;              /* indices of the queue */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t head = S->head;                       /* position of the oldest entry of the queue */
+  uint32_t count = S->count;                     /* number of entries of the queue */
+  uint32_t sampleIndex = S->sampleIndex;         /* index of the current sample */
+  uint32_t back;                                 /* position of the newest entry of the queue */
+  float32_t in;                                  /* Temporary input variable */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* The oldest entry leaves the queue when it leaves the window */
+    if((count > 0u) && ((sampleIndex - pIndices[head]) >= windowLength))
+    {
+      head = (head == (windowLength - 1u)) ? 0u : (head + 1u);
+      count--;
+    }
+
+    /* The smaller entries can no longer be the maximum of a window */
+    while(count > 0u)
+    {
+      back = head + count - 1u;
+      back = (back >= windowLength) ? (back - windowLength) : back;
+
+      if(pValues[back] < in)
+      {
+        count--;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    /* Append the new sample to the queue */
+    back = head + count;
+    back = (back >= windowLength) ? (back - windowLength) : back;
+    pValues[back] = in;
+    pIndices[back] = sampleIndex;
+    count++;
+
+    /* The oldest entry is the maximum of the window */
+    *pDst++ = pValues[head];
+
+    if(pIndex != NULL)
+    {
+      *pIndex++ = pIndices[head];
+    }
+
+    sampleIndex++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the queue for the next call */
+  S->head = (uint16_t) head;
+  S->count = (uint16_t) count;
+  S->sampleIndex = sampleIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
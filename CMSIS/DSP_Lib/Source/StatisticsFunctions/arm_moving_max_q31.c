@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_max_q31.c
+*
+* Description:	Q31 sliding window maximum.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Q31 sliding window maximum.
+ * @param[in,out] *S points to an instance of the Q31 sliding window minimum and maximum structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of maximum values of the windows ending at each input sample.
+ * @param[out]    *pIndex points to the block of indices of the maximum values, or is NULL.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ */
+
+void arm_moving_max_q31(
+  arm_moving_minmax_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t * pIndex,
+  uint32_t blockSize)
+{
+  q31_t *pValues = S->pValues;                   /* values of the queue */
+  uint32_t *pIndices = S->pIndices;              /* indices of the queue */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t head = S->head;                       /* position of the oldest entry of the queue */
+  uint32_t count = S->count;                     /* number of entries of the queue */
+  uint32_t sampleIndex = S->sampleIndex;         /* index of the current sample */
+  uint32_t back;                                 /* position of the newest entry of the queue */
+  q31_t in;                                      /* Temporary input variable */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* The oldest entry leaves the queue when it leaves the window */
+    if((count > 0u) && ((sampleIndex - pIndices[head]) >= windowLength))
+    {
+      head = (head == (windowLength - 1u)) ? 0u : (head + 1u);
+      count--;
+    }
+
+    /* The smaller entries can no longer be the maximum of a window */
+    while(count > 0u)
+    {
+      back = head + count - 1u;
+      back = (back >= windowLength) ? (back - windowLength) : back;
+
+      if(pValues[back] < in)
+      {
+        count--;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    /* Append the new sample to the queue */
+    back = head + count;
+    back = (back >= windowLength) ? (back - windowLength) : back;
+    pValues[back] = in;
+    pIndices[back] = sampleIndex;
+    count++;
+
+    /* The oldest entry is the maximum of the window */
+    *pDst++ = pValues[head];
+
+    if(pIndex != NULL)
+    {
+      *pIndex++ = pIndices[head];
+    }
+
+    sampleIndex++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the queue for the next call */
+  S->head = (uint16_t) head;
+  S->count = (uint16_t) count;
+  S->sampleIndex = sampleIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
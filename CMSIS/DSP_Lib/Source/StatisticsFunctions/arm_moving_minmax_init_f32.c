@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_minmax_init_f32.c
+*
+* Description:	Floating-point sliding window minimum and maximum initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding window minimum and maximum.
+ * @param[in,out] *S points to an instance of the floating-point sliding window minimum and maximum structure.
+ * @param[in]     windowLength number of samples <code>W</code> in the window.
+ * @param[in]     *pValues points to the array of <code>windowLength</code> values of the queue.
+ * @param[in]     *pIndices points to the array of <code>windowLength</code> indices of the queue.
+ * @return        The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if
+ * <code>windowLength</code> is zero, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * An instance is used either by arm_moving_max_f32() or by arm_moving_min_f32().
+ */
+
+arm_status arm_moving_minmax_init_f32(
+  arm_moving_minmax_instance_f32 * S,
+  uint16_t windowLength,
+  float32_t * pValues,
+  uint32_t * pIndices)
+{
+  if(windowLength == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length and the arrays of the queue */
+  S->windowLength = windowLength;
+  S->pValues = pValues;
+  S->pIndices = pIndices;
+
+  /* The queue is empty and no sample has been processed */
+  S->head = 0u;
+  S->count = 0u;
+  S->sampleIndex = 0u;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_rms_q15.c
+*
+* Description:	Q15 moving RMS.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Q15 moving RMS.
+ * @param[in,out] *S points to an instance of the Q15 moving average structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.15 format.  The sum of the squares, in 2.30 format, is kept exactly in a 64-bit
+ * accumulator.  The mean square is truncated to 1.15 format and saturated, and the RMS value
+ * is its square root computed by arm_vsqrt_q15().
+ */
+
+void arm_moving_rms_q15(
+  arm_moving_average_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* state buffer pointer */
+  q63_t sum = S->sum;                            /* running sum of squares */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* position of the oldest sample */
+  q63_t recip = S->recip;                        /* reciprocal of the window length */
+  uint32_t shift = S->shift;                     /* shift of the reciprocal */
+  q63_t meanSq;                                  /* mean square */
+  q15_t in, old;                                 /* new sample and sample that leaves the window */
+  q15_t *pOut = pDst;                            /* output pointer, for the square roots */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Replace the oldest sample of the window by the new one */
+    in = *pSrc++;
+    old = pState[stateIndex];
+    pState[stateIndex] = in;
+
+    sum += ((q31_t) in * in) - ((q31_t) old * old);
+
+    if(++stateIndex == windowLength)
+    {
+      stateIndex = 0u;
+    }
+
+    /* The mean square in 2.30 format is ((sum >> shift) * recip) >> 30, truncated to 1.15 format */
+    meanSq = ((sum >> shift) * recip) >> 30;
+    *pDst++ = (q15_t) __SSAT((q31_t) (meanSq >> 15), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Square roots of the mean squares, computed in place as a block */
+  arm_vsqrt_q15(pOut, pOut, blockSize);
+
+  /* Save the running sum for the next call */
+  S->sum = sum;
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_rms_q31.c
+*
+* Description:	Q31 moving RMS.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Q31 moving RMS.
+ * @param[in,out] *S points to an instance of the Q31 moving average structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.31 format.  The squares of the samples are truncated to 1.31 format and their sum is kept
+ * exactly in a 64-bit accumulator.  The mean square is computed with the reciprocal of the window
+ * length, after discarding the bits of the sum below the window length, and the result
+ * may be 1 or 2 LSBs below the truncated mean square. The RMS value is its square root
+ * computed by arm_vsqrt_q31().
+ */
+
+void arm_moving_rms_q31(
+  arm_moving_average_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* state buffer pointer */
+  q63_t sum = S->sum;                            /* running sum of squares */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* position of the oldest sample */
+  q63_t recip = S->recip;                        /* reciprocal of the window length */
+  uint32_t shift = S->shift;                     /* shift of the reciprocal */
+  q63_t meanSq;                                  /* mean square */
+  q31_t in, old;                                 /* new sample and sample that leaves the window */
+  q31_t *pOut = pDst;                            /* output pointer, for the square roots */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Replace the oldest sample of the window by the new one */
+    in = *pSrc++;
+    old = pState[stateIndex];
+    pState[stateIndex] = in;
+
+    sum += (((q63_t) in * in) >> 31) - (((q63_t) old * old) >> 31);
+
+    if(++stateIndex == windowLength)
+    {
+      stateIndex = 0u;
+    }
+
+    /* The mean square in 1.31 format is sum / windowLength = ((sum >> shift) * recip) >> 30 */
+    meanSq = ((sum >> shift) * recip) >> 30;
+    *pDst++ = clip_q63_to_q31(meanSq);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Square roots of the mean squares, computed in place as a block */
+  arm_vsqrt_q31(pOut, pOut, blockSize);
+
+  /* Save the running sum for the next call */
+  S->sum = sum;
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_rms_q7.c
+*
+* Description:	Q7 moving RMS.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingWindow
+ * @{
+ */
+
+/**
+ * @brief Q7 moving RMS.
+ * @param[in,out] *S points to an instance of the Q7 moving average structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is in 1.7 format.  The sum of the squares, in 2.14 format, is kept exactly in a 32-bit
+ * accumulator.  The mean square is converted to 1.15 format, its square root is computed by
+ * arm_vsqrt_q15() and truncated to 1.7 format.
+ */
+
+void arm_moving_rms_q7(
+  arm_moving_average_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  q7_t *pState = S->pState;                      /* state buffer pointer */
+  q31_t sum = S->sum;                            /* running sum of squares */
+  uint32_t windowLength = S->windowLength;       /* length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* position of the oldest sample */
+  q63_t recip = S->recip;                        /* reciprocal of the window length */
+  uint32_t shift = S->shift;                     /* shift of the reciprocal */
+  q63_t meanSq;                                  /* mean square */
+  q15_t meanSq15, root;                          /* mean square and RMS value in 1.15 format */
+  q7_t in, old;                                  /* new sample and sample that leaves the window */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Replace the oldest sample of the window by the new one */
+    in = *pSrc++;
+    old = pState[stateIndex];
+    pState[stateIndex] = in;
+
+    sum += ((q15_t) in * in) - ((q15_t) old * old);
+
+    if(++stateIndex == windowLength)
+    {
+      stateIndex = 0u;
+    }
+
+    /* The mean square in 2.14 format is (sum * recip) >> (30 + shift), shifted to 1.15 format */
+    meanSq = ((q63_t) sum * recip) >> (30u + shift);
+    meanSq15 = (q15_t) __SSAT((q31_t) (meanSq << 1), 16);
+    arm_vsqrt_q15(&meanSq15, &root, 1u);
+
+    /* Convert the root from 1.15 to 1.7 format */
+    *pDst++ = (q7_t) (root >> 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the running sum for the next call */
+  S->sum = sum;
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of SlidingWindow group
+ */
@@ -110,7 +110,7 @@ void arm_rms_q15(
   in1 = (q15_t) (sum / blockSize);
 
   /* Store the result in the destination */
-  arm_sqrt_q15(in1, pResult);
+  arm_vsqrt_q15(&in1, pResult, 1u);
 
 #else
 
@@ -139,7 +139,7 @@ void arm_rms_q15(
   in = (q15_t) (sum / blockSize);
 
   /* Store the result in the destination */
-  arm_sqrt_q15(in, pResult);
+  arm_vsqrt_q15(&in, pResult, 1u);
 
 #endif /* #ifndef ARM_MATH_CM0 */
 
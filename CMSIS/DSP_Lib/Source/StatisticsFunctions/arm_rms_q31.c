@@ -66,6 +66,7 @@ void arm_rms_q31(
 {
   q63_t sum = 0;                                 /* accumulator */
   q31_t in;                                      /* Temporary variable to store the input */
+  q31_t meanSq;                                  /* mean square */
   uint32_t blkCnt;                               /* loop counter */
 
 #ifndef ARM_MATH_CM0
@@ -134,8 +135,11 @@ void arm_rms_q31(
   /* Convert data in 2.62 to 1.31 by 31 right shifts */
   sum = sum >> 31;
 
+  /* Compute the mean square */
+  meanSq = (q31_t) (sum / (int32_t) blockSize);
+
   /* Compute Rms and store the result in the destination vector */
-  arm_sqrt_q31((q31_t) (sum / (int32_t) blockSize), pResult);
+  arm_vsqrt_q31(&meanSq, pResult, 1u);
 }
 
 /**   
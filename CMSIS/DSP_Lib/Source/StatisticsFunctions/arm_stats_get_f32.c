@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_get_f32.c
+*
+* Description:	Floating-point streaming statistics results.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Floating-point streaming statistics results.
+ * @param[in]  *S points to an instance of the floating-point streaming statistics structure.
+ * @param[out] *pResult points to the structure that receives the statistics.
+ * @return     none.
+ *
+ * The results are those of arm_mean_f32(), arm_var_f32(), arm_std_f32(), arm_rms_f32(),
+ * arm_power_f32(), arm_min_f32() and arm_max_f32() on all the samples of the stream:
+ * the variance is normalized by <code>count - 1</code>, and is zero for a single sample.
+ * All the results are zero if no sample has been accumulated.
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t n = (float32_t) S->count;            /* number of samples */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  pResult->mean = S->mean;
+  pResult->var = (S->count > 1u) ? (S->m2 / (n - 1.0f)) : 0.0f;
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+
+  /* std = sqrt(var) and rms = sqrt(power / count) */
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  arm_sqrt_f32(S->sumSq / n, &pResult->rms);
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_get_q15.c
+*
+* Description:	Q15 streaming statistics results.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Q15 streaming statistics results.
+ * @param[in]  *S points to an instance of the Q15 streaming statistics structure.
+ * @param[out] *pResult points to the structure that receives the statistics.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, the standard deviation, the RMS value, the minimum and the maximum are in
+ * 1.15 format.  The variance is in 1.15 format in a 32-bit value and the power is the
+ * sum of squares in 34.30 format, as returned by arm_var_q15() and arm_power_q15().
+ * The sum of squared deviations from the mean, <code>sumSq - sum^2 / count</code>, is
+ * computed exactly in 34.30 format before it is divided by <code>count - 1</code>,
+ * truncated to 1.15 format and saturated.
+ * All the results are zero if no sample has been accumulated.
+ */
+
+void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t n = (q63_t) S->count;                    /* number of samples */
+  q63_t q, r;                                    /* quotient and remainder of sum / n */
+  q63_t m2;                                      /* sum of squared deviations from the mean */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q15));
+    return;
+  }
+
+  /* sum = q * n + r, so that sum^2 / n = q * sum + q * r + r^2 / n without overflow */
+  q = S->sum / n;
+  r = S->sum % n;
+  m2 = S->sumSq - ((q * S->sum) + (q * r) +
+                   (q63_t) (((uint64_t) r * (uint64_t) r) / (uint64_t) n));
+
+  pResult->mean = (q15_t) q;
+  pResult->var = (S->count > 1u) ? __SSAT((q31_t) ((m2 / (n - 1)) >> 15), 16) : 0;
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+
+  /* std = sqrt(var) and rms = sqrt(sumSq / count) */
+  arm_sqrt_q15((q15_t) pResult->var, &pResult->std);
+  arm_sqrt_q15((q15_t) __SSAT((q31_t) ((S->sumSq / n) >> 15), 16), &pResult->rms);
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_get_q31.c
+*
+* Description:	Q31 streaming statistics results.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Q31 streaming statistics results.
+ * @param[in]  *S points to an instance of the Q31 streaming statistics structure.
+ * @param[out] *pResult points to the structure that receives the statistics.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, the standard deviation, the RMS value, the minimum and the maximum are in
+ * 1.31 format.  The variance is in 1.31 format in a 64-bit value, as returned by
+ * arm_var_q31().  The power is the sum of squares in 33.31 format, which differs from
+ * the 16.48 format of arm_power_q31() but cannot overflow.
+ * The sum of squared deviations from the mean, <code>sumSq - sum^2 / count</code>, is
+ * computed in 33.31 format before it is divided by <code>count - 1</code>.
+ * All the results are zero if no sample has been accumulated.
+ */
+
+void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t n = (q63_t) S->count;                    /* number of samples */
+  q63_t q, r;                                    /* quotient and remainder of sum / n */
+  q63_t m2;                                      /* sum of squared deviations from the mean */
+  q63_t meanSq;                                  /* mean of the squares */
+
+  if(S->count == 0u)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q31));
+    return;
+  }
+
+  /* sum = q * n + r, so that sum^2 / n = q^2 * n + 2 * q * r + r^2 / n, in 2.62 format */
+  q = S->sum / n;
+  r = S->sum % n;
+  m2 = S->sumSq - ((((q * q) >> 31) * n) + ((q * r) >> 30) +
+                   ((q63_t) (((uint64_t) r * (uint64_t) r) / (uint64_t) n) >> 31));
+
+  if(m2 < 0)
+  {
+    /* Truncation of the squares can make m2 slightly negative for a constant signal */
+    m2 = 0;
+  }
+
+  pResult->mean = (q31_t) q;
+  pResult->var = (S->count > 1u) ? (m2 / (n - 1)) : 0;
+  pResult->power = S->sumSq;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+
+  /* std = sqrt(var) and rms = sqrt(sumSq / count) */
+  arm_sqrt_q31(clip_q63_to_q31(pResult->var), &pResult->std);
+
+  meanSq = S->sumSq / n;
+  arm_sqrt_q31(clip_q63_to_q31(meanSq), &pResult->rms);
+}
+
+/**
+ * @} end of StreamStats group
+ */
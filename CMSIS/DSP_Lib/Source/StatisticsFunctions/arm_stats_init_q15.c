@@ -0,0 +1,43 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_init_q15.c
+*
+* Description:	Q15 streaming statistics initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 streaming statistics.
+ * @param[out] *S points to an instance of the Q15 streaming statistics structure.
+ * @return     none.
+ *
+ * The function clears the accumulator.  It is also used to restart the statistics.
+ */
+
+void arm_stats_init_q15(
+  arm_stats_instance_q15 * S)
+{
+  /* Clear the accumulator */
+  memset(S, 0, sizeof(arm_stats_instance_q15));
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_merge_f32.c
+*
+* Description:	Floating-point streaming statistics merge.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Floating-point streaming statistics merge.
+ * @param[in,out] *S points to the accumulator that receives the merged statistics.
+ * @param[in]     *S2 points to the accumulator of the samples that follow those of <code>S</code>.
+ * @return        none.
+ */
+
+void arm_stats_merge_f32(
+  arm_stats_instance_f32 * S,
+  const arm_stats_instance_f32 * S2)
+{
+  float32_t delta;                               /* difference of the means */
+  float32_t nA = (float32_t) S->count;           /* number of samples of S */
+  float32_t nB = (float32_t) S2->count;          /* number of samples of S2 */
+  float32_t n = nA + nB;                         /* number of samples of the merge */
+
+  if(S2->count == 0u)
+  {
+    return;
+  }
+
+  if(S->count == 0u)
+  {
+    *S = *S2;
+    return;
+  }
+
+  /* Update of Chan, Golub and LeVeque */
+  delta = S2->mean - S->mean;
+  S->mean += delta * (nB / n);
+  S->m2 += S2->m2 + ((delta * delta) * ((nA * nB) / n));
+  S->sumSq += S2->sumSq;
+
+  /* The indices of S2 follow the samples of S */
+  if(S2->min < S->min)
+  {
+    S->min = S2->min;
+    S->minIndex = S->count + S2->minIndex;
+  }
+
+  if(S2->max > S->max)
+  {
+    S->max = S2->max;
+    S->maxIndex = S->count + S2->maxIndex;
+  }
+
+  S->count += S2->count;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_merge_q31.c
+*
+* Description:	Q31 streaming statistics merge.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Q31 streaming statistics merge.
+ * @param[in,out] *S points to the accumulator that receives the merged statistics.
+ * @param[in]     *S2 points to the accumulator of the samples that follow those of <code>S</code>.
+ * @return        none.
+ *
+ * The sums are exact, so that merging accumulators gives the same result as
+ * accumulating all the samples in a single one.
+ */
+
+void arm_stats_merge_q31(
+  arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * S2)
+{
+  if(S2->count == 0u)
+  {
+    return;
+  }
+
+  if(S->count == 0u)
+  {
+    *S = *S2;
+    return;
+  }
+
+  S->sum += S2->sum;
+  S->sumSq += S2->sumSq;
+
+  /* The indices of S2 follow the samples of S */
+  if(S2->min < S->min)
+  {
+    S->min = S2->min;
+    S->minIndex = S->count + S2->minIndex;
+  }
+
+  if(S2->max > S->max)
+  {
+    S->max = S2->max;
+    S->maxIndex = S->count + S2->maxIndex;
+  }
+
+  S->count += S2->count;
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_update_f32.c
+*
+* Description:	Floating-point streaming statistics update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup StreamStats Streaming Statistics
+ *
+ * Accumulates the mean, variance, standard deviation, RMS value, power, minimum and
+ * maximum of a stream of samples in a single pass over the data.
+ * Calling arm_mean_f32(), arm_var_f32(), arm_rms_f32(), arm_power_f32(), arm_min_f32()
+ * and arm_max_f32() on a block reads it six times; arm_stats_update_f32() reads it once,
+ * and the statistics of all the blocks seen since arm_stats_init_f32() are returned by
+ * arm_stats_get_f32().
+ *
+ * \par Algorithm
+ * The floating-point accumulator holds the number of samples, their mean, the sum of
+ * the squared deviations from the mean <code>M2</code>, the sum of squares, the
+ * minimum and the maximum.  Each block is reduced to the same quantities, computing
+ * the sums on the samples shifted by the running mean to avoid cancellation, and
+ * merged into the accumulator with the update of Chan, Golub and LeVeque:
+ * <pre>
+ *     delta = meanB - meanA
+ *     mean  = meanA + delta * nB / (nA + nB)
+ *     M2    = M2A + M2B + delta^2 * nA * nB / (nA + nB)
+ * </pre>
+ * The Q31 and Q15 accumulators hold the exact integer sums of the samples and of
+ * their squares, which are merged by addition.
+ *
+ * \par Merging and sliding windows
+ * arm_stats_merge_f32() merges two accumulators, as if the samples of the second one
+ * followed those of the first one.  The statistics of a sliding window of
+ * <code>K</code> blocks are computed without scanning the window again by keeping an
+ * accumulator per block in a ring of <code>K</code> instances, and merging the
+ * <code>K</code> instances into a cleared one when the statistics are needed.
+ *
+ * \par
+ * The indices of the minimum and of the maximum count the samples from the start of
+ * the stream.  If the minimum or the maximum occurs several times, the first
+ * occurrence is returned, as with arm_min_f32() and arm_max_f32().
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Floating-point streaming statistics update.
+ * @param[in,out] *S points to an instance of the floating-point streaming statistics structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ */
+
+void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_instance_f32 B;                      /* statistics of the block */
+  float32_t sumD = 0.0f, sumD2 = 0.0f;           /* sums of the shifted samples and of their squares */
+  float32_t sumSq = 0.0f;                        /* sum of squares */
+  float32_t shift;                               /* estimate of the mean */
+  float32_t minVal, maxVal;                      /* minimum and maximum */
+  float32_t in, d;                               /* Temporary variables */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* indices of the minimum and maximum */
+  uint32_t i = 0u;                               /* index of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The sums are computed on the samples shifted by the best known estimate of the mean */
+  shift = (S->count == 0u) ? pSrc[0] : S->mean;
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sumD += d;
+    sumD2 += d * d;
+    sumSq += in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sumD += d;
+    sumD2 += d * d;
+    sumSq += in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 1u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 1u;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sumD += d;
+    sumD2 += d * d;
+    sumSq += in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 2u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 2u;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sumD += d;
+    sumD2 += d * d;
+    sumSq += in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 3u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 3u;
+    }
+
+    i += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sumD += d;
+    sumD2 += d * d;
+    sumSq += in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Statistics of the block: M2 = sum((x - shift)^2) - (sum(x - shift))^2 / n */
+  B.count = blockSize;
+  B.mean = shift + (sumD / (float32_t) blockSize);
+  B.m2 = sumD2 - ((sumD * sumD) / (float32_t) blockSize);
+  B.sumSq = sumSq;
+  B.min = minVal;
+  B.max = maxVal;
+  B.minIndex = minIndex;
+  B.maxIndex = maxIndex;
+
+  /* Rounding can make M2 slightly negative for a constant block */
+  if(B.m2 < 0.0f)
+  {
+    B.m2 = 0.0f;
+  }
+
+  arm_stats_merge_f32(S, &B);
+}
+
+/**
+ * @} end of StreamStats group
+ */
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_update_q15.c
+*
+* Description:	Q15 streaming statistics update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StreamStats
+ * @{
+ */
+
+/**
+ * @brief Q15 streaming statistics update.
+ * @param[in,out] *S points to an instance of the Q15 streaming statistics structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[in]     blockSize number of samples to process.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is represented in 1.15 format.  The samples are added in a 64-bit
+ * accumulator in 49.15 format, and their squares, in 2.30 format, in a 64-bit
+ * accumulator in 34.30 format.  The sums are exact and cannot overflow before
+ * <code>2^32</code> samples.
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_instance_q15 B;                      /* statistics of the block */
+  q63_t sum = 0, sumSq = 0;                      /* accumulators */
+  q15_t minVal, maxVal;                          /* minimum and maximum */
+  q15_t in;                                      /* Temporary input variable */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* indices of the minimum and maximum */
+  uint32_t i = 0u;                               /* index of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 1u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 1u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 2u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 2u;
+    }
+
+    in = *pSrc++;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i + 3u;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i + 3u;
+    }
+
+    i += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumSq += (q31_t) in * in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+
+    i++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  B.count = blockSize;
+  B.sum = sum;
+  B.sumSq = sumSq;
+  B.min = minVal;
+  B.max = maxVal;
+  B.minIndex = minIndex;
+  B.maxIndex = maxIndex;
+
+  arm_stats_merge_q15(S, &B);
+}
+
+/**
+ * @} end of StreamStats group
+ */
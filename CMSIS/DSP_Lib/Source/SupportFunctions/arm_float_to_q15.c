@@ -29,6 +29,148 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_float_to_q15(): 16 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_float_to_q15_avx2(
+  float32_t * pIn,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  __m256 vScale = _mm256_set1_ps(32768.0f);      /* conversion factor */
+#ifdef ARM_MATH_ROUNDING
+  __m256 vHalf = _mm256_set1_ps(0.5f), vMinusHalf = _mm256_set1_ps(-0.5f); /* rounding offsets */
+  float32_t in0;                                 /* input of the remaining samples */
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+  __m256 in1, in2;                               /* scaled inputs */
+  __m256i out;                                   /* converted samples */
+  uint32_t blkCnt = blockSize >> 4u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in1 = _mm256_mul_ps(_mm256_loadu_ps(pIn), vScale);
+    in2 = _mm256_mul_ps(_mm256_loadu_ps(pIn + 8), vScale);
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* in += in > 0 ? 0.5 : -0.5 */
+    in1 = _mm256_add_ps(in1, _mm256_blendv_ps(vMinusHalf, vHalf,
+                                              _mm256_cmp_ps(in1, _mm256_setzero_ps(), _CMP_GT_OQ)));
+    in2 = _mm256_add_ps(in2, _mm256_blendv_ps(vMinusHalf, vHalf,
+                                              _mm256_cmp_ps(in2, _mm256_setzero_ps(), _CMP_GT_OQ)));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Truncate to 32 bits, saturate to 16 bits and restore the order of the samples.
+     ** Out of range and NaN inputs truncate to 0x80000000 as in the scalar code. */
+    out = _mm256_packs_epi32(_mm256_cvttps_epi32(in1), _mm256_cvttps_epi32(in2));
+    _mm256_storeu_si256((__m256i *) pDst, _mm256_permute4x64_epi64(out, 0xD8));
+
+    pIn += 16u;
+    pDst += 16u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 15u;
+
+  while(blkCnt > 0u)
+  {
+#ifdef ARM_MATH_ROUNDING
+
+    in0 = *pIn++;
+    in0 = (in0 * 32768.0f);
+    in0 += in0 > 0 ? 0.5 : -0.5;
+    *pDst++ = (q15_t) (__SSAT((q31_t) (in0), 16));
+
+#else
+
+    *pDst++ = (q15_t) __SSAT((q31_t) (*pIn++ * 32768.0f), 16);
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_float_to_q15(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_float_to_q15_sse41(
+  float32_t * pIn,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  __m128 vScale = _mm_set1_ps(32768.0f);         /* conversion factor */
+#ifdef ARM_MATH_ROUNDING
+  __m128 vHalf = _mm_set1_ps(0.5f), vMinusHalf = _mm_set1_ps(-0.5f); /* rounding offsets */
+  float32_t in0;                                 /* input of the remaining samples */
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+  __m128 in1, in2;                               /* scaled inputs */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in1 = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+    in2 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), vScale);
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* in += in > 0 ? 0.5 : -0.5 */
+    in1 = _mm_add_ps(in1, _mm_blendv_ps(vMinusHalf, vHalf, _mm_cmpgt_ps(in1, _mm_setzero_ps())));
+    in2 = _mm_add_ps(in2, _mm_blendv_ps(vMinusHalf, vHalf, _mm_cmpgt_ps(in2, _mm_setzero_ps())));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Truncate to 32 bits and saturate to 16 bits.
+     ** Out of range and NaN inputs truncate to 0x80000000 as in the scalar code. */
+    _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(_mm_cvttps_epi32(in1), _mm_cvttps_epi32(in2)));
+
+    pIn += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+#ifdef ARM_MATH_ROUNDING
+
+    in0 = *pIn++;
+    in0 = (in0 * 32768.0f);
+    in0 += in0 > 0 ? 0.5 : -0.5;
+    *pDst++ = (q15_t) (__SSAT((q31_t) (in0), 16));
+
+#else
+
+    *pDst++ = (q15_t) __SSAT((q31_t) (*pIn++ * 32768.0f), 16);
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupSupport   
  */
@@ -76,6 +218,25 @@ void arm_float_to_q15(
 
 #endif /*      #ifdef ARM_MATH_ROUNDING        */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_float_to_q15_avx2(pSrc, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_float_to_q15_sse41(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
@@ -29,6 +29,150 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * AVX2 kernel of arm_float_to_q31(): 8 samples at a time.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_float_to_q31_avx2(
+  float32_t * pIn,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  __m256 vScale = _mm256_set1_ps(2147483648.0f); /* conversion factor, also the first positive overflow */
+  __m256 vLimit = _mm256_set1_ps(9223372036854775808.0f); /* first value out of the q63 range */
+#ifdef ARM_MATH_ROUNDING
+  __m256 vHalf = _mm256_set1_ps(0.5f), vMinusHalf = _mm256_set1_ps(-0.5f); /* rounding offsets */
+  float32_t in0;                                 /* input of the remaining samples */
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+  __m256 in;                                     /* scaled input */
+  __m256i over;                                  /* positive overflows */
+  uint32_t blkCnt = blockSize >> 3u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm256_mul_ps(_mm256_loadu_ps(pIn), vScale);
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* in += in > 0 ? 0.5 : -0.5 */
+    in = _mm256_add_ps(in, _mm256_blendv_ps(vMinusHalf, vHalf,
+                                            _mm256_cmp_ps(in, _mm256_setzero_ps(), _CMP_GT_OQ)));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* clip_q63_to_q31((q63_t) in): the scalar code saturates the values in [2^31, 2^63) to 0x7FFFFFFF.
+     ** The other values out of range and NaN give 0x80000000, as the truncation here. */
+    over = _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(in, vScale, _CMP_GE_OQ),
+                                             _mm256_cmp_ps(in, vLimit, _CMP_LT_OQ)));
+
+    _mm256_storeu_si256((__m256i *) pDst, _mm256_xor_si256(_mm256_cvttps_epi32(in), over));
+
+    pIn += 8u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 7u;
+
+  while(blkCnt > 0u)
+  {
+#ifdef ARM_MATH_ROUNDING
+
+    in0 = *pIn++;
+    in0 = (in0 * 2147483648.0f);
+    in0 += in0 > 0 ? 0.5 : -0.5;
+    *pDst++ = clip_q63_to_q31((q63_t) (in0));
+
+#else
+
+    *pDst++ = clip_q63_to_q31((q63_t) (*pIn++ * 2147483648.0f));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+/*
+ * SSE4.1 kernel of arm_float_to_q31(): 4 samples at a time.
+ */
+
+ARM_HOST_TARGET("sse4.1")
+static void arm_float_to_q31_sse41(
+  float32_t * pIn,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  __m128 vScale = _mm_set1_ps(2147483648.0f);    /* conversion factor, also the first positive overflow */
+  __m128 vLimit = _mm_set1_ps(9223372036854775808.0f); /* first value out of the q63 range */
+#ifdef ARM_MATH_ROUNDING
+  __m128 vHalf = _mm_set1_ps(0.5f), vMinusHalf = _mm_set1_ps(-0.5f); /* rounding offsets */
+  float32_t in0;                                 /* input of the remaining samples */
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+  __m128 in;                                     /* scaled input */
+  __m128i over;                                  /* positive overflows */
+  uint32_t blkCnt = blockSize >> 2u;             /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = _mm_mul_ps(_mm_loadu_ps(pIn), vScale);
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* in += in > 0 ? 0.5 : -0.5 */
+    in = _mm_add_ps(in, _mm_blendv_ps(vMinusHalf, vHalf, _mm_cmpgt_ps(in, _mm_setzero_ps())));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* clip_q63_to_q31((q63_t) in): the scalar code saturates the values in [2^31, 2^63) to 0x7FFFFFFF.
+     ** The other values out of range and NaN give 0x80000000, as the truncation here. */
+    over = _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(in, vScale), _mm_cmplt_ps(in, vLimit)));
+
+    _mm_storeu_si128((__m128i *) pDst, _mm_xor_si128(_mm_cvttps_epi32(in), over));
+
+    pIn += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining samples one at a time */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+#ifdef ARM_MATH_ROUNDING
+
+    in0 = *pIn++;
+    in0 = (in0 * 2147483648.0f);
+    in0 += in0 > 0 ? 0.5 : -0.5;
+    *pDst++ = clip_q63_to_q31((q63_t) (in0));
+
+#else
+
+    *pDst++ = clip_q63_to_q31((q63_t) (*pIn++ * 2147483648.0f));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 /**   
  * @ingroup groupSupport   
  */
@@ -80,6 +224,25 @@ void arm_float_to_q31(
 
 #endif /*      #ifdef ARM_MATH_ROUNDING        */
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /* Run the below code on x86 hosts */
+#if defined (ARM_MATH_HOST_AVX2)
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_float_to_q31_avx2(pSrc, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+  if(ARM_HOST_CPU_HAS(ARM_HOST_CPU_SSE41))
+  {
+    arm_float_to_q31_sse41(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
 #ifndef ARM_MATH_CM0
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_host_cpu.c
+*
+* Description:	Instruction set detection for the x86 host kernels.
+*
+* Target Processor: x86 host
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST_SSE41)
+
+#if defined (ARM_MATH_HOST_DISPATCH)
+#include <stdlib.h>
+
+/* Names of the levels for the ARM_MATH_HOST_CPU environment variable */
+static const char *const arm_host_cpu_names[] = { "generic", "sse41", "avx2", "avx512" };
+#endif /* #if defined (ARM_MATH_HOST_DISPATCH) */
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @brief  Instruction set extensions of the processor the library runs on.
+ * @return The function returns the highest level of x86 kernels that the library
+ * contains and that the processor supports.
+ *
+ * \par
+ * With ARM_MATH_HOST_DISPATCH the processor is queried with CPUID on the first call
+ * and the result is kept for the following calls, so that every kernel selects its
+ * implementation with a single comparison.  The query also checks that the
+ * operating system saves the AVX and AVX-512 registers.  Without ARM_MATH_HOST_DISPATCH
+ * the level is the one the library is compiled for.
+ * \par
+ * The environment variable <code>ARM_MATH_HOST_CPU</code> lowers the level of a
+ * dispatching library to <code>generic</code>, <code>sse41</code>, <code>avx2</code>
+ * or <code>avx512</code>, for example to compare the kernels on one machine.
+ * As all the kernels give the same results, except arm_dot_prod_f32(), this only
+ * changes the speed.
+ */
+
+arm_host_cpu_level arm_host_cpu(void)
+{
+#if defined (ARM_MATH_HOST_DISPATCH)
+
+  static int cpuLevel = -1;                      /* Level found by the first call */
+  int level = __atomic_load_n(&cpuLevel, __ATOMIC_RELAXED);
+  const char *pName;                             /* Level requested in the environment */
+  int i;                                         /* Loop counter */
+
+  if(level < 0)
+  {
+    __builtin_cpu_init();
+
+    level = (int) ARM_HOST_CPU_GENERIC;
+
+    if(__builtin_cpu_supports("sse4.1"))
+    {
+      level = (int) ARM_HOST_CPU_SSE41;
+
+      if(__builtin_cpu_supports("avx2"))
+      {
+        level = (int) ARM_HOST_CPU_AVX2;
+
+        if(__builtin_cpu_supports("avx512f"))
+        {
+          level = (int) ARM_HOST_CPU_AVX512;
+        }
+      }
+    }
+
+    pName = getenv("ARM_MATH_HOST_CPU");
+
+    if(pName != NULL)
+    {
+      for (i = 0; i < level; i++)
+      {
+        if(strcmp(pName, arm_host_cpu_names[i]) == 0)
+        {
+          level = i;
+        }
+      }
+    }
+
+    /* Concurrent first calls store the same value */
+    __atomic_store_n(&cpuLevel, level, __ATOMIC_RELAXED);
+  }
+
+  return ((arm_host_cpu_level) level);
+
+#elif defined (ARM_MATH_HOST_AVX512)
+
+  return (ARM_HOST_CPU_AVX512);
+
+#elif defined (ARM_MATH_HOST_AVX2)
+
+  return (ARM_HOST_CPU_AVX2);
+
+#else
+
+  return (ARM_HOST_CPU_SSE41);
+
+#endif /* #if defined (ARM_MATH_HOST_DISPATCH) */
+}
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
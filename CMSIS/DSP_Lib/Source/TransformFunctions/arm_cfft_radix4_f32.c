@@ -36,6 +36,200 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+/*
+ * Radix-4 butterfly of four interleaved complex values per vector for the AVX2
+ * kernel.  ma negates the lanes that give (Q + j*U) in the second output and
+ * the twiddle product of the forward or inverse transform, md those of the
+ * fourth output.  The products and sums are those of the portable code, so the
+ * results are the same.
+ */
+
+ARM_HOST_TARGET("avx2")
+static __INLINE void arm_radix4_butterfly_f32_avx2_dft(
+  __m256 * pA,
+  __m256 * pB,
+  __m256 * pC,
+  __m256 * pD,
+  __m256 ma,
+  __m256 md)
+{
+  __m256 p, q, t, u;                             /* Sums and differences of the inputs */
+
+  /* (xa + xc), (ya + yc) and (xa - xc), (ya - yc) */
+  p = _mm256_add_ps(*pA, *pC);
+  q = _mm256_sub_ps(*pA, *pC);
+
+  /* (xb + xd), (yb + yd) and (yb - yd), (xb - xd) */
+  t = _mm256_add_ps(*pB, *pD);
+  u = _mm256_permute_ps(_mm256_sub_ps(*pB, *pD), 0xB1);
+
+  /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+  *pA = _mm256_add_ps(p, t);
+
+  /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+  *pB = _mm256_sub_ps(p, t);
+
+  /* (xa - xc) +/- (yb - yd), (ya - yc) -/+ (xb - xd) */
+  *pC = _mm256_add_ps(q, _mm256_xor_ps(u, ma));
+  *pD = _mm256_add_ps(q, _mm256_xor_ps(u, md));
+}
+
+/*
+ * Complex product of four interleaved values with the twiddle factors w for the
+ * AVX2 kernel: (x*co + y*si, y*co - x*si) when ma negates the imaginary lanes,
+ * (x*co - y*si, y*co + x*si) when it negates the real lanes.
+ */
+
+ARM_HOST_TARGET("avx2")
+static __INLINE __m256 arm_radix4_butterfly_f32_avx2_twiddle(
+  __m256 x,
+  __m256 w,
+  __m256 ma)
+{
+  return (_mm256_add_ps(_mm256_mul_ps(x, _mm256_moveldup_ps(w)),
+                        _mm256_xor_ps(_mm256_mul_ps(_mm256_permute_ps(x, 0xB1),
+                                                    _mm256_movehdup_ps(w)), ma)));
+}
+
+/*
+ * AVX2 kernel of arm_radix4_butterfly_f32() and arm_radix4_butterfly_inverse_f32()
+ * for fftLen >= 16.  Every stage but the last computes four butterflies with
+ * consecutive twiddle factors at a time.  The last stage has no twiddle factors
+ * and computes four butterflies of four consecutive values after a transpose.
+ */
+
+ARM_HOST_TARGET("avx2")
+static void arm_radix4_butterfly_f32_avx2(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  float32_t * pCoef,
+  uint16_t twidCoefModifier,
+  float32_t onebyfftLen,
+  uint8_t ifftFlag)
+{
+  const __m256 signRe = _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+  const __m256 signIm = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+  __m256 ma, md;                                 /* Sign masks of the transform direction */
+  __m256 w1, w2, w3;                             /* Twiddle factors of four butterflies */
+  __m256 xa, xb, xc, xd;                         /* Inputs and outputs of four butterflies */
+  __m256 t0, t1, t2, t3;                         /* Transposed values of the last stage */
+  __m256 scale;                                  /* 1/fftLen for the inverse transform */
+  float32_t *pX;                                 /* Input of the current butterflies */
+  uint32_t ia1, ia2, ia3;                        /* Twiddle factor indices */
+  uint32_t i0, n1, n2, j, k;                     /* Loop counters and stage sizes */
+
+  /* The forward transform multiplies with the conjugate twiddle factors */
+  if(ifftFlag == 0u)
+  {
+    ma = signIm;
+    md = signRe;
+  }
+  else
+  {
+    ma = signRe;
+    md = signIm;
+  }
+
+  /* All stages but the last one */
+  n2 = fftLen;
+
+  for (k = fftLen; k > 4u; k >>= 2u)
+  {
+    n1 = n2;
+    n2 >>= 2u;
+
+    for (j = 0u; j < n2; j += 4u)
+    {
+      /*  Twiddle factors of the butterflies j to j + 3 */
+      ia1 = j * twidCoefModifier;
+      ia2 = ia1 + ia1;
+      ia3 = ia2 + ia1;
+
+      w1 = _mm256_setr_ps(pCoef[ia1 * 2u], pCoef[(ia1 * 2u) + 1u],
+                          pCoef[(ia1 + twidCoefModifier) * 2u], pCoef[((ia1 + twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia1 + 2u * twidCoefModifier) * 2u], pCoef[((ia1 + 2u * twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia1 + 3u * twidCoefModifier) * 2u], pCoef[((ia1 + 3u * twidCoefModifier) * 2u) + 1u]);
+      w2 = _mm256_setr_ps(pCoef[ia2 * 2u], pCoef[(ia2 * 2u) + 1u],
+                          pCoef[(ia2 + 2u * twidCoefModifier) * 2u], pCoef[((ia2 + 2u * twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia2 + 4u * twidCoefModifier) * 2u], pCoef[((ia2 + 4u * twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia2 + 6u * twidCoefModifier) * 2u], pCoef[((ia2 + 6u * twidCoefModifier) * 2u) + 1u]);
+      w3 = _mm256_setr_ps(pCoef[ia3 * 2u], pCoef[(ia3 * 2u) + 1u],
+                          pCoef[(ia3 + 3u * twidCoefModifier) * 2u], pCoef[((ia3 + 3u * twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia3 + 6u * twidCoefModifier) * 2u], pCoef[((ia3 + 6u * twidCoefModifier) * 2u) + 1u],
+                          pCoef[(ia3 + 9u * twidCoefModifier) * 2u], pCoef[((ia3 + 9u * twidCoefModifier) * 2u) + 1u]);
+
+      for (i0 = j; i0 < fftLen; i0 += n1)
+      {
+        pX = pSrc + (2u * i0);
+
+        xa = _mm256_loadu_ps(pX);
+        xb = _mm256_loadu_ps(pX + (2u * n2));
+        xc = _mm256_loadu_ps(pX + (4u * n2));
+        xd = _mm256_loadu_ps(pX + (6u * n2));
+
+        arm_radix4_butterfly_f32_avx2_dft(&xa, &xb, &xc, &xd, ma, md);
+
+        /* xa' to pSrc[i0], xc' to pSrc[i1], xb' to pSrc[i2], xd' to pSrc[i3] */
+        _mm256_storeu_ps(pX, xa);
+        _mm256_storeu_ps(pX + (2u * n2), arm_radix4_butterfly_f32_avx2_twiddle(xb, w2, ma));
+        _mm256_storeu_ps(pX + (4u * n2), arm_radix4_butterfly_f32_avx2_twiddle(xc, w1, ma));
+        _mm256_storeu_ps(pX + (6u * n2), arm_radix4_butterfly_f32_avx2_twiddle(xd, w3, ma));
+      }
+    }
+
+    twidCoefModifier <<= 2u;
+  }
+
+  /* Last stage: four butterflies of four consecutive values at a time */
+  scale = _mm256_set1_ps(onebyfftLen);
+
+  for (i0 = 0u; i0 < fftLen; i0 += 16u)
+  {
+    pX = pSrc + (2u * i0);
+
+    t0 = _mm256_loadu_ps(pX);
+    t1 = _mm256_loadu_ps(pX + 8);
+    t2 = _mm256_loadu_ps(pX + 16);
+    t3 = _mm256_loadu_ps(pX + 24);
+
+    /* Transpose the complex values so that xa holds the first input of each butterfly */
+    xa = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+    xb = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+    xc = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+    xd = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+    t0 = _mm256_permute2f128_ps(xa, xc, 0x20);
+    t1 = _mm256_permute2f128_ps(xb, xd, 0x20);
+    t2 = _mm256_permute2f128_ps(xa, xc, 0x31);
+    t3 = _mm256_permute2f128_ps(xb, xd, 0x31);
+
+    arm_radix4_butterfly_f32_avx2_dft(&t0, &t1, &t2, &t3, ma, md);
+
+    if(ifftFlag != 0u)
+    {
+      t0 = _mm256_mul_ps(t0, scale);
+      t1 = _mm256_mul_ps(t1, scale);
+      t2 = _mm256_mul_ps(t2, scale);
+      t3 = _mm256_mul_ps(t3, scale);
+    }
+
+    /* Transpose back: xa' to pSrc[i0], xc' to pSrc[i1], xb' to pSrc[i2], xd' to pSrc[i3] */
+    xa = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+    xb = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t1)));
+    xc = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+    xd = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t2), _mm256_castps_pd(t3)));
+
+    _mm256_storeu_ps(pX, _mm256_permute2f128_ps(xa, xc, 0x20));
+    _mm256_storeu_ps(pX + 8, _mm256_permute2f128_ps(xb, xd, 0x20));
+    _mm256_storeu_ps(pX + 16, _mm256_permute2f128_ps(xa, xc, 0x31));
+    _mm256_storeu_ps(pX + 24, _mm256_permute2f128_ps(xb, xd, 0x31));
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
+
 /**   
  * @ingroup groupTransforms   
  */
@@ -62,6 +256,11 @@
  * \par   
  * Internally, the function utilize a radix-4 decimation in frequency(DIF) algorithm   
  * and the size of the FFT supported are of the lengths [16, 64, 256, 1024].  
+ * The floating-point transform also supports 4096.   
+ * \par   
+ * The floating-point mixed-radix transform arm_cfft_radix8_f32() uses radix-8 stages   
+ * followed by one radix-4 or radix-2 stage and supports every power of two from 16 to 4096.   
+ * It shares the twiddle factor and bit reversal tables with arm_cfft_radix4_f32().   
  *    
  *   
  * \par Algorithm:   
@@ -233,6 +432,17 @@ void arm_radix4_butterfly_f32(
   uint32_t i0, i1, i2, i3;
   uint32_t n1, n2, j, k;
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+  /* Run the below code on x86 hosts */
+  if((fftLen >= 16u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_radix4_butterfly_f32_avx2(pSrc, fftLen, pCoef, twidCoefModifier, 0.0f, 0u);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
 #ifndef ARM_MATH_CM0
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
@@ -670,6 +880,17 @@ void arm_radix4_butterfly_inverse_f32(
   uint32_t i0, i1, i2, i3;
   uint32_t n1, n2, j, k;
 
+#if defined (ARM_MATH_HOST_AVX2)
+
+  /* Run the below code on x86 hosts */
+  if((fftLen >= 16u) && ARM_HOST_CPU_HAS(ARM_HOST_CPU_AVX2))
+  {
+    arm_radix4_butterfly_f32_avx2(pSrc, fftLen, pCoef, twidCoefModifier, onebyfftLen, 1u);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST_AVX2) */
+
 #ifndef ARM_MATH_CM0
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
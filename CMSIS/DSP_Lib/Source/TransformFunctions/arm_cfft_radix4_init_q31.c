@@ -622,6 +622,45 @@ arm_status arm_cfft_radix4_init_q31(
   /*  Initialise the Flag for calculation Bit reversal or not */
   S->bitReverseFlag = bitReverseFlag;
 
+#if defined (ARM_DSP_CONFIG_TABLES)
+
+  /*  The bit reversal tables are built for one FFT length each */
+  S->bitRevFactor = 1u;
+
+  switch (S->fftLen)
+  {
+#if defined (ARM_TABLE_BITREV_1024)
+  case 1024u:
+    S->twidCoefModifier = 1u;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_1024;
+    break;
+#endif
+#if defined (ARM_TABLE_BITREV_256)
+  case 256u:
+    S->twidCoefModifier = 4u;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_256;
+    break;
+#endif
+#if defined (ARM_TABLE_BITREV_64)
+  case 64u:
+    S->twidCoefModifier = 16u;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_64;
+    break;
+#endif
+#if defined (ARM_TABLE_BITREV_16)
+  case 16u:
+    S->twidCoefModifier = 64u;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_16;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value or its table is not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+#else
+
   /*  Initializations of Instance structure depending on the FFT length */
   switch (S->fftLen)
   {
@@ -630,30 +669,30 @@ arm_status arm_cfft_radix4_init_q31(
     /*  Initialise the twiddle coef modifier value */
     S->twidCoefModifier = 1u;
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 1u;
+    S->bitRevFactor = 4u;
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = armBitRevTable;
+    S->pBitRevTable = &armBitRevTable[3];
     break;
 
   case 256u:
     /*  Initializations of structure parameters for 256 point FFT */
     S->twidCoefModifier = 4u;
-    S->bitRevFactor = 4u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[3];
+    S->bitRevFactor = 16u;
+    S->pBitRevTable = (uint16_t *) &armBitRevTable[15];
     break;
 
   case 64u:
     /*  Initializations of structure parameters for 64 point FFT */
     S->twidCoefModifier = 16u;
-    S->bitRevFactor = 16u;
-    S->pBitRevTable = &armBitRevTable[15];
+    S->bitRevFactor = 64u;
+    S->pBitRevTable = &armBitRevTable[63];
     break;
 
   case 16u:
     /*  Initializations of structure parameters for 16 point FFT */
     S->twidCoefModifier = 64u;
-    S->bitRevFactor = 64u;
-    S->pBitRevTable = &armBitRevTable[63];
+    S->bitRevFactor = 256u;
+    S->pBitRevTable = &armBitRevTable[255];
     break;
 
   default:
@@ -662,6 +701,8 @@ arm_status arm_cfft_radix4_init_q31(
     break;
   }
 
+#endif /* defined (ARM_DSP_CONFIG_TABLES) */
+
   return (status);
 }
 
@@ -0,0 +1,479 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_radix8_f32.c
+*
+* Description:	Mixed radix-8/4/2 Decimation in Frequency CFFT & CIFFT Floating point processing function
+*
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CFFT_CIFFT
+ * @{
+ */
+
+/**
+ * @details
+ * @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.
+ * @param[in]      *S    points to an instance of the floating-point mixed-radix CFFT/CIFFT structure.
+ * @param[in, out] *pSrc points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @return none.
+ *
+ * \par
+ * The transform supports every power of two length from 16 to 4096.
+ * Internally it is a decimation in frequency algorithm built from radix-8
+ * stages followed, when log2(fftLen) is not a multiple of 3, by a single
+ * radix-4 or radix-2 stage.  Each radix-8 stage replaces three radix-2 passes
+ * over the buffer.
+ * \par
+ * Every butterfly writes its outputs in bit reversed order, so the result of
+ * the butterfly stages is in bit reversed order for all lengths and the same
+ * bit reversal table as the radix-4 transform is used to restore normal order.
+ * \par
+ * <b> Radix-8 butterfly equations:</b>
+ * <pre>
+ * X(k) = W<sub>L</sub><sup>jk</sup> * sum(x(j + q*L/8) * W<sub>8</sub><sup>qk</sup>), q = 0..7
+ * </pre>
+ * where L is the span of the stage and j the index within a group.  X(k) is
+ * stored at <code>j + bitrev(k)*L/8</code>.
+ */
+
+void arm_cfft_radix8_f32(
+  const arm_cfft_radix8_instance_f32 * S,
+  float32_t * pSrc)
+{
+
+  if(S->ifftFlag == 1u)
+  {
+    /*  Complex IFFT mixed radix  */
+    arm_radix8_butterfly_inverse_f32(pSrc, S->fftLen, S->pTwiddle,
+                                     S->twidCoefModifier, S->onebyfftLen);
+  }
+  else
+  {
+    /*  Complex FFT mixed radix  */
+    arm_radix8_butterfly_f32(pSrc, S->fftLen, S->pTwiddle,
+                             S->twidCoefModifier);
+  }
+
+  if(S->bitReverseFlag == 1u)
+  {
+    /*  Bit Reversal */
+    arm_bitreversal_f32(pSrc, S->fftLen, S->bitRevFactor, S->pBitRevTable);
+  }
+
+}
+
+
+/**
+ * @} end of CFFT_CIFFT group
+ */
+
+
+
+/* ----------------------------------------------------------------------
+** Internal helper function used by the FFTs
+** ------------------------------------------------------------------- */
+
+/*
+ * @brief  8-point DFT of the samples pIn[0], pIn[n2], .. pIn[7*n2].
+ * @param[in]  *pIn   points to the first complex sample.
+ * @param[in]  n2     distance between the samples in complex values.
+ * @param[out] *pOut  points to the 16 values of the result, in natural order.
+ * @return none.
+ */
+
+static __INLINE void arm_radix8_dft_f32(
+  const float32_t * pIn,
+  uint32_t n2,
+  float32_t * pOut)
+{
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+  float32_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+  float32_t c0r, c0i, c1r, c1i, c2r, c2i, c3r, c3i;
+  float32_t d0r, d0i, d1r, d1i, d2r, d2i, d3r, d3i;
+  float32_t t1, t2;
+  uint32_t s = 2u * n2;
+
+  /* a(q) = x(q) + x(q+4), b(q) = x(q) - x(q+4) */
+  a0r = pIn[0] + pIn[4u * s];
+  a0i = pIn[1] + pIn[(4u * s) + 1u];
+  b0r = pIn[0] - pIn[4u * s];
+  b0i = pIn[1] - pIn[(4u * s) + 1u];
+  a1r = pIn[s] + pIn[5u * s];
+  a1i = pIn[s + 1u] + pIn[(5u * s) + 1u];
+  b1r = pIn[s] - pIn[5u * s];
+  b1i = pIn[s + 1u] - pIn[(5u * s) + 1u];
+  a2r = pIn[2u * s] + pIn[6u * s];
+  a2i = pIn[(2u * s) + 1u] + pIn[(6u * s) + 1u];
+  b2r = pIn[2u * s] - pIn[6u * s];
+  b2i = pIn[(2u * s) + 1u] - pIn[(6u * s) + 1u];
+  a3r = pIn[3u * s] + pIn[7u * s];
+  a3i = pIn[(3u * s) + 1u] + pIn[(7u * s) + 1u];
+  b3r = pIn[3u * s] - pIn[7u * s];
+  b3i = pIn[(3u * s) + 1u] - pIn[(7u * s) + 1u];
+
+  /* Even outputs: 4-point DFT of a(q) */
+  c0r = a0r + a2r;
+  c0i = a0i + a2i;
+  c2r = a0r - a2r;
+  c2i = a0i - a2i;
+  c1r = a1r + a3r;
+  c1i = a1i + a3i;
+  c3r = a1r - a3r;
+  c3i = a1i - a3i;
+
+  /* X(0) = c0 + c1, X(4) = c0 - c1 */
+  pOut[0] = c0r + c1r;
+  pOut[1] = c0i + c1i;
+  pOut[8] = c0r - c1r;
+  pOut[9] = c0i - c1i;
+
+  /* X(2) = c2 - j*c3, X(6) = c2 + j*c3 */
+  pOut[4] = c2r + c3i;
+  pOut[5] = c2i - c3r;
+  pOut[12] = c2r - c3i;
+  pOut[13] = c2i + c3r;
+
+  /* Odd outputs: b(q) rotated by W8^q, then a 4-point DFT */
+  /* d0 = b0 + b2 * W8^2, d2 = b0 - b2 * W8^2 */
+  d0r = b0r + b2i;
+  d0i = b0i - b2r;
+  d2r = b0r - b2i;
+  d2i = b0i + b2r;
+
+  /* b1 * W8^1 = (b1r + b1i, b1i - b1r) / sqrt(2) */
+  t1 = b1r + b1i;
+  t2 = b1i - b1r;
+
+  /* b3 * W8^3 = (b3i - b3r, -b3r - b3i) / sqrt(2) */
+  c0r = b3i - b3r;
+  c0i = -(b3r + b3i);
+
+  /* d1 = b1 * W8^1 + b3 * W8^3, d3 = b1 * W8^1 - b3 * W8^3 */
+  d1r = (t1 + c0r) * 0.707106781186547524f;
+  d1i = (t2 + c0i) * 0.707106781186547524f;
+  d3r = (t1 - c0r) * 0.707106781186547524f;
+  d3i = (t2 - c0i) * 0.707106781186547524f;
+
+  /* X(1) = d0 + d1, X(5) = d0 - d1 */
+  pOut[2] = d0r + d1r;
+  pOut[3] = d0i + d1i;
+  pOut[10] = d0r - d1r;
+  pOut[11] = d0i - d1i;
+
+  /* X(3) = d2 - j*d3, X(7) = d2 + j*d3 */
+  pOut[6] = d2r + d3i;
+  pOut[7] = d2i - d3r;
+  pOut[14] = d2r - d3i;
+  pOut[15] = d2i + d3r;
+}
+
+/*
+ * @brief  Stores one output of a radix-8 butterfly multiplied by its twiddle factor.
+ * @param[out] *pOut  points to the first complex sample of the butterfly.
+ * @param[in]  n2     distance between the butterfly samples in complex values.
+ * @param[in]  pos    output position in units of n2.
+ * @param[in]  *pX    points to the output value.
+ * @param[in]  co     cosine of the twiddle factor.
+ * @param[in]  si     sine of the twiddle factor.
+ * @return none.
+ */
+
+static __INLINE void arm_radix8_store_f32(
+  float32_t * pOut,
+  uint32_t n2,
+  uint32_t pos,
+  const float32_t * pX,
+  float32_t co,
+  float32_t si)
+{
+  pOut[2u * pos * n2] = (pX[0] * co) + (pX[1] * si);
+  pOut[(2u * pos * n2) + 1u] = (pX[1] * co) - (pX[0] * si);
+}
+
+/*
+ * @brief  Core function for the floating-point mixed-radix CFFT butterfly process.
+ * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      *pCoef           points to the twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+ * @return none.
+ */
+
+void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  float32_t * pCoef,
+  uint16_t twidCoefModifier)
+{
+  /* Output position of X(k) within a radix-8 butterfly, in units of n2 */
+  static const uint8_t bitRev8[8] = { 0u, 4u, 2u, 6u, 1u, 5u, 3u, 7u };
+  float32_t X[16];
+  float32_t co[8], si[8];
+  float32_t xr, xi;
+  float32_t *pIn;
+  uint32_t n1, n2, i0, j, k, ia, modifier;
+
+  n1 = fftLen;
+  modifier = twidCoefModifier;
+
+  /*  Radix-8 stages */
+  while(n1 >= 8u)
+  {
+    n2 = n1 >> 3u;
+
+    if(n1 == 8u)
+    {
+      /*  Radix-8 last stage: all twiddle factors are one */
+      for (i0 = 0u; i0 < fftLen; i0 += 8u)
+      {
+        pIn = pSrc + (2u * i0);
+
+        arm_radix8_dft_f32(pIn, 1u, X);
+
+        for (k = 0u; k < 8u; k++)
+        {
+          pIn[2u * bitRev8[k]] = X[2u * k];
+          pIn[(2u * bitRev8[k]) + 1u] = X[(2u * k) + 1u];
+        }
+      }
+
+      return;
+    }
+
+    for (j = 0u; j < n2; j++)
+    {
+      /*  Twiddle factors W(jk) of the current stage */
+      ia = j * modifier;
+
+      for (k = 1u; k < 8u; k++)
+      {
+        co[k] = pCoef[2u * ia * k];
+        si[k] = pCoef[(2u * ia * k) + 1u];
+      }
+
+      for (i0 = j; i0 < fftLen; i0 += n1)
+      {
+        pIn = pSrc + (2u * i0);
+
+        arm_radix8_dft_f32(pIn, n2, X);
+
+        /*  xa' = X(0) */
+        pIn[0] = X[0];
+        pIn[1] = X[1];
+
+        /*  X(k) * W(jk) is stored at bitrev(k) * n2 */
+        arm_radix8_store_f32(pIn, n2, 4u, &X[2], co[1], si[1]);
+        arm_radix8_store_f32(pIn, n2, 2u, &X[4], co[2], si[2]);
+        arm_radix8_store_f32(pIn, n2, 6u, &X[6], co[3], si[3]);
+        arm_radix8_store_f32(pIn, n2, 1u, &X[8], co[4], si[4]);
+        arm_radix8_store_f32(pIn, n2, 5u, &X[10], co[5], si[5]);
+        arm_radix8_store_f32(pIn, n2, 3u, &X[12], co[6], si[6]);
+        arm_radix8_store_f32(pIn, n2, 7u, &X[14], co[7], si[7]);
+      }
+    }
+
+    /*  Twiddle coefficients index modifier for the next stage */
+    modifier <<= 3u;
+    n1 = n2;
+  }
+
+  if(n1 == 4u)
+  {
+    /*  Radix-4 last stage, all twiddle factors are one */
+    for (i0 = 0u; i0 < fftLen; i0 += 4u)
+    {
+      pIn = pSrc + (2u * i0);
+
+      X[0] = pIn[0] + pIn[4];
+      X[1] = pIn[1] + pIn[5];
+      X[2] = pIn[0] - pIn[4];
+      X[3] = pIn[1] - pIn[5];
+      X[4] = pIn[2] + pIn[6];
+      X[5] = pIn[3] + pIn[7];
+      X[6] = pIn[2] - pIn[6];
+      X[7] = pIn[3] - pIn[7];
+
+      /*  xa' = (xa + xc) + (xb + xd) */
+      pIn[0] = X[0] + X[4];
+      pIn[1] = X[1] + X[5];
+      /*  xb' = (xa + xc) - (xb + xd) */
+      pIn[2] = X[0] - X[4];
+      pIn[3] = X[1] - X[5];
+      /*  xc' = (xa - xc) - j(xb - xd) */
+      pIn[4] = X[2] + X[7];
+      pIn[5] = X[3] - X[6];
+      /*  xd' = (xa - xc) + j(xb - xd) */
+      pIn[6] = X[2] - X[7];
+      pIn[7] = X[3] + X[6];
+    }
+  }
+  else if(n1 == 2u)
+  {
+    /*  Radix-2 last stage */
+    for (i0 = 0u; i0 < fftLen; i0 += 2u)
+    {
+      pIn = pSrc + (2u * i0);
+
+      xr = pIn[0] - pIn[2];
+      xi = pIn[1] - pIn[3];
+      pIn[0] = pIn[0] + pIn[2];
+      pIn[1] = pIn[1] + pIn[3];
+      pIn[2] = xr;
+      pIn[3] = xi;
+    }
+  }
+}
+
+/*
+ * @brief  Core function for the floating-point mixed-radix CIFFT butterfly process.
+ * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      *pCoef           points to twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+ * @param[in]      onebyfftLen      value of 1/fftLen.
+ * @return none.
+ *
+ * The inverse 8-point DFT is the forward one with output k read from 8-k.
+ * The 1/fftLen scaling is applied in the last stage.
+ */
+
+void arm_radix8_butterfly_inverse_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  float32_t * pCoef,
+  uint16_t twidCoefModifier,
+  float32_t onebyfftLen)
+{
+  static const uint8_t bitRev8[8] = { 0u, 4u, 2u, 6u, 1u, 5u, 3u, 7u };
+  float32_t X[16];
+  float32_t co[8], si[8];
+  float32_t xr, xi;
+  float32_t *pIn;
+  uint32_t n1, n2, i0, j, k, ia, modifier;
+
+  n1 = fftLen;
+  modifier = twidCoefModifier;
+
+  /*  Radix-8 stages */
+  while(n1 >= 8u)
+  {
+    n2 = n1 >> 3u;
+
+    if(n1 == 8u)
+    {
+      /*  Radix-8 last stage: all twiddle factors are one, apply the scaling */
+      for (i0 = 0u; i0 < fftLen; i0 += 8u)
+      {
+        pIn = pSrc + (2u * i0);
+
+        arm_radix8_dft_f32(pIn, 1u, X);
+
+        pIn[0] = X[0] * onebyfftLen;
+        pIn[1] = X[1] * onebyfftLen;
+
+        for (k = 1u; k < 8u; k++)
+        {
+          pIn[2u * bitRev8[k]] = X[2u * (8u - k)] * onebyfftLen;
+          pIn[(2u * bitRev8[k]) + 1u] = X[(2u * (8u - k)) + 1u] * onebyfftLen;
+        }
+      }
+
+      return;
+    }
+
+    for (j = 0u; j < n2; j++)
+    {
+      /*  Twiddle factors W(jk) of the current stage */
+      ia = j * modifier;
+
+      for (k = 1u; k < 8u; k++)
+      {
+        co[k] = pCoef[2u * ia * k];
+        si[k] = pCoef[(2u * ia * k) + 1u];
+      }
+
+      for (i0 = j; i0 < fftLen; i0 += n1)
+      {
+        pIn = pSrc + (2u * i0);
+
+        arm_radix8_dft_f32(pIn, n2, X);
+
+        pIn[0] = X[0];
+        pIn[1] = X[1];
+
+        /*  X(k) * conj(W(jk)), with X(k) taken from output 8-k */
+        arm_radix8_store_f32(pIn, n2, 4u, &X[14], co[1], -si[1]);
+        arm_radix8_store_f32(pIn, n2, 2u, &X[12], co[2], -si[2]);
+        arm_radix8_store_f32(pIn, n2, 6u, &X[10], co[3], -si[3]);
+        arm_radix8_store_f32(pIn, n2, 1u, &X[8], co[4], -si[4]);
+        arm_radix8_store_f32(pIn, n2, 5u, &X[6], co[5], -si[5]);
+        arm_radix8_store_f32(pIn, n2, 3u, &X[4], co[6], -si[6]);
+        arm_radix8_store_f32(pIn, n2, 7u, &X[2], co[7], -si[7]);
+      }
+    }
+
+    /*  Twiddle coefficients index modifier for the next stage */
+    modifier <<= 3u;
+    n1 = n2;
+  }
+
+  if(n1 == 4u)
+  {
+    /*  Radix-4 last stage with scaling */
+    for (i0 = 0u; i0 < fftLen; i0 += 4u)
+    {
+      pIn = pSrc + (2u * i0);
+
+      X[0] = pIn[0] + pIn[4];
+      X[1] = pIn[1] + pIn[5];
+      X[2] = pIn[0] - pIn[4];
+      X[3] = pIn[1] - pIn[5];
+      X[4] = pIn[2] + pIn[6];
+      X[5] = pIn[3] + pIn[7];
+      X[6] = pIn[2] - pIn[6];
+      X[7] = pIn[3] - pIn[7];
+
+      /*  xa' = (xa + xc) + (xb + xd) */
+      pIn[0] = (X[0] + X[4]) * onebyfftLen;
+      pIn[1] = (X[1] + X[5]) * onebyfftLen;
+      /*  xb' = (xa + xc) - (xb + xd) */
+      pIn[2] = (X[0] - X[4]) * onebyfftLen;
+      pIn[3] = (X[1] - X[5]) * onebyfftLen;
+      /*  xc' = (xa - xc) + j(xb - xd) */
+      pIn[4] = (X[2] - X[7]) * onebyfftLen;
+      pIn[5] = (X[3] + X[6]) * onebyfftLen;
+      /*  xd' = (xa - xc) - j(xb - xd) */
+      pIn[6] = (X[2] + X[7]) * onebyfftLen;
+      pIn[7] = (X[3] - X[6]) * onebyfftLen;
+    }
+  }
+  else if(n1 == 2u)
+  {
+    /*  Radix-2 last stage with scaling */
+    for (i0 = 0u; i0 < fftLen; i0 += 2u)
+    {
+      pIn = pSrc + (2u * i0);
+
+      xr = (pIn[0] - pIn[2]) * onebyfftLen;
+      xi = (pIn[1] - pIn[3]) * onebyfftLen;
+      pIn[0] = (pIn[0] + pIn[2]) * onebyfftLen;
+      pIn[1] = (pIn[1] + pIn[3]) * onebyfftLen;
+      pIn[2] = xr;
+      pIn[3] = xi;
+    }
+  }
+}
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_radix8_init_f32.c
+*
+* Description:	Mixed radix-8/4/2 Decimation in Frequency Floating-point CFFT & CIFFT Initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CFFT_CIFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+* @param[in,out] *S             points to an instance of the floating-point mixed-radix CFFT/CIFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>ifftFlag</code> controls whether a forward or inverse transform is computed.
+* Set(=1) ifftFlag for calculation of CIFFT otherwise  CFFT is calculated
+* \par
+* The parameter <code>bitReverseFlag</code> controls whether output is in normal order or bit reversed order.
+* Set(=1) bitReverseFlag for output to be in normal order otherwise output is in bit reversed order.
+* \par
+* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The twiddle factor and bit reversal tables are the ones used by arm_cfft_radix4_init_f32().
+*/
+
+arm_status arm_cfft_radix8_init_f32(
+  arm_cfft_radix8_instance_f32 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initialise the Flag for selection of CFFT or CIFFT */
+  S->ifftFlag = ifftFlag;
+
+  /*  Initialise the Flag for calculation Bit reversal or not */
+  S->bitReverseFlag = bitReverseFlag;
+
+#if defined (ARM_DSP_CONFIG_TABLES)
+
+  /*  The tables are built for one FFT length each and are read with stride 1 */
+  switch (S->fftLen)
+  {
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_4096) && defined (ARM_TABLE_BITREV_4096)
+  case 4096u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_4096;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_4096;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_2048) && defined (ARM_TABLE_BITREV_2048)
+  case 2048u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_2048;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_2048;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_1024) && defined (ARM_TABLE_BITREV_1024)
+  case 1024u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_1024;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_1024;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_512) && defined (ARM_TABLE_BITREV_512)
+  case 512u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_512;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_512;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_256) && defined (ARM_TABLE_BITREV_256)
+  case 256u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_256;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_256;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_128) && defined (ARM_TABLE_BITREV_128)
+  case 128u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_128;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_128;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_64) && defined (ARM_TABLE_BITREV_64)
+  case 64u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_64;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_64;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_32) && defined (ARM_TABLE_BITREV_32)
+  case 32u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_32;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_32;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_16) && defined (ARM_TABLE_BITREV_16)
+  case 16u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_16;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_16;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value or its tables are not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  S->twidCoefModifier = 1u;
+  S->bitRevFactor = 1u;
+  S->onebyfftLen = 1.0f / (float32_t) fftLen;
+
+#else
+
+  /*  Initialise the Twiddle coefficient pointer */
+  S->pTwiddle = (float32_t *) twiddleCoef;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (S->fftLen)
+  {
+  case 4096u:
+  case 2048u:
+  case 1024u:
+  case 512u:
+  case 256u:
+  case 128u:
+  case 64u:
+  case 32u:
+  case 16u:
+    /*  The tables are built for 4096 points and are read with a stride */
+    S->twidCoefModifier = (uint16_t) (4096u / fftLen);
+    S->bitRevFactor = S->twidCoefModifier;
+    S->pBitRevTable = &armBitRevTable[S->bitRevFactor - 1u];
+    S->onebyfftLen = 1.0f / (float32_t) fftLen;
+    break;
+
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+#endif /* defined (ARM_DSP_CONFIG_TABLES) */
+
+  return (status);
+}
+
+/**
+ * @} end of CFFT_CIFFT group
+ */
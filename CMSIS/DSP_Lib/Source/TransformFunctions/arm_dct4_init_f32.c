@@ -29,6 +29,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**   
  * @ingroup groupTransforms   
@@ -61,6 +62,8 @@
 * array length is <code>2*N</code>.   
 */
 
+#if !defined (ARM_DSP_CONFIG_TABLES)
+
 static const float32_t Weights_128[256] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999924701839144500f,
   -0.012271538285719925f,
@@ -4124,6 +4127,8 @@ static const float32_t cos_factors_2048[2048] = {
   0.000383495187571497f
 };
 
+#endif /* !defined (ARM_DSP_CONFIG_TABLES) */
+
 /**   
  * @brief  Initialization function for the floating-point DCT4/IDCT4.  
  * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.  
@@ -4150,6 +4155,8 @@ arm_status arm_dct4_init_f32(
   /*  Initialize the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
+#if !defined (ARM_DSP_CONFIG_TABLES)
+
   /* Initializing the pointer array with the weight table base addresses of different lengths */
   float32_t *twiddlePtr[3] =
     { (float32_t *) Weights_128, (float32_t *) Weights_512,
@@ -4162,6 +4169,8 @@ arm_status arm_dct4_init_f32(
     (float32_t *) cos_factors_2048
   };
 
+#endif /* !defined (ARM_DSP_CONFIG_TABLES) */
+
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -4177,6 +4186,35 @@ arm_status arm_dct4_init_f32(
   /* Initialize Complex FFT Instance */
   S->pCfft = S_CFFT;
 
+#if defined (ARM_DSP_CONFIG_TABLES)
+
+  /*  The tables are built for one DCT length each */
+  switch (N)
+  {
+#if defined (ARM_TABLE_DCT4_F32_2048)
+  case 2048u:
+    S->pTwiddle = (float32_t *) Weights_f32_2048;
+    S->pCosFactor = (float32_t *) cos_factors_f32_2048;
+    break;
+#endif
+#if defined (ARM_TABLE_DCT4_F32_512)
+  case 512u:
+    S->pTwiddle = (float32_t *) Weights_f32_512;
+    S->pCosFactor = (float32_t *) cos_factors_f32_512;
+    break;
+#endif
+#if defined (ARM_TABLE_DCT4_F32_128)
+  case 128u:
+    S->pTwiddle = (float32_t *) Weights_f32_128;
+    S->pCosFactor = (float32_t *) cos_factors_f32_128;
+    break;
+#endif
+  default:
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+#else
+
   switch (N)
   {
     /* Initialize the table modifier values */
@@ -4196,8 +4234,13 @@ arm_status arm_dct4_init_f32(
     status = ARM_MATH_ARGUMENT_ERROR;
   }
 
-  /* Initialize the RFFT/RIFFT */
-  arm_rfft_init_f32(S->pRfft, S->pCfft, S->N, 0u, 1u);
+#endif /* defined (ARM_DSP_CONFIG_TABLES) */
+
+  /* Initialize the RFFT/RIFFT, which can fail when its tables are not built */
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_init_f32(S->pRfft, S->pCfft, S->N, 0u, 1u);
+  }
 
   /* return the status of DCT4 Init function */
   return (status);
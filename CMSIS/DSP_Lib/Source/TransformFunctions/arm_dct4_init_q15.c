@@ -1178,8 +1178,11 @@ arm_status arm_dct4_init_q15(
     status = ARM_MATH_ARGUMENT_ERROR;
   }
 
-  /* Initialize the RFFT/RIFFT */
-  arm_rfft_init_q15(S->pRfft, S->pCfft, S->N, 0u, 1u);
+  /* Initialize the RFFT/RIFFT, which can fail when its tables are not built */
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_init_q15(S->pRfft, S->pCfft, S->N, 0u, 1u);
+  }
 
   /* return the status of DCT4 Init function */
   return (status);
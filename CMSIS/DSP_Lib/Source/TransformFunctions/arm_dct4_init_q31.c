@@ -2186,8 +2186,11 @@ arm_status arm_dct4_init_q31(
     status = ARM_MATH_ARGUMENT_ERROR;
   }
 
-  /* Initialize the RFFT/RIFFT Function */
-  arm_rfft_init_q31(S->pRfft, S->pCfft, S->N, 0, 1);
+  /* Initialize the RFFT/RIFFT, which can fail when its tables are not built */
+  if(status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_init_q31(S->pRfft, S->pCfft, S->N, 0, 1);
+  }
 
   /* return the status of DCT4 Init function */
   return (status);
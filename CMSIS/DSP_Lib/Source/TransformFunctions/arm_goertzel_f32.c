@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_f32.c
+*
+* Description:	Floating-point Goertzel filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * Computes a few bins of the DFT of a frame of <code>N = frameLen</code> real samples:
+ * <pre>
+ *     X[k] = sum(x[n] * exp(-j * 2 * pi * k * n / N), n = 0 ... N - 1)
+ * </pre>
+ * for the bin indices <code>k</code> given at initialization, as tone, DTMF or
+ * vibration line detectors need.  Each bin is computed by the second order recursion
+ * <pre>
+ *     s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2],    w = 2 * pi * k / N
+ *     X[k] = exp(j * w) * s[N - 1] - s[N - 2]
+ * </pre>
+ * which costs one multiplication and two additions per sample and per bin.  Computing
+ * <code>K</code> bins costs <code>K * N</code> multiplications, against about
+ * <code>2 * N * log2(N)</code> for a complex FFT followed by a magnitude over all the bins,
+ * so a bank of a few bins is much cheaper than the full transform.
+ *
+ * The outputs are interleaved as <code>{real, imag, real, imag, ...}</code>, one complex
+ * value per bin in the order of the bin indices, so that the power or the magnitude of
+ * the bins can be computed with arm_cmplx_mag_squared_f32(), arm_cmplx_mag_f32() or
+ * arm_cmplx_mag_db_f32().
+ * The floating-point outputs are not scaled.  The Q31 outputs are scaled down by
+ * <code>2^scaleShift</code>, where <code>scaleShift = ceil(log2(N))</code>, which is
+ * <code>1/N</code> for a power of two frame length, so that they cannot overflow.
+ *
+ * \par Instance Structure
+ * The frame length, the bins and their coefficients are stored in an instance data
+ * structure, which must be initialized with arm_goertzel_init_f32() or
+ * arm_goertzel_init_q31().  The coefficient buffer holds the cosine and the sine of
+ * the frequency of each bin.  The processing functions have no state: every call
+ * processes a whole frame.  For a bin value updated on every sample, use the
+ * \ref SDFT "sliding DFT".
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Goertzel filter bank.
+ * @param[in]  *S points to an instance of the floating-point Goertzel structure.
+ * @param[in]  *pSrc points to the input frame of frameLen samples.
+ * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+ * @return none.
+ */
+
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t *pIn;                                /* input pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* cosine and sine of the bins */
+  float32_t cosVal, sinVal, coef;                /* cosine, sine and 2 * cosine */
+  float32_t s0, s1, s2;                          /* last values of the recursion */
+  uint32_t binCnt, blkCnt;                       /* loop counters */
+
+  binCnt = S->numBins;
+
+  while(binCnt > 0u)
+  {
+    cosVal = *pCoeffs++;
+    sinVal = *pCoeffs++;
+    coef = 2.0f * cosVal;
+
+    pIn = pSrc;
+    s1 = 0.0f;
+    s2 = 0.0f;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = (uint32_t) S->frameLen >> 2u;
+
+    /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+     ** a second loop below processes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2], with s1 and s2 swapping roles */
+      s2 = (pIn[0] + (coef * s1)) - s2;
+      s1 = (pIn[1] + (coef * s2)) - s1;
+      s2 = (pIn[2] + (coef * s1)) - s2;
+      s1 = (pIn[3] + (coef * s2)) - s1;
+
+      pIn += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the frameLen is not a multiple of 4, process the remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = (uint32_t) S->frameLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = S->frameLen;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+    while(blkCnt > 0u)
+    {
+      /* s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2] */
+      s0 = (*pIn++ + (coef * s1)) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* X[k] = exp(j * w) * s[N - 1] - s[N - 2] */
+    *pDst++ = (cosVal * s1) - s2;
+    *pDst++ = sinVal * s1;
+
+    /* Decrement the bin counter */
+    binCnt--;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
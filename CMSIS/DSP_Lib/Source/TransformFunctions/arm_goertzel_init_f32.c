@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_f32.c
+*
+* Description:	Floating-point Goertzel filter bank initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel filter bank.
+ * @param[out] *S points to an instance of the floating-point Goertzel structure.
+ * @param[in]  numBins number of bins.
+ * @param[in]  frameLen frame length, the number of points of the DFT.
+ * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+ * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+ *
+ * \par Description:
+ * \par
+ * The bin of index <code>k</code> has the frequency <code>k * fs / frameLen</code>.
+ * Bin indices above <code>frameLen/2</code> are negative frequencies.
+ * \par
+ * <code>pCoeffs</code> is filled with the cosine and the sine of
+ * <code>w = 2 * pi * k / frameLen</code> for each bin, computed with arm_vsin_cos_q31().
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  uint16_t * pBinIndex,
+  float32_t * pCoeffs)
+{
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the initialization */
+  q31_t phase, sinVal, cosVal;                   /* bin frequency, its sine and cosine */
+  uint32_t i;                                    /* loop counter */
+
+  /* Assign the number of bins, the frame length and the coefficient pointer */
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->pCoeffs = pCoeffs;
+
+  if(frameLen < 2u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBinIndex[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+      /* w = k / frameLen of a turn, rounded to 0.32 format */
+      phase = (q31_t) (uint32_t) ((((uint64_t) pBinIndex[i] << 32) + (frameLen >> 1u)) /
+                                  frameLen);
+      arm_vsin_cos_q31(&phase, &sinVal, &cosVal, 1u);
+
+      pCoeffs[0] = (float32_t) cosVal * 4.656612873077393e-10f;
+      pCoeffs[1] = (float32_t) sinVal * 4.656612873077393e-10f;
+    }
+
+    pCoeffs += 2u;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_q31.c
+*
+* Description:	Q31 Goertzel filter bank initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel filter bank.
+ * @param[out] *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]  numBins number of bins.
+ * @param[in]  frameLen frame length, the number of points of the DFT.
+ * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+ * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+ *
+ * \par Description:
+ * \par
+ * The bin of index <code>k</code> has the frequency <code>k * fs / frameLen</code>.
+ * Bin indices above <code>frameLen/2</code> are negative frequencies.
+ * \par
+ * <code>pCoeffs</code> is filled with the cosine and the sine of
+ * <code>w = 2 * pi * k / frameLen</code> for each bin, computed with arm_vsin_cos_q31()
+ * from the nearest quarter turn, in 2.30 format, so that +1 and -1 are exact and the
+ * recursion of the DC and Nyquist bins has no coefficient error.
+ * \par
+ * <code>scaleShift</code> is set to <code>ceil(log2(frameLen))</code>.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  uint16_t * pBinIndex,
+  q31_t * pCoeffs)
+{
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the initialization */
+  uint32_t phase, quadrant;                      /* bin frequency and nearest quarter turn */
+  q31_t offset, sinVal, cosVal;                  /* offset from it, its sine and cosine */
+  uint32_t i;                                    /* loop counter */
+
+  /* Assign the number of bins, the frame length and the coefficient pointer */
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->pCoeffs = pCoeffs;
+
+  /* The outputs are scaled down by 2^ceil(log2(frameLen)) */
+  S->scaleShift = (frameLen < 2u) ? 1u : (uint8_t) (32u - __CLZ((uint32_t) frameLen - 1u));
+
+  if(frameLen < 2u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBinIndex[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+      /* w = k / frameLen of a turn, rounded to 0.32 format */
+      phase = (uint32_t) ((((uint64_t) pBinIndex[i] << 32) + (frameLen >> 1u)) / frameLen);
+
+      /* Nearest quarter turn, and offset from it in [-1/8 +1/8) turn */
+      quadrant = (phase + 0x20000000u) >> 30;
+      offset = (q31_t) (phase - (quadrant << 30));
+      arm_vsin_cos_q31(&offset, &sinVal, &cosVal, 1u);
+
+      /* 1.31 to 2.30 format with rounding, so that cos(0) is exactly +1 */
+      cosVal = (cosVal >> 1) + (cosVal & 1);
+      sinVal = (sinVal >> 1) + (sinVal & 1);
+
+      /* Rotate by the quarter turns, so that the DC and Nyquist bins are exact */
+      switch (quadrant)
+      {
+      case 0u:
+        pCoeffs[0] = cosVal;
+        pCoeffs[1] = sinVal;
+        break;
+      case 1u:
+        pCoeffs[0] = -sinVal;
+        pCoeffs[1] = cosVal;
+        break;
+      case 2u:
+        pCoeffs[0] = -cosVal;
+        pCoeffs[1] = -sinVal;
+        break;
+      default:
+        pCoeffs[0] = sinVal;
+        pCoeffs[1] = -cosVal;
+        break;
+      }
+    }
+
+    pCoeffs += 2u;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_q31.c
+*
+* Description:	Q31 Goertzel filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @brief Product of a 64-bit state and twice a Q31 coefficient.
+ * @param[in] s state, in 33.31 format.
+ * @param[in] c coefficient in 2.30 format.
+ * @return <code>2 * c * s</code> in 33.31 format.
+ */
+
+static __INLINE q63_t arm_goertzel_mult_q31(
+  q63_t s,
+  q31_t c)
+{
+  /* s = hi * 2^32 + lo, with lo unsigned, and 2 * c * s = c * s / 2^29 */
+  return ((((q63_t) c * (q31_t) (s >> 32)) << 3) + (((q63_t) c * (uint32_t) s) >> 29));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 Goertzel filter bank.
+ * @param[in]  *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]  *pSrc points to the input frame of frameLen samples.
+ * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The recursion runs in 64-bit state variables in 33.31 format.  They grow to at most
+ * <code>N^2/2</code> times a full scale input, which is below <code>2^31</code> for any
+ * frame length, so they cannot overflow.  The outputs are the DFT values scaled down by
+ * <code>2^scaleShift</code> with rounding, in 1.31 format.
+ */
+
+void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t *pIn;                                    /* input pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* cosine and sine of the bins */
+  q31_t cosVal, sinVal;                          /* cosine and sine of the bin frequency */
+  q63_t s0, s1, s2;                              /* last values of the recursion */
+  q63_t re, im;                                  /* DFT value */
+  q63_t round;                                   /* rounding constant of the outputs */
+  uint32_t binCnt, blkCnt;                       /* loop counters */
+
+  round = (q63_t) 1 << (S->scaleShift - 1u);
+  binCnt = S->numBins;
+
+  while(binCnt > 0u)
+  {
+    cosVal = *pCoeffs++;
+    sinVal = *pCoeffs++;
+
+    pIn = pSrc;
+    s1 = 0;
+    s2 = 0;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = (uint32_t) S->frameLen >> 2u;
+
+    /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+     ** a second loop below processes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2], with s1 and s2 swapping roles */
+      s2 = ((q63_t) pIn[0] + arm_goertzel_mult_q31(s1, cosVal)) - s2;
+      s1 = ((q63_t) pIn[1] + arm_goertzel_mult_q31(s2, cosVal)) - s1;
+      s2 = ((q63_t) pIn[2] + arm_goertzel_mult_q31(s1, cosVal)) - s2;
+      s1 = ((q63_t) pIn[3] + arm_goertzel_mult_q31(s2, cosVal)) - s1;
+
+      pIn += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the frameLen is not a multiple of 4, process the remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = (uint32_t) S->frameLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = S->frameLen;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+    while(blkCnt > 0u)
+    {
+      /* s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2] */
+      s0 = ((q63_t) * pIn++ + arm_goertzel_mult_q31(s1, cosVal)) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* X[k] = exp(j * w) * s[N - 1] - s[N - 2] */
+    re = (arm_goertzel_mult_q31(s1, cosVal) >> 1) - s2;
+    im = arm_goertzel_mult_q31(s1, sinVal) >> 1;
+
+    /* Scale down by 2^scaleShift with rounding, to 1.31 format */
+    *pDst++ = clip_q63_to_q31((re + round) >> S->scaleShift);
+    *pDst++ = clip_q63_to_q31((im + round) >> S->scaleShift);
+
+    /* Decrement the bin counter */
+    binCnt--;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
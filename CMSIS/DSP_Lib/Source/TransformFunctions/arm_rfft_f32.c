@@ -81,6 +81,11 @@
  * \par Lengths supported by the transform:  
  * \par   
  * Real FFT/IFFT supports the lengths [128, 512, 2048], as it internally uses CFFT/CIFFT.   
+ * \par   
+ * The floating-point arm_rfft_fast_f32() supports every power of two from 32 to 4096.   
+ * It needs no complex FFT instance and stores the spectrum of N real values in N values,   
+ * with the real DC and Nyquist bins packed into the first complex slot:   
+ * <pre>{real(0), real(N/2), real(1), imag(1), ..}</pre>   
  *   
  * \par Instance Structure   
  * A separate instance structure must be defined for each Instance but the twiddle factors can be reused.   
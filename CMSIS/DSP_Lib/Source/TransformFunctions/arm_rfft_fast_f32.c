@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rfft_fast_f32.c
+*
+* Description:	RFFT & RIFFT Floating point process function with packed spectrum
+*
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RFFT_RIFFT
+ * @{
+ */
+
+/*--------------------------------------------------------------------
+ *		Internal functions
+ *--------------------------------------------------------------------*/
+
+/*
+ * @brief  Bit reversal and split step of the packed real FFT.
+ * @param[in]  *pSrc     points to the N/2-point complex FFT result, in bit reversed order.
+ * @param[in]  fftLen    length of the complex FFT (N/2).
+ * @param[in]  *pCoef    points to the twiddle factor table.
+ * @param[in]  modifier  stride of the twiddle factors of the N-point real FFT.
+ * @param[out] *pDst     points to the packed N-point spectrum.
+ * @return none.
+ *
+ * With Z(k) the complex FFT of z(n) = x(2n) + j*x(2n+1):
+ * <pre>
+ * X(k)      = E(k) + W(k) * O(k)
+ * X(N/2-k)  = conj(E(k) - W(k) * O(k))
+ * E(k)      = (Z(k) + conj(Z(N/2-k))) / 2
+ * O(k)      = (Z(k) - conj(Z(N/2-k))) / 2j
+ * </pre>
+ * Z(k) is read from its bit reversed position, so no separate bit reversal
+ * pass is needed.
+ */
+
+static void arm_split_rfft_fast_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  float32_t * pCoef,
+  uint32_t modifier,
+  float32_t * pDst)
+{
+  float32_t ar, ai, br, bi;                      /* Z(k) and Z(N/2-k) */
+  float32_t er, ei, odr, odi;                    /* E(k) and O(k) */
+  float32_t tr, ti;                              /* W(k) * O(k) */
+  float32_t co, si;                              /* twiddle factor */
+  uint32_t k, j, jPrev, bit, ia;
+
+  /* X(0) = Zr(0) + Zi(0), X(N/2) = Zr(0) - Zi(0), both real */
+  pDst[0] = pSrc[0] + pSrc[1];
+  pDst[1] = pSrc[0] - pSrc[1];
+
+  /* j holds the bit reversed value of k */
+  j = 0u;
+  ia = 0u;
+
+  for (k = 1u; k <= (fftLen >> 1u); k++)
+  {
+    /* Bit reversed increment: j = bitrev(k), jPrev = bitrev(k - 1) */
+    jPrev = j;
+    bit = fftLen >> 1u;
+
+    while((j & bit) != 0u)
+    {
+      j ^= bit;
+      bit >>= 1u;
+    }
+    j |= bit;
+
+    ia = ia + modifier;
+
+    /* Z(k) */
+    ar = pSrc[2u * j];
+    ai = pSrc[(2u * j) + 1u];
+
+    /* Z(N/2-k) is at bitrev(N/2-k) = N/2-1-bitrev(k-1) */
+    br = pSrc[2u * ((fftLen - 1u) - jPrev)];
+    bi = pSrc[(2u * ((fftLen - 1u) - jPrev)) + 1u];
+
+    co = pCoef[2u * ia];
+    si = pCoef[(2u * ia) + 1u];
+
+    /* E(k) = (Z(k) + conj(Z(N/2-k))) / 2 */
+    er = 0.5f * (ar + br);
+    ei = 0.5f * (ai - bi);
+
+    /* O(k) = (Z(k) - conj(Z(N/2-k))) / 2j */
+    odr = 0.5f * (ai + bi);
+    odi = 0.5f * (br - ar);
+
+    /* W(k) * O(k), W(k) = co - j*si */
+    tr = (odr * co) + (odi * si);
+    ti = (odi * co) - (odr * si);
+
+    /* X(k) = E(k) + W(k) * O(k) */
+    pDst[2u * k] = er + tr;
+    pDst[(2u * k) + 1u] = ei + ti;
+
+    /* X(N/2-k) = conj(E(k) - W(k) * O(k)) */
+    pDst[2u * (fftLen - k)] = er - tr;
+    pDst[(2u * (fftLen - k)) + 1u] = ti - ei;
+  }
+}
+
+/*
+ * @brief  Merge step of the packed real IFFT.
+ * @param[in]  *pSrc     points to the packed N-point spectrum.
+ * @param[in]  fftLen    length of the complex IFFT (N/2).
+ * @param[in]  *pCoef    points to the twiddle factor table.
+ * @param[in]  modifier  stride of the twiddle factors of the N-point real FFT.
+ * @param[out] *pDst     points to the N/2-point complex IFFT input, in natural order.
+ * @return none.
+ *
+ * <pre>
+ * Z(k)      = E(k) + j * O(k)
+ * E(k)      = (X(k) + conj(X(N/2-k))) / 2
+ * O(k)      = (X(k) - conj(X(N/2-k))) * conj(W(k)) / 2
+ * Z(N/2-k)  = conj(E(k)) + j * conj(O(k))
+ * </pre>
+ */
+
+static void arm_split_rifft_fast_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  float32_t * pCoef,
+  uint32_t modifier,
+  float32_t * pDst)
+{
+  float32_t ar, ai, br, bi;                      /* X(k) and X(N/2-k) */
+  float32_t er, ei, dr, di, odr, odi;            /* E(k), difference term and O(k) */
+  float32_t co, si;                              /* twiddle factor */
+  uint32_t k, ia;
+
+  /* Z(0) from the real DC and Nyquist values */
+  pDst[0] = 0.5f * (pSrc[0] + pSrc[1]);
+  pDst[1] = 0.5f * (pSrc[0] - pSrc[1]);
+
+  ia = 0u;
+
+  for (k = 1u; k <= (fftLen >> 1u); k++)
+  {
+    ia = ia + modifier;
+
+    ar = pSrc[2u * k];
+    ai = pSrc[(2u * k) + 1u];
+    br = pSrc[2u * (fftLen - k)];
+    bi = pSrc[(2u * (fftLen - k)) + 1u];
+
+    co = pCoef[2u * ia];
+    si = pCoef[(2u * ia) + 1u];
+
+    /* E(k) = (X(k) + conj(X(N/2-k))) / 2 */
+    er = 0.5f * (ar + br);
+    ei = 0.5f * (ai - bi);
+
+    /* (X(k) - conj(X(N/2-k))) / 2 */
+    dr = 0.5f * (ar - br);
+    di = 0.5f * (ai + bi);
+
+    /* O(k) = difference * (co + j*si) */
+    odr = (dr * co) - (di * si);
+    odi = (dr * si) + (di * co);
+
+    /* Z(k) = E(k) + j * O(k) */
+    pDst[2u * k] = er - odi;
+    pDst[(2u * k) + 1u] = ei + odr;
+
+    /* Z(N/2-k) = conj(E(k)) + j * conj(O(k)) */
+    pDst[2u * (fftLen - k)] = er + odi;
+    pDst[(2u * (fftLen - k)) + 1u] = odr - ei;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point RFFT/RIFFT with packed spectrum.
+ * @param[in]  *S    points to an instance of the floating-point packed RFFT/RIFFT structure.
+ * @param[in]  *pSrc points to the input buffer.
+ * @param[out] *pDst points to the output buffer.
+ * @return none.
+ *
+ * \par
+ * The spectrum of a real sequence of length N is stored in N values:
+ * <pre>{real(0), real(N/2), real(1), imag(1), ..., real(N/2-1), imag(N/2-1)}</pre>
+ * The DC and Nyquist bins, whose imaginary parts are zero, share the first
+ * complex slot.  The remaining bins follow from X(N-k) = conj(X(k)).
+ * \par
+ * The forward transform reads <code>fftLenReal</code> real samples from
+ * <code>pSrc</code> and writes the packed spectrum to <code>pDst</code>.
+ * <code>pSrc</code> is used as working memory and is modified.
+ * The inverse transform reads a packed spectrum from <code>pSrc</code>, which
+ * is left unchanged, and writes <code>fftLenReal</code> real samples, scaled
+ * by 1/fftLenReal, to <code>pDst</code>.
+ * \par
+ * The N/2-point complex transform uses the mixed-radix butterflies of
+ * arm_cfft_radix8_f32().  In the forward direction the bit reversal is done
+ * while the spectrum is split, so the result is produced with one pass over
+ * the data after the butterfly stages.
+ */
+
+void arm_rfft_fast_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  if(S->ifftFlagR == 1u)
+  {
+    /*  Merge the spectrum into an N/2-point complex sequence */
+    arm_split_rifft_fast_f32(pSrc, S->fftLenBy2, S->pTwiddle,
+                             S->twidCoefRModifier, pDst);
+
+    /*  Complex IFFT, scaled by 1/(N/2) */
+    arm_radix8_butterfly_inverse_f32(pDst, S->fftLenBy2, S->pTwiddle,
+                                     S->twidCoefModifier, S->onebyfftLenBy2);
+
+    /*  Bit Reversal */
+    arm_bitreversal_f32(pDst, S->fftLenBy2, S->bitRevFactor,
+                        S->pBitRevTable);
+  }
+  else
+  {
+    /*  Complex FFT of the even/odd samples, output in bit reversed order */
+    arm_radix8_butterfly_f32(pSrc, S->fftLenBy2, S->pTwiddle,
+                             S->twidCoefModifier);
+
+    /*  Bit reversal and split into the packed real spectrum */
+    arm_split_rfft_fast_f32(pSrc, S->fftLenBy2, S->pTwiddle,
+                            S->twidCoefRModifier, pDst);
+  }
+}
+
+/**
+ * @} end of RFFT_RIFFT group
+ */
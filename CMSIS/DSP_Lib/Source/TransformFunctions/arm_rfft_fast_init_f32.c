@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rfft_fast_init_f32.c
+*
+* Description:	RFFT & RIFFT Floating point initialization function with packed spectrum
+*
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RFFT_RIFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point RFFT/RIFFT with packed spectrum.
+* @param[in,out] *S             points to an instance of the floating-point packed RFFT/RIFFT structure.
+* @param[in]     fftLenReal     length of the real FFT.
+* @param[in]     ifftFlagR      flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform.
+* @return		The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLenReal</code>	Specifies length of RFFT/RIFFT Process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The parameter <code>ifftFlagR</code> controls whether a forward or inverse transform is computed.
+* Set(=1) ifftFlagR to calculate RIFFT, otherwise RFFT is calculated.
+* \par
+* No complex FFT instance is needed: the function uses the twiddle factor and
+* bit reversal tables of the complex FFTs directly.
+*/
+
+arm_status arm_rfft_fast_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint32_t fftLenReal,
+  uint32_t ifftFlagR)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialize the Real FFT length */
+  S->fftLenReal = (uint16_t) fftLenReal;
+
+  /*  Initialize the Complex FFT length */
+  S->fftLenBy2 = (uint16_t) fftLenReal / 2u;
+
+  /*  Initialize the Flag for selection of RFFT or RIFFT */
+  S->ifftFlagR = (uint8_t) ifftFlagR;
+
+#if defined (ARM_DSP_CONFIG_TABLES)
+
+  /*  The tables are built for one FFT length each and are read with stride 1 */
+  switch (fftLenReal)
+  {
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_4096) && defined (ARM_TABLE_BITREV_2048)
+  case 4096u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_4096;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_2048;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_2048) && defined (ARM_TABLE_BITREV_1024)
+  case 2048u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_2048;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_1024;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_1024) && defined (ARM_TABLE_BITREV_512)
+  case 1024u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_1024;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_512;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_512) && defined (ARM_TABLE_BITREV_256)
+  case 512u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_512;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_256;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_256) && defined (ARM_TABLE_BITREV_128)
+  case 256u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_256;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_128;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_128) && defined (ARM_TABLE_BITREV_64)
+  case 128u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_128;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_64;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_64) && defined (ARM_TABLE_BITREV_32)
+  case 64u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_64;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_32;
+    break;
+#endif
+#if defined (ARM_TABLE_TWIDDLECOEF_F32_32) && defined (ARM_TABLE_BITREV_16)
+  case 32u:
+    S->pTwiddle = (float32_t *) twiddleCoef_f32_32;
+    S->pBitRevTable = (uint16_t *) armBitRevTable_16;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if rfftSize is not valid value or its tables are not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  /*  The N/2 point complex stages use every second twiddle factor */
+  S->twidCoefRModifier = 1u;
+  S->twidCoefModifier = 2u;
+  S->bitRevFactor = 1u;
+  S->onebyfftLenBy2 = 1.0f / (float32_t) S->fftLenBy2;
+
+#else
+
+  /*  Initialise the Twiddle coefficient pointer */
+  S->pTwiddle = (float32_t *) twiddleCoef;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (fftLenReal)
+  {
+  case 4096u:
+  case 2048u:
+  case 1024u:
+  case 512u:
+  case 256u:
+  case 128u:
+  case 64u:
+  case 32u:
+    /*  The tables are built for 4096 points and are read with a stride */
+    S->twidCoefRModifier = (uint16_t) (4096u / fftLenReal);
+    S->twidCoefModifier = 2u * S->twidCoefRModifier;
+    S->bitRevFactor = S->twidCoefModifier;
+    S->pBitRevTable = &armBitRevTable[S->bitRevFactor - 1u];
+    S->onebyfftLenBy2 = 1.0f / (float32_t) S->fftLenBy2;
+    break;
+
+  default:
+    /*  Reporting argument error if rfftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+#endif /* defined (ARM_DSP_CONFIG_TABLES) */
+
+  /* return the status of RFFT Init function */
+  return (status);
+}
+
+/**
+ * @} end of RFFT_RIFFT group
+ */
@@ -32,6 +32,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**   
  * @ingroup groupTransforms   
@@ -56,6 +57,8 @@
 
 
 
+#if !defined (ARM_DSP_CONFIG_TABLES)
+
 static const float32_t realCoefA[2048] = {
   0.500000000000000000f, -0.500000000000000000f, 0.498466014862060550f,
   -0.499997645616531370f, 0.496932059526443480f, -0.499990582466125490f,
@@ -1611,6 +1614,8 @@ static const float32_t realCoefB[2048] = {
   0.501533985137939450f, -0.499997645616531370f
 };
 
+#endif /* !defined (ARM_DSP_CONFIG_TABLES) */
+
 
 
 /**   
@@ -1652,18 +1657,51 @@ arm_status arm_rfft_init_f32(
   /*  Initialize the Complex FFT length */
   S->fftLenBy2 = (uint16_t) fftLenReal / 2u;
 
-  /*  Initialize the Twiddle coefficientA pointer */
-  S->pTwiddleAReal = (float32_t *) realCoefA;
-
-  /*  Initialize the Twiddle coefficientB pointer */
-  S->pTwiddleBReal = (float32_t *) realCoefB;
-
   /*  Initialize the Flag for selection of RFFT or RIFFT */
   S->ifftFlagR = (uint8_t) ifftFlagR;
 
   /*  Initialize the Flag for calculation Bit reversal or not */
   S->bitReverseFlagR = (uint8_t) bitReverseFlag;
 
+#if defined (ARM_DSP_CONFIG_TABLES)
+
+  /*  The tables are built for one FFT length each and are read with stride 1 */
+  switch (S->fftLenReal)
+  {
+#if defined (ARM_TABLE_REALCOEF_F32_2048)
+  case 2048u:
+    S->pTwiddleAReal = (float32_t *) realCoefA_f32_2048;
+    S->pTwiddleBReal = (float32_t *) realCoefB_f32_2048;
+    break;
+#endif
+#if defined (ARM_TABLE_REALCOEF_F32_512)
+  case 512u:
+    S->pTwiddleAReal = (float32_t *) realCoefA_f32_512;
+    S->pTwiddleBReal = (float32_t *) realCoefB_f32_512;
+    break;
+#endif
+#if defined (ARM_TABLE_REALCOEF_F32_128)
+  case 128u:
+    S->pTwiddleAReal = (float32_t *) realCoefA_f32_128;
+    S->pTwiddleBReal = (float32_t *) realCoefB_f32_128;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if rfftSize is not valid value or its tables are not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  S->twidCoefRModifier = 1u;
+
+#else
+
+  /*  Initialize the Twiddle coefficientA pointer */
+  S->pTwiddleAReal = (float32_t *) realCoefA;
+
+  /*  Initialize the Twiddle coefficientB pointer */
+  S->pTwiddleBReal = (float32_t *) realCoefB;
+
   /*  Initializations of structure parameters depending on the FFT length */
   switch (S->fftLenReal)
   {
@@ -1683,18 +1721,23 @@ arm_status arm_rfft_init_f32(
     break;
   }
 
+#endif /* defined (ARM_DSP_CONFIG_TABLES) */
+
   /* Init Complex FFT Instance */
   S->pCfft = S_CFFT;
 
-  if(S->ifftFlagR)
-  {
-    /* Initializes the CIFFT Module for fftLenreal/2 length */
-    arm_cfft_radix4_init_f32(S->pCfft, S->fftLenBy2, 1u, 0u);
-  }
-  else
+  /* Initializes the CFFT/CIFFT Module for fftLenreal/2 length, which can fail
+   * when its tables are not built */
+  if(status == ARM_MATH_SUCCESS)
   {
-    /* Initializes the CFFT Module for fftLenreal/2 length */
-    arm_cfft_radix4_init_f32(S->pCfft, S->fftLenBy2, 0u, 0u);
+    if(S->ifftFlagR)
+    {
+      status = arm_cfft_radix4_init_f32(S->pCfft, S->fftLenBy2, 1u, 0u);
+    }
+    else
+    {
+      status = arm_cfft_radix4_init_f32(S->pCfft, S->fftLenBy2, 0u, 0u);
+    }
   }
 
   /* return the status of RFFT Init function */
@@ -667,15 +667,18 @@ arm_status arm_rfft_init_q15(
   /* Init Complex FFT Instance */
   S->pCfft = S_CFFT;
 
-  if(S->ifftFlagR)
+  /* Initializes the CFFT/CIFFT Module for fftLenreal/2 length, which can fail
+   * when its tables are not built */
+  if(status == ARM_MATH_SUCCESS)
   {
-    /* Initializes the CIFFT Module for fftLenreal/2 length */
-    arm_cfft_radix4_init_q15(S->pCfft, S->fftLenBy2, 1u, 1u);
-  }
-  else
-  {
-    /* Initializes the CFFT Module for fftLenreal/2 length */
-    arm_cfft_radix4_init_q15(S->pCfft, S->fftLenBy2, 0u, 1u);
+    if(S->ifftFlagR)
+    {
+      status = arm_cfft_radix4_init_q15(S->pCfft, S->fftLenBy2, 1u, 1u);
+    }
+    else
+    {
+      status = arm_cfft_radix4_init_q15(S->pCfft, S->fftLenBy2, 0u, 1u);
+    }
   }
 
   /* return the status of RFFT Init function */
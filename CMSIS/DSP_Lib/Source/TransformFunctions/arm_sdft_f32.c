@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_f32.c
+*
+* Description:	Floating-point sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SDFT Sliding DFT
+ *
+ * Tracks a few bins of the DFT of the last <code>N = frameLen</code> input samples,
+ * updated on every sample:
+ * <pre>
+ *     X[k] = sum(x[n - N + 1 + m] * exp(-j * 2 * pi * k * m / N), m = 0 ... N - 1)
+ * </pre>
+ * When the window slides by one sample, the oldest sample leaves it and a new one enters
+ * it, so each bin is updated by the recursion
+ * <pre>
+ *     X[k] = exp(j * w) * (X[k] + x[n] - x[n - N]),    w = 2 * pi * k / N
+ * </pre>
+ * which costs one complex multiplication per sample and per bin, whatever the frame length.
+ * The functions process blocks of samples, and write the value of the bins after the last
+ * sample of the block, in the format of the \ref Goertzel "Goertzel filter bank".
+ *
+ * The pole of the recursion is on the unit circle, so its rounding errors would
+ * accumulate forever.  Each time the delay line has been filled with a whole frame, which
+ * it then holds in chronological order, the bins are instead recomputed exactly from it
+ * with arm_goertzel_f32() or arm_goertzel_q31().  This bounds the errors to those of one
+ * frame, and costs one real multiplication per sample and per bin on average.
+ *
+ * \par Instance Structure
+ * The bins, their coefficients, the delay line and the position of the oldest sample are
+ * stored in an instance data structure, which must be initialized with
+ * arm_sdft_init_f32() or arm_sdft_init_q31().  A separate instance structure must be
+ * defined for each input signal.
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pBins = S->pState;                  /* current value of the bins */
+  float32_t *pDelay;                             /* delay line of the last frame */
+  float32_t *pIn, *pOld, *pCoeffs, *pX;          /* input, delay, coefficient, bin pointers */
+  float32_t cosVal, sinVal, re, im, temp;        /* rotation of one sample and bin value */
+  uint32_t frameLen = S->goertzel.frameLen;      /* frame length */
+  uint32_t numSamples, binCnt, blkCnt;           /* loop counters */
+
+  pDelay = pBins + (2u * S->goertzel.numBins);
+
+  while(blockSize > 0u)
+  {
+    /* Number of samples up to the end of the delay line */
+    numSamples = frameLen - S->index;
+    numSamples = (blockSize < numSamples) ? blockSize : numSamples;
+
+    /* The bins are recomputed below when the delay line is full */
+    if((S->index + numSamples) < frameLen)
+    {
+      pCoeffs = S->goertzel.pCoeffs;
+      pX = pBins;
+      binCnt = S->goertzel.numBins;
+
+      while(binCnt > 0u)
+      {
+        cosVal = *pCoeffs++;
+        sinVal = *pCoeffs++;
+        re = pX[0];
+        im = pX[1];
+
+        pIn = pSrc;
+        pOld = pDelay + S->index;
+
+#ifndef ARM_MATH_CM0
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /*loop Unrolling */
+        blkCnt = numSamples >> 2u;
+
+        /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+         ** a second loop below processes the remaining 1 to 3 samples. */
+        while(blkCnt > 0u)
+        {
+          /* X[k] = exp(j * w) * (X[k] + x[n] - x[n - N]) */
+          re += pIn[0] - pOld[0];
+          temp = (re * cosVal) - (im * sinVal);
+          im = (re * sinVal) + (im * cosVal);
+          re = temp;
+
+          re += pIn[1] - pOld[1];
+          temp = (re * cosVal) - (im * sinVal);
+          im = (re * sinVal) + (im * cosVal);
+          re = temp;
+
+          re += pIn[2] - pOld[2];
+          temp = (re * cosVal) - (im * sinVal);
+          im = (re * sinVal) + (im * cosVal);
+          re = temp;
+
+          re += pIn[3] - pOld[3];
+          temp = (re * cosVal) - (im * sinVal);
+          im = (re * sinVal) + (im * cosVal);
+          re = temp;
+
+          pIn += 4u;
+          pOld += 4u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        /* If the numSamples is not a multiple of 4, process the remaining samples here.
+         ** No loop unrolling is used. */
+        blkCnt = numSamples % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        /* Initialize blkCnt with number of samples */
+        blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+        while(blkCnt > 0u)
+        {
+          /* X[k] = exp(j * w) * (X[k] + x[n] - x[n - N]) */
+          re += *pIn++ - *pOld++;
+          temp = (re * cosVal) - (im * sinVal);
+          im = (re * sinVal) + (im * cosVal);
+          re = temp;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        *pX++ = re;
+        *pX++ = im;
+
+        /* Decrement the bin counter */
+        binCnt--;
+      }
+    }
+
+    /* Replace the oldest samples of the delay line with the new ones */
+    arm_copy_f32(pSrc, pDelay + S->index, numSamples);
+
+    S->index += (uint16_t) numSamples;
+    pSrc += numSamples;
+    blockSize -= numSamples;
+
+    if(S->index == frameLen)
+    {
+      /* The delay line holds the last frame in chronological order: recompute the bins */
+      S->index = 0u;
+      arm_goertzel_f32(&S->goertzel, pDelay, pBins);
+    }
+  }
+
+  /* Value of the bins after the last sample */
+  arm_copy_f32(pBins, pDst, 2u * S->goertzel.numBins);
+}
+
+/**
+ * @} end of SDFT group
+ */
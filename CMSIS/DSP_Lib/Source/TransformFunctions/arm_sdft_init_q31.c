@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_init_q31.c
+*
+* Description:	Q31 sliding DFT initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]  numBins number of bins.
+ * @param[in]  frameLen frame length, the number of points of the DFT.
+ * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+ * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+ * @param[in]  *pState points to the state buffer of 2*numBins + frameLen values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+ *
+ * \par Description:
+ * \par
+ * The bins and their coefficients are initialized by arm_goertzel_init_q31().
+ * The state buffer holds the current value of the bins followed by the delay line of
+ * the last <code>frameLen</code> input samples, and is cleared, as if the sliding DFT had
+ * been fed with zeros.
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  uint16_t * pBinIndex,
+  q31_t * pCoeffs,
+  q31_t * pState)
+{
+  arm_status status;                             /* status of the initialization */
+
+  /* Initialise the Goertzel filter bank that recomputes the bins once per frame */
+  status = arm_goertzel_init_q31(&S->goertzel, numBins, frameLen, pBinIndex, pCoeffs);
+
+  /* The oldest sample is at the start of the delay line */
+  S->index = 0u;
+
+  /* Clear state buffer and the size of state buffer is (2 * numBins + frameLen) */
+  memset(pState, 0, ((2u * numBins) + frameLen) * sizeof(q31_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (status);
+}
+
+/**
+ * @} end of SDFT group
+ */
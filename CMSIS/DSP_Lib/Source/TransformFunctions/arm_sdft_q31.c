@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. July 2011
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_q31.c
+*
+* Description:	Q31 sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The bins are the DFT values scaled down by <code>2^scaleShift</code>, in 1.31 format,
+ * as for arm_goertzel_q31().  The difference of the new and the oldest samples is scaled
+ * down with rounding before each update, and the rotation is rounded, so the error of the
+ * recursion grows by at most 2 LSB per sample, much less on average, and is cleared when
+ * the bins are recomputed once per frame.  The additions saturate.
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pBins = S->pState;                      /* current value of the bins */
+  q31_t *pDelay;                                 /* delay line of the last frame */
+  q31_t *pIn, *pOld, *pCoeffs, *pX;              /* input, delay, coefficient, bin pointers */
+  q31_t cosVal, sinVal, re, im, temp;            /* rotation of one sample and bin value */
+  uint32_t shift = S->goertzel.scaleShift;       /* scaling of the bins */
+  q63_t round;                                   /* rounding constant of the new samples */
+  uint32_t frameLen = S->goertzel.frameLen;      /* frame length */
+  uint32_t numSamples, binCnt, blkCnt;           /* loop counters */
+
+  pDelay = pBins + (2u * S->goertzel.numBins);
+  round = (q63_t) 1 << (shift - 1u);
+
+  while(blockSize > 0u)
+  {
+    /* Number of samples up to the end of the delay line */
+    numSamples = frameLen - S->index;
+    numSamples = (blockSize < numSamples) ? blockSize : numSamples;
+
+    /* The bins are recomputed below when the delay line is full */
+    if((S->index + numSamples) < frameLen)
+    {
+      pCoeffs = S->goertzel.pCoeffs;
+      pX = pBins;
+      binCnt = S->goertzel.numBins;
+
+      while(binCnt > 0u)
+      {
+        /* 2.30 to 1.31 format, saturated so that the rotation stays within the unit circle */
+        cosVal = clip_q63_to_q31((q63_t) * pCoeffs++ << 1);
+        sinVal = clip_q63_to_q31((q63_t) * pCoeffs++ << 1);
+        cosVal = (cosVal < -0x7FFFFFFF) ? -0x7FFFFFFF : cosVal;
+        sinVal = (sinVal < -0x7FFFFFFF) ? -0x7FFFFFFF : sinVal;
+        re = pX[0];
+        im = pX[1];
+
+        pIn = pSrc;
+        pOld = pDelay + S->index;
+
+#ifndef ARM_MATH_CM0
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /*loop Unrolling */
+        blkCnt = numSamples >> 2u;
+
+        /* First part of the processing with loop unrolling.  Process 4 samples at a time.
+         ** a second loop below processes the remaining 1 to 3 samples. */
+        while(blkCnt > 0u)
+        {
+          /* X[k] = exp(j * w) * (X[k] + (x[n] - x[n - N]) / 2^scaleShift) */
+          re = __QADD(re, (q31_t) ((((q63_t) pIn[0] - pOld[0]) + round) >> shift));
+          temp = (q31_t) (((((q63_t) re * cosVal) - ((q63_t) im * sinVal)) + 0x40000000) >> 31);
+          im = (q31_t) (((((q63_t) re * sinVal) + ((q63_t) im * cosVal)) + 0x40000000) >> 31);
+          re = temp;
+
+          re = __QADD(re, (q31_t) ((((q63_t) pIn[1] - pOld[1]) + round) >> shift));
+          temp = (q31_t) (((((q63_t) re * cosVal) - ((q63_t) im * sinVal)) + 0x40000000) >> 31);
+          im = (q31_t) (((((q63_t) re * sinVal) + ((q63_t) im * cosVal)) + 0x40000000) >> 31);
+          re = temp;
+
+          re = __QADD(re, (q31_t) ((((q63_t) pIn[2] - pOld[2]) + round) >> shift));
+          temp = (q31_t) (((((q63_t) re * cosVal) - ((q63_t) im * sinVal)) + 0x40000000) >> 31);
+          im = (q31_t) (((((q63_t) re * sinVal) + ((q63_t) im * cosVal)) + 0x40000000) >> 31);
+          re = temp;
+
+          re = __QADD(re, (q31_t) ((((q63_t) pIn[3] - pOld[3]) + round) >> shift));
+          temp = (q31_t) (((((q63_t) re * cosVal) - ((q63_t) im * sinVal)) + 0x40000000) >> 31);
+          im = (q31_t) (((((q63_t) re * sinVal) + ((q63_t) im * cosVal)) + 0x40000000) >> 31);
+          re = temp;
+
+          pIn += 4u;
+          pOld += 4u;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        /* If the numSamples is not a multiple of 4, process the remaining samples here.
+         ** No loop unrolling is used. */
+        blkCnt = numSamples % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        /* Initialize blkCnt with number of samples */
+        blkCnt = numSamples;
+
+#endif /*   #ifndef ARM_MATH_CM0   */
+
+        while(blkCnt > 0u)
+        {
+          /* X[k] = exp(j * w) * (X[k] + (x[n] - x[n - N]) / 2^scaleShift) */
+          re = __QADD(re, (q31_t) ((((q63_t) * pIn++ - *pOld++) + round) >> shift));
+          temp = (q31_t) (((((q63_t) re * cosVal) - ((q63_t) im * sinVal)) + 0x40000000) >> 31);
+          im = (q31_t) (((((q63_t) re * sinVal) + ((q63_t) im * cosVal)) + 0x40000000) >> 31);
+          re = temp;
+
+          /* Decrement the loop counter */
+          blkCnt--;
+        }
+
+        *pX++ = re;
+        *pX++ = im;
+
+        /* Decrement the bin counter */
+        binCnt--;
+      }
+    }
+
+    /* Replace the oldest samples of the delay line with the new ones */
+    arm_copy_q31(pSrc, pDelay + S->index, numSamples);
+
+    S->index += (uint16_t) numSamples;
+    pSrc += numSamples;
+    blockSize -= numSamples;
+
+    if(S->index == frameLen)
+    {
+      /* The delay line holds the last frame in chronological order: recompute the bins */
+      S->index = 0u;
+      arm_goertzel_q31(&S->goertzel, pDelay, pBins);
+    }
+  }
+
+  /* Value of the bins after the last sample */
+  arm_copy_q31(pBins, pDst, 2u * S->goertzel.numBins);
+}
+
+/**
+ * @} end of SDFT group
+ */
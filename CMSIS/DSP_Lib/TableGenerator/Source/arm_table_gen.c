@@ -0,0 +1,483 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V1.0.10
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_table_gen.c
+*
+* Description:	Host tool that writes the floating-point FFT and DCT tables
+*               of the transform lengths an application uses.
+*
+*               Options:
+*                 -o <dir>     output directory (default: current directory)
+*                 -c <sizes>   arm_cfft_radix4_f32 / arm_cfft_radix8_f32 lengths
+*                 -r <sizes>   arm_rfft_f32 lengths
+*                 -p <sizes>   arm_rfft_fast_f32 lengths
+*                 -d <sizes>   arm_dct4_f32 lengths
+*
+*               Sizes are separated by ',' or ';'.  The tool writes
+*               arm_dsp_tables.h and arm_dsp_tables.c.  Build the library
+*               with ARM_DSP_CONFIG_TABLES defined, the output directory on
+*               the include path and arm_dsp_tables.c in the sources.  The
+*               init functions then accept the selected lengths only.
+*
+*               Every table is built for exactly one length, so the first
+*               CFFT butterfly stage reads the twiddle factors with stride 1.
+*
+* Target Processor: host
+* -------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ARM_TABLE_MIN_LEN     16u
+#define ARM_TABLE_MAX_LEN     4096u
+
+#define PI                    3.14159265358979323846
+
+/* Tables are selected per length: bit k of a mask stands for length 2^k */
+typedef struct
+{
+  unsigned long bitRev;                 /* armBitRevTable_N */
+  unsigned long twiddle;                /* twiddleCoef_f32_N */
+  unsigned long realCoef;               /* realCoefA_f32_N, realCoefB_f32_N */
+  unsigned long dct4;                   /* Weights_f32_N, cos_factors_f32_N */
+} arm_table_selection;
+
+static unsigned int arm_table_log2(
+  unsigned long n)
+{
+  unsigned int l = 0u;
+
+  while((1ul << l) < n)
+  {
+    l++;
+  }
+
+  return (l);
+}
+
+/* ----------------------------------------------------------------------
+* Option parsing
+* ------------------------------------------------------------------- */
+
+typedef int (*arm_table_size_fn) (
+  arm_table_selection * sel,
+  unsigned long n);
+
+/* CFFT of length N: twiddle factors and bit reversal table of length N */
+static int arm_table_add_cfft(
+  arm_table_selection * sel,
+  unsigned long n)
+{
+  if((n < ARM_TABLE_MIN_LEN) || (n > ARM_TABLE_MAX_LEN) || ((n & (n - 1u)) != 0u))
+  {
+    return (-1);
+  }
+
+  sel->twiddle |= n;
+  sel->bitRev |= n;
+
+  return (0);
+}
+
+/* arm_rfft_f32 of length N: real coefficients and a radix-4 CFFT of N/2 */
+static int arm_table_add_rfft(
+  arm_table_selection * sel,
+  unsigned long n)
+{
+  if((n != 128u) && (n != 512u) && (n != 2048u))
+  {
+    return (-1);
+  }
+
+  sel->realCoef |= n;
+
+  return (arm_table_add_cfft(sel, n / 2u));
+}
+
+/* arm_rfft_fast_f32 of length N: twiddle factors of length N, read with
+   stride 2 by the N/2 point complex stages and stride 1 by the split step */
+static int arm_table_add_rfft_fast(
+  arm_table_selection * sel,
+  unsigned long n)
+{
+  if((n < (2u * ARM_TABLE_MIN_LEN)) || (n > ARM_TABLE_MAX_LEN)
+     || ((n & (n - 1u)) != 0u))
+  {
+    return (-1);
+  }
+
+  sel->twiddle |= n;
+  sel->bitRev |= n / 2u;
+
+  return (0);
+}
+
+/* arm_dct4_f32 of length N: weights, cos factors and arm_rfft_f32 of N */
+static int arm_table_add_dct4(
+  arm_table_selection * sel,
+  unsigned long n)
+{
+  if(arm_table_add_rfft(sel, n) != 0)
+  {
+    return (-1);
+  }
+
+  sel->dct4 |= n;
+
+  return (0);
+}
+
+static int arm_table_parse_sizes(
+  arm_table_selection * sel,
+  const char *list,
+  arm_table_size_fn add)
+{
+  const char *p = list;
+  char *end;
+  unsigned long n;
+
+  while(*p != '\0')
+  {
+    if((*p == ',') || (*p == ';') || (*p == ' '))
+    {
+      p++;
+      continue;
+    }
+
+    n = strtoul(p, &end, 10);
+
+    if((end == p) || (add(sel, n) != 0))
+    {
+      fprintf(stderr, "unsupported length in '%s'\n", list);
+      return (-1);
+    }
+
+    p = end;
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+* Table writers
+* ------------------------------------------------------------------- */
+
+static void arm_table_write_f32(
+  FILE * fp,
+  const char *name,
+  unsigned long n,
+  const double *pData,
+  unsigned long len)
+{
+  unsigned long i;
+
+  fprintf(fp, "const float32_t %s_%lu[%lu] = {", name, n, len);
+
+  for (i = 0u; i < len; i++)
+  {
+    fprintf(fp, "%s%.18ff%s", ((i % 2u) == 0u) ? "\n  " : " ",
+            pData[i], (i + 1u < len) ? "," : "");
+  }
+
+  fprintf(fp, "\n};\n\n");
+}
+
+/* Same layout as armBitRevTable in arm_common_tables.c, built for N */
+static void arm_table_write_bitrev(
+  FILE * fp,
+  unsigned long n)
+{
+  unsigned int logN2 = arm_table_log2(n);
+  unsigned long l, y;
+  unsigned int j;
+
+  fprintf(fp, "const uint16_t armBitRevTable_%lu[%lu] = {", n, n / 4u);
+
+  for (l = 1u; l <= n / 4u; l++)
+  {
+    y = 0u;
+
+    for (j = 0u; j < logN2; j++)
+    {
+      if((l & (1ul << j)) != 0u)
+      {
+        y += 1ul << ((logN2 - 1u) - j);
+      }
+    }
+
+    fprintf(fp, "%s0x%lx%s", (((l - 1u) % 8u) == 0u) ? "\n  " : " ",
+            y >> 1u, (l < n / 4u) ? "," : "");
+  }
+
+  fprintf(fp, "\n};\n\n");
+}
+
+static void arm_table_write_twiddle(
+  FILE * fp,
+  double *pBuf,
+  unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pBuf[2u * i] = cos((double) i * 2.0 * PI / (double) n);
+    pBuf[(2u * i) + 1u] = sin((double) i * 2.0 * PI / (double) n);
+  }
+
+  arm_table_write_f32(fp, "twiddleCoef_f32", n, pBuf, 2u * n);
+}
+
+static void arm_table_write_real_coef(
+  FILE * fp,
+  double *pBuf,
+  unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0u; i < n / 2u; i++)
+  {
+    pBuf[2u * i] = 0.5 * (1.0 - sin(2.0 * PI / (double) n * (double) i));
+    pBuf[(2u * i) + 1u] = 0.5 * (-1.0 * cos(2.0 * PI / (double) n * (double) i));
+  }
+
+  arm_table_write_f32(fp, "realCoefA_f32", n, pBuf, n);
+
+  for (i = 0u; i < n / 2u; i++)
+  {
+    pBuf[2u * i] = 0.5 * (1.0 + sin(2.0 * PI / (double) n * (double) i));
+    pBuf[(2u * i) + 1u] = 0.5 * (1.0 * cos(2.0 * PI / (double) n * (double) i));
+  }
+
+  arm_table_write_f32(fp, "realCoefB_f32", n, pBuf, n);
+}
+
+static void arm_table_write_dct4(
+  FILE * fp,
+  double *pBuf,
+  unsigned long n)
+{
+  double c = PI / (2.0 * (double) n);
+  unsigned long i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pBuf[2u * i] = cos((double) i * c);
+    pBuf[(2u * i) + 1u] = -sin((double) i * c);
+  }
+
+  arm_table_write_f32(fp, "Weights_f32", n, pBuf, 2u * n);
+
+  /* The library tables hold cos((2n+1)*pi/(4*N)), without the factor 2
+     of the formula quoted in arm_dct4_init_f32.c */
+  for (i = 0u; i < n; i++)
+  {
+    pBuf[i] = cos((2.0 * (double) i + 1.0) * c / 2.0);
+  }
+
+  arm_table_write_f32(fp, "cos_factors_f32", n, pBuf, n);
+}
+
+static void arm_table_write_banner(
+  FILE * fp,
+  const char *title,
+  const char *description)
+{
+  fprintf(fp,
+          "/* ----------------------------------------------------------------------\n"
+          "* Project: 	    CMSIS DSP Library\n"
+          "* Title:	    %s\n"
+          "*\n"
+          "* Description:	%s\n"
+          "*               Generated by arm_table_gen, do not edit.\n"
+          "* -------------------------------------------------------------------- */\n\n",
+          title, description);
+}
+
+static int arm_table_write_header(
+  const char *path,
+  const arm_table_selection * sel)
+{
+  FILE *fp = fopen(path, "w");
+  unsigned long n;
+
+  if(fp == NULL)
+  {
+    return (-1);
+  }
+
+  arm_table_write_banner(fp, "arm_dsp_tables.h",
+                         "Declarations of the FFT and DCT tables selected at build time.");
+
+  fprintf(fp, "#ifndef _ARM_DSP_TABLES_H\n#define _ARM_DSP_TABLES_H\n\n");
+  fprintf(fp, "#include \"arm_math.h\"\n\n");
+
+  for (n = ARM_TABLE_MIN_LEN / 2u; n <= ARM_TABLE_MAX_LEN; n <<= 1u)
+  {
+    if((sel->bitRev & n) != 0u)
+    {
+      fprintf(fp, "#define ARM_TABLE_BITREV_%lu\n", n);
+      fprintf(fp, "extern const uint16_t armBitRevTable_%lu[%lu];\n", n, n / 4u);
+    }
+
+    if((sel->twiddle & n) != 0u)
+    {
+      fprintf(fp, "#define ARM_TABLE_TWIDDLECOEF_F32_%lu\n", n);
+      fprintf(fp, "extern const float32_t twiddleCoef_f32_%lu[%lu];\n", n, 2u * n);
+    }
+
+    if((sel->realCoef & n) != 0u)
+    {
+      fprintf(fp, "#define ARM_TABLE_REALCOEF_F32_%lu\n", n);
+      fprintf(fp, "extern const float32_t realCoefA_f32_%lu[%lu];\n", n, n);
+      fprintf(fp, "extern const float32_t realCoefB_f32_%lu[%lu];\n", n, n);
+    }
+
+    if((sel->dct4 & n) != 0u)
+    {
+      fprintf(fp, "#define ARM_TABLE_DCT4_F32_%lu\n", n);
+      fprintf(fp, "extern const float32_t Weights_f32_%lu[%lu];\n", n, 2u * n);
+      fprintf(fp, "extern const float32_t cos_factors_f32_%lu[%lu];\n", n, n);
+    }
+  }
+
+  fprintf(fp, "\n#endif /* _ARM_DSP_TABLES_H */\n");
+
+  return (fclose(fp));
+}
+
+static int arm_table_write_source(
+  const char *path,
+  const arm_table_selection * sel)
+{
+  FILE *fp = fopen(path, "w");
+  double *pBuf;
+  unsigned long n;
+
+  if(fp == NULL)
+  {
+    return (-1);
+  }
+
+  pBuf = (double *) malloc(2u * ARM_TABLE_MAX_LEN * sizeof(double));
+
+  if(pBuf == NULL)
+  {
+    fclose(fp);
+    return (-1);
+  }
+
+  arm_table_write_banner(fp, "arm_dsp_tables.c",
+                         "FFT and DCT tables selected at build time.");
+
+  fprintf(fp, "#include \"arm_dsp_tables.h\"\n\n");
+
+  for (n = ARM_TABLE_MIN_LEN / 2u; n <= ARM_TABLE_MAX_LEN; n <<= 1u)
+  {
+    if((sel->bitRev & n) != 0u)
+    {
+      arm_table_write_bitrev(fp, n);
+    }
+
+    if((sel->twiddle & n) != 0u)
+    {
+      arm_table_write_twiddle(fp, pBuf, n);
+    }
+
+    if((sel->realCoef & n) != 0u)
+    {
+      arm_table_write_real_coef(fp, pBuf, n);
+    }
+
+    if((sel->dct4 & n) != 0u)
+    {
+      arm_table_write_dct4(fp, pBuf, n);
+    }
+  }
+
+  free(pBuf);
+
+  return (fclose(fp));
+}
+
+/* ----------------------------------------------------------------------
+* Main
+* ------------------------------------------------------------------- */
+
+int main(
+  int argc,
+  char **argv)
+{
+  arm_table_selection sel = { 0u, 0u, 0u, 0u };
+  const char *dir = ".";
+  arm_table_size_fn add;
+  char path[4096];
+  int k;
+
+  for (k = 1; k < argc; k++)
+  {
+    if((argv[k][0] != '-') || (argv[k][1] == '\0') || (argv[k][2] != '\0')
+       || (k + 1 >= argc))
+    {
+      break;
+    }
+
+    switch (argv[k][1])
+    {
+    case 'o':
+      dir = argv[++k];
+      continue;
+    case 'c':
+      add = arm_table_add_cfft;
+      break;
+    case 'r':
+      add = arm_table_add_rfft;
+      break;
+    case 'p':
+      add = arm_table_add_rfft_fast;
+      break;
+    case 'd':
+      add = arm_table_add_dct4;
+      break;
+    default:
+      add = NULL;
+      break;
+    }
+
+    if((add == NULL) || (arm_table_parse_sizes(&sel, argv[++k], add) != 0))
+    {
+      break;
+    }
+  }
+
+  if(k < argc)
+  {
+    fprintf(stderr,
+            "usage: %s [-o dir] [-c sizes] [-r sizes] [-p sizes] [-d sizes]\n",
+            argv[0]);
+    return (1);
+  }
+
+  snprintf(path, sizeof(path), "%s/arm_dsp_tables.h", dir);
+
+  if(arm_table_write_header(path, &sel) != 0)
+  {
+    fprintf(stderr, "cannot write %s\n", path);
+    return (1);
+  }
+
+  snprintf(path, sizeof(path), "%s/arm_dsp_tables.c", dir);
+
+  if(arm_table_write_source(path, &sel) != 0)
+  {
+    fprintf(stderr, "cannot write %s\n", path);
+    return (1);
+  }
+
+  return (0);
+}
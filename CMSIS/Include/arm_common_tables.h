@@ -26,10 +26,18 @@
  
 #include "arm_math.h" 
  
-extern uint16_t armBitRevTable[256]; 
 extern q15_t armRecipTableQ15[64]; 
 extern q31_t armRecipTableQ31[64]; 
 extern const q31_t realCoefAQ31[1024];
 extern const q31_t realCoefBQ31[1024];
+extern const uint32_t armTwoByPiTable[8];
+
+#if defined (ARM_DSP_CONFIG_TABLES)
+/* Per-length FFT tables written by arm_table_gen */
+#include "arm_dsp_tables.h"
+#else
+extern uint16_t armBitRevTable[1024]; 
+extern const float32_t twiddleCoef[8192];
+#endif
  
 #endif /*  ARM_COMMON_TABLES_H */ 
@@ -104,6 +104,25 @@
    * Define macro ARM_MATH_CM4 for building the library on Cortex-M4 target, ARM_MATH_CM3 for building library on Cortex-M3 target
    * and ARM_MATH_CM0 for building library on cortex-M0 target.
    *
+   * <b>ARM_MATH_HOST:</b>
+   * Define macro ARM_MATH_HOST instead of ARM_MATH_CMx to build the library for a host processor (for example x86-64 Linux).
+   * The Cortex-M4 code paths are compiled and the core and SIMD intrinsics are taken from <code>core_host.h</code>,
+   * which implements them in portable C with results bit-exact to the Cortex-M4 instructions.
+   *
+   * <b>ARM_MATH_HOST_SSE41, ARM_MATH_HOST_AVX2, ARM_MATH_HOST_AVX512:</b>
+   * Define these macros together with ARM_MATH_HOST to build the SSE4.1, AVX2 and AVX-512 kernels on x86 hosts:
+   * the basic math and support functions, arm_fir_f32(), arm_mat_mult_f32() and arm_cfft_radix4_f32().
+   * Each macro implies the previous ones.  The kernels give the same results as the portable code,
+   * including saturation and rounding, except for the summation order of arm_dot_prod_f32().
+   * The library must be compiled without contraction of floating-point expressions (<code>-ffp-contract=off</code>)
+   * for the portable code to give the same results on processors with and without FMA.
+   *
+   * <b>ARM_MATH_HOST_DISPATCH:</b>
+   * Define macro ARM_MATH_HOST_DISPATCH together with ARM_MATH_HOST_AVX512 to compile
+   * the x86 kernels without the matching compiler options and select them at run time from CPUID.
+   * Without ARM_MATH_HOST_DISPATCH the library must be compiled with <code>-msse4.1</code>, <code>-mavx2</code>
+   * or <code>-mavx512f</code> and only runs on processors with the instruction set.
+   *
    * <b>ARM_MATH_BIG_ENDIAN:</b>
    * Define macro ARM_MATH_BIG_ENDIAN to build the library for big endian targets. By default library builds for little endian targets.
    *
@@ -119,6 +138,14 @@
    *
    * The project can be built by opening the appropriate project in MDK-ARM 4.21 chain and defining the optional pre processor MACROs detailed above.
    *
+   * A host build of the library (<code>libarm_cortexMx_math</code>) is provided by the CMake project in the <code>CMSIS\DSP_Lib</code> folder:
+   * <pre>
+   *     cmake -S CMSIS/DSP_Lib -B build
+   *     cmake --build build
+   * </pre>
+   * The CMake option <code>ARM_MATH_HOST_SIMD</code> selects the x86 kernels: <code>NONE</code> (default),
+   * <code>SSE41</code>, <code>AVX2</code>, <code>AVX512</code> or <code>DISPATCH</code>.
+   *
    * <b>Copyright Notice</b>
    *
    * Copyright (C) 2010 ARM Limited. All rights reserved.
@@ -253,7 +280,18 @@
 
 #define __CMSIS_GENERIC              /* disable NVIC and Systick functions */
 
-#if defined (ARM_MATH_CM4)
+#if defined (ARM_MATH_HOST)
+  #include "core_host.h"
+  #if defined (ARM_MATH_HOST_AVX512) && !defined (ARM_MATH_HOST_AVX2)
+    #define ARM_MATH_HOST_AVX2           /* processors with AVX-512 also have AVX2 */
+  #endif
+  #if defined (ARM_MATH_HOST_AVX2) && !defined (ARM_MATH_HOST_SSE41)
+    #define ARM_MATH_HOST_SSE41          /* processors with AVX2 also have SSE4.1 */
+  #endif
+  #if defined (ARM_MATH_HOST_SSE41)
+    #include <immintrin.h>
+  #endif
+#elif defined (ARM_MATH_CM4)
   #include "core_cm4.h"
 #elif defined (ARM_MATH_CM3)
   #include "core_cm3.h"
@@ -377,6 +415,47 @@ extern "C"
 #endif
 
 
+#if defined (ARM_MATH_HOST_SSE41)
+
+  /**
+   * @brief x86 instruction set extensions used by the host kernels.
+   */
+  typedef enum
+    {
+      ARM_HOST_CPU_GENERIC = 0,          /**< Portable C code only */
+      ARM_HOST_CPU_SSE41 = 1,            /**< SSE4.1 kernels */
+      ARM_HOST_CPU_AVX2 = 2,             /**< AVX2 kernels */
+      ARM_HOST_CPU_AVX512 = 3            /**< AVX-512 (AVX512F) kernels */
+    } arm_host_cpu_level;
+
+  /**
+   * @brief  Instruction set extensions of the processor the library runs on.
+   * @return highest level supported by the processor and by the build.
+   */
+  arm_host_cpu_level arm_host_cpu(void);
+
+#if defined (ARM_MATH_HOST_DISPATCH)
+
+  /**
+   * @brief Compiles a kernel for an instruction set that the whole library is not compiled for.
+   */
+#define ARM_HOST_TARGET(isa)        __attribute__((target(isa)))
+
+  /**
+   * @brief Checks at run time that the processor supports a kernel.
+   */
+#define ARM_HOST_CPU_HAS(level)     (arm_host_cpu() >= (level))
+
+#else
+
+#define ARM_HOST_TARGET(isa)
+#define ARM_HOST_CPU_HAS(level)     (1)
+
+#endif /* #if defined (ARM_MATH_HOST_DISPATCH) */
+
+#endif /* #if defined (ARM_MATH_HOST_SSE41) */
+
+
   /**
    * @brief Clips Q63 to Q31 values.
    */
@@ -1163,6 +1242,270 @@ extern "C"
 			float32_t * pState,
 			uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels filtered with the same coefficients. */
+    uint8_t planarFlag;       /**< flag that selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_multichannel_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels filtered with the same coefficients. */
+    uint8_t planarFlag;       /**< flag that selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 multichannel FIR filter.
+   * @param[in] *S points to an instance of the Q15 multichannel FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples per channel to process.
+   * @return none.
+   */
+  void arm_fir_multichannel_q15(
+		   const arm_fir_multichannel_instance_q15 * S,
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 multichannel FIR filter structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	numChannels  Number of channels.
+   * @param[in] 	planarFlag  selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples per channel that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_multichannel_init_q15(
+			arm_fir_multichannel_instance_q15 * S,
+			uint16_t numTaps,
+			uint16_t numChannels,
+			uint8_t planarFlag,
+			q15_t * pCoeffs,
+			q15_t * pState,
+			uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multichannel FIR filter.
+   * @param[in] *S points to an instance of the floating-point multichannel FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples per channel to process.
+   * @return none.
+   */
+  void arm_fir_multichannel_f32(
+		   const arm_fir_multichannel_instance_f32 * S,
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point multichannel FIR filter structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	numChannels  Number of channels.
+   * @param[in] 	planarFlag  selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples per channel that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_multichannel_init_f32(
+			arm_fir_multichannel_instance_f32 * S,
+			uint16_t numTaps,
+			uint16_t numChannels,
+			uint8_t planarFlag,
+			float32_t * pCoeffs,
+			float32_t * pState,
+			uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q7 FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;      /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    uint16_t stateLength;     /**< length of the delay line, numTaps+blockSize-1. */
+    q7_t *pState;             /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    q7_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circular_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;      /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    uint16_t stateLength;     /**< length of the delay line, numTaps+blockSize-1. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circular_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;      /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    uint16_t stateLength;     /**< length of the delay line, numTaps+blockSize-1. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circular_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;      /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    uint16_t stateLength;     /**< length of the delay line, numTaps+blockSize-1. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_circular_instance_f32;
+
+  /**
+   * @brief Processing function for the Q7 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q7 circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_circular_q7(
+		   arm_fir_circular_instance_q7 * S,
+		   q7_t * pSrc,
+		   q7_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q7 circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples that are processed at a time.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps+blockSize-1</code> exceeds 65535.
+   */
+  arm_status arm_fir_circular_init_q7(
+			arm_fir_circular_instance_q7 * S,
+			uint16_t numTaps,
+			q7_t * pCoeffs,
+			q7_t * pState,
+			uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_circular_q15(
+		   arm_fir_circular_instance_q15 * S,
+		   q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples that are processed at a time.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not a supported value or <code>numTaps+blockSize-1</code> exceeds 65535.
+   */
+  arm_status arm_fir_circular_init_q15(
+			arm_fir_circular_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t * pCoeffs,
+			q15_t * pState,
+			uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_circular_q31(
+		   arm_fir_circular_instance_q31 * S,
+		   q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples that are processed at a time.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps+blockSize-1</code> exceeds 65535.
+   */
+  arm_status arm_fir_circular_init_q31(
+			arm_fir_circular_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t * pCoeffs,
+			q31_t * pState,
+			uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_circular_f32(
+		   arm_fir_circular_instance_f32 * S,
+		   float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples that are processed at a time.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps+blockSize-1</code> exceeds 65535.
+   */
+  arm_status arm_fir_circular_init_f32(
+			arm_fir_circular_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t * pCoeffs,
+			float32_t * pState,
+			uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -1365,6 +1708,51 @@ extern "C"
 
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the Q7 matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;          /**< points to the data of the matrix. */
+
+  } arm_matrix_instance_q7;
+
+  /**
+   * @brief Instance structure for the floating-point packed symmetric matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix. */
+    float32_t *pData;     /**< points to the lower triangle of the matrix, packed row by row in numRows*(numRows+1)/2 values. */
+  } arm_matrix_instance_sym_f32;
+
+  /**
+   * @brief Instance structure for the floating-point sparse matrix structure in compressed sparse row form.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;          /**< number of rows of the matrix.     */
+    uint16_t numCols;          /**< number of columns of the matrix.  */
+    const uint16_t *pRowPtr;   /**< points to the numRows+1 offsets of the rows in pColIdx and pData. */
+    const uint16_t *pColIdx;   /**< points to the column indices of the nonzero elements. */
+    float32_t *pData;          /**< points to the nonzero elements of the matrix, row by row. */
+  } arm_matrix_instance_csr_f32;
+
+  /**
+   * @brief Instance structure for the floating-point diagonal matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows and columns of the matrix. */
+    float32_t *pData;     /**< points to the numRows diagonal elements of the matrix. */
+  } arm_matrix_instance_diag_f32;
+
 
 
   /**
@@ -2006,6 +2394,48 @@ extern "C"
 				      uint8_t ifftFlag,
 				      uint8_t bitReverseFlag);
 
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t     fftLen;               /**< length of the FFT. */
+    uint8_t      ifftFlag;             /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t      bitReverseFlag;       /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    float32_t    *pTwiddle;            /**< points to the twiddle factor table. */
+    uint16_t     *pBitRevTable;        /**< points to the bit reversal table. */
+    uint16_t     twidCoefModifier;     /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t     bitRevFactor;         /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+    float32_t    onebyfftLen;          /**< value of 1/fftLen. */
+  } arm_cfft_radix8_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the floating-point mixed-radix CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft_radix8_f32(
+			   const arm_cfft_radix8_instance_f32 * S,
+			   float32_t * pSrc);
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the floating-point mixed-radix CFFT/CIFFT structure.
+   * @param[in]     fftLen         length of the FFT, any power of two from 16 to 4096.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+   */
+
+  arm_status arm_cfft_radix8_init_f32(
+				      arm_cfft_radix8_instance_f32 * S,
+				      uint16_t fftLen,
+				      uint8_t ifftFlag,
+				      uint8_t bitReverseFlag);
+
 
 
   /*----------------------------------------------------------------------
@@ -2060,21 +2490,53 @@ extern "C"
 			   uint16_t *pBitRevTab);
 
   /**
-   * @brief  Core function for the Q31 CFFT butterfly process.
-   * @param[in, out] *pSrc            points to the in-place buffer of Q31 data type.
+   * @brief  Core function for the floating-point mixed-radix CFFT butterfly process.
+   * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
    * @param[in]      fftLen           length of the FFT.
-   * @param[in]      *pCoef           points to twiddle coefficient buffer.
+   * @param[in]      *pCoef           points to the twiddle coefficient buffer.
    * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
    * @return none.
    */
-  
-  void arm_radix4_butterfly_q31(
-				q31_t *pSrc,
-				uint32_t fftLen,
-				q31_t *pCoef,
-				uint32_t twidCoefModifier);
 
-  /**
+  void arm_radix8_butterfly_f32(
+				float32_t * pSrc,
+				uint16_t fftLen,
+				float32_t * pCoef,
+				uint16_t twidCoefModifier);
+
+  /**
+   * @brief  Core function for the floating-point mixed-radix CIFFT butterfly process.
+   * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+   * @param[in]      fftLen           length of the FFT.
+   * @param[in]      *pCoef           points to twiddle coefficient buffer.
+   * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+   * @param[in]      onebyfftLen      value of 1/fftLen.
+   * @return none.
+   */
+
+  void arm_radix8_butterfly_inverse_f32(
+					float32_t * pSrc,
+					uint16_t fftLen,
+					float32_t * pCoef,
+					uint16_t twidCoefModifier,
+					float32_t onebyfftLen);
+
+  /**
+   * @brief  Core function for the Q31 CFFT butterfly process.
+   * @param[in, out] *pSrc            points to the in-place buffer of Q31 data type.
+   * @param[in]      fftLen           length of the FFT.
+   * @param[in]      *pCoef           points to twiddle coefficient buffer.
+   * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+   * @return none.
+   */
+  
+  void arm_radix4_butterfly_q31(
+				q31_t *pSrc,
+				uint32_t fftLen,
+				q31_t *pCoef,
+				uint32_t twidCoefModifier);
+
+  /**
    * @brief  Core function for the Q31 CIFFT butterfly process.
    * @param[in, out] *pSrc            points to the in-place buffer of Q31 data type.
    * @param[in]      fftLen           length of the FFT.
@@ -2287,6 +2749,96 @@ extern "C"
 		    float32_t * pSrc,
 		    float32_t * pDst);
 
+  /**
+   * @brief Instance structure for the floating-point RFFT/RIFFT function with packed spectrum.
+   */
+
+  typedef struct
+  {
+    uint16_t  fftLenReal;                       /**< length of the real FFT. */
+    uint16_t  fftLenBy2;                        /**< length of the complex FFT. */
+    uint8_t   ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    float32_t *pTwiddle;                        /**< points to the twiddle factor table. */
+    uint16_t  *pBitRevTable;                    /**< points to the bit reversal table. */
+    uint16_t  twidCoefModifier;                 /**< twiddle coefficient modifier of the complex FFT. */
+    uint16_t  twidCoefRModifier;                /**< twiddle coefficient modifier of the split step. */
+    uint16_t  bitRevFactor;                     /**< bit reversal modifier of the complex FFT. */
+    float32_t onebyfftLenBy2;                   /**< value of 1/fftLenBy2. */
+  } arm_rfft_fast_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point RFFT/RIFFT with packed spectrum.
+   * @param[in,out] *S             points to an instance of the floating-point packed RFFT/RIFFT structure.
+   * @param[in]     fftLenReal     length of the FFT, any power of two from 32 to 4096.
+   * @param[in]     ifftFlagR      flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform.
+   * @return		The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported value.
+   */
+
+  arm_status arm_rfft_fast_init_f32(
+				    arm_rfft_fast_instance_f32 * S,
+				    uint32_t fftLenReal,
+				    uint32_t ifftFlagR);
+
+  /**
+   * @brief Processing function for the floating-point RFFT/RIFFT with packed spectrum.
+   * @param[in]  *S    points to an instance of the floating-point packed RFFT/RIFFT structure.
+   * @param[in]  *pSrc points to the input buffer of <code>fftLenReal</code> values.
+   * @param[out] *pDst points to the output buffer of <code>fftLenReal</code> values.
+   * @return none.
+   */
+
+  void arm_rfft_fast_f32(
+			 const arm_rfft_fast_instance_f32 * S,
+			 float32_t * pSrc,
+			 float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point FFT-based FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t partSize;                  /**< partition length.  The FFT length is 2*partSize. */
+    uint16_t numParts;                  /**< number of partitions of the filter. */
+    uint16_t partIndex;                 /**< slot of the newest input spectrum in the frequency domain delay line. */
+    float32_t *pCoeffSpec;              /**< points to the spectra of the coefficient partitions, of length 2*partSize*numParts. */
+    float32_t *pState;                  /**< points to the state array of length 2*partSize*(numParts+3). */
+    arm_rfft_fast_instance_f32 rfft;    /**< forward real FFT of length 2*partSize. */
+    arm_rfft_fast_instance_f32 rifft;   /**< inverse real FFT of length 2*partSize. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FFT-based FIR filter.
+   * @param[in,out] *S        points to an instance of the floating-point FFT-based FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data.
+   * @param[in]  blockSize    number of samples to process, a multiple of the partition length.
+   * @return     none.
+   */
+  void arm_fir_fft_f32(
+		       arm_fir_fft_instance_f32 * S,
+		       float32_t * pSrc,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FFT-based FIR filter.
+   * @param[in,out] *S          points to an instance of the floating-point FFT-based FIR structure.
+   * @param[in]     numTaps     number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs    points to the filter coefficients, in the same order as for arm_fir_f32().
+   * @param[out]    *pCoeffSpec points to the buffer for the coefficient spectra.
+   * @param[in]     *pState     points to the state buffer.
+   * @param[in]     partSize    partition length, any power of two from 16 to 2048.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>partSize</code> is not a supported value.
+   */
+  arm_status arm_fir_fft_init_f32(
+				  arm_fir_fft_instance_f32 * S,
+				  uint16_t numTaps,
+				  float32_t * pCoeffs,
+				  float32_t * pCoeffSpec,
+				  float32_t * pState,
+				  uint16_t partSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2428,6 +2980,183 @@ extern "C"
 		    q15_t * pState,
 		    q15_t * pInlineBuffer);
 
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;         /**< number of bins. */
+    uint16_t frameLen;        /**< frame length, the number of points of the DFT. */
+    float32_t *pCoeffs;       /**< points to the cosine and sine of the bin frequencies, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[out] *S points to an instance of the floating-point Goertzel structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen frame length, the number of points of the DFT.
+   * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+   * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+   */
+
+  arm_status arm_goertzel_init_f32(
+			arm_goertzel_instance_f32 * S,
+			uint16_t numBins,
+			uint16_t frameLen,
+			uint16_t * pBinIndex,
+			float32_t * pCoeffs);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel filter bank.
+   * @param[in]  *S points to an instance of the floating-point Goertzel structure.
+   * @param[in]  *pSrc points to the input frame of frameLen samples.
+   * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+   * @return none.
+   */
+
+  void arm_goertzel_f32(
+			const arm_goertzel_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+
+  typedef struct
+  {
+    arm_goertzel_instance_f32 goertzel; /**< Goertzel filter bank of the bins, which recomputes them once per frame. */
+    uint16_t index;           /**< position of the oldest sample in the delay line. */
+    float32_t *pState;        /**< points to the state buffer of 2*numBins + frameLen values. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[out] *S points to an instance of the floating-point sliding DFT structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen frame length, the number of points of the DFT.
+   * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+   * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+   * @param[in]  *pState points to the state buffer of 2*numBins + frameLen values.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+   */
+
+  arm_status arm_sdft_init_f32(
+			arm_sdft_instance_f32 * S,
+			uint16_t numBins,
+			uint16_t frameLen,
+			uint16_t * pBinIndex,
+			float32_t * pCoeffs,
+			float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_sdft_f32(
+			arm_sdft_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;         /**< number of bins. */
+    uint16_t frameLen;        /**< frame length, the number of points of the DFT. */
+    uint8_t scaleShift;       /**< the outputs are the DFT values scaled down by 2^scaleShift. */
+    q31_t *pCoeffs;           /**< points to the cosine and sine of the bin frequencies in 2.30 format, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[out] *S points to an instance of the Q31 Goertzel structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen frame length, the number of points of the DFT.
+   * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+   * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+   */
+
+  arm_status arm_goertzel_init_q31(
+			arm_goertzel_instance_q31 * S,
+			uint16_t numBins,
+			uint16_t frameLen,
+			uint16_t * pBinIndex,
+			q31_t * pCoeffs);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel filter bank.
+   * @param[in]  *S points to an instance of the Q31 Goertzel structure.
+   * @param[in]  *pSrc points to the input frame of frameLen samples.
+   * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+   * @return none.
+   */
+
+  void arm_goertzel_q31(
+			const arm_goertzel_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+
+  typedef struct
+  {
+    arm_goertzel_instance_q31 goertzel; /**< Goertzel filter bank of the bins, which recomputes them once per frame. */
+    uint16_t index;           /**< position of the oldest sample in the delay line. */
+    q31_t *pState;            /**< points to the state buffer of 2*numBins + frameLen values. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[out] *S points to an instance of the Q31 sliding DFT structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen frame length, the number of points of the DFT.
+   * @param[in]  *pBinIndex points to the indices of the bins, numBins values.
+   * @param[in]  *pCoeffs points to the coefficient buffer of 2*numBins values.
+   * @param[in]  *pState points to the state buffer of 2*numBins + frameLen values.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+   * <code>frameLen</code> is less than 2 or a bin index is not less than <code>frameLen</code>.
+   */
+
+  arm_status arm_sdft_init_q31(
+			arm_sdft_instance_q31 * S,
+			uint16_t numBins,
+			uint16_t frameLen,
+			uint16_t * pBinIndex,
+			q31_t * pCoeffs,
+			q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 sliding DFT.
+   * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the complex output buffer of 2*numBins values.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_sdft_q31(
+			arm_sdft_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
   /**
    * @brief Floating-point vector addition.
    * @param[in]       *pSrcA points to the first input vector
@@ -2994,6 +3723,27 @@ extern "C"
 		    uint32_t srcBLen,
 		    float32_t * pDst);
 
+/**  
+ * @brief Convolution of floating-point sequences using partitioned fast convolution.  
+ * @param[in] *pSrcA points to the first input sequence.  
+ * @param[in] srcALen length of the first input sequence.  
+ * @param[in] *pSrcB points to the second input sequence.  
+ * @param[in] srcBLen length of the second input sequence.  
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.  
+ * @param[in] partSize partition length, any power of two from 16 to 2048.  
+ * @param[in] *pScratch points to scratch buffer of size 2*partSize*(2*numParts+3), numParts = ceil(min(srcALen, srcBLen)/partSize).  
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>partSize</code> is not supported or the shorter sequence is longer than 65535 samples.  
+ */ 
+
+  arm_status arm_conv_fft_f32(
+			      float32_t * pSrcA,
+			      uint32_t srcALen,
+			      float32_t * pSrcB,
+			      uint32_t srcBLen,
+			      float32_t * pDst,
+			      uint16_t partSize,
+			      float32_t * pScratch);
+
 /**  
  * @brief Convolution of Q15 sequences.  
  * @param[in] *pSrcA points to the first input sequence.  
@@ -3283,6 +4033,181 @@ extern "C"
 				       float32_t * pState,
 				       uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;                  /**< number of integrator and comb stages. */
+    uint8_t postShift;                  /**< right shift that normalizes the gain R^numStages of the filter. */
+    uint16_t R;                         /**< decimation factor. */
+    q63_t *pState;                      /**< points to the state variable array. The array is of length 2*numStages. */
+  } arm_cic_decimate_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator.
+   * @param[in]  *S         points to an instance of the Q31 CIC decimator structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data, of length blockSize/R.
+   * @param[in]  blockSize  number of input samples to process per call, a multiple of R.
+   * @return     none.
+   */
+
+  void arm_cic_decimate_q31(
+			    const arm_cic_decimate_instance_q31 * S,
+			    q31_t * pSrc,
+			    q31_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages   number of integrator and comb stages.
+   * @param[in]     R           decimation factor.
+   * @param[in]     *pState     points to the state buffer.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * blockSize is not a multiple of R, or ARM_MATH_ARGUMENT_ERROR if the gain R^numStages exceeds 2^32.
+   */
+
+  arm_status arm_cic_decimate_init_q31(
+				       arm_cic_decimate_instance_q31 * S,
+				       uint8_t numStages,
+				       uint16_t R,
+				       q63_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 multistage decimator.
+   */
+
+  typedef struct
+  {
+    const arm_cic_decimate_instance_q31 *pCic;    /**< points to the CIC front end, or NULL if there is none. */
+    uint8_t numStages;                            /**< number of FIR decimator stages. */
+    const arm_fir_decimate_instance_q31 *pStages; /**< points to the array of numStages FIR decimator instances. */
+    q31_t *pScratch;                              /**< points to the buffer for the outputs of intermediate stages. */
+  } arm_fir_decimate_multistage_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point multistage decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;                            /**< number of FIR decimator stages. */
+    const arm_fir_decimate_instance_f32 *pStages; /**< points to the array of numStages FIR decimator instances. */
+    float32_t *pScratch;                          /**< points to the buffer for the outputs of intermediate stages. */
+  } arm_fir_decimate_multistage_instance_f32;
+
+  /**
+   * @brief Processing function for the Q31 multistage decimator.
+   * @param[in]  *S         points to an instance of the Q31 multistage decimator structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return     none.
+   */
+
+  void arm_fir_decimate_multistage_q31(
+				       const arm_fir_decimate_multistage_instance_q31 * S,
+				       q31_t * pSrc,
+				       q31_t * pDst,
+				       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multistage decimator.
+   * @param[in,out] *S          points to an instance of the Q31 multistage decimator structure.
+   * @param[in]     *pCic       points to an initialized CIC decimator, or NULL.
+   * @param[in]     numStages   number of FIR decimator stages.
+   * @param[in]     *pStages    points to the array of initialized FIR decimators.
+   * @param[in]     *pScratch   points to the scratch buffer.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * blockSize is not a multiple of the overall decimation factor.
+   */
+
+  arm_status arm_fir_decimate_multistage_init_q31(
+						  arm_fir_decimate_multistage_instance_q31 * S,
+						  const arm_cic_decimate_instance_q31 * pCic,
+						  uint8_t numStages,
+						  const arm_fir_decimate_instance_q31 * pStages,
+						  q31_t * pScratch,
+						  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multistage decimator.
+   * @param[in]  *S         points to an instance of the floating-point multistage decimator structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return     none.
+   */
+
+  void arm_fir_decimate_multistage_f32(
+				       const arm_fir_decimate_multistage_instance_f32 * S,
+				       float32_t * pSrc,
+				       float32_t * pDst,
+				       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multistage decimator.
+   * @param[in,out] *S          points to an instance of the floating-point multistage decimator structure.
+   * @param[in]     numStages   number of FIR decimator stages.
+   * @param[in]     *pStages    points to the array of initialized FIR decimators.
+   * @param[in]     *pScratch   points to the scratch buffer.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * blockSize is not a multiple of the overall decimation factor.
+   */
+
+  arm_status arm_fir_decimate_multistage_init_f32(
+						  arm_fir_decimate_multistage_instance_f32 * S,
+						  uint8_t numStages,
+						  const arm_fir_decimate_instance_f32 * pStages,
+						  float32_t * pScratch,
+						  uint32_t blockSize);
+
+  /**
+   * @brief Maximum number of FIR stages of a multistage decimator plan.
+   */
+#define ARM_DECIMATE_PLAN_MAX_STAGES   4u
+
+  /**
+   * @brief Multistage decimator plan computed by arm_fir_decimate_plan_f32().
+   */
+
+  typedef struct
+  {
+    uint16_t cicFactor;                                 /**< decimation factor of the CIC front end, 1 if there is none. */
+    uint8_t numStages;                                  /**< number of FIR decimator stages. */
+    uint8_t M[ARM_DECIMATE_PLAN_MAX_STAGES];            /**< decimation factors of the FIR stages, first stage first. */
+    uint16_t numTaps[ARM_DECIMATE_PLAN_MAX_STAGES];     /**< estimated number of taps of the FIR stages. */
+    float32_t macsPerOutput;                            /**< estimated multiply-accumulates per output sample. */
+    float32_t cicDroop;                                 /**< attenuation of the CIC front end at the passband edge, in dB. */
+  } arm_fir_decimate_plan_instance;
+
+  /**
+   * @brief  Chooses the stage factors of a multistage decimator.
+   * @param[out] *pPlan        points to the plan.
+   * @param[in]  M             overall decimation factor.
+   * @param[in]  maxStages     largest number of FIR stages, at most ARM_DECIMATE_PLAN_MAX_STAGES.
+   * @param[in]  cicStages     number of stages of the CIC front end, 0 for none.
+   * @param[in]  passband      passband edge, as a fraction of the output sample rate, below 0.5.
+   * @param[in]  attenuation   stopband attenuation in dB.
+   * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range
+   * or no plan fits the limits of the FIR decimators.
+   */
+
+  arm_status arm_fir_decimate_plan_f32(
+				       arm_fir_decimate_plan_instance * pPlan,
+				       uint32_t M,
+				       uint8_t maxStages,
+				       uint8_t cicStages,
+				       float32_t passband,
+				       float32_t attenuation);
+
   /**
    * @brief Processing function for the Q15 FIR decimator.
    * @param[in] *S points to an instance of the Q15 FIR decimator structure.
@@ -3533,60 +4458,210 @@ extern "C"
 					  uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the Q15 FIR sample rate converter.
    */
 
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_cas_df1_32x64_ins_q31;
-
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< decimation factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q15;
 
   /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief Instance structure for the Q31 FIR sample rate converter.
    */
 
-  void arm_biquad_cas_df1_32x64_q31(
-				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
-				     q31_t * pSrc,
-				    q31_t * pDst,
-				    uint32_t blockSize);
-
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< decimation factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q31;
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief Instance structure for the floating-point FIR sample rate converter.
    */
 
-  void arm_biquad_cas_df1_32x64_init_q31(
-					 arm_biquad_cas_df1_32x64_ins_q31 * S,
-					 uint8_t numStages,
-					 q31_t * pCoeffs,
-					 q63_t * pState,
-					 uint8_t postShift);
-
-
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< decimation factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_f32;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Processing function for the Q15 FIR sample rate converter.
+   * @param[in]  *S        points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize number of input samples to process per call, a multiple of M.
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+  void arm_fir_resample_q15(
+			    const arm_fir_resample_instance_q15 * S,
+			    q15_t * pSrc,
+			    q15_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR sample rate converter.
+   * @param[in,out] *S        points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         decimation factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * numTaps is not a multiple of L or blockSize is not a multiple of M.
+   */
+
+  arm_status arm_fir_resample_init_q15(
+				       arm_fir_resample_instance_q15 * S,
+				       uint16_t L,
+				       uint16_t M,
+				       uint16_t numTaps,
+				       q15_t * pCoeffs,
+				       q15_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR sample rate converter.
+   * @param[in]  *S        points to an instance of the Q31 FIR sample rate converter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize number of input samples to process per call, a multiple of M.
+   * @return none.
+   */
+
+  void arm_fir_resample_q31(
+			    const arm_fir_resample_instance_q31 * S,
+			    q31_t * pSrc,
+			    q31_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR sample rate converter.
+   * @param[in,out] *S        points to an instance of the Q31 FIR sample rate converter structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         decimation factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * numTaps is not a multiple of L or blockSize is not a multiple of M.
+   */
+
+  arm_status arm_fir_resample_init_q31(
+				       arm_fir_resample_instance_q31 * S,
+				       uint16_t L,
+				       uint16_t M,
+				       uint16_t numTaps,
+				       q31_t * pCoeffs,
+				       q31_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR sample rate converter.
+   * @param[in]  *S        points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize number of input samples to process per call, a multiple of M.
+   * @return none.
+   */
+
+  void arm_fir_resample_f32(
+			    const arm_fir_resample_instance_f32 * S,
+			    float32_t * pSrc,
+			    float32_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR sample rate converter.
+   * @param[in,out] *S        points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         decimation factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * numTaps is not a multiple of L or blockSize is not a multiple of M.
+   */
+
+  arm_status arm_fir_resample_init_f32(
+				       arm_fir_resample_instance_f32 * S,
+				       uint16_t L,
+				       uint16_t M,
+				       uint16_t numTaps,
+				       float32_t * pCoeffs,
+				       float32_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cas_df1_32x64_q31(
+				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
+				     q31_t * pSrc,
+				    q31_t * pDst,
+				    uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cas_df1_32x64_init_q31(
+					 arm_biquad_cas_df1_32x64_ins_q31 * S,
+					 uint8_t numStages,
+					 q31_t * pCoeffs,
+					 q63_t * pState,
+					 uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
     float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_df2T_instance_f32;
 
@@ -3622,6 +4697,204 @@ extern "C"
 					float32_t * pCoeffs,
 					float32_t * pState);
 
+  /**
+   * @brief Instance structure for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t  numChannels;     /**< number of interleaved channels filtered with the same coefficients. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_multichannel_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data.
+   * @param[in]  blockSize number of samples per channel to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_multichannel_f32(
+				   const arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+				   float32_t * pSrc,
+				   float32_t * pDst,
+				   uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_multichannel_init_f32(
+					arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+					uint8_t numStages,
+					uint16_t numChannels,
+					float32_t * pCoeffs,
+					float32_t * pState);
+
+
+  /**
+   * @brief Instance structure for the Q15 multichannel Biquad cascade DF1 filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t  numChannels;     /**< number of channels filtered with the same coefficients. */
+    uint8_t   planarFlag;      /**< flag that selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output. */
+    q15_t     *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t     *pCoeffs;        /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t    postShift;       /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df1_multichannel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel Biquad cascade DF1 filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t  numChannels;     /**< number of channels filtered with the same coefficients. */
+    uint8_t   planarFlag;      /**< flag that selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output. */
+    q31_t     *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t     *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t   postShift;       /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df1_multichannel_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q15 multichannel Biquad cascade DF1 filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples per channel to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df1_multichannel_q15(
+				   const arm_biquad_cascade_df1_multichannel_instance_q15 * S,
+				   q15_t * pSrc,
+				   q15_t * pDst,
+				   uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel Biquad cascade DF1 filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     planarFlag   selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_multichannel_init_q15(
+					arm_biquad_cascade_df1_multichannel_instance_q15 * S,
+					uint8_t numStages,
+					uint16_t numChannels,
+					uint8_t planarFlag,
+					q15_t * pCoeffs,
+					q15_t * pState,
+					int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the Q31 multichannel Biquad cascade DF1 filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples per channel to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df1_multichannel_q31(
+				   const arm_biquad_cascade_df1_multichannel_instance_q31 * S,
+				   q31_t * pSrc,
+				   q31_t * pDst,
+				   uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel Biquad cascade DF1 filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     planarFlag   selects interleaved (planarFlag=0) or planar (planarFlag=1) input and output.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_multichannel_init_q31(
+					arm_biquad_cascade_df1_multichannel_instance_q31 * S,
+					uint8_t numStages,
+					uint16_t numChannels,
+					uint8_t planarFlag,
+					q31_t * pCoeffs,
+					q31_t * pState,
+					uint8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the floating-point block state-space transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    float32_t *pBlockCoeffs;   /**< points to the array of block coefficients.  The array is of length 48*numStages. */
+  } arm_biquad_cascade_df2T_block_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point block state-space transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_block_f32(
+				   const arm_biquad_cascade_df2T_block_instance_f32 * S,
+				   float32_t * pSrc,
+				   float32_t * pDst,
+				   uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point block state-space transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S             points to an instance of the filter data structure.
+   * @param[in]     numStages      number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs       points to the filter coefficients.
+   * @param[out]    *pBlockCoeffs  points to the block coefficients computed from pCoeffs.
+   * @param[in]     *pState        points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_block_init_f32(
+					arm_biquad_cascade_df2T_block_instance_f32 * S,
+					uint8_t numStages,
+					float32_t * pCoeffs,
+					float32_t * pBlockCoeffs,
+					float32_t * pState);
+
 
 
   /**
@@ -4554,29 +5827,227 @@ extern "C"
 
 
   /**
-   * @brief  Floating-point complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief Number of samples of the NCO recursive rotation between two renormalisations.
    */
-
-  void arm_cmplx_conj_f32(
-			   float32_t * pSrc,
-			  float32_t * pDst,
-			  uint32_t numSamples);
+#define NCO_RESYNC_INTERVAL  32u
 
   /**
-   * @brief  Q31 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point numerically controlled oscillator.
    */
 
-  void arm_cmplx_conj_q31(
-			   q31_t * pSrc,
-			  q31_t * pDst,
+  typedef struct
+  {
+    uint32_t phase;           /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;        /**< phase increment per sample. */
+    float32_t stepCos;        /**< cosine of the phase increment. */
+    float32_t stepSin;        /**< sine of the phase increment. */
+  } arm_nco_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 numerically controlled oscillator.
+   */
+
+  typedef struct
+  {
+    uint32_t phase;           /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;        /**< phase increment per sample. */
+    q31_t stepCos;            /**< cosine of the phase increment in 1.31 format. */
+    q31_t stepSin;            /**< sine of the phase increment in 1.31 format. */
+  } arm_nco_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 numerically controlled oscillator.
+   */
+
+  typedef struct
+  {
+    uint32_t phase;           /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;        /**< phase increment per sample. */
+    q31_t stepCos;            /**< cosine of the phase increment in 1.31 format. */
+    q31_t stepSin;            /**< sine of the phase increment in 1.31 format. */
+  } arm_nco_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point NCO.
+   * @param[out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]  frequency frequency as a fraction of the sample rate.
+   * @param[in]  phase initial phase as a fraction of a turn.
+   * @return     none.
+   */
+
+  void arm_nco_init_f32(
+			arm_nco_instance_f32 * S,
+			float32_t frequency,
+			float32_t phase);
+
+  /**
+   * @brief  Sets the frequency of a floating-point NCO, keeping its phase.
+   * @param[in,out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]     frequency frequency as a fraction of the sample rate.
+   * @return        none.
+   */
+
+  void arm_nco_set_frequency_f32(
+			arm_nco_instance_f32 * S,
+			float32_t frequency);
+
+  /**
+   * @brief  Floating-point numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the floating-point NCO structure.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return        none.
+   */
+
+  void arm_nco_f32(
+			arm_nco_instance_f32 * S,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point mixing of a real signal with a numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]     *pSrc points to the real input buffer.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of input samples.
+   * @return        none.
+   */
+
+  void arm_nco_mix_f32(
+			arm_nco_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 NCO.
+   * @param[out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]  frequency frequency in [-1 +1), mapping to [-fs/2 +fs/2).
+   * @param[in]  phase initial phase in [-1 +1), mapping to [-180 180) degrees.
+   * @return     none.
+   */
+
+  void arm_nco_init_q31(
+			arm_nco_instance_q31 * S,
+			q31_t frequency,
+			q31_t phase);
+
+  /**
+   * @brief  Sets the frequency of a Q31 NCO, keeping its phase.
+   * @param[in,out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]     frequency frequency in [-1 +1), mapping to [-fs/2 +fs/2).
+   * @return        none.
+   */
+
+  void arm_nco_set_frequency_q31(
+			arm_nco_instance_q31 * S,
+			q31_t frequency);
+
+  /**
+   * @brief  Q31 numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the Q31 NCO structure.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return        none.
+   */
+
+  void arm_nco_q31(
+			arm_nco_instance_q31 * S,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 mixing of a real signal with a numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]     *pSrc points to the real input buffer.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of input samples.
+   * @return        none.
+   */
+
+  void arm_nco_mix_q31(
+			arm_nco_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 NCO.
+   * @param[out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]  frequency frequency in [-1 +1), mapping to [-fs/2 +fs/2).
+   * @param[in]  phase initial phase in [-1 +1), mapping to [-180 180) degrees.
+   * @return     none.
+   */
+
+  void arm_nco_init_q15(
+			arm_nco_instance_q15 * S,
+			q15_t frequency,
+			q15_t phase);
+
+  /**
+   * @brief  Sets the frequency of a Q15 NCO, keeping its phase.
+   * @param[in,out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]     frequency frequency in [-1 +1), mapping to [-fs/2 +fs/2).
+   * @return        none.
+   */
+
+  void arm_nco_set_frequency_q15(
+			arm_nco_instance_q15 * S,
+			q15_t frequency);
+
+  /**
+   * @brief  Q15 numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the Q15 NCO structure.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return        none.
+   */
+
+  void arm_nco_q15(
+			arm_nco_instance_q15 * S,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q15 mixing of a real signal with a numerically controlled oscillator.
+   * @param[in,out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]     *pSrc points to the real input buffer.
+   * @param[out]    *pDst points to the complex output buffer of 2*blockSize values.
+   * @param[in]     blockSize number of input samples.
+   * @return        none.
+   */
+
+  void arm_nco_mix_q15(
+			arm_nco_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_f32(
+			   float32_t * pSrc,
+			  float32_t * pDst,
+			  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_q31(
+			   q31_t * pSrc,
+			  q31_t * pDst,
 			  uint32_t numSamples);
 
   /**
@@ -4797,6 +6268,7 @@ extern "C"
   {
     q63_t acc;
     q15_t out;
+    q15_t *pState = S->state;
 
     /* Implementation of PID controller */
 
@@ -4821,7 +6293,7 @@ extern "C"
 	#else
 
     /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc = __SMLALD(S->A1, (q31_t)__SIMD32(S->state), acc);
+    acc = __SMLALD(S->A1, *__SIMD32(pState), acc);
 
 	#endif
 
@@ -4858,6 +6330,410 @@ extern "C"
 				 const arm_matrix_instance_f32 * src,
 				 arm_matrix_instance_f32 * dst);
 
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  *pSrc points to the input symmetric positive definite matrix structure.
+   * @param[out] *pDst points to the output lower triangular matrix structure, which may be the input.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square or of the same size,
+   * or ARM_MATH_SINGULAR if the input matrix is not positive definite.
+   */
+
+  arm_status arm_mat_cholesky_f32(
+				const arm_matrix_instance_f32 * pSrc,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 Cholesky decomposition.
+   * @param[in]  *pSrc points to the input symmetric positive definite matrix structure.
+   * @param[out] *pDst points to the output lower triangular matrix structure, which may be the input.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square or of the same size,
+   * or ARM_MATH_SINGULAR if the input matrix is not positive definite.
+   */
+
+  arm_status arm_mat_cholesky_q31(
+				const arm_matrix_instance_q31 * pSrc,
+				arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Floating-point linear system solution with a Cholesky decomposition.
+   * @param[in]  *pSrcL points to the lower triangular matrix structure computed by arm_mat_cholesky_f32().
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of pSrcL is zero.
+   */
+
+  arm_status arm_mat_cholesky_solve_f32(
+				const arm_matrix_instance_f32 * pSrcL,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point LDL' decomposition.
+   * @param[in]  *pSrc points to the input symmetric matrix structure.
+   * @param[out] *pDst points to the output matrix structure of L and D, which may be the input.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square or of the same size,
+   * or ARM_MATH_SINGULAR if a pivot is zero.
+   */
+
+  arm_status arm_mat_ldlt_f32(
+				const arm_matrix_instance_f32 * pSrc,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point linear system solution with an LDL' decomposition.
+   * @param[in]  *pSrcLD points to the matrix structure of L and D computed by arm_mat_ldlt_f32().
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a pivot is zero.
+   */
+
+  arm_status arm_mat_ldlt_solve_f32(
+				const arm_matrix_instance_f32 * pSrcLD,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  *pSrc points to the input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of L and U, which may be the input.
+   * @param[out] *pPerm points to the row permutation array of numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the matrices are not square or of the same size,
+   * or ARM_MATH_SINGULAR if the input matrix is singular.
+   */
+
+  arm_status arm_mat_lu_f32(
+				const arm_matrix_instance_f32 * pSrc,
+				arm_matrix_instance_f32 * pDst,
+				uint16_t * pPerm);
+
+  /**
+   * @brief Floating-point linear system solution with an LU decomposition.
+   * @param[in]  *pSrcLU points to the matrix structure of L and U computed by arm_mat_lu_f32().
+   * @param[in]  *pPerm points to the row permutation array computed by arm_mat_lu_f32().
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure, which must not be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of U is zero.
+   */
+
+  arm_status arm_mat_lu_solve_f32(
+				const arm_matrix_instance_f32 * pSrcLU,
+				const uint16_t * pPerm,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point Householder QR decomposition.
+   * @param[in]  *pSrc points to the input matrix structure, with at least as many rows as columns.
+   * @param[out] *pDst points to the output matrix structure of R and of the reflections, which may be the input.
+   * @param[out] *pTau points to the array of numCols factors of the reflections.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if R has a zero on the diagonal.
+   */
+
+  arm_status arm_mat_qr_f32(
+				const arm_matrix_instance_f32 * pSrc,
+				arm_matrix_instance_f32 * pDst,
+				float32_t * pTau);
+
+  /**
+   * @brief Floating-point least squares solution with a QR decomposition.
+   * @param[in]  *pSrcQR points to the matrix structure computed by arm_mat_qr_f32().
+   * @param[in]  *pTau points to the factors of the reflections computed by arm_mat_qr_f32().
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure of the size of pSrcB, which may be pSrcB.
+   * Its first numCols rows receive the solution.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if R has a zero on the diagonal.
+   */
+
+  arm_status arm_mat_qr_solve_f32(
+				const arm_matrix_instance_f32 * pSrcQR,
+				const float32_t * pTau,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point forward substitution.
+   * @param[in]  *pSrcL points to the lower triangular matrix structure.
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of pSrcL is zero.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f32(
+				const arm_matrix_instance_f32 * pSrcL,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point back substitution.
+   * @param[in]  *pSrcU points to the upper triangular matrix structure.
+   * @param[in]  *pSrcB points to the matrix structure of the right-hand sides.
+   * @param[out] *pDst points to the output matrix structure, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of pSrcU is zero.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f32(
+				const arm_matrix_instance_f32 * pSrcU,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point multiplication by a transposed matrix.
+   * @param[in]  *pSrcA points to the first input matrix structure.
+   * @param[in]  *pSrcB points to the second input matrix structure, which is transposed.
+   * @param[out] *pDst points to the output matrix structure of pSrcA * pSrcB'.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_trans_f32(
+				const arm_matrix_instance_f32 * pSrcA,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief  Floating-point packed symmetric matrix initialization.
+   * @param[in,out] *S             points to an instance of the packed symmetric matrix structure.
+   * @param[in]     nRows          number of rows and columns of the matrix.
+   * @param[in]     *pData	       points to the array of nRows*(nRows+1)/2 values.
+   * @return        none
+   */
+
+  void arm_mat_sym_init_f32(
+			arm_matrix_instance_sym_f32 * S,
+			uint16_t nRows,
+			float32_t * pData);
+
+  /**
+   * @brief Floating-point conversion of a dense matrix to packed symmetric form.
+   * @param[in]  *pSrc points to the input square matrix structure, of which the lower triangle is read.
+   * @param[out] *pDst points to the output packed symmetric matrix structure.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_pack_f32(
+				const arm_matrix_instance_f32 * pSrc,
+				arm_matrix_instance_sym_f32 * pDst);
+
+  /**
+   * @brief Floating-point conversion of a packed symmetric matrix to dense form.
+   * @param[in]  *pSrc points to the input packed symmetric matrix structure.
+   * @param[out] *pDst points to the output square matrix structure.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_unpack_f32(
+				const arm_matrix_instance_sym_f32 * pSrc,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point packed symmetric matrix addition.
+   * @param[in]  *pSrcA points to the first input packed symmetric matrix structure.
+   * @param[in]  *pSrcB points to the second input packed symmetric matrix structure.
+   * @param[out] *pDst points to the output packed symmetric matrix structure.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_add_f32(
+				const arm_matrix_instance_sym_f32 * pSrcA,
+				const arm_matrix_instance_sym_f32 * pSrcB,
+				arm_matrix_instance_sym_f32 * pDst);
+
+  /**
+   * @brief Floating-point packed symmetric matrix multiplication.
+   * @param[in]  *pSrcS points to the input packed symmetric matrix structure.
+   * @param[in]  *pSrcB points to the second input matrix structure.
+   * @param[out] *pDst points to the output matrix structure, which must not be pSrcB.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_mult_f32(
+				const arm_matrix_instance_sym_f32 * pSrcS,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point packed symmetric matrix vector multiplication.
+   * @param[in]  *pSrcS points to the input packed symmetric matrix structure.
+   * @param[in]  *pVec points to the input vector of numRows values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_sym_vec_mult_f32(
+				const arm_matrix_instance_sym_f32 * pSrcS,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point symmetric product A * S * A'.
+   * @param[in]  *pSrcA points to the M x N input matrix structure.
+   * @param[in]  *pSrcS points to the N x N input packed symmetric matrix structure.
+   * @param[out] *pDst points to the M x M output packed symmetric matrix structure.
+   * @param[in]  *pScratch points to a scratch buffer of N values.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_sym_abat_f32(
+				const arm_matrix_instance_f32 * pSrcA,
+				const arm_matrix_instance_sym_f32 * pSrcS,
+				arm_matrix_instance_sym_f32 * pDst,
+				float32_t * pScratch);
+
+  /**
+   * @brief  Floating-point sparse CSR matrix initialization.
+   * @param[in,out] *S             points to an instance of the sparse matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pRowPtr       points to the array of nRows+1 row offsets.
+   * @param[in]     *pColIdx       points to the array of column indices of the nonzero elements.
+   * @param[in]     *pData	       points to the array of nonzero elements.
+   * @return        none
+   */
+
+  void arm_mat_csr_init_f32(
+			arm_matrix_instance_csr_f32 * S,
+			uint16_t nRows,
+			uint16_t nColumns,
+			const uint16_t * pRowPtr,
+			const uint16_t * pColIdx,
+			float32_t * pData);
+
+  /**
+   * @brief Floating-point sparse CSR matrix multiplication.
+   * @param[in]  *pSrcA points to the first input sparse matrix structure.
+   * @param[in]  *pSrcB points to the second input matrix structure.
+   * @param[out] *pDst points to the output matrix structure, which must not be pSrcB.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_csr_mult_f32(
+				const arm_matrix_instance_csr_f32 * pSrcA,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point sparse CSR matrix vector multiplication.
+   * @param[in]  *pSrcA points to the input sparse matrix structure.
+   * @param[in]  *pVec points to the input vector of numCols values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_csr_vec_mult_f32(
+				const arm_matrix_instance_csr_f32 * pSrcA,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief  Floating-point diagonal matrix initialization.
+   * @param[in,out] *S             points to an instance of the diagonal matrix structure.
+   * @param[in]     nRows          number of rows and columns of the matrix.
+   * @param[in]     *pData	       points to the array of nRows diagonal elements.
+   * @return        none
+   */
+
+  void arm_mat_diag_init_f32(
+			arm_matrix_instance_diag_f32 * S,
+			uint16_t nRows,
+			float32_t * pData);
+
+  /**
+   * @brief Floating-point diagonal matrix multiplication.
+   * @param[in]  *pSrcD points to the input diagonal matrix structure.
+   * @param[in]  *pSrcB points to the second input matrix structure.
+   * @param[out] *pDst points to the output matrix structure of pSrcD * pSrcB, which may be pSrcB.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_diag_mult_f32(
+				const arm_matrix_instance_diag_f32 * pSrcD,
+				const arm_matrix_instance_f32 * pSrcB,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point multiplication by a diagonal matrix.
+   * @param[in]  *pSrcA points to the first input matrix structure.
+   * @param[in]  *pSrcD points to the input diagonal matrix structure.
+   * @param[out] *pDst points to the output matrix structure of pSrcA * pSrcD, which may be pSrcA.
+   * @return The function returns either ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_diag_f32(
+				const arm_matrix_instance_f32 * pSrcA,
+				const arm_matrix_instance_diag_f32 * pSrcD,
+				arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point diagonal matrix vector multiplication.
+   * @param[in]  *pSrcD points to the input diagonal matrix structure.
+   * @param[in]  *pVec points to the input vector of numRows values.
+   * @param[out] *pDst points to the output vector of numRows values, which may be pVec.
+   * @return none.
+   */
+
+  void arm_mat_diag_vec_mult_f32(
+				const arm_matrix_instance_diag_f32 * pSrcD,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Floating-point matrix and vector multiplication.
+   * @param[in]  *pSrcMat points to the input matrix structure.
+   * @param[in]  *pVec points to the input vector of numCols values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_f32(
+				const arm_matrix_instance_f32 * pSrcMat,
+				const float32_t * pVec,
+				float32_t * pDst);
+
+  /**
+   * @brief Q31 matrix and vector multiplication.
+   * @param[in]  *pSrcMat points to the input matrix structure.
+   * @param[in]  *pVec points to the input vector of numCols values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q31(
+				const arm_matrix_instance_q31 * pSrcMat,
+				const q31_t * pVec,
+				q31_t * pDst);
+
+  /**
+   * @brief Q15 matrix and vector multiplication.
+   * @param[in]  *pSrcMat points to the input matrix structure.
+   * @param[in]  *pVec points to the input vector of numCols values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q15(
+				const arm_matrix_instance_q15 * pSrcMat,
+				const q15_t * pVec,
+				q15_t * pDst);
+
+  /**
+   * @brief Q7 matrix and vector multiplication.
+   * @param[in]  *pSrcMat points to the input matrix structure.
+   * @param[in]  *pVec points to the input vector of numCols values.
+   * @param[out] *pDst points to the output vector of numRows values, which must not overlap pVec.
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_q7(
+				const arm_matrix_instance_q7 * pSrcMat,
+				const q7_t * pVec,
+				q7_t * pDst);
+
   
  
   /**
@@ -5652,20 +7528,305 @@ extern "C"
   q15_t arm_cos_q15(
 		     q15_t x);
 
+  /**
+   * @brief  Vector sine for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
 
   /**
-   * @ingroup groupFastMath
+   * @brief  Vector cosine for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
    */
 
+  void arm_vcos_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
 
   /**
-   * @defgroup SQRT Square Root
-   *
-   * Computes the square root of a number.
-   * There are separate functions for Q15, Q31, and floating-point data types.  
-   * The square root function is computed using the Newton-Raphson algorithm.
-   * This is an iterative algorithm of the form:
-   * <pre>
+   * @brief  Vector sine and cosine for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pSinVal points to the output buffer of the sines
+   * @param[out] *pCosVal points to the output buffer of the cosines
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_cos_f32(
+			float32_t * pSrc,
+			float32_t * pSinVal,
+			float32_t * pCosVal,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector exponential for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vexp_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector natural logarithm for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vlog_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector four-quadrant arc tangent for floating-point data.
+   * @param[in]  *pSrcY points to the input buffer of the ordinates
+   * @param[in]  *pSrcX points to the input buffer of the abscissas
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vatan2_f32(
+			float32_t * pSrcY,
+			float32_t * pSrcX,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector hyperbolic tangent for floating-point data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vtanh_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector sine for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector cosine for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vcos_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector sine and cosine for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pSinVal points to the output buffer of the sines
+   * @param[out] *pCosVal points to the output buffer of the cosines
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_cos_q31(
+			q31_t * pSrc,
+			q31_t * pSinVal,
+			q31_t * pCosVal,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector exponential for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vexp_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector natural logarithm for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vlog_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector four-quadrant arc tangent for Q31 data.
+   * @param[in]  *pSrcY points to the input buffer of the ordinates
+   * @param[in]  *pSrcX points to the input buffer of the abscissas
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vatan2_q31(
+			q31_t * pSrcY,
+			q31_t * pSrcX,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector hyperbolic tangent for Q31 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vtanh_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector sine for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector cosine for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vcos_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector sine and cosine for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pSinVal points to the output buffer of the sines
+   * @param[out] *pCosVal points to the output buffer of the cosines
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsin_cos_q15(
+			q15_t * pSrc,
+			q15_t * pSinVal,
+			q15_t * pCosVal,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector exponential for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vexp_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector natural logarithm for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vlog_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector four-quadrant arc tangent for Q15 data.
+   * @param[in]  *pSrcY points to the input buffer of the ordinates
+   * @param[in]  *pSrcX points to the input buffer of the abscissas
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vatan2_q15(
+			q15_t * pSrcY,
+			q15_t * pSrcX,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Vector hyperbolic tangent for Q15 data.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vtanh_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+
+  /**
+   * @ingroup groupFastMath
+   */
+
+
+  /**
+   * @defgroup SQRT Square Root
+   *
+   * Computes the square root of a number.
+   * There are separate functions for Q15, Q31, and floating-point data types.  
+   * The square root function is computed using the Newton-Raphson algorithm.
+   * This is an iterative algorithm of the form:
+   * <pre>
    *      x1 = x0 - f(x0)/f'(x0)
    * </pre>
    * where <code>x1</code> is the current estimate,
@@ -5676,6 +7837,19 @@ extern "C"
    *     x0 = in/2                         [initial guess]
    *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
    * </pre>
+   *
+   * The block functions arm_vsqrt_f32(), arm_vsqrt_q31(), arm_vsqrt_q15() and the reciprocal
+   * square roots arm_vrsqrt_f32(), arm_vrsqrt_q31(), arm_vrsqrt_q15() avoid the divisions.
+   * The fixed-point versions normalize the input to <code>u</code> in [0.25 1), take a quadratic
+   * estimate of <code>h = 1/(2*sqrt(u))</code> and refine it with a fixed number of
+   * Newton-Raphson iterations, which only multiply:
+   * <pre>
+   *     h1 = h0 * (1.5 - 2 * u * h0^2)
+   * </pre>
+   * The square root is then <code>2 * u * h</code>, corrected to the exact truncated result.
+   * The floating-point square root uses the square root instruction of the floating-point unit,
+   * and the floating-point reciprocal square root refines an estimate taken from the bit
+   * pattern of the input.
    */
 
 
@@ -5736,6 +7910,88 @@ extern "C"
   arm_status arm_sqrt_q15(
 		      q15_t in, q15_t *pOut);
 
+  /**
+   * @brief  Floating-point vector square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsqrt_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 vector square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsqrt_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q15 vector square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vsqrt_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector reciprocal square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vrsqrt_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 vector reciprocal square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer of mantissas in 1.31 format
+   * @param[out] *pShift points to the output buffer of shifts
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vrsqrt_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint8_t * pShift,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q15 vector reciprocal square root.
+   * @param[in]  *pSrc points to the input buffer
+   * @param[out] *pDst points to the output buffer of mantissas in 1.15 format
+   * @param[out] *pShift points to the output buffer of shifts
+   * @param[in]  blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void arm_vrsqrt_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint8_t * pShift,
+			uint32_t blockSize);
+
   /**
    * @} end of SQRT group
    */
@@ -5806,12 +8062,13 @@ extern "C"
 					    uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5824,7 +8081,7 @@ extern "C"
 	/* Update the input pointer */
 	dst += dstInc;
 
-	if(dst == (int32_t *) dst_end)
+	if(dst == dst_end)
 	  {
 	    dst = dst_base;
 	  }
@@ -5906,13 +8163,14 @@ extern "C"
 					    uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5925,7 +8183,7 @@ extern "C"
 	/* Update the input pointer */
 	dst += dstInc;
 
-	if(dst == (q15_t *) dst_end)
+	if(dst == dst_end)
 	  {
 	    dst = dst_base;
 	  }
@@ -6008,13 +8266,14 @@ extern "C"
 					   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6027,7 +8286,7 @@ extern "C"
 	/* Update the input pointer */
 	dst += dstInc;
 
-	if(dst == (q7_t *) dst_end)
+	if(dst == dst_end)
 	  {
 	    dst = dst_base;
 	  }
@@ -6306,6 +8565,84 @@ extern "C"
 			 q15_t * pDst,
 			 uint32_t numSamples);
 
+  /**
+   * @brief  Floating-point fast approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_f32(
+			  float32_t * pSrc,
+			 float32_t * pDst,
+			 uint32_t numSamples);
+
+  /**
+   * @brief  Q31 fast approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q31(
+			  q31_t * pSrc,
+			 q31_t * pDst,
+			 uint32_t numSamples);
+
+  /**
+   * @brief  Q15 fast approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q15(
+			  q15_t * pSrc,
+			 q15_t * pDst,
+			 uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex power in decibels
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_db_f32(
+			  float32_t * pSrc,
+			 float32_t * pDst,
+			 uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex power in decibels
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_db_q31(
+			  q31_t * pSrc,
+			 q31_t * pDst,
+			 uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex power in decibels
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_db_q15(
+			  q15_t * pSrc,
+			 q15_t * pDst,
+			 uint32_t numSamples);
+
   /**
    * @brief  Q15 complex dot product
    * @param[in]  *pSrcA points to the first input vector
@@ -6521,6 +8858,721 @@ extern "C"
 		   float32_t * pResult,
 		   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point streaming statistics.
+   */
+
+  typedef struct
+  {
+    uint32_t count;           /**< number of samples accumulated. */
+    float32_t mean;           /**< mean of the samples. */
+    float32_t m2;             /**< sum of the squared deviations of the samples from their mean. */
+    float32_t sumSq;          /**< sum of the squares of the samples. */
+    float32_t min;            /**< minimum of the samples. */
+    float32_t max;            /**< maximum of the samples. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 streaming statistics.
+   */
+
+  typedef struct
+  {
+    uint32_t count;           /**< number of samples accumulated. */
+    q63_t sum;                /**< sum of the samples in 33.31 format. */
+    q63_t sumSq;              /**< sum of the squares of the samples in 33.31 format. */
+    q31_t min;                /**< minimum of the samples. */
+    q31_t max;                /**< maximum of the samples. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 streaming statistics.
+   */
+
+  typedef struct
+  {
+    uint32_t count;           /**< number of samples accumulated. */
+    q63_t sum;                /**< sum of the samples in 49.15 format. */
+    q63_t sumSq;              /**< sum of the squares of the samples in 34.30 format. */
+    q15_t min;                /**< minimum of the samples. */
+    q15_t max;                /**< maximum of the samples. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_instance_q15;
+
+  /**
+   * @brief Floating-point streaming statistics results.
+   */
+
+  typedef struct
+  {
+    float32_t mean;           /**< mean, as arm_mean_f32(). */
+    float32_t var;            /**< variance, as arm_var_f32(). */
+    float32_t std;            /**< standard deviation, as arm_std_f32(). */
+    float32_t rms;            /**< root mean square, as arm_rms_f32(). */
+    float32_t power;          /**< sum of squares, as arm_power_f32(). */
+    float32_t min;            /**< minimum value. */
+    float32_t max;            /**< maximum value. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Q31 streaming statistics results.
+   */
+
+  typedef struct
+  {
+    q31_t mean;               /**< mean in 1.31 format. */
+    q63_t var;                /**< variance in 1.31 format, as arm_var_q31(). */
+    q31_t std;                /**< standard deviation in 1.31 format. */
+    q31_t rms;                /**< root mean square in 1.31 format. */
+    q63_t power;              /**< sum of squares in 33.31 format. */
+    q31_t min;                /**< minimum value. */
+    q31_t max;                /**< maximum value. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Q15 streaming statistics results.
+   */
+
+  typedef struct
+  {
+    q15_t mean;               /**< mean in 1.15 format. */
+    q31_t var;                /**< variance in 1.15 format, as arm_var_q15(). */
+    q15_t std;                /**< standard deviation in 1.15 format. */
+    q15_t rms;                /**< root mean square in 1.15 format. */
+    q63_t power;              /**< sum of squares in 34.30 format, as arm_power_q15(). */
+    q15_t min;                /**< minimum value. */
+    q15_t max;                /**< maximum value. */
+    uint32_t minIndex;        /**< index of the minimum in the stream. */
+    uint32_t maxIndex;        /**< index of the maximum in the stream. */
+  } arm_stats_result_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point streaming statistics.
+   * @param[out] *S points to an instance of the floating-point streaming statistics structure.
+   * @return     none.
+   */
+
+  void arm_stats_init_f32(
+			arm_stats_instance_f32 * S);
+
+  /**
+   * @brief  Accumulates a block of samples in the floating-point streaming statistics.
+   * @param[in,out] *S points to an instance of the floating-point streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_stats_update_f32(
+			arm_stats_instance_f32 * S,
+			float32_t * pSrc,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Merges two floating-point streaming statistics accumulators.
+   * @param[in,out] *S points to the accumulator that receives the merged statistics.
+   * @param[in]     *S2 points to the accumulator of the samples that follow those of S.
+   * @return        none.
+   */
+
+  void arm_stats_merge_f32(
+			arm_stats_instance_f32 * S,
+			const arm_stats_instance_f32 * S2);
+
+  /**
+   * @brief  Computes the floating-point streaming statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the floating-point streaming statistics structure.
+   * @param[out] *pResult points to the structure that receives the statistics.
+   * @return     none.
+   */
+
+  void arm_stats_get_f32(
+			const arm_stats_instance_f32 * S,
+			arm_stats_result_f32 * pResult);
+
+  /**
+   * @brief  Initialization function for the Q31 streaming statistics.
+   * @param[out] *S points to an instance of the Q31 streaming statistics structure.
+   * @return     none.
+   */
+
+  void arm_stats_init_q31(
+			arm_stats_instance_q31 * S);
+
+  /**
+   * @brief  Accumulates a block of samples in the Q31 streaming statistics.
+   * @param[in,out] *S points to an instance of the Q31 streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_stats_update_q31(
+			arm_stats_instance_q31 * S,
+			q31_t * pSrc,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Merges two Q31 streaming statistics accumulators.
+   * @param[in,out] *S points to the accumulator that receives the merged statistics.
+   * @param[in]     *S2 points to the accumulator of the samples that follow those of S.
+   * @return        none.
+   */
+
+  void arm_stats_merge_q31(
+			arm_stats_instance_q31 * S,
+			const arm_stats_instance_q31 * S2);
+
+  /**
+   * @brief  Computes the Q31 streaming statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the Q31 streaming statistics structure.
+   * @param[out] *pResult points to the structure that receives the statistics.
+   * @return     none.
+   */
+
+  void arm_stats_get_q31(
+			const arm_stats_instance_q31 * S,
+			arm_stats_result_q31 * pResult);
+
+  /**
+   * @brief  Initialization function for the Q15 streaming statistics.
+   * @param[out] *S points to an instance of the Q15 streaming statistics structure.
+   * @return     none.
+   */
+
+  void arm_stats_init_q15(
+			arm_stats_instance_q15 * S);
+
+  /**
+   * @brief  Accumulates a block of samples in the Q15 streaming statistics.
+   * @param[in,out] *S points to an instance of the Q15 streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_stats_update_q15(
+			arm_stats_instance_q15 * S,
+			q15_t * pSrc,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Merges two Q15 streaming statistics accumulators.
+   * @param[in,out] *S points to the accumulator that receives the merged statistics.
+   * @param[in]     *S2 points to the accumulator of the samples that follow those of S.
+   * @return        none.
+   */
+
+  void arm_stats_merge_q15(
+			arm_stats_instance_q15 * S,
+			const arm_stats_instance_q15 * S2);
+
+  /**
+   * @brief  Computes the Q15 streaming statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the Q15 streaming statistics structure.
+   * @param[out] *pResult points to the structure that receives the statistics.
+   * @return     none.
+   */
+
+  void arm_stats_get_q15(
+			const arm_stats_instance_q15 * S,
+			arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding window minimum and maximum.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t head;            /**< position of the front of the queue in the ring buffers. */
+    uint16_t count;           /**< number of candidates in the queue. */
+    uint32_t sampleIndex;     /**< index in the stream of the next sample. */
+    float32_t *pValues;       /**< points to the ring buffer of windowLength candidate values. */
+    uint32_t *pIndices;       /**< points to the ring buffer of windowLength candidate indices. */
+  } arm_moving_minmax_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point moving average and moving RMS.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< position of the oldest sample in the state buffer. */
+    float32_t *pState;        /**< points to the state buffer of windowLength samples. */
+    float32_t sum;            /**< sum of the samples, or of their squares, in the window. */
+  } arm_moving_average_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding window minimum and maximum.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t head;            /**< position of the front of the queue in the ring buffers. */
+    uint16_t count;           /**< number of candidates in the queue. */
+    uint32_t sampleIndex;     /**< index in the stream of the next sample. */
+    q31_t *pValues;           /**< points to the ring buffer of windowLength candidate values. */
+    uint32_t *pIndices;       /**< points to the ring buffer of windowLength candidate indices. */
+  } arm_moving_minmax_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q31 moving average and moving RMS.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< position of the oldest sample in the state buffer. */
+    q31_t *pState;            /**< points to the state buffer of windowLength samples. */
+    q63_t sum;                /**< sum of the samples in 33.31 format, or of their squares in 33.31 format. */
+    q31_t recip;              /**< reciprocal of windowLength in 2.30 format, scaled by 2^shift. */
+    uint8_t shift;            /**< shift of the reciprocal. */
+  } arm_moving_average_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding window minimum and maximum.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t head;            /**< position of the front of the queue in the ring buffers. */
+    uint16_t count;           /**< number of candidates in the queue. */
+    uint32_t sampleIndex;     /**< index in the stream of the next sample. */
+    q15_t *pValues;           /**< points to the ring buffer of windowLength candidate values. */
+    uint32_t *pIndices;       /**< points to the ring buffer of windowLength candidate indices. */
+  } arm_moving_minmax_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q15 moving average and moving RMS.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< position of the oldest sample in the state buffer. */
+    q15_t *pState;            /**< points to the state buffer of windowLength samples. */
+    q63_t sum;                /**< sum of the samples in 49.15 format, or of their squares in 34.30 format. */
+    q31_t recip;              /**< reciprocal of windowLength in 2.30 format, scaled by 2^shift. */
+    uint8_t shift;            /**< shift of the reciprocal. */
+  } arm_moving_average_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sliding window minimum and maximum.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t head;            /**< position of the front of the queue in the ring buffers. */
+    uint16_t count;           /**< number of candidates in the queue. */
+    uint32_t sampleIndex;     /**< index in the stream of the next sample. */
+    q7_t *pValues;            /**< points to the ring buffer of windowLength candidate values. */
+    uint32_t *pIndices;       /**< points to the ring buffer of windowLength candidate indices. */
+  } arm_moving_minmax_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q7 moving average and moving RMS.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;    /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< position of the oldest sample in the state buffer. */
+    q7_t *pState;             /**< points to the state buffer of windowLength samples. */
+    q31_t sum;                /**< sum of the samples in 25.7 format, or of their squares in 18.14 format. */
+    q31_t recip;              /**< reciprocal of windowLength in 2.30 format, scaled by 2^shift. */
+    uint8_t shift;            /**< shift of the reciprocal. */
+  } arm_moving_average_instance_q7;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window minimum and maximum.
+   * @param[out] *S points to an instance of the floating-point sliding window structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pValues points to the buffer of windowLength candidate values.
+   * @param[in]  *pIndices points to the buffer of windowLength candidate indices.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_minmax_init_f32(
+			arm_moving_minmax_instance_f32 * S,
+			uint16_t windowLength,
+			float32_t * pValues,
+			uint32_t * pIndices);
+
+  /**
+   * @brief  Floating-point sliding window maximum.
+   * @param[in,out] *S points to an instance of the floating-point sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of maximums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the maximums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_max_f32(
+			arm_moving_minmax_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point sliding window minimum.
+   * @param[in,out] *S points to an instance of the floating-point sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of minimums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the minimums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_min_f32(
+			arm_moving_minmax_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window minimum and maximum.
+   * @param[out] *S points to an instance of the Q31 sliding window structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pValues points to the buffer of windowLength candidate values.
+   * @param[in]  *pIndices points to the buffer of windowLength candidate indices.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_minmax_init_q31(
+			arm_moving_minmax_instance_q31 * S,
+			uint16_t windowLength,
+			q31_t * pValues,
+			uint32_t * pIndices);
+
+  /**
+   * @brief  Q31 sliding window maximum.
+   * @param[in,out] *S points to an instance of the Q31 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of maximums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the maximums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_max_q31(
+			arm_moving_minmax_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 sliding window minimum.
+   * @param[in,out] *S points to an instance of the Q31 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of minimums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the minimums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_min_q31(
+			arm_moving_minmax_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window minimum and maximum.
+   * @param[out] *S points to an instance of the Q15 sliding window structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pValues points to the buffer of windowLength candidate values.
+   * @param[in]  *pIndices points to the buffer of windowLength candidate indices.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_minmax_init_q15(
+			arm_moving_minmax_instance_q15 * S,
+			uint16_t windowLength,
+			q15_t * pValues,
+			uint32_t * pIndices);
+
+  /**
+   * @brief  Q15 sliding window maximum.
+   * @param[in,out] *S points to an instance of the Q15 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of maximums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the maximums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_max_q15(
+			arm_moving_minmax_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q15 sliding window minimum.
+   * @param[in,out] *S points to an instance of the Q15 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of minimums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the minimums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_min_q15(
+			arm_moving_minmax_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 sliding window minimum and maximum.
+   * @param[out] *S points to an instance of the Q7 sliding window structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pValues points to the buffer of windowLength candidate values.
+   * @param[in]  *pIndices points to the buffer of windowLength candidate indices.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_minmax_init_q7(
+			arm_moving_minmax_instance_q7 * S,
+			uint16_t windowLength,
+			q7_t * pValues,
+			uint32_t * pIndices);
+
+  /**
+   * @brief  Q7 sliding window maximum.
+   * @param[in,out] *S points to an instance of the Q7 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of maximums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the maximums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_max_q7(
+			arm_moving_minmax_instance_q7 * S,
+			q7_t * pSrc,
+			q7_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q7 sliding window minimum.
+   * @param[in,out] *S points to an instance of the Q7 sliding window structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of minimums of the windows ending at each input sample.
+   * @param[out]    *pIndex points to the block of stream indices of the minimums, or is NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_min_q7(
+			arm_moving_minmax_instance_q7 * S,
+			q7_t * pSrc,
+			q7_t * pDst,
+			uint32_t * pIndex,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point moving average and moving RMS.
+   * @param[out] *S points to an instance of the floating-point moving average structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pState points to the state buffer of windowLength samples.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_average_init_f32(
+			arm_moving_average_instance_f32 * S,
+			uint16_t windowLength,
+			float32_t * pState);
+
+  /**
+   * @brief  Floating-point moving average.
+   * @param[in,out] *S points to an instance of the floating-point moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_average_f32(
+			arm_moving_average_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point moving RMS.
+   * @param[in,out] *S points to an instance of the floating-point moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_rms_f32(
+			arm_moving_average_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 moving average and moving RMS.
+   * @param[out] *S points to an instance of the Q31 moving average structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pState points to the state buffer of windowLength samples.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_average_init_q31(
+			arm_moving_average_instance_q31 * S,
+			uint16_t windowLength,
+			q31_t * pState);
+
+  /**
+   * @brief  Q31 moving average.
+   * @param[in,out] *S points to an instance of the Q31 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_average_q31(
+			arm_moving_average_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 moving RMS.
+   * @param[in,out] *S points to an instance of the Q31 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_rms_q31(
+			arm_moving_average_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 moving average and moving RMS.
+   * @param[out] *S points to an instance of the Q15 moving average structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pState points to the state buffer of windowLength samples.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_average_init_q15(
+			arm_moving_average_instance_q15 * S,
+			uint16_t windowLength,
+			q15_t * pState);
+
+  /**
+   * @brief  Q15 moving average.
+   * @param[in,out] *S points to an instance of the Q15 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_average_q15(
+			arm_moving_average_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q15 moving RMS.
+   * @param[in,out] *S points to an instance of the Q15 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_rms_q15(
+			arm_moving_average_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 moving average and moving RMS.
+   * @param[out] *S points to an instance of the Q7 moving average structure.
+   * @param[in]  windowLength number of samples in the window.
+   * @param[in]  *pState points to the state buffer of windowLength samples.
+   * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowLength is zero
+   * and ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_moving_average_init_q7(
+			arm_moving_average_instance_q7 * S,
+			uint16_t windowLength,
+			q7_t * pState);
+
+  /**
+   * @brief  Q7 moving average.
+   * @param[in,out] *S points to an instance of the Q7 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of means of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_average_q7(
+			arm_moving_average_instance_q7 * S,
+			q7_t * pSrc,
+			q7_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q7 moving RMS.
+   * @param[in,out] *S points to an instance of the Q7 moving average structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of RMS values of the windows ending at each input sample.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+
+  void arm_moving_rms_q7(
+			arm_moving_average_instance_q7 * S,
+			q7_t * pSrc,
+			q7_t * pDst,
+			uint32_t blockSize);
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  *pSrcA points to the first input vector
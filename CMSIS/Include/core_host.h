@@ -0,0 +1,734 @@
+/**************************************************************************//**
+ * @file     core_host.h
+ * @brief    CMSIS Host (non Cortex-M) Core Instruction and SIMD Header File
+ * @version  V2.10
+ * @date     17. October 2026
+ *
+ * @note
+ * Copyright (C) 2010-2011 ARM Limited. All rights reserved.
+ *
+ * @par
+ * This file provides portable C implementations of the Cortex-M core
+ * instruction intrinsics (core_cmInstr.h) and the Cortex-M4 SIMD intrinsics
+ * (core_cm4_simd.h) so that the CMSIS DSP Library can be built and run on a
+ * host processor (for example x86-64 Linux).  Every function returns the
+ * same bit pattern as the corresponding Cortex-M4 instruction.
+ *
+ * @par
+ * The sticky Q flag is not modelled.  The GE flags are modelled per
+ * translation unit so that __SEL observes the result of the preceding
+ * GE-setting instruction in the same way as on the target.
+ *
+ * @par
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * ARM SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL, OR
+ * CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ ******************************************************************************/
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#ifndef __CORE_HOST_H
+#define __CORE_HOST_H
+
+#include <stdint.h>                      /*!< standard types definitions                      */
+
+
+/*******************************************************************************
+ *                 CMSIS definitions
+ ******************************************************************************/
+/** \defgroup CMSIS_host_definitions CMSIS Host Definitions
+  Core definitions used when the library is built for a host processor.
+  @{
+ */
+
+#define __CORTEX_M                (0x04)    /*!< Cortex-M4 instruction semantics are emulated */
+
+#define __ASM            __asm              /*!< asm keyword for host compiler         */
+#define __INLINE         inline             /*!< inline keyword for host compiler      */
+
+#define __FPU_USED       0                  /*!< no Cortex-M FPU; the host C library is used */
+
+/*@} end of group CMSIS_host_definitions */
+
+
+/* ##########################  Core Instruction Access  ######################### */
+/** \defgroup CMSIS_host_InstructionInterface CMSIS Host Instruction Interface
+  Portable C implementation of the Cortex-M core instructions
+  @{
+*/
+
+/** \brief  No Operation
+ */
+static __INLINE void __NOP(void)
+{
+}
+
+
+/** \brief  Instruction Synchronization Barrier
+
+    On the host this only prevents the compiler from reordering memory accesses.
+ */
+static __INLINE void __ISB(void)
+{
+#if defined ( __GNUC__ )
+  __ASM volatile ("" : : : "memory");
+#endif
+}
+
+
+/** \brief  Data Synchronization Barrier
+
+    On the host this only prevents the compiler from reordering memory accesses.
+ */
+static __INLINE void __DSB(void)
+{
+#if defined ( __GNUC__ )
+  __ASM volatile ("" : : : "memory");
+#endif
+}
+
+
+/** \brief  Data Memory Barrier
+
+    On the host this only prevents the compiler from reordering memory accesses.
+ */
+static __INLINE void __DMB(void)
+{
+#if defined ( __GNUC__ )
+  __ASM volatile ("" : : : "memory");
+#endif
+}
+
+
+/** \brief  Reverse byte order (32 bit)
+
+    \param [in]    value  Value to reverse
+    \return               Reversed value
+ */
+static __INLINE uint32_t __REV(uint32_t value)
+{
+  return ((value >> 24)               ) |
+         ((value >>  8) & 0x0000FF00UL) |
+         ((value <<  8) & 0x00FF0000UL) |
+         ((value << 24)               );
+}
+
+
+/** \brief  Reverse byte order (16 bit)
+
+    This function reverses the byte order in two unsigned short values.
+
+    \param [in]    value  Value to reverse
+    \return               Reversed value
+ */
+static __INLINE uint32_t __REV16(uint32_t value)
+{
+  return ((value >> 8) & 0x00FF00FFUL) |
+         ((value << 8) & 0xFF00FF00UL);
+}
+
+
+/** \brief  Reverse byte order in signed short value
+
+    This function reverses the byte order in a signed short value with sign extension to integer.
+
+    \param [in]    value  Value to reverse
+    \return               Reversed value
+ */
+static __INLINE int32_t __REVSH(int32_t value)
+{
+  return (int32_t) (int16_t) (((value >> 8) & 0x00FF) | ((value << 8) & 0xFF00));
+}
+
+
+/** \brief  Reverse bit order of value
+
+    \param [in]    value  Value to reverse
+    \return               Reversed value
+ */
+static __INLINE uint32_t __RBIT(uint32_t value)
+{
+  value = ((value >> 1) & 0x55555555UL) | ((value & 0x55555555UL) << 1);
+  value = ((value >> 2) & 0x33333333UL) | ((value & 0x33333333UL) << 2);
+  value = ((value >> 4) & 0x0F0F0F0FUL) | ((value & 0x0F0F0F0FUL) << 4);
+
+  return __REV(value);
+}
+
+
+/** \brief  Signed Saturate
+
+    This function saturates a signed value.
+
+    \param [in]  value  Value to be saturated
+    \param [in]    sat  Bit position to saturate to (1..32)
+    \return             Saturated value
+ */
+static __INLINE int32_t __SSAT(int32_t value, uint32_t sat)
+{
+  int64_t max = ((int64_t) 1 << (sat - 1u)) - 1;
+  int64_t min = -((int64_t) 1 << (sat - 1u));
+
+  return (int32_t) ((value > max) ? max : ((value < min) ? min : value));
+}
+
+
+/** \brief  Unsigned Saturate
+
+    This function saturates a signed value to an unsigned range.
+
+    \param [in]  value  Value to be saturated
+    \param [in]    sat  Bit position to saturate to (0..31)
+    \return             Saturated value
+ */
+static __INLINE uint32_t __USAT(int32_t value, uint32_t sat)
+{
+  int64_t max = ((int64_t) 1 << sat) - 1;
+
+  return (uint32_t) ((value > max) ? max : ((value < 0) ? 0 : value));
+}
+
+
+/** \brief  Count leading zeros
+
+    This function counts the number of leading zeros of a data value.
+
+    \param [in]  value  Value to count the leading zeros
+    \return             number of leading zeros in value
+ */
+static __INLINE uint8_t __CLZ(uint32_t value)
+{
+#if defined ( __GNUC__ )
+  return (value == 0u) ? 32u : (uint8_t) __builtin_clz(value);
+#else
+  uint8_t count = 0u;
+
+  if(value == 0u)
+  {
+    return 32u;
+  }
+
+  while((value & 0x80000000UL) == 0u)
+  {
+    count++;
+    value <<= 1u;
+  }
+
+  return count;
+#endif
+}
+
+/*@}*/ /* end of group CMSIS_host_InstructionInterface */
+
+
+/* ###################  SIMD Intrinsics  ########################### */
+/** \defgroup CMSIS_host_SIMD_intrinsics CMSIS Host SIMD Intrinsics
+  Portable C implementation of the Cortex-M4 SIMD instructions
+  @{
+*/
+
+/* APSR.GE bits as left by the last GE-setting instruction in this translation unit */
+static uint32_t __host_ge;
+
+/* lane access helpers */
+#define __HOST_S8(x, n)    ((int32_t) (int8_t) ((uint32_t) (x) >> (8 * (n))))
+#define __HOST_U8(x, n)    ((int32_t) (uint8_t) ((uint32_t) (x) >> (8 * (n))))
+#define __HOST_S16(x, n)   ((int32_t) (int16_t) ((uint32_t) (x) >> (16 * (n))))
+#define __HOST_U16(x, n)   ((int32_t) (uint16_t) ((uint32_t) (x) >> (16 * (n))))
+
+static __INLINE uint32_t __host_pack8(int32_t b0, int32_t b1, int32_t b2, int32_t b3)
+{
+  return ((uint32_t) b0 & 0xFFu) | (((uint32_t) b1 & 0xFFu) << 8) |
+         (((uint32_t) b2 & 0xFFu) << 16) | (((uint32_t) b3 & 0xFFu) << 24);
+}
+
+static __INLINE uint32_t __host_pack16(int32_t h0, int32_t h1)
+{
+  return ((uint32_t) h0 & 0xFFFFu) | (((uint32_t) h1 & 0xFFFFu) << 16);
+}
+
+static __INLINE int32_t __host_sat(int32_t x, int32_t min, int32_t max)
+{
+  return (x > max) ? max : ((x < min) ? min : x);
+}
+
+/* set the GE bits of one 8-bit lane / both bits of one 16-bit lane */
+static __INLINE uint32_t __host_ge8(int32_t cond, uint32_t n)
+{
+  return cond ? (1u << n) : 0u;
+}
+
+static __INLINE uint32_t __host_ge16(int32_t cond, uint32_t n)
+{
+  return cond ? (3u << (2u * n)) : 0u;
+}
+
+
+/*------ 8-bit parallel add / subtract -------------------------------------------*/
+static __INLINE uint32_t __SADD8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S8(op1, 0) + __HOST_S8(op2, 0);
+  int32_t r1 = __HOST_S8(op1, 1) + __HOST_S8(op2, 1);
+  int32_t r2 = __HOST_S8(op1, 2) + __HOST_S8(op2, 2);
+  int32_t r3 = __HOST_S8(op1, 3) + __HOST_S8(op2, 3);
+
+  __host_ge = __host_ge8(r0 >= 0, 0) | __host_ge8(r1 >= 0, 1) |
+              __host_ge8(r2 >= 0, 2) | __host_ge8(r3 >= 0, 3);
+  return __host_pack8(r0, r1, r2, r3);
+}
+
+static __INLINE uint32_t __QADD8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8(__host_sat(__HOST_S8(op1, 0) + __HOST_S8(op2, 0), -128, 127),
+                      __host_sat(__HOST_S8(op1, 1) + __HOST_S8(op2, 1), -128, 127),
+                      __host_sat(__HOST_S8(op1, 2) + __HOST_S8(op2, 2), -128, 127),
+                      __host_sat(__HOST_S8(op1, 3) + __HOST_S8(op2, 3), -128, 127));
+}
+
+static __INLINE uint32_t __SHADD8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8((__HOST_S8(op1, 0) + __HOST_S8(op2, 0)) >> 1,
+                      (__HOST_S8(op1, 1) + __HOST_S8(op2, 1)) >> 1,
+                      (__HOST_S8(op1, 2) + __HOST_S8(op2, 2)) >> 1,
+                      (__HOST_S8(op1, 3) + __HOST_S8(op2, 3)) >> 1);
+}
+
+static __INLINE uint32_t __UADD8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U8(op1, 0) + __HOST_U8(op2, 0);
+  int32_t r1 = __HOST_U8(op1, 1) + __HOST_U8(op2, 1);
+  int32_t r2 = __HOST_U8(op1, 2) + __HOST_U8(op2, 2);
+  int32_t r3 = __HOST_U8(op1, 3) + __HOST_U8(op2, 3);
+
+  __host_ge = __host_ge8(r0 > 0xFF, 0) | __host_ge8(r1 > 0xFF, 1) |
+              __host_ge8(r2 > 0xFF, 2) | __host_ge8(r3 > 0xFF, 3);
+  return __host_pack8(r0, r1, r2, r3);
+}
+
+static __INLINE uint32_t __UQADD8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8(__host_sat(__HOST_U8(op1, 0) + __HOST_U8(op2, 0), 0, 255),
+                      __host_sat(__HOST_U8(op1, 1) + __HOST_U8(op2, 1), 0, 255),
+                      __host_sat(__HOST_U8(op1, 2) + __HOST_U8(op2, 2), 0, 255),
+                      __host_sat(__HOST_U8(op1, 3) + __HOST_U8(op2, 3), 0, 255));
+}
+
+static __INLINE uint32_t __UHADD8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8((__HOST_U8(op1, 0) + __HOST_U8(op2, 0)) >> 1,
+                      (__HOST_U8(op1, 1) + __HOST_U8(op2, 1)) >> 1,
+                      (__HOST_U8(op1, 2) + __HOST_U8(op2, 2)) >> 1,
+                      (__HOST_U8(op1, 3) + __HOST_U8(op2, 3)) >> 1);
+}
+
+static __INLINE uint32_t __SSUB8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S8(op1, 0) - __HOST_S8(op2, 0);
+  int32_t r1 = __HOST_S8(op1, 1) - __HOST_S8(op2, 1);
+  int32_t r2 = __HOST_S8(op1, 2) - __HOST_S8(op2, 2);
+  int32_t r3 = __HOST_S8(op1, 3) - __HOST_S8(op2, 3);
+
+  __host_ge = __host_ge8(r0 >= 0, 0) | __host_ge8(r1 >= 0, 1) |
+              __host_ge8(r2 >= 0, 2) | __host_ge8(r3 >= 0, 3);
+  return __host_pack8(r0, r1, r2, r3);
+}
+
+static __INLINE uint32_t __QSUB8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8(__host_sat(__HOST_S8(op1, 0) - __HOST_S8(op2, 0), -128, 127),
+                      __host_sat(__HOST_S8(op1, 1) - __HOST_S8(op2, 1), -128, 127),
+                      __host_sat(__HOST_S8(op1, 2) - __HOST_S8(op2, 2), -128, 127),
+                      __host_sat(__HOST_S8(op1, 3) - __HOST_S8(op2, 3), -128, 127));
+}
+
+static __INLINE uint32_t __SHSUB8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8((__HOST_S8(op1, 0) - __HOST_S8(op2, 0)) >> 1,
+                      (__HOST_S8(op1, 1) - __HOST_S8(op2, 1)) >> 1,
+                      (__HOST_S8(op1, 2) - __HOST_S8(op2, 2)) >> 1,
+                      (__HOST_S8(op1, 3) - __HOST_S8(op2, 3)) >> 1);
+}
+
+static __INLINE uint32_t __USUB8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U8(op1, 0) - __HOST_U8(op2, 0);
+  int32_t r1 = __HOST_U8(op1, 1) - __HOST_U8(op2, 1);
+  int32_t r2 = __HOST_U8(op1, 2) - __HOST_U8(op2, 2);
+  int32_t r3 = __HOST_U8(op1, 3) - __HOST_U8(op2, 3);
+
+  __host_ge = __host_ge8(r0 >= 0, 0) | __host_ge8(r1 >= 0, 1) |
+              __host_ge8(r2 >= 0, 2) | __host_ge8(r3 >= 0, 3);
+  return __host_pack8(r0, r1, r2, r3);
+}
+
+static __INLINE uint32_t __UQSUB8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8(__host_sat(__HOST_U8(op1, 0) - __HOST_U8(op2, 0), 0, 255),
+                      __host_sat(__HOST_U8(op1, 1) - __HOST_U8(op2, 1), 0, 255),
+                      __host_sat(__HOST_U8(op1, 2) - __HOST_U8(op2, 2), 0, 255),
+                      __host_sat(__HOST_U8(op1, 3) - __HOST_U8(op2, 3), 0, 255));
+}
+
+static __INLINE uint32_t __UHSUB8(uint32_t op1, uint32_t op2)
+{
+  return __host_pack8((__HOST_U8(op1, 0) - __HOST_U8(op2, 0)) >> 1,
+                      (__HOST_U8(op1, 1) - __HOST_U8(op2, 1)) >> 1,
+                      (__HOST_U8(op1, 2) - __HOST_U8(op2, 2)) >> 1,
+                      (__HOST_U8(op1, 3) - __HOST_U8(op2, 3)) >> 1);
+}
+
+
+/*------ 16-bit parallel add / subtract ------------------------------------------*/
+static __INLINE uint32_t __SADD16(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S16(op1, 0) + __HOST_S16(op2, 0);
+  int32_t r1 = __HOST_S16(op1, 1) + __HOST_S16(op2, 1);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __QADD16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_S16(op1, 0) + __HOST_S16(op2, 0), -32768, 32767),
+                       __host_sat(__HOST_S16(op1, 1) + __HOST_S16(op2, 1), -32768, 32767));
+}
+
+static __INLINE uint32_t __SHADD16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_S16(op1, 0) + __HOST_S16(op2, 0)) >> 1,
+                       (__HOST_S16(op1, 1) + __HOST_S16(op2, 1)) >> 1);
+}
+
+static __INLINE uint32_t __UADD16(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U16(op1, 0) + __HOST_U16(op2, 0);
+  int32_t r1 = __HOST_U16(op1, 1) + __HOST_U16(op2, 1);
+
+  __host_ge = __host_ge16(r0 > 0xFFFF, 0) | __host_ge16(r1 > 0xFFFF, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __UQADD16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_U16(op1, 0) + __HOST_U16(op2, 0), 0, 65535),
+                       __host_sat(__HOST_U16(op1, 1) + __HOST_U16(op2, 1), 0, 65535));
+}
+
+static __INLINE uint32_t __UHADD16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_U16(op1, 0) + __HOST_U16(op2, 0)) >> 1,
+                       (__HOST_U16(op1, 1) + __HOST_U16(op2, 1)) >> 1);
+}
+
+static __INLINE uint32_t __SSUB16(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S16(op1, 0) - __HOST_S16(op2, 0);
+  int32_t r1 = __HOST_S16(op1, 1) - __HOST_S16(op2, 1);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __QSUB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_S16(op1, 0) - __HOST_S16(op2, 0), -32768, 32767),
+                       __host_sat(__HOST_S16(op1, 1) - __HOST_S16(op2, 1), -32768, 32767));
+}
+
+static __INLINE uint32_t __SHSUB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_S16(op1, 0) - __HOST_S16(op2, 0)) >> 1,
+                       (__HOST_S16(op1, 1) - __HOST_S16(op2, 1)) >> 1);
+}
+
+static __INLINE uint32_t __USUB16(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U16(op1, 0) - __HOST_U16(op2, 0);
+  int32_t r1 = __HOST_U16(op1, 1) - __HOST_U16(op2, 1);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __UQSUB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_U16(op1, 0) - __HOST_U16(op2, 0), 0, 65535),
+                       __host_sat(__HOST_U16(op1, 1) - __HOST_U16(op2, 1), 0, 65535));
+}
+
+static __INLINE uint32_t __UHSUB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_U16(op1, 0) - __HOST_U16(op2, 0)) >> 1,
+                       (__HOST_U16(op1, 1) - __HOST_U16(op2, 1)) >> 1);
+}
+
+
+/*------ 16-bit add and subtract with exchange -----------------------------------*/
+/* ASX: top = op1.top + op2.bottom, bottom = op1.bottom - op2.top */
+/* SAX: top = op1.top - op2.bottom, bottom = op1.bottom + op2.top */
+static __INLINE uint32_t __SASX(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S16(op1, 0) - __HOST_S16(op2, 1);
+  int32_t r1 = __HOST_S16(op1, 1) + __HOST_S16(op2, 0);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __QASX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_S16(op1, 0) - __HOST_S16(op2, 1), -32768, 32767),
+                       __host_sat(__HOST_S16(op1, 1) + __HOST_S16(op2, 0), -32768, 32767));
+}
+
+static __INLINE uint32_t __SHASX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_S16(op1, 0) - __HOST_S16(op2, 1)) >> 1,
+                       (__HOST_S16(op1, 1) + __HOST_S16(op2, 0)) >> 1);
+}
+
+static __INLINE uint32_t __UASX(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U16(op1, 0) - __HOST_U16(op2, 1);
+  int32_t r1 = __HOST_U16(op1, 1) + __HOST_U16(op2, 0);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 > 0xFFFF, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __UQASX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_U16(op1, 0) - __HOST_U16(op2, 1), 0, 65535),
+                       __host_sat(__HOST_U16(op1, 1) + __HOST_U16(op2, 0), 0, 65535));
+}
+
+static __INLINE uint32_t __UHASX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_U16(op1, 0) - __HOST_U16(op2, 1)) >> 1,
+                       (__HOST_U16(op1, 1) + __HOST_U16(op2, 0)) >> 1);
+}
+
+static __INLINE uint32_t __SSAX(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_S16(op1, 0) + __HOST_S16(op2, 1);
+  int32_t r1 = __HOST_S16(op1, 1) - __HOST_S16(op2, 0);
+
+  __host_ge = __host_ge16(r0 >= 0, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __QSAX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_S16(op1, 0) + __HOST_S16(op2, 1), -32768, 32767),
+                       __host_sat(__HOST_S16(op1, 1) - __HOST_S16(op2, 0), -32768, 32767));
+}
+
+static __INLINE uint32_t __SHSAX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_S16(op1, 0) + __HOST_S16(op2, 1)) >> 1,
+                       (__HOST_S16(op1, 1) - __HOST_S16(op2, 0)) >> 1);
+}
+
+static __INLINE uint32_t __USAX(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_U16(op1, 0) + __HOST_U16(op2, 1);
+  int32_t r1 = __HOST_U16(op1, 1) - __HOST_U16(op2, 0);
+
+  __host_ge = __host_ge16(r0 > 0xFFFF, 0) | __host_ge16(r1 >= 0, 1);
+  return __host_pack16(r0, r1);
+}
+
+static __INLINE uint32_t __UQSAX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__host_sat(__HOST_U16(op1, 0) + __HOST_U16(op2, 1), 0, 65535),
+                       __host_sat(__HOST_U16(op1, 1) - __HOST_U16(op2, 0), 0, 65535));
+}
+
+static __INLINE uint32_t __UHSAX(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16((__HOST_U16(op1, 0) + __HOST_U16(op2, 1)) >> 1,
+                       (__HOST_U16(op1, 1) - __HOST_U16(op2, 0)) >> 1);
+}
+
+
+/*------ sum of absolute differences ---------------------------------------------*/
+static __INLINE uint32_t __USADA8(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  int32_t d0 = __HOST_U8(op1, 0) - __HOST_U8(op2, 0);
+  int32_t d1 = __HOST_U8(op1, 1) - __HOST_U8(op2, 1);
+  int32_t d2 = __HOST_U8(op1, 2) - __HOST_U8(op2, 2);
+  int32_t d3 = __HOST_U8(op1, 3) - __HOST_U8(op2, 3);
+
+  return op3 + (uint32_t) ((d0 < 0 ? -d0 : d0) + (d1 < 0 ? -d1 : d1) +
+                           (d2 < 0 ? -d2 : d2) + (d3 < 0 ? -d3 : d3));
+}
+
+static __INLINE uint32_t __USAD8(uint32_t op1, uint32_t op2)
+{
+  return __USADA8(op1, op2, 0u);
+}
+
+
+/*------ dual 16-bit saturate ----------------------------------------------------*/
+static __INLINE uint32_t __SSAT16(uint32_t op1, uint32_t sat)
+{
+  return __host_pack16(__SSAT(__HOST_S16(op1, 0), sat), __SSAT(__HOST_S16(op1, 1), sat));
+}
+
+static __INLINE uint32_t __USAT16(uint32_t op1, uint32_t sat)
+{
+  return __host_pack16((int32_t) __USAT(__HOST_S16(op1, 0), sat),
+                       (int32_t) __USAT(__HOST_S16(op1, 1), sat));
+}
+
+
+/*------ dual 8-bit to 16-bit extend ---------------------------------------------*/
+static __INLINE uint32_t __UXTB16(uint32_t op1)
+{
+  return op1 & 0x00FF00FFUL;
+}
+
+static __INLINE uint32_t __UXTAB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__HOST_U16(op1, 0) + __HOST_U8(op2, 0),
+                       __HOST_U16(op1, 1) + __HOST_U8(op2, 2));
+}
+
+static __INLINE uint32_t __SXTB16(uint32_t op1)
+{
+  return __host_pack16(__HOST_S8(op1, 0), __HOST_S8(op1, 2));
+}
+
+static __INLINE uint32_t __SXTAB16(uint32_t op1, uint32_t op2)
+{
+  return __host_pack16(__HOST_U16(op1, 0) + __HOST_S8(op2, 0),
+                       __HOST_U16(op1, 1) + __HOST_S8(op2, 2));
+}
+
+
+/*------ dual 16-bit multiply with 32-bit accumulate -----------------------------*/
+/* The 32-bit accumulations wrap modulo 2^32 exactly as on the target.          */
+static __INLINE int32_t __SMUAD(int32_t op1, int32_t op2)
+{
+  return (int32_t) ((uint32_t) (__HOST_S16(op1, 0) * __HOST_S16(op2, 0)) +
+                    (uint32_t) (__HOST_S16(op1, 1) * __HOST_S16(op2, 1)));
+}
+
+static __INLINE int32_t __SMUADX(int32_t op1, int32_t op2)
+{
+  return (int32_t) ((uint32_t) (__HOST_S16(op1, 0) * __HOST_S16(op2, 1)) +
+                    (uint32_t) (__HOST_S16(op1, 1) * __HOST_S16(op2, 0)));
+}
+
+static __INLINE int32_t __SMLAD(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t) ((uint32_t) __SMUAD(op1, op2) + (uint32_t) op3);
+}
+
+static __INLINE int32_t __SMLADX(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t) ((uint32_t) __SMUADX(op1, op2) + (uint32_t) op3);
+}
+
+static __INLINE int32_t __SMUSD(int32_t op1, int32_t op2)
+{
+  return (int32_t) ((uint32_t) (__HOST_S16(op1, 0) * __HOST_S16(op2, 0)) -
+                    (uint32_t) (__HOST_S16(op1, 1) * __HOST_S16(op2, 1)));
+}
+
+static __INLINE int32_t __SMUSDX(int32_t op1, int32_t op2)
+{
+  return (int32_t) ((uint32_t) (__HOST_S16(op1, 0) * __HOST_S16(op2, 1)) -
+                    (uint32_t) (__HOST_S16(op1, 1) * __HOST_S16(op2, 0)));
+}
+
+static __INLINE int32_t __SMLSD(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t) ((uint32_t) __SMUSD(op1, op2) + (uint32_t) op3);
+}
+
+static __INLINE int32_t __SMLSDX(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t) ((uint32_t) __SMUSDX(op1, op2) + (uint32_t) op3);
+}
+
+
+/*------ dual 16-bit multiply with 64-bit accumulate -----------------------------*/
+static __INLINE int64_t __SMLALD(int32_t op1, int32_t op2, int64_t acc)
+{
+  return (int64_t) ((uint64_t) acc +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 0) * __HOST_S16(op2, 0)) +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 1) * __HOST_S16(op2, 1)));
+}
+
+static __INLINE int64_t __SMLALDX(int32_t op1, int32_t op2, int64_t acc)
+{
+  return (int64_t) ((uint64_t) acc +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 0) * __HOST_S16(op2, 1)) +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 1) * __HOST_S16(op2, 0)));
+}
+
+static __INLINE int64_t __SMLSLD(int32_t op1, int32_t op2, int64_t acc)
+{
+  return (int64_t) ((uint64_t) acc +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 0) * __HOST_S16(op2, 0)) -
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 1) * __HOST_S16(op2, 1)));
+}
+
+static __INLINE int64_t __SMLSLDX(int32_t op1, int32_t op2, int64_t acc)
+{
+  return (int64_t) ((uint64_t) acc +
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 0) * __HOST_S16(op2, 1)) -
+                    (uint64_t) ((int64_t) __HOST_S16(op1, 1) * __HOST_S16(op2, 0)));
+}
+
+
+/*------ select bytes on GE flags ------------------------------------------------*/
+static __INLINE uint32_t __SEL(uint32_t op1, uint32_t op2)
+{
+  uint32_t mask = ((__host_ge & 1u) ? 0x000000FFUL : 0u) |
+                  ((__host_ge & 2u) ? 0x0000FF00UL : 0u) |
+                  ((__host_ge & 4u) ? 0x00FF0000UL : 0u) |
+                  ((__host_ge & 8u) ? 0xFF000000UL : 0u);
+
+  return (op1 & mask) | (op2 & ~mask);
+}
+
+
+/*------ 32-bit saturating add / subtract ----------------------------------------*/
+static __INLINE int32_t __QADD(int32_t op1, int32_t op2)
+{
+  int64_t sum = (int64_t) op1 + op2;
+
+  return (int32_t) ((sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : sum));
+}
+
+static __INLINE int32_t __QSUB(int32_t op1, int32_t op2)
+{
+  int64_t diff = (int64_t) op1 - op2;
+
+  return (int32_t) ((diff > INT32_MAX) ? INT32_MAX : ((diff < INT32_MIN) ? INT32_MIN : diff));
+}
+
+
+/*------ halfword packing --------------------------------------------------------*/
+#define __PKHBT(ARG1,ARG2,ARG3)          ( ((((uint32_t)(ARG1))          ) & 0x0000FFFFUL) |  \
+                                           ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL)  )
+
+#define __PKHTB(ARG1,ARG2,ARG3)          ( ((((uint32_t)(ARG1))          ) & 0xFFFF0000UL) |  \
+                                           ((((int32_t)(ARG2)) >> (ARG3)) & 0x0000FFFFUL)  )
+
+/*@} end of group CMSIS_host_SIMD_intrinsics */
+
+
+#endif /* __CORE_HOST_H */
+
+#ifdef __cplusplus
+}
+#endif